@@ -0,0 +1,310 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "gpu_baseline.h"
+#include "gpu_assert.h"
+#include "gpu_log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define BASELINE_LINE_MAX 1024
+#define BASELINE_KEY_MAX 96
+#define BASELINE_COLUMN_MAX 32
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct gpu_baseline_entry_s {
+    char key[BASELINE_KEY_MAX];
+    float values[GPU_BASELINE_FIELD_COUNT];
+};
+
+struct gpu_baseline_s {
+    struct gpu_baseline_entry_s* entries;
+    int entry_count;
+    int entry_capacity;
+    float pct_threshold;
+    float abs_threshold;
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static int gpu_baseline_split(char* line, char** columns, int max_columns);
+static int gpu_baseline_find_column(char** columns, int column_count, const char* name);
+static void gpu_baseline_add_entry(struct gpu_baseline_s* baseline, const struct gpu_baseline_entry_s* entry);
+static const struct gpu_baseline_entry_s* gpu_baseline_find_entry(const struct gpu_baseline_s* baseline, const char* key);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const char* const gpu_baseline_field_names[GPU_BASELINE_FIELD_COUNT] = {
+    "Setup Time(ms)",
+    "Draw Time(ms)",
+    "Finish Time(ms)",
+};
+
+static const char* const gpu_baseline_field_short_names[GPU_BASELINE_FIELD_COUNT] = {
+    "SETUP",
+    "DRAW",
+    "FINISH",
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+struct gpu_baseline_s* gpu_baseline_load(const char* path, float pct_threshold, float abs_threshold)
+{
+    GPU_ASSERT_NULL(path);
+
+    FILE* fp = fopen(path, "r");
+    if (!fp) {
+        GPU_LOG_INFO("No baseline found: %s", path);
+        return NULL;
+    }
+
+    struct gpu_baseline_s* baseline = calloc(1, sizeof(struct gpu_baseline_s));
+    GPU_ASSERT_NULL(baseline);
+    baseline->pct_threshold = pct_threshold;
+    baseline->abs_threshold = abs_threshold;
+
+    char line[BASELINE_LINE_MAX];
+    char* columns[BASELINE_COLUMN_MAX];
+    int field_index[GPU_BASELINE_FIELD_COUNT];
+    int format_index = -1;
+    int area_index = -1;
+    bool header_found = false;
+
+    while (fgets(line, sizeof(line), fp)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        int column_count = gpu_baseline_split(line, columns, BASELINE_COLUMN_MAX);
+        if (column_count == 0) {
+            continue;
+        }
+
+        /* Skip everything before the header row, same as scripts/diff_report.py */
+        if (!header_found) {
+            if (strcmp(columns[0], "Testcase") != 0) {
+                continue;
+            }
+
+            header_found = true;
+            for (int i = 0; i < GPU_BASELINE_FIELD_COUNT; i++) {
+                field_index[i] = gpu_baseline_find_column(columns, column_count, gpu_baseline_field_names[i]);
+                if (field_index[i] < 0) {
+                    GPU_LOG_ERROR("Baseline %s has no '%s' column", path, gpu_baseline_field_names[i]);
+                    fclose(fp);
+                    gpu_baseline_destroy(baseline);
+                    return NULL;
+                }
+            }
+
+            format_index = gpu_baseline_find_column(columns, column_count, "Target Format");
+            area_index = gpu_baseline_find_column(columns, column_count, "Target Area");
+            continue;
+        }
+
+        if (strncmp(columns[0], "Test result", 11) == 0) {
+            continue;
+        }
+
+        struct gpu_baseline_entry_s entry;
+        int len = snprintf(entry.key, sizeof(entry.key), "%s", columns[0]);
+        if (format_index >= 0 && format_index < column_count && len < (int)sizeof(entry.key)) {
+            len += snprintf(entry.key + len, sizeof(entry.key) - len, ",%s", columns[format_index]);
+        }
+
+        if (area_index >= 0 && area_index < column_count && len < (int)sizeof(entry.key)) {
+            snprintf(entry.key + len, sizeof(entry.key) - len, ",%s", columns[area_index]);
+        }
+
+        for (int i = 0; i < GPU_BASELINE_FIELD_COUNT; i++) {
+            char* end = NULL;
+            const char* str = field_index[i] < column_count ? columns[field_index[i]] : "";
+            entry.values[i] = strtof(str, &end);
+
+            /* Mark the missing values, they are never compared */
+            if (end == str) {
+                entry.values[i] = -1.0f;
+            }
+        }
+
+        gpu_baseline_add_entry(baseline, &entry);
+    }
+
+    fclose(fp);
+
+    if (!header_found) {
+        GPU_LOG_ERROR("Baseline %s has no 'Testcase' header", path);
+        gpu_baseline_destroy(baseline);
+        return NULL;
+    }
+
+    GPU_LOG_INFO("Baseline %s loaded: %d cases, threshold >%0.2f%% and >%0.3fms",
+        path, baseline->entry_count, pct_threshold, abs_threshold);
+    return baseline;
+}
+
+void gpu_baseline_destroy(struct gpu_baseline_s* baseline)
+{
+    GPU_ASSERT_NULL(baseline);
+    free(baseline->entries);
+    memset(baseline, 0, sizeof(struct gpu_baseline_s));
+    free(baseline);
+}
+
+enum gpu_baseline_result_e gpu_baseline_check(
+    struct gpu_baseline_s* baseline,
+    const char* key,
+    const float values[GPU_BASELINE_FIELD_COUNT],
+    char* remark,
+    size_t remark_size)
+{
+    GPU_ASSERT_NULL(baseline);
+    GPU_ASSERT_NULL(key);
+    GPU_ASSERT_NULL(values);
+    GPU_ASSERT_NULL(remark);
+    GPU_ASSERT(remark_size > 0);
+
+    remark[0] = '\0';
+
+    const struct gpu_baseline_entry_s* entry = gpu_baseline_find_entry(baseline, key);
+    if (!entry) {
+        snprintf(remark, remark_size, "Not in baseline");
+        return GPU_BASELINE_RESULT_NONE;
+    }
+
+    enum gpu_baseline_result_e result = GPU_BASELINE_RESULT_PASS;
+    size_t len = 0;
+
+    for (int i = 0; i < GPU_BASELINE_FIELD_COUNT; i++) {
+        float base = entry->values[i];
+        if (base < 0) {
+            continue;
+        }
+
+        /* Only slowdowns fail the gate */
+        float abs_diff = values[i] - base;
+        float pct_diff = base > 0 ? abs_diff / base * 100.0f : (abs_diff > 0 ? 100.0f : 0.0f);
+
+        if (pct_diff > baseline->pct_threshold && abs_diff > baseline->abs_threshold) {
+            result = GPU_BASELINE_RESULT_FAIL;
+            GPU_LOG_WARN("Perf regression %s %s: %0.3fms -> %0.3fms (+%0.2f%%)",
+                key, gpu_baseline_field_short_names[i], base, values[i], pct_diff);
+
+            if (len < remark_size) {
+                len += snprintf(remark + len, remark_size - len, "%s%s +%0.1f%% (+%0.3fms)",
+                    len > 0 ? " " : "", gpu_baseline_field_short_names[i], pct_diff, abs_diff);
+            }
+        }
+    }
+
+    return result;
+}
+
+const char* gpu_baseline_result_string(enum gpu_baseline_result_e result)
+{
+    switch (result) {
+    case GPU_BASELINE_RESULT_PASS:
+        return "PASS";
+    case GPU_BASELINE_RESULT_FAIL:
+        return "FAIL";
+    default:
+        break;
+    }
+
+    return "-";
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static int gpu_baseline_split(char* line, char** columns, int max_columns)
+{
+    if (line[0] == '\0') {
+        return 0;
+    }
+
+    int count = 0;
+    char* str = line;
+
+    while (count < max_columns) {
+        columns[count++] = str;
+        char* sep = strchr(str, ',');
+        if (!sep) {
+            break;
+        }
+
+        *sep = '\0';
+        str = sep + 1;
+    }
+
+    return count;
+}
+
+static int gpu_baseline_find_column(char** columns, int column_count, const char* name)
+{
+    for (int i = 0; i < column_count; i++) {
+        if (strcmp(columns[i], name) == 0) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static void gpu_baseline_add_entry(struct gpu_baseline_s* baseline, const struct gpu_baseline_entry_s* entry)
+{
+    if (baseline->entry_count >= baseline->entry_capacity) {
+        int capacity = baseline->entry_capacity ? baseline->entry_capacity * 2 : 32;
+        struct gpu_baseline_entry_s* entries = realloc(baseline->entries, capacity * sizeof(struct gpu_baseline_entry_s));
+        GPU_ASSERT_NULL(entries);
+        baseline->entries = entries;
+        baseline->entry_capacity = capacity;
+    }
+
+    baseline->entries[baseline->entry_count++] = *entry;
+}
+
+static const struct gpu_baseline_entry_s* gpu_baseline_find_entry(const struct gpu_baseline_s* baseline, const char* key)
+{
+    /* Later rows win, same as scripts/diff_report.py */
+    for (int i = baseline->entry_count - 1; i >= 0; i--) {
+        if (strcmp(baseline->entries[i].key, key) == 0) {
+            return &baseline->entries[i];
+        }
+    }
+
+    return NULL;
+}
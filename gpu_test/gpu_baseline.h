@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GPU_BASELINE_H
+#define GPU_BASELINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define GPU_BASELINE_NAME_DEFAULT "baseline_vg_lite.csv"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct gpu_baseline_s;
+
+enum gpu_baseline_field_e {
+    GPU_BASELINE_FIELD_SETUP = 0,
+    GPU_BASELINE_FIELD_DRAW,
+    GPU_BASELINE_FIELD_FINISH,
+    GPU_BASELINE_FIELD_COUNT,
+};
+
+enum gpu_baseline_result_e {
+    GPU_BASELINE_RESULT_NONE = 0,
+    GPU_BASELINE_RESULT_PASS,
+    GPU_BASELINE_RESULT_FAIL,
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Load a baseline report
+ * @param path The path of the baseline report csv file
+ * @param pct_threshold The percentage slowdown that is tolerated
+ * @param abs_threshold The absolute slowdown(ms) that is tolerated
+ * @return A pointer to the loaded baseline on success, NULL if the file can't be loaded
+ * @note The rows are keyed by "<Testcase>,<Target Format>,<Target Area>",
+ *       the last two columns are omitted from the key if the report doesn't have them.
+ */
+struct gpu_baseline_s* gpu_baseline_load(const char* path, float pct_threshold, float abs_threshold);
+
+/**
+ * @brief Destroy a baseline
+ * @param baseline The baseline to destroy
+ */
+void gpu_baseline_destroy(struct gpu_baseline_s* baseline);
+
+/**
+ * @brief Compare the times(ms) of a test case against the baseline
+ * @param baseline The baseline to compare against
+ * @param key The key of the test case, see gpu_baseline_load
+ * @param values The times(ms) indexed by enum gpu_baseline_field_e
+ * @param remark The buffer to write the regression details to
+ * @param remark_size The size of the remark buffer
+ * @return GPU_BASELINE_RESULT_FAIL if any time regressed beyond both thresholds,
+ *         GPU_BASELINE_RESULT_NONE if the test case is not in the baseline
+ */
+enum gpu_baseline_result_e gpu_baseline_check(
+    struct gpu_baseline_s* baseline,
+    const char* key,
+    const float values[GPU_BASELINE_FIELD_COUNT],
+    char* remark,
+    size_t remark_size);
+
+/**
+ * @brief Convert a baseline result to a string
+ * @param result The result to convert
+ * @return The string of the result
+ */
+const char* gpu_baseline_result_string(enum gpu_baseline_result_e result);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*GPU_BASELINE_H*/
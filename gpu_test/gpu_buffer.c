@@ -102,9 +102,9 @@ uint32_t gpu_buffer_get_pixel(struct gpu_buffer_s* buffer, uint32_t x, uint32_t
     case GPU_COLOR_FORMAT_BGR565: {
         const gpu_color_bgr565_t* c16 = pixel;
         gpu_color_bgra8888_t c32;
-        c32.ch.blue = c16->ch.blue * 0xFF / 0x1F;
-        c32.ch.green = c16->ch.green * 0xFF / 0x3F;
-        c32.ch.red = c16->ch.red * 0xFF / 0x1F;
+        c32.ch.blue = gpu_color_expand_5_lut[c16->ch.blue];
+        c32.ch.green = gpu_color_expand_6_lut[c16->ch.green];
+        c32.ch.red = gpu_color_expand_5_lut[c16->ch.red];
         c32.ch.alpha = 0xFF;
         return c32.full;
     }
@@ -131,9 +131,9 @@ uint32_t gpu_buffer_get_pixel(struct gpu_buffer_s* buffer, uint32_t x, uint32_t
     case GPU_COLOR_FORMAT_BGRA5658: {
         const gpu_color_bgra5658_t* c16a = pixel;
         gpu_color_bgra8888_t c32;
-        c32.ch.blue = c16a->ch.blue * 0xFF / 0x1F;
-        c32.ch.green = c16a->ch.green * 0xFF / 0x3F;
-        c32.ch.red = c16a->ch.red * 0xFF / 0x1F;
+        c32.ch.blue = gpu_color_expand_5_lut[c16a->ch.blue];
+        c32.ch.green = gpu_color_expand_6_lut[c16a->ch.green];
+        c32.ch.red = gpu_color_expand_5_lut[c16a->ch.red];
         c32.ch.alpha = c16a->ch.alpha;
         return c32.full;
     }
@@ -21,11 +21,19 @@
 #include "gpu_color.h"
 #include "gpu_log.h"
 #include <stdlib.h>
+#include <string.h>
 
 /*********************
  *      DEFINES
  *********************/
 
+/* The expansion tables are generated by the compiler from GPU_COLOR_EXPAND */
+#define EXPAND_5(c) GPU_COLOR_EXPAND(c, 0x1F)
+#define EXPAND_6(c) GPU_COLOR_EXPAND(c, 0x3F)
+#define LUT_4(F, i) F(i), F(i + 1), F(i + 2), F(i + 3)
+#define LUT_16(F, i) LUT_4(F, i), LUT_4(F, i + 4), LUT_4(F, i + 8), LUT_4(F, i + 12)
+#define LUT_32(F, i) LUT_16(F, i), LUT_16(F, i + 16)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -34,6 +42,15 @@
  *  STATIC PROTOTYPES
  **********************/
 
+static inline uint32_t bgr565_to_bgra8888(uint32_t value);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+const uint8_t gpu_color_expand_5_lut[GPU_COLOR_EXPAND_5_LUT_SIZE] = { LUT_32(EXPAND_5, 0) };
+const uint8_t gpu_color_expand_6_lut[GPU_COLOR_EXPAND_6_LUT_SIZE] = { LUT_32(EXPAND_6, 0), LUT_32(EXPAND_6, 32) };
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -79,6 +96,41 @@ uint32_t gpu_color_format_get_bpp(gpu_color_format_t format)
     return 0;
 }
 
+const char* gpu_color_format_to_string(gpu_color_format_t format)
+{
+#define COLOR_FORMAT_TO_STRING(FMT) \
+    case GPU_COLOR_FORMAT_##FMT:    \
+        return #FMT;
+
+    switch (format) {
+        COLOR_FORMAT_TO_STRING(BGR565);
+        COLOR_FORMAT_TO_STRING(BGR888);
+        COLOR_FORMAT_TO_STRING(BGRA8888);
+        COLOR_FORMAT_TO_STRING(BGRX8888);
+        COLOR_FORMAT_TO_STRING(BGRA5658);
+        COLOR_FORMAT_TO_STRING(INDEX_8);
+        COLOR_FORMAT_TO_STRING(A4);
+        COLOR_FORMAT_TO_STRING(A8);
+    default:
+        break;
+    }
+
+#undef COLOR_FORMAT_TO_STRING
+
+    return "UNKNOWN";
+}
+
+gpu_color_format_t gpu_color_format_from_string(const char* str)
+{
+    for (int format = GPU_COLOR_FORMAT_UNKNOWN + 1; format <= GPU_COLOR_FORMAT_A8; format++) {
+        if (strcmp(str, gpu_color_format_to_string(format)) == 0) {
+            return format;
+        }
+    }
+
+    return GPU_COLOR_FORMAT_UNKNOWN;
+}
+
 bool gpu_color_bgra8888_compare(gpu_color_bgra8888_t color1, gpu_color_bgra8888_t color2, int tolerance)
 {
     if (abs(color1.ch.red - color2.ch.red) > tolerance) {
@@ -98,6 +150,39 @@ bool gpu_color_bgra8888_compare(gpu_color_bgra8888_t color1, gpu_color_bgra8888_
     return true;
 }
 
+void gpu_color_bgr565_to_bgra8888(gpu_color_bgra8888_t* dst, const gpu_color_bgr565_t* src, uint32_t len)
+{
+    const uint16_t* src16 = &src->full;
+    uint32_t i = 0;
+
+    /* Align the source, so the rest is read two pixels per word */
+    if (len > 0 && ((uintptr_t)src16 & 0x3)) {
+        dst[0].full = bgr565_to_bgra8888(src16[0]);
+        i = 1;
+    }
+
+    for (; i + 2 <= len; i += 2) {
+        uint32_t word;
+        memcpy(&word, &src16[i], sizeof(word));
+
+        /* Little endian, the first pixel is the low half */
+        dst[i].full = bgr565_to_bgra8888(word & 0xFFFF);
+        dst[i + 1].full = bgr565_to_bgra8888(word >> 16);
+    }
+
+    if (i < len) {
+        dst[i].full = bgr565_to_bgra8888(src16[i]);
+    }
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+static inline uint32_t bgr565_to_bgra8888(uint32_t value)
+{
+    return 0xFF000000
+        | (uint32_t)gpu_color_expand_5_lut[(value >> 11) & 0x1F] << 16
+        | (uint32_t)gpu_color_expand_6_lut[(value >> 5) & 0x3F] << 8
+        | gpu_color_expand_5_lut[value & 0x1F];
+}
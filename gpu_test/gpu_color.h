@@ -32,6 +32,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#define GPU_COLOR_EXPAND_5_LUT_SIZE 32
+#define GPU_COLOR_EXPAND_6_LUT_SIZE 64
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -81,7 +84,7 @@ typedef union gpu_color_bgr565_u {
     uint16_t full;
 } gpu_color16_t, gpu_color_bgr565_t;
 
-typedef struct gpu_color_bgra5658_u {
+typedef union gpu_color_bgra5658_u {
     struct
     {
         uint16_t blue : 5;
@@ -105,6 +108,20 @@ typedef struct gpu_color_bgra5658_u {
  */
 uint32_t gpu_color_format_get_bpp(gpu_color_format_t format);
 
+/**
+ * @brief Get the name of a color format
+ * @param format The color format
+ * @return The name of the color format, e.g. "BGRA8888"
+ */
+const char* gpu_color_format_to_string(gpu_color_format_t format);
+
+/**
+ * @brief Get the color format by name
+ * @param str The name of the color format, e.g. "BGRA8888"
+ * @return The color format, or GPU_COLOR_FORMAT_UNKNOWN if not found
+ */
+gpu_color_format_t gpu_color_format_from_string(const char* str);
+
 /**
  * @brief Compare two colors(bgra8888) for equality
  * @param color1 The first color to compare
@@ -113,10 +130,32 @@ uint32_t gpu_color_format_get_bpp(gpu_color_format_t format);
  */
  bool gpu_color_bgra8888_compare(gpu_color_bgra8888_t color1, gpu_color_bgra8888_t color2, int tolerance);
 
+/**
+ * @brief Expansion table of a 5 bits channel to 8 bits, entry c is GPU_COLOR_EXPAND(c, 0x1F)
+ */
+extern const uint8_t gpu_color_expand_5_lut[GPU_COLOR_EXPAND_5_LUT_SIZE];
+
+/**
+ * @brief Expansion table of a 6 bits channel to 8 bits, entry c is GPU_COLOR_EXPAND(c, 0x3F)
+ */
+extern const uint8_t gpu_color_expand_6_lut[GPU_COLOR_EXPAND_6_LUT_SIZE];
+
+/**
+ * @brief Convert a row of BGR565 pixels to BGRA8888, two pixels per 32 bits load
+ * @param dst The destination pixels
+ * @param src The source pixels, any 16 bits alignment
+ * @param len The number of pixels
+ */
+void gpu_color_bgr565_to_bgra8888(gpu_color_bgra8888_t* dst, const gpu_color_bgr565_t* src, uint32_t len);
+
+
 /**********************
  *      MACROS
  **********************/
 
+/* Widen a channel of maximum value max to 8 bits, rounded down. Every narrow channel decoder follows it */
+#define GPU_COLOR_EXPAND(c, max) ((c) * 0xFF / (max))
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -35,12 +35,22 @@ extern "C" {
 #define GPU_TEST_DESIGN_WIDTH 480
 #define GPU_TEST_DESIGN_HEIGHT 480
 
+#define GPU_TEST_TARGET_SIZE_MAX 16
+#define GPU_TEST_TARGET_FORMAT_MAX 8
+#define GPU_TEST_QUEUE_DEPTH_MAX 8
+
 /**********************
  *      TYPEDEFS
  **********************/
 
 struct gpu_recorder_s;
 struct gpu_fb_s;
+struct gpu_baseline_s;
+
+struct gpu_test_size_s {
+    int width;
+    int height;
+};
 
 enum gpu_test_mode_e {
     GPU_TEST_MODE_DEFAULT = 0,
@@ -54,16 +64,26 @@ struct gpu_test_param_s {
     const char* output_dir;
     const char* testcase_name;
     const char* fbdev_path;
-    int target_width;
-    int target_height;
+    struct gpu_test_size_s target_sizes[GPU_TEST_TARGET_SIZE_MAX];
+    int target_size_count;
+    gpu_color_format_t target_formats[GPU_TEST_TARGET_FORMAT_MAX];
+    int target_format_count;
     int run_loop_count;
+    int queue_depth;
+    int repeat_count;
+    const char* perf_baseline;
+    float perf_pct_threshold;
+    float perf_abs_threshold;
     int cpu_freq;
     int color_tolerance;
     bool screenshot_en;
+    bool present_en;
+    bool cpu_ref_en;
 };
 
 struct gpu_test_context_s {
     struct gpu_recorder_s* recorder;
+    struct gpu_baseline_s* baseline;
     struct gpu_fb_s* fb;
     struct gpu_test_param_s param;
     struct gpu_buffer_s target_buffer;
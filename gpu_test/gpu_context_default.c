@@ -65,6 +65,12 @@ bool gpu_test_context_setup(struct gpu_test_context_s* ctx)
             return false;
         }
 
+        if (ctx->param.present_en && !gpu_fb_enable_double_buffer(ctx->fb)) {
+            gpu_fb_destroy(ctx->fb);
+            ctx->fb = NULL;
+            return false;
+        }
+
         gpu_fb_get_buffer(ctx->fb, &ctx->target_buffer);
     }
 
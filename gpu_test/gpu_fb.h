@@ -25,10 +25,16 @@ extern "C" {
  *      INCLUDES
  *********************/
 
+#include <stdbool.h>
+#include <stdint.h>
+
 /*********************
  *      DEFINES
  *********************/
 
+/* Used when the display doesn't report its refresh rate */
+#define GPU_FB_VSYNC_PERIOD_DEFAULT (1000000 / 60)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -54,12 +60,35 @@ struct gpu_fb_s* gpu_fb_create(const char* path);
 void gpu_fb_destroy(struct gpu_fb_s* fb);
 
 /**
- * Get the GPU buffer object associated with the framebuffer
+ * Get the GPU buffer object to draw into
  * @param fb The framebuffer object
  * @param buffer The buffer object to fill in
+ * @note When double buffering is enabled this is the back page, which changes after each present.
  */
 void gpu_fb_get_buffer(const struct gpu_fb_s* fb, struct gpu_buffer_s* buffer);
 
+/**
+ * Enable double buffering, the framebuffer must have room for two pages
+ * @param fb The framebuffer object
+ * @return True if two pages are available, false otherwise
+ */
+bool gpu_fb_enable_double_buffer(struct gpu_fb_s* fb);
+
+/**
+ * Show the back page and wait for the next vsync where available
+ * @param fb The framebuffer object
+ * @param latency_tick The time(us) from the flip request to its completion
+ * @return True on success, false otherwise
+ */
+bool gpu_fb_present(struct gpu_fb_s* fb, uint32_t* latency_tick);
+
+/**
+ * Get the vsync period of the display
+ * @param fb The framebuffer object
+ * @return The vsync period(us)
+ */
+uint32_t gpu_fb_get_vsync_period(const struct gpu_fb_s* fb);
+
 /**********************
  *      MACROS
  **********************/
@@ -24,19 +24,31 @@
 #include "gpu_buffer.h"
 #include "gpu_fb.h"
 #include "gpu_log.h"
+#include "gpu_tick.h"
 #include <errno.h>
 #include <fcntl.h>
+#include <inttypes.h>
 #include <linux/fb.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 /*********************
  *      DEFINES
  *********************/
 
+/* Prefix of a path that names a file-backed fake framebuffer */
+#define GPU_FB_FAKE_PREFIX "file:"
+
+/* Geometry of the file-backed fake framebuffer */
+#define GPU_FB_FAKE_XRES 480
+#define GPU_FB_FAKE_YRES 480
+#define GPU_FB_FAKE_BPP 32
+#define GPU_FB_FAKE_PAGE_MAX 2
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -46,12 +58,24 @@ struct gpu_fb_s {
     struct fb_var_screeninfo vinfo;
     struct fb_fix_screeninfo finfo;
     void* memory;
+    size_t mem_len;
+    int page_count;
+    int back_page;
+    uint32_t vsync_period;
+
+    /* A regular file emulates the device, see gpu_fb_ioctl */
+    bool fake;
+    uint32_t fake_vsync_tick;
 };
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
+static int gpu_fb_ioctl(struct gpu_fb_s* fb, unsigned long request, void* arg);
+static bool gpu_fb_map(struct gpu_fb_s* fb);
+static uint32_t gpu_fb_calc_vsync_period(const struct fb_var_screeninfo* vinfo);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -69,34 +93,61 @@ struct gpu_fb_s* gpu_fb_create(const char* path)
     struct gpu_fb_s* fb = malloc(sizeof(struct gpu_fb_s));
     GPU_ASSERT_NULL(fb);
     memset(fb, 0, sizeof(struct gpu_fb_s));
+    fb->page_count = 1;
+
+    /* Only an explicit file: path is used as a fake framebuffer */
+    fb->fake = strncmp(path, GPU_FB_FAKE_PREFIX, sizeof(GPU_FB_FAKE_PREFIX) - 1) == 0;
+    if (fb->fake) {
+        path += sizeof(GPU_FB_FAKE_PREFIX) - 1;
+    }
 
-    fb->fd = open(path, O_RDWR);
+    fb->fd = open(path, fb->fake ? (O_RDWR | O_CREAT) : O_RDWR, 0666);
     if (fb->fd < 0) {
         GPU_LOG_ERROR("Failed to open framebuffer device: %s, error: %d", path, errno);
         goto failed;
     }
 
+    struct stat st;
+    if (!fb->fake && (fstat(fb->fd, &st) < 0 || !S_ISCHR(st.st_mode))) {
+        GPU_LOG_ERROR("%s is not a device, use " GPU_FB_FAKE_PREFIX "%s for a fake framebuffer", path, path);
+        goto failed;
+    }
+
+    if (fb->fake) {
+        GPU_LOG_WARN("Using %s as a file-backed fake framebuffer", path);
+        fb->vinfo.xres = fb->vinfo.xres_virtual = GPU_FB_FAKE_XRES;
+        fb->vinfo.yres = fb->vinfo.yres_virtual = GPU_FB_FAKE_YRES;
+        fb->vinfo.bits_per_pixel = GPU_FB_FAKE_BPP;
+        fb->finfo.line_length = GPU_FB_FAKE_XRES * GPU_FB_FAKE_BPP / 8;
+        fb->finfo.smem_len = fb->finfo.line_length * GPU_FB_FAKE_YRES * GPU_FB_FAKE_PAGE_MAX;
+
+        if (ftruncate(fb->fd, fb->finfo.smem_len) < 0) {
+            GPU_LOG_ERROR("ftruncate failed: %d", errno);
+            goto failed;
+        }
+    }
+
     /* Get fixed screen information*/
-    if (ioctl(fb->fd, FBIOGET_FSCREENINFO, &fb->finfo) < 0) {
+    if (gpu_fb_ioctl(fb, FBIOGET_FSCREENINFO, &fb->finfo) < 0) {
         GPU_LOG_ERROR("ioctl FBIOGET_FSCREENINFO failed: %d", errno);
         goto failed;
     }
 
     /* Get variable screen information*/
-    if (ioctl(fb->fd, FBIOGET_VSCREENINFO, &fb->vinfo) < 0) {
+    if (gpu_fb_ioctl(fb, FBIOGET_VSCREENINFO, &fb->vinfo) < 0) {
         GPU_LOG_ERROR("ioctl FBIOGET_VSCREENINFO failed: %d", errno);
         goto failed;
     }
 
     /* Map the device to memory*/
-    fb->memory = mmap(0, fb->finfo.smem_len, PROT_READ | PROT_WRITE, MAP_SHARED, fb->fd, 0);
-    if ((intptr_t)fb->memory == -1) {
-        GPU_LOG_ERROR("mmap failed: %d", errno);
+    if (!gpu_fb_map(fb)) {
         goto failed;
     }
 
-    GPU_LOG_INFO("Framebuffer device opened: %s, size: %ux%u, depth: %u, stride: %d",
-        path, fb->vinfo.xres, fb->vinfo.yres, fb->vinfo.bits_per_pixel, fb->finfo.line_length);
+    fb->vsync_period = gpu_fb_calc_vsync_period(&fb->vinfo);
+
+    GPU_LOG_INFO("Framebuffer device opened: %s, size: %ux%u, depth: %u, stride: %d, vsync: %" PRIu32 "us",
+        path, fb->vinfo.xres, fb->vinfo.yres, fb->vinfo.bits_per_pixel, fb->finfo.line_length, fb->vsync_period);
 
     return fb;
 
@@ -109,8 +160,8 @@ void gpu_fb_destroy(struct gpu_fb_s* fb)
 {
     GPU_ASSERT_NULL(fb);
     if (fb->memory) {
-        GPU_LOG_INFO("munmap memory: %p, size: %u", fb->memory, fb->finfo.smem_len);
-        munmap(fb->memory, fb->finfo.smem_len);
+        GPU_LOG_INFO("munmap memory: %p, size: %zu", fb->memory, fb->mem_len);
+        munmap(fb->memory, fb->mem_len);
     }
 
     if (fb->fd >= 0) {
@@ -128,7 +179,7 @@ void gpu_fb_get_buffer(const struct gpu_fb_s* fb, struct gpu_buffer_s* buffer)
     GPU_ASSERT_NULL(fb);
     GPU_ASSERT_NULL(buffer);
 
-    buffer->data = fb->memory;
+    buffer->data = (uint8_t*)fb->memory + (size_t)fb->back_page * fb->vinfo.yres * fb->finfo.line_length;
     buffer->width = fb->vinfo.xres;
     buffer->height = fb->vinfo.yres;
     buffer->stride = fb->finfo.line_length;
@@ -153,8 +204,165 @@ void gpu_fb_get_buffer(const struct gpu_fb_s* fb, struct gpu_buffer_s* buffer)
     }
 }
 
+bool gpu_fb_enable_double_buffer(struct gpu_fb_s* fb)
+{
+    GPU_ASSERT_NULL(fb);
+
+    if (fb->vinfo.yres_virtual < fb->vinfo.yres * 2) {
+        struct fb_var_screeninfo vinfo = fb->vinfo;
+        vinfo.yres_virtual = vinfo.yres * 2;
+        vinfo.yoffset = 0;
+
+        if (gpu_fb_ioctl(fb, FBIOPUT_VSCREENINFO, &vinfo) < 0) {
+            GPU_LOG_ERROR("ioctl FBIOPUT_VSCREENINFO yres_virtual %u failed: %d", vinfo.yres_virtual, errno);
+            return false;
+        }
+
+        /* The driver may have adjusted the layout and the memory size */
+        if (gpu_fb_ioctl(fb, FBIOGET_VSCREENINFO, &fb->vinfo) < 0
+            || gpu_fb_ioctl(fb, FBIOGET_FSCREENINFO, &fb->finfo) < 0) {
+            GPU_LOG_ERROR("ioctl FBIOGET_SCREENINFO failed: %d", errno);
+            return false;
+        }
+
+        if (!gpu_fb_map(fb)) {
+            return false;
+        }
+    }
+
+    if (fb->vinfo.yres_virtual < fb->vinfo.yres * 2
+        || fb->finfo.smem_len < (size_t)fb->finfo.line_length * fb->vinfo.yres * 2) {
+        GPU_LOG_ERROR("Framebuffer has no room for two pages: yres_virtual %u, smem_len %u",
+            fb->vinfo.yres_virtual, fb->finfo.smem_len);
+        return false;
+    }
+
+    fb->page_count = 2;
+    fb->back_page = fb->vinfo.yoffset >= fb->vinfo.yres ? 0 : 1;
+    GPU_LOG_INFO("Double buffer enabled, back page: %d", fb->back_page);
+    return true;
+}
+
+bool gpu_fb_present(struct gpu_fb_s* fb, uint32_t* latency_tick)
+{
+    GPU_ASSERT_NULL(fb);
+    uint32_t start_tick = gpu_tick_get();
+
+    if (fb->page_count > 1) {
+        fb->vinfo.yoffset = fb->back_page * fb->vinfo.yres;
+        if (gpu_fb_ioctl(fb, FBIOPAN_DISPLAY, &fb->vinfo) < 0) {
+            GPU_LOG_ERROR("ioctl FBIOPAN_DISPLAY yoffset %u failed: %d", fb->vinfo.yoffset, errno);
+            return false;
+        }
+
+        fb->back_page = (fb->back_page + 1) % fb->page_count;
+    }
+
+    /* Not every driver implements vsync, then the flip is treated as immediate */
+    uint32_t crtc = 0;
+    if (gpu_fb_ioctl(fb, FBIO_WAITFORVSYNC, &crtc) < 0 && errno != ENOTTY && errno != EINVAL) {
+        GPU_LOG_WARN("ioctl FBIO_WAITFORVSYNC failed: %d", errno);
+    }
+
+    if (latency_tick) {
+        *latency_tick = gpu_tick_elaps(start_tick);
+    }
+
+    return true;
+}
+
+uint32_t gpu_fb_get_vsync_period(const struct gpu_fb_s* fb)
+{
+    GPU_ASSERT_NULL(fb);
+    return fb->vsync_period;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static int gpu_fb_ioctl(struct gpu_fb_s* fb, unsigned long request, void* arg)
+{
+    if (!fb->fake) {
+        return ioctl(fb->fd, request, arg);
+    }
+
+    /* The fake framebuffer keeps its screen info in fb itself */
+    switch (request) {
+    case FBIOGET_FSCREENINFO:
+    case FBIOGET_VSCREENINFO:
+        return 0;
+
+    case FBIOPUT_VSCREENINFO: {
+        const struct fb_var_screeninfo* vinfo = arg;
+        if (vinfo->yres_virtual > GPU_FB_FAKE_YRES * GPU_FB_FAKE_PAGE_MAX) {
+            errno = EINVAL;
+            return -1;
+        }
+
+        fb->vinfo.yres_virtual = vinfo->yres_virtual;
+        fb->vinfo.yoffset = vinfo->yoffset;
+        return 0;
+    }
+
+    case FBIOPAN_DISPLAY: {
+        const struct fb_var_screeninfo* vinfo = arg;
+        if (vinfo->yoffset + fb->vinfo.yres > fb->vinfo.yres_virtual) {
+            errno = EINVAL;
+            return -1;
+        }
+
+        fb->vinfo.yoffset = vinfo->yoffset;
+        return 0;
+    }
+
+    case FBIO_WAITFORVSYNC: {
+        /* Sleep until the next emulated vsync edge */
+        uint32_t elaps = gpu_tick_elaps(fb->fake_vsync_tick);
+        uint32_t remain = fb->vsync_period - elaps % fb->vsync_period;
+        usleep(remain);
+        fb->fake_vsync_tick = gpu_tick_get();
+        return 0;
+    }
+
+    default:
+        break;
+    }
+
+    errno = ENOTTY;
+    return -1;
+}
+
+static bool gpu_fb_map(struct gpu_fb_s* fb)
+{
+    if (fb->memory) {
+        munmap(fb->memory, fb->mem_len);
+        fb->memory = NULL;
+    }
+
+    fb->memory = mmap(0, fb->finfo.smem_len, PROT_READ | PROT_WRITE, MAP_SHARED, fb->fd, 0);
+    if ((intptr_t)fb->memory == -1) {
+        GPU_LOG_ERROR("mmap failed: %d", errno);
+        fb->memory = NULL;
+        return false;
+    }
+
+    fb->mem_len = fb->finfo.smem_len;
+    return true;
+}
+
+static uint32_t gpu_fb_calc_vsync_period(const struct fb_var_screeninfo* vinfo)
+{
+    /* pixclock is in picoseconds, 0 means the driver doesn't report timings */
+    uint64_t htotal = (uint64_t)vinfo->xres + vinfo->left_margin + vinfo->right_margin + vinfo->hsync_len;
+    uint64_t vtotal = (uint64_t)vinfo->yres + vinfo->upper_margin + vinfo->lower_margin + vinfo->vsync_len;
+    uint64_t period = (uint64_t)vinfo->pixclock * htotal * vtotal / 1000000;
+
+    if (period == 0 || period > 1000000) {
+        return GPU_FB_VSYNC_PERIOD_DEFAULT;
+    }
+
+    return (uint32_t)period;
+}
+
 #endif /* GPU_TEST_CONTEXT_LINUX_DISABLE */
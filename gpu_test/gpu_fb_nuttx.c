@@ -24,6 +24,7 @@
 #include "gpu_buffer.h"
 #include "gpu_fb.h"
 #include "gpu_log.h"
+#include "gpu_tick.h"
 #include <errno.h>
 #include <fcntl.h>
 #include <nuttx/video/fb.h>
@@ -46,6 +47,8 @@ struct gpu_fb_s {
     struct fb_videoinfo_s vinfo;
     struct fb_planeinfo_s pinfo;
     void* memory;
+    int page_count;
+    int back_page;
 };
 
 /**********************
@@ -69,6 +72,7 @@ struct gpu_fb_s* gpu_fb_create(const char* path)
     struct gpu_fb_s* fb = malloc(sizeof(struct gpu_fb_s));
     GPU_ASSERT_NULL(fb);
     memset(fb, 0, sizeof(struct gpu_fb_s));
+    fb->page_count = 1;
 
     fb->fd = open(path, O_RDWR | O_CLOEXEC);
     if (fb->fd < 0) {
@@ -129,7 +133,7 @@ void gpu_fb_get_buffer(const struct gpu_fb_s* fb, struct gpu_buffer_s* buffer)
     GPU_ASSERT_NULL(fb);
     GPU_ASSERT_NULL(buffer);
 
-    buffer->data = fb->memory;
+    buffer->data = (uint8_t*)fb->memory + (size_t)fb->back_page * fb->vinfo.yres * fb->pinfo.stride;
     buffer->width = fb->vinfo.xres;
     buffer->height = fb->vinfo.yres;
     buffer->stride = fb->pinfo.stride;
@@ -158,6 +162,59 @@ void gpu_fb_get_buffer(const struct gpu_fb_s* fb, struct gpu_buffer_s* buffer)
     }
 }
 
+bool gpu_fb_enable_double_buffer(struct gpu_fb_s* fb)
+{
+    GPU_ASSERT_NULL(fb);
+
+    /* The virtual resolution is fixed by the driver configuration */
+    if (fb->pinfo.yres_virtual < fb->vinfo.yres * 2
+        || fb->pinfo.fblen < (size_t)fb->pinfo.stride * fb->vinfo.yres * 2) {
+        GPU_LOG_ERROR("Framebuffer has no room for two pages: yres_virtual %u, fblen %zu",
+            fb->pinfo.yres_virtual, (size_t)fb->pinfo.fblen);
+        return false;
+    }
+
+    fb->page_count = 2;
+    fb->back_page = fb->pinfo.yoffset >= fb->vinfo.yres ? 0 : 1;
+    GPU_LOG_INFO("Double buffer enabled, back page: %d", fb->back_page);
+    return true;
+}
+
+bool gpu_fb_present(struct gpu_fb_s* fb, uint32_t* latency_tick)
+{
+    GPU_ASSERT_NULL(fb);
+    uint32_t start_tick = gpu_tick_get();
+
+    if (fb->page_count > 1) {
+        fb->pinfo.yoffset = fb->back_page * fb->vinfo.yres;
+        if (ioctl(fb->fd, FBIOPAN_DISPLAY, (unsigned long)((uintptr_t)&fb->pinfo)) < 0) {
+            GPU_LOG_ERROR("ioctl FBIOPAN_DISPLAY yoffset %u failed: %d", fb->pinfo.yoffset, errno);
+            return false;
+        }
+
+        fb->back_page = (fb->back_page + 1) % fb->page_count;
+    }
+
+    /* Not every driver implements vsync, then the flip is treated as immediate */
+    if (ioctl(fb->fd, FBIO_WAITFORVSYNC, 0) < 0 && errno != ENOTTY && errno != EINVAL) {
+        GPU_LOG_WARN("ioctl FBIO_WAITFORVSYNC failed: %d", errno);
+    }
+
+    if (latency_tick) {
+        *latency_tick = gpu_tick_elaps(start_tick);
+    }
+
+    return true;
+}
+
+uint32_t gpu_fb_get_vsync_period(const struct gpu_fb_s* fb)
+{
+    GPU_ASSERT_NULL(fb);
+
+    /* The video info doesn't carry the display timings */
+    return GPU_FB_VSYNC_PERIOD_DEFAULT;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -18,6 +18,7 @@
  *      INCLUDES
  *********************/
 
+#include "gpu_baseline.h"
 #include "gpu_context.h"
 #include "gpu_log.h"
 #include "gpu_test.h"
@@ -44,6 +45,8 @@
  **********************/
 
 static void parse_commandline(int argc, char** argv, struct gpu_test_param_s* param);
+static bool parse_target_sizes(const char* str, struct gpu_test_param_s* param);
+static bool parse_target_formats(const char* str, struct gpu_test_param_s* param);
 
 /**********************
  *  STATIC VARIABLES
@@ -96,7 +99,9 @@ static void show_usage(const char* progname, int exitcode)
 {
     printf("\nUsage: %s"
            " -m <string> -o <string> -t <string> -s\n"
-           " --target <string> --loop-count <int> --cpu-freq <int> --fbdev <string> --tolerance <int>\n",
+           " --target <string> --target-format <string> --loop-count <int> --cpu-freq <int> --fbdev <string> --tolerance <int>\n"
+           " --repeat <int> --perf-baseline <string> --perf-pct <float> --perf-abs <float> --present\n"
+           " --queue-depth <int> --cpu-ref\n",
         progname);
 
     printf("\nWhere:\n");
@@ -106,11 +111,29 @@ static void show_usage(const char* progname, int exitcode)
     printf("  -s Enable screenshot.\n");
 
     printf("  --target <string> Target render image size(px), default is 480x480. Example: "
-           "<decimal-value width>x<decimal-value height>\n");
+           "<decimal-value width>x<decimal-value height>\n"
+           "    A comma separated list (240x240,480x480) or a range with step count (240x240..1024x600:5)\n"
+           "    runs every testcase per size and reports the per-pixel cost, up to %d sizes.\n",
+        GPU_TEST_TARGET_SIZE_MAX);
+    printf("  --target-format <string> Target render image format, default is BGRA8888.\n"
+           "    A comma separated list of BGRA8888, BGRX8888, BGR888, BGR565, BGRA5658\n"
+           "    runs every testcase per format, up to %d formats.\n",
+        GPU_TEST_TARGET_FORMAT_MAX);
     printf("  --loop-count <int> Stress mode loop count, default is 10000.\n");
+    printf("  --queue-depth <int> Stress mode submits this many testcases into separate targets before\n"
+           "    waiting for the GPU, default is 1 (wait after each), max is %d.\n",
+        GPU_TEST_QUEUE_DEPTH_MAX);
     printf("  --cpu-freq <int> CPU frequency in MHz, default is 0 (auto).\n");
-    printf("  --fbdev <string> Framebuffer device path.\n");
+    printf("  --fbdev <string> Framebuffer device path.\n"
+           "    A file:<path> is a regular file used as a file-backed fake framebuffer.\n");
     printf("  --tolerance <int> Color deviation tolerance, default is 1.\n");
+    printf("  --repeat <int> Run each testcase N times and report the median times, default is 1.\n");
+    printf("  --perf-baseline <string> Baseline report to gate the times against, default is <output dir>/" GPU_BASELINE_NAME_DEFAULT ".\n");
+    printf("  --perf-pct <float> Tolerated slowdown against the baseline(%%), default is 20.\n");
+    printf("  --perf-abs <float> Tolerated slowdown against the baseline(ms), default is 0.05.\n");
+    printf("  --present Double buffer the framebuffer of --fbdev and flip it after each frame.\n");
+    printf("  --cpu-ref Replay each testcase on the VG-Lite CPU backend first and report its time,\n"
+           "    the speedup of the GPU and the pixel difference of both outputs.\n");
 
     exit(exitcode);
 }
@@ -156,18 +179,12 @@ static void parse_long_commandline(
 {
     switch (longindex) {
 
-    case 0: {
-        int width = 0;
-        int height = 0;
-        int converted = sscanf(optarg, "%dx%d", &width, &height);
-        if (converted == 2 && width >= 0 && height >= 0) {
-            param->target_width = width;
-            param->target_height = height;
-        } else {
+    case 0:
+        if (!parse_target_sizes(optarg, param)) {
             GPU_LOG_ERROR("Error target image size: %s", optarg);
             show_usage(argv[0], EXIT_FAILURE);
         }
-    } break;
+        break;
 
     case 1:
         param->run_loop_count = atoi(optarg);
@@ -189,6 +206,49 @@ static void parse_long_commandline(
         }
         break;
 
+    case 5:
+        if (!parse_target_formats(optarg, param)) {
+            GPU_LOG_ERROR("Error target image format: %s", optarg);
+            show_usage(argv[0], EXIT_FAILURE);
+        }
+        break;
+
+    case 6:
+        param->repeat_count = atoi(optarg);
+        if (param->repeat_count <= 0) {
+            GPU_LOG_ERROR("Repeat count should be greater than 0");
+            show_usage(argv[0], EXIT_FAILURE);
+        }
+        break;
+
+    case 7:
+        param->perf_baseline = optarg;
+        break;
+
+    case 8:
+        param->perf_pct_threshold = atof(optarg);
+        break;
+
+    case 9:
+        param->perf_abs_threshold = atof(optarg);
+        break;
+
+    case 10:
+        param->present_en = true;
+        break;
+
+    case 11:
+        param->queue_depth = atoi(optarg);
+        if (param->queue_depth <= 0 || param->queue_depth > GPU_TEST_QUEUE_DEPTH_MAX) {
+            GPU_LOG_ERROR("Queue depth should be in 1~%d", GPU_TEST_QUEUE_DEPTH_MAX);
+            show_usage(argv[0], EXIT_FAILURE);
+        }
+        break;
+
+    case 12:
+        param->cpu_ref_en = true;
+        break;
+
     default:
         GPU_LOG_WARN("Unknown longindex: %d", longindex);
         show_usage(argv[0], EXIT_FAILURE);
@@ -210,9 +270,16 @@ static void parse_commandline(int argc, char** argv, struct gpu_test_param_s* pa
     param->argv = argv;
     param->mode = GPU_TEST_MODE_DEFAULT;
     param->output_dir = GPU_OUTPUT_DIR_DEFAULT;
-    param->target_width = GPU_TEST_DESIGN_WIDTH;
-    param->target_height = GPU_TEST_DESIGN_WIDTH;
+    param->target_sizes[0].width = GPU_TEST_DESIGN_WIDTH;
+    param->target_sizes[0].height = GPU_TEST_DESIGN_HEIGHT;
+    param->target_size_count = 1;
+    param->target_formats[0] = GPU_COLOR_FORMAT_BGRA8888;
+    param->target_format_count = 1;
     param->run_loop_count = 10000;
+    param->queue_depth = 1;
+    param->repeat_count = 1;
+    param->perf_pct_threshold = 20.0f;
+    param->perf_abs_threshold = 0.05f;
     param->color_tolerance = 1;
 
     int ch;
@@ -224,6 +291,14 @@ static void parse_commandline(int argc, char** argv, struct gpu_test_param_s* pa
         { "cpu-freq", required_argument, NULL, 0 },
         { "fbdev", required_argument, NULL, 0 },
         { "tolerance", required_argument, NULL, 0 },
+        { "target-format", required_argument, NULL, 0 },
+        { "repeat", required_argument, NULL, 0 },
+        { "perf-baseline", required_argument, NULL, 0 },
+        { "perf-pct", required_argument, NULL, 0 },
+        { "perf-abs", required_argument, NULL, 0 },
+        { "present", no_argument, NULL, 0 },
+        { "queue-depth", required_argument, NULL, 0 },
+        { "cpu-ref", no_argument, NULL, 0 },
         { 0, 0, NULL, 0 }
     };
 
@@ -263,6 +338,11 @@ static void parse_commandline(int argc, char** argv, struct gpu_test_param_s* pa
         }
     }
 
+    if (param->present_en && !param->fbdev_path) {
+        GPU_LOG_ERROR("Present mode requires a framebuffer device");
+        show_usage(argv[0], EXIT_FAILURE);
+    }
+
     if (param->run_loop_count <= 0) {
         GPU_LOG_ERROR("Loop count should be greater than 0");
         show_usage(argv[0], EXIT_FAILURE);
@@ -270,11 +350,136 @@ static void parse_commandline(int argc, char** argv, struct gpu_test_param_s* pa
 
     GPU_LOG_INFO("Test mode: %d", param->mode);
     GPU_LOG_INFO("Output DIR: %s", param->output_dir);
-    GPU_LOG_INFO("Target render image size: %dx%d", param->target_width, param->target_height);
+    for (int i = 0; i < param->target_size_count; i++) {
+        GPU_LOG_INFO("Target render image size[%d]: %dx%d",
+            i, param->target_sizes[i].width, param->target_sizes[i].height);
+    }
+    for (int i = 0; i < param->target_format_count; i++) {
+        GPU_LOG_INFO("Target render image format[%d]: %s",
+            i, gpu_color_format_to_string(param->target_formats[i]));
+    }
     GPU_LOG_INFO("Testcase name: %s", param->testcase_name);
     GPU_LOG_INFO("Screenshot: %s", param->screenshot_en ? "enable" : "disable");
     GPU_LOG_INFO("Loop count: %d", param->run_loop_count);
+    GPU_LOG_INFO("Queue depth: %d", param->queue_depth);
+    GPU_LOG_INFO("Repeat count: %d", param->repeat_count);
+    GPU_LOG_INFO("Perf baseline: %s", param->perf_baseline);
+    GPU_LOG_INFO("Perf threshold: >%0.2f%% and >%0.3fms", param->perf_pct_threshold, param->perf_abs_threshold);
     GPU_LOG_INFO("CPU frequency: %d MHz (0 means auto)", param->cpu_freq);
     GPU_LOG_INFO("Framebuffer device: %s", param->fbdev_path);
+    GPU_LOG_INFO("Present: %s", param->present_en ? "enable" : "disable");
+    GPU_LOG_INFO("CPU reference: %s", param->cpu_ref_en ? "enable" : "disable");
     GPU_LOG_INFO("Color deviation tolerance: %d", param->color_tolerance);
 }
+
+/**
+ * @brief Add a target size to the test parameters
+ * @param param The test parameters
+ * @param width The width of the target
+ * @param height The height of the target
+ * @return True on success, false if the size is invalid or the list is full
+ */
+static bool add_target_size(struct gpu_test_param_s* param, int width, int height)
+{
+    if (width <= 0 || height <= 0) {
+        GPU_LOG_ERROR("Invalid target size: %dx%d", width, height);
+        return false;
+    }
+
+    if (param->target_size_count >= GPU_TEST_TARGET_SIZE_MAX) {
+        GPU_LOG_ERROR("Too many target sizes, max is %d", GPU_TEST_TARGET_SIZE_MAX);
+        return false;
+    }
+
+    param->target_sizes[param->target_size_count].width = width;
+    param->target_sizes[param->target_size_count].height = height;
+    param->target_size_count++;
+    return true;
+}
+
+/**
+ * @brief Parse the target size list
+ * @param str The string to parse, e.g. "480x480", "240x240,480x480" or "240x240..1024x600:5"
+ * @param param The test parameters
+ * @return True on success, false on failure
+ */
+static bool parse_target_sizes(const char* str, struct gpu_test_param_s* param)
+{
+    char buf[256];
+    snprintf(buf, sizeof(buf), "%s", str);
+    param->target_size_count = 0;
+
+    char* saveptr = NULL;
+    for (char* token = strtok_r(buf, ",", &saveptr); token; token = strtok_r(NULL, ",", &saveptr)) {
+        int w1 = 0;
+        int h1 = 0;
+        int w2 = 0;
+        int h2 = 0;
+        int steps = 0;
+        int converted = sscanf(token, "%dx%d..%dx%d:%d", &w1, &h1, &w2, &h2, &steps);
+
+        if (converted == 5) {
+            if (steps < 2) {
+                GPU_LOG_ERROR("Range step count should be at least 2: %s", token);
+                return false;
+            }
+
+            /* Interpolate both dimensions linearly between the range ends */
+            for (int i = 0; i < steps; i++) {
+                int width = w1 + (w2 - w1) * i / (steps - 1);
+                int height = h1 + (h2 - h1) * i / (steps - 1);
+                if (!add_target_size(param, width, height)) {
+                    return false;
+                }
+            }
+        } else if (converted == 2 && !strstr(token, "..")) {
+            if (!add_target_size(param, w1, h1)) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+    }
+
+    return param->target_size_count > 0;
+}
+
+/**
+ * @brief Parse the target format list
+ * @param str The string to parse, e.g. "BGRA8888" or "BGRA8888,BGR565"
+ * @param param The test parameters
+ * @return True on success, false on failure
+ */
+static bool parse_target_formats(const char* str, struct gpu_test_param_s* param)
+{
+    char buf[128];
+    snprintf(buf, sizeof(buf), "%s", str);
+    param->target_format_count = 0;
+
+    char* saveptr = NULL;
+    for (char* token = strtok_r(buf, ",", &saveptr); token; token = strtok_r(NULL, ",", &saveptr)) {
+        gpu_color_format_t format = gpu_color_format_from_string(token);
+
+        switch (format) {
+        case GPU_COLOR_FORMAT_BGRA8888:
+        case GPU_COLOR_FORMAT_BGRX8888:
+        case GPU_COLOR_FORMAT_BGR888:
+        case GPU_COLOR_FORMAT_BGR565:
+        case GPU_COLOR_FORMAT_BGRA5658:
+            break;
+
+        default:
+            GPU_LOG_ERROR("Unsupported target format: %s", token);
+            return false;
+        }
+
+        if (param->target_format_count >= GPU_TEST_TARGET_FORMAT_MAX) {
+            GPU_LOG_ERROR("Too many target formats, max is %d", GPU_TEST_TARGET_FORMAT_MAX);
+            return false;
+        }
+
+        param->target_formats[param->target_format_count++] = format;
+    }
+
+    return param->target_format_count > 0;
+}
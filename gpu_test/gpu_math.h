@@ -52,6 +52,7 @@ extern "C" {
 
 #define MATH_MIN(a, b) ((a) < (b) ? (a) : (b))
 #define MATH_MAX(a, b) ((a) > (b) ? (a) : (b))
+#define MATH_ABS(x) ((x) < 0 ? -(x) : (x))
 
 /**********************
  *      TYPEDEFS
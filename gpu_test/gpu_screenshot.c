@@ -168,9 +168,9 @@ static bool convert_color_to_bgr888(struct gpu_buffer_s* dest_buffer, const stru
             gpu_color24_t* dest = (gpu_color24_t*)((uint8_t*)dest_buffer->data + y * dest_buffer->stride);
 
             for (int x = 0; x < src_buffer->width; x++) {
-                dest->ch.blue = src->ch.blue * 0xFF / 0x1F;
-                dest->ch.green = src->ch.green * 0xFF / 0x3F;
-                dest->ch.red = src->ch.red * 0xFF / 0x1F;
+                dest->ch.blue = gpu_color_expand_5_lut[src->ch.blue];
+                dest->ch.green = gpu_color_expand_6_lut[src->ch.green];
+                dest->ch.red = gpu_color_expand_5_lut[src->ch.red];
                 src++;
                 dest++;
             }
@@ -183,9 +183,9 @@ static bool convert_color_to_bgr888(struct gpu_buffer_s* dest_buffer, const stru
             gpu_color24_t* dest = (gpu_color24_t*)((uint8_t*)dest_buffer->data + y * dest_buffer->stride);
 
             for (int x = 0; x < src_buffer->width; x++) {
-                dest->ch.blue = src->ch.blue * 0xFF / 0x1F;
-                dest->ch.green = src->ch.green * 0xFF / 0x3F;
-                dest->ch.red = src->ch.red * 0xFF / 0x1F;
+                dest->ch.blue = gpu_color_expand_5_lut[src->ch.blue];
+                dest->ch.green = gpu_color_expand_6_lut[src->ch.green];
+                dest->ch.red = gpu_color_expand_5_lut[src->ch.red];
                 src++;
                 dest++;
             }
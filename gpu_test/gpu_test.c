@@ -19,7 +19,9 @@
  *********************/
 
 #include "gpu_test.h"
+#include "gpu_baseline.h"
 #include "gpu_context.h"
+#include "gpu_log.h"
 #include "gpu_recorder.h"
 #include "gpu_tick.h"
 #include "vg_lite/vg_lite_test.h"
@@ -39,6 +41,7 @@
  **********************/
 
 static void gpu_test_write_header(struct gpu_test_context_s* ctx);
+static bool gpu_test_load_baseline(struct gpu_test_context_s* ctx);
 
 /**********************
  *  STATIC VARIABLES
@@ -54,8 +57,17 @@ static void gpu_test_write_header(struct gpu_test_context_s* ctx);
 
 int gpu_test_run(struct gpu_test_context_s* ctx)
 {
+    /* Load the baseline before the report is overwritten, it may be the same file */
+    if (!gpu_test_load_baseline(ctx)) {
+        return -1;
+    }
+
     ctx->recorder = gpu_recorder_create(ctx->param.output_dir, "vg_lite");
     if (!ctx->recorder) {
+        if (ctx->baseline) {
+            gpu_baseline_destroy(ctx->baseline);
+            ctx->baseline = NULL;
+        }
         return -1;
     }
 
@@ -68,6 +80,11 @@ int gpu_test_run(struct gpu_test_context_s* ctx)
 
     gpu_recorder_delete(ctx->recorder);
 
+    if (ctx->baseline) {
+        gpu_baseline_destroy(ctx->baseline);
+        ctx->baseline = NULL;
+    }
+
     return ret;
 }
 
@@ -90,3 +107,28 @@ static void gpu_test_write_header(struct gpu_test_context_s* ctx)
 
     gpu_recorder_write_string(ctx->recorder, "\n\n");
 }
+
+static bool gpu_test_load_baseline(struct gpu_test_context_s* ctx)
+{
+    /* Stress mode doesn't record the times of passed cases */
+    if (ctx->param.mode != GPU_TEST_MODE_DEFAULT) {
+        return true;
+    }
+
+    char path[256];
+    if (ctx->param.perf_baseline) {
+        snprintf(path, sizeof(path), "%s", ctx->param.perf_baseline);
+    } else {
+        snprintf(path, sizeof(path), "%s/" GPU_BASELINE_NAME_DEFAULT, ctx->param.output_dir);
+    }
+
+    ctx->baseline = gpu_baseline_load(path, ctx->param.perf_pct_threshold, ctx->param.perf_abs_threshold);
+
+    /* The default baseline is optional, an explicit one is not */
+    if (!ctx->baseline && ctx->param.perf_baseline) {
+        GPU_LOG_ERROR("Failed to load perf baseline: %s", path);
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,975 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#if defined(GPU_TEST_VG_LITE_CPU_ENABLE) || defined(GPU_TEST_VG_LITE_CPU_REF_ENABLE)
+
+#include "vg_lite_cpu.h"
+#include "../../gpu_assert.h"
+#include "../../gpu_log.h"
+#include "../../gpu_math.h"
+#include "../vg_lite_test_utils.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define GRAD_IMAGE_WIDTH 256
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t clut[VG_LITE_CPU_CLUT_SIZE];
+    float gaussian_weights[3];
+    bool scissor_enabled;
+    vg_lite_int32_t scissor[4];
+    struct vg_lite_cpu_edges_s* edges;
+    bool replay;
+} vg_lite_cpu_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool matrix_invert(const vg_lite_matrix_t* matrix, float inverse[3][3]);
+static void matrix_map_point(const vg_lite_matrix_t* matrix, float x, float y, float* out_x, float* out_y);
+static int path_samples(vg_lite_quality_t quality);
+static vg_lite_error_t draw_init(vg_lite_cpu_draw_t* draw, vg_lite_buffer_t* target, vg_lite_blend_t blend, const vg_lite_cpu_paint_t* paint);
+static void draw_clip(vg_lite_cpu_draw_t* draw, const float* points, int count);
+static vg_lite_error_t fill_path(vg_lite_cpu_draw_t* draw, const vg_lite_path_t* path, vg_lite_fill_t fill_rule, const vg_lite_matrix_t* matrix);
+static vg_lite_error_t paint_init_image(vg_lite_cpu_paint_t* paint, const vg_lite_buffer_t* image, const vg_lite_matrix_t* matrix, vg_lite_color_t color, vg_lite_filter_t filter);
+static vg_lite_error_t paint_init_ramp(vg_lite_cpu_paint_t* paint, vg_lite_cpu_paint_cb_t cb, const vg_lite_matrix_t* matrix, const vg_lite_matrix_t* grad_matrix,
+    const vg_lite_color_ramp_t* ramp, uint32_t ramp_length, uint32_t pre_multiplied, vg_lite_gradient_spreadmode_t spread_mode);
+static vg_lite_error_t blit(vg_lite_buffer_t* target, vg_lite_buffer_t* source, const vg_lite_rectangle_t* rect, vg_lite_matrix_t* matrix,
+    vg_lite_blend_t blend, vg_lite_color_t color, vg_lite_filter_t filter);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static vg_lite_cpu_ctx_t g_ctx = {
+    .gaussian_weights = { 0.25f, 0.125f, 0.0625f },
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void vg_lite_cpu_init(void)
+{
+    GPU_LOG_INFO("VG-Lite CPU backend, %d threads", VG_LITE_CPU_THREAD_COUNT);
+    vg_lite_cpu_raster_init();
+}
+
+void vg_lite_cpu_deinit(void)
+{
+    vg_lite_cpu_raster_deinit();
+
+    if (g_ctx.edges) {
+        vg_lite_cpu_edges_destroy(g_ctx.edges);
+        g_ctx.edges = NULL;
+    }
+}
+
+#ifdef GPU_TEST_VG_LITE_CPU_ENABLE
+
+void gpu_init(void)
+{
+    vg_lite_cpu_init();
+}
+
+void gpu_deinit(void)
+{
+    vg_lite_cpu_deinit();
+}
+
+#else
+
+void vg_lite_cpu_set_replay(bool enable)
+{
+    g_ctx.replay = enable;
+}
+
+bool vg_lite_cpu_is_replay(void)
+{
+    return g_ctx.replay;
+}
+
+#endif /* GPU_TEST_VG_LITE_CPU_ENABLE */
+
+const uint32_t* vg_lite_cpu_get_clut(void)
+{
+    return g_ctx.clut;
+}
+
+void vg_lite_cpu_get_gaussian_weights(float weights[3])
+{
+    memcpy(weights, g_ctx.gaussian_weights, sizeof(g_ctx.gaussian_weights));
+}
+
+#ifdef GPU_TEST_VG_LITE_CPU_ENABLE
+
+/* Matrix, only provided when replacing the vendor library */
+
+vg_lite_error_t vg_lite_identity(vg_lite_matrix_t* matrix)
+{
+    GPU_ASSERT_NULL(matrix);
+    memset(matrix, 0, sizeof(vg_lite_matrix_t));
+    matrix->m[0][0] = 1;
+    matrix->m[1][1] = 1;
+    matrix->m[2][2] = 1;
+    matrix->scaleX = 1;
+    matrix->scaleY = 1;
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_translate(vg_lite_float_t x, vg_lite_float_t y, vg_lite_matrix_t* matrix)
+{
+    vg_lite_matrix_t t;
+    vg_lite_identity(&t);
+    t.m[0][2] = x;
+    t.m[1][2] = y;
+    vg_lite_test_matrix_multiply(matrix, &t);
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_scale(vg_lite_float_t scale_x, vg_lite_float_t scale_y, vg_lite_matrix_t* matrix)
+{
+    vg_lite_matrix_t t;
+    vg_lite_identity(&t);
+    t.m[0][0] = scale_x;
+    t.m[1][1] = scale_y;
+    vg_lite_test_matrix_multiply(matrix, &t);
+    matrix->scaleX *= scale_x;
+    matrix->scaleY *= scale_y;
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_rotate(vg_lite_float_t degrees, vg_lite_matrix_t* matrix)
+{
+    float radians = MATH_RADIANS(degrees);
+    float c = MATH_COSF(radians);
+    float s = MATH_SINF(radians);
+
+    vg_lite_matrix_t t;
+    vg_lite_identity(&t);
+    t.m[0][0] = c;
+    t.m[0][1] = -s;
+    t.m[1][0] = s;
+    t.m[1][1] = c;
+    vg_lite_test_matrix_multiply(matrix, &t);
+    matrix->angle += degrees;
+    return VG_LITE_SUCCESS;
+}
+
+#endif /* GPU_TEST_VG_LITE_CPU_ENABLE */
+
+/* Path */
+
+vg_lite_error_t VG_LITE_CPU_API(init_path)(vg_lite_path_t* path,
+    vg_lite_format_t data_format,
+    vg_lite_quality_t quality,
+    vg_lite_uint32_t path_length,
+    vg_lite_pointer path_data,
+    vg_lite_float_t min_x, vg_lite_float_t min_y,
+    vg_lite_float_t max_x, vg_lite_float_t max_y)
+{
+    if (!path) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    memset(path, 0, sizeof(vg_lite_path_t));
+    path->format = data_format;
+    path->quality = quality;
+    path->path_length = path_length;
+    path->path = path_data;
+    path->bounding_box[0] = min_x;
+    path->bounding_box[1] = min_y;
+    path->bounding_box[2] = max_x;
+    path->bounding_box[3] = max_y;
+    path->path_changed = 1;
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(clear_path)(vg_lite_path_t* path)
+{
+    /* Nothing is uploaded, the path data belongs to the caller */
+    return path ? VG_LITE_SUCCESS : VG_LITE_INVALID_ARGUMENT;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(set_path_type)(vg_lite_path_t* path, vg_lite_path_type_t path_type)
+{
+    if (!path) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    /* Strokes are not rasterized, see vg_lite_set_stroke */
+    if (path_type != VG_LITE_DRAW_ZERO && path_type != VG_LITE_DRAW_FILL_PATH) {
+        return VG_LITE_NOT_SUPPORT;
+    }
+
+    path->path_type = path_type;
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(set_stroke)(vg_lite_path_t* path,
+    vg_lite_cap_style_t cap_style,
+    vg_lite_join_style_t join_style,
+    vg_lite_float_t line_width,
+    vg_lite_float_t miter_limit,
+    vg_lite_float_t* dash_pattern,
+    vg_lite_uint32_t pattern_count,
+    vg_lite_float_t dash_phase,
+    vg_lite_color_t stroke_color)
+{
+    return VG_LITE_NOT_SUPPORT;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(update_stroke)(vg_lite_path_t* path)
+{
+    return VG_LITE_NOT_SUPPORT;
+}
+
+/* Draw */
+
+vg_lite_error_t VG_LITE_CPU_API(clear)(vg_lite_buffer_t* target, vg_lite_rectangle_t* rectangle, vg_lite_color_t color)
+{
+    if (!target || !vg_lite_cpu_pixel_is_supported(target->format, true)) {
+        return VG_LITE_NOT_SUPPORT;
+    }
+
+    int x1 = 0;
+    int y1 = 0;
+    int x2 = target->width;
+    int y2 = target->height;
+
+    if (rectangle) {
+        x1 = MATH_MAX(x1, rectangle->x);
+        y1 = MATH_MAX(y1, rectangle->y);
+        x2 = MATH_MIN(x2, rectangle->x + rectangle->width);
+        y2 = MATH_MIN(y2, rectangle->y + rectangle->height);
+    }
+
+    /* The clear color is stored as is */
+    vg_lite_cpu_color_t value = vg_lite_cpu_color_from_abgr(color, false);
+    for (int y = y1; y < y2; y++) {
+        if (x2 > x1) {
+            vg_lite_cpu_pixel_fill_span(target, x1, y, x2 - x1, &value);
+        }
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(draw)(vg_lite_buffer_t* target,
+    vg_lite_path_t* path,
+    vg_lite_fill_t fill_rule,
+    vg_lite_matrix_t* matrix,
+    vg_lite_blend_t blend,
+    vg_lite_color_t color)
+{
+    vg_lite_cpu_paint_t paint = {
+        .cb = vg_lite_cpu_paint_solid,
+        .color = vg_lite_cpu_color_from_abgr(color, true),
+    };
+
+    vg_lite_cpu_draw_t draw;
+    VG_LITE_TEST_CHECK_ERROR_RETURN(draw_init(&draw, target, blend, &paint));
+    return fill_path(&draw, path, fill_rule, matrix);
+}
+
+vg_lite_error_t VG_LITE_CPU_API(draw_pattern)(vg_lite_buffer_t* target,
+    vg_lite_path_t* path,
+    vg_lite_fill_t fill_rule,
+    vg_lite_matrix_t* path_matrix,
+    vg_lite_buffer_t* pattern_image,
+    vg_lite_matrix_t* pattern_matrix,
+    vg_lite_blend_t blend,
+    vg_lite_pattern_mode_t pattern_mode,
+    vg_lite_color_t pattern_color,
+    vg_lite_color_t color,
+    vg_lite_filter_t filter)
+{
+    vg_lite_cpu_paint_t paint;
+    VG_LITE_TEST_CHECK_ERROR_RETURN(paint_init_image(&paint, pattern_image, pattern_matrix, color, filter));
+    paint.pattern_mode = pattern_mode;
+    paint.pattern_color = vg_lite_cpu_color_from_abgr(pattern_color, true);
+
+    vg_lite_cpu_draw_t draw;
+    VG_LITE_TEST_CHECK_ERROR_RETURN(draw_init(&draw, target, blend, &paint));
+    return fill_path(&draw, path, fill_rule, path_matrix);
+}
+
+vg_lite_error_t VG_LITE_CPU_API(blit)(vg_lite_buffer_t* target,
+    vg_lite_buffer_t* source,
+    vg_lite_matrix_t* matrix,
+    vg_lite_blend_t blend,
+    vg_lite_color_t color,
+    vg_lite_filter_t filter)
+{
+    if (!source) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    vg_lite_rectangle_t rect = { 0, 0, source->width, source->height };
+    return blit(target, source, &rect, matrix, blend, color, filter);
+}
+
+vg_lite_error_t VG_LITE_CPU_API(blit_rect)(vg_lite_buffer_t* target,
+    vg_lite_buffer_t* source,
+    vg_lite_rectangle_t* rect,
+    vg_lite_matrix_t* matrix,
+    vg_lite_blend_t blend,
+    vg_lite_color_t color,
+    vg_lite_filter_t filter)
+{
+    if (!source || !rect) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    /* Only the part inside of the source is read */
+    vg_lite_rectangle_t clipped;
+    clipped.x = MATH_MAX(rect->x, 0);
+    clipped.y = MATH_MAX(rect->y, 0);
+    clipped.width = MATH_MIN(rect->x + rect->width, source->width) - clipped.x;
+    clipped.height = MATH_MIN(rect->y + rect->height, source->height) - clipped.y;
+    return blit(target, source, &clipped, matrix, blend, color, filter);
+}
+
+vg_lite_error_t VG_LITE_CPU_API(finish)(void)
+{
+    /* Every call completes before it returns */
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(flush)(void)
+{
+    return VG_LITE_SUCCESS;
+}
+
+/* Gradient */
+
+vg_lite_error_t VG_LITE_CPU_API(init_grad)(vg_lite_linear_gradient_t* grad)
+{
+    if (!grad) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    memset(grad, 0, sizeof(vg_lite_linear_gradient_t));
+    vg_lite_identity(&grad->matrix);
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(set_grad)(vg_lite_linear_gradient_t* grad, vg_lite_uint32_t count, vg_lite_uint32_t* colors, vg_lite_uint32_t* stops)
+{
+    if (!grad || !colors || !stops || count > VLC_MAX_GRADIENT_STOPS) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    grad->count = count;
+    memcpy(grad->colors, colors, count * sizeof(vg_lite_uint32_t));
+    memcpy(grad->stops, stops, count * sizeof(vg_lite_uint32_t));
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(update_grad)(vg_lite_linear_gradient_t* grad)
+{
+    if (!grad || !grad->count) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    vg_lite_buffer_t* image = &grad->image;
+    if (!image->memory) {
+        image->memory = malloc(GRAD_IMAGE_WIDTH * sizeof(uint32_t));
+        if (!image->memory) {
+            return VG_LITE_OUT_OF_MEMORY;
+        }
+    }
+
+    image->width = GRAD_IMAGE_WIDTH;
+    image->height = 1;
+    image->stride = GRAD_IMAGE_WIDTH * sizeof(uint32_t);
+    image->format = VG_LITE_BGRA8888;
+    image->tiled = VG_LITE_LINEAR;
+
+    /* The ramp is a 256 pixel ARGB8888 image, stops are pixel positions */
+    uint32_t* pixels = image->memory;
+    for (uint32_t x = 0; x < GRAD_IMAGE_WIDTH; x++) {
+        uint32_t i = 0;
+        while (i + 1 < grad->count && grad->stops[i + 1] <= x) {
+            i++;
+        }
+
+        uint32_t next = MATH_MIN(i + 1, grad->count - 1);
+        uint32_t range = grad->stops[next] - grad->stops[i];
+        float f = (range && x > grad->stops[i]) ? MATH_MIN((float)(x - grad->stops[i]) / range, 1.0f) : 0;
+
+        uint32_t color = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            float c0 = (grad->colors[i] >> shift) & 0xFF;
+            float c1 = (grad->colors[next] >> shift) & 0xFF;
+            color |= (uint32_t)(c0 + (c1 - c0) * f + 0.5f) << shift;
+        }
+
+        pixels[x] = color;
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(clear_grad)(vg_lite_linear_gradient_t* grad)
+{
+    if (!grad) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    free(grad->image.memory);
+    grad->image.memory = NULL;
+    grad->count = 0;
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_matrix_t* VG_LITE_CPU_API(get_grad_matrix)(vg_lite_linear_gradient_t* grad)
+{
+    return grad ? &grad->matrix : NULL;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(draw_grad)(vg_lite_buffer_t* target,
+    vg_lite_path_t* path,
+    vg_lite_fill_t fill_rule,
+    vg_lite_matrix_t* matrix,
+    vg_lite_linear_gradient_t* grad,
+    vg_lite_blend_t blend)
+{
+    if (!grad || !grad->image.memory || !matrix) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    /* The gradient matrix maps the ramp image into path space */
+    vg_lite_matrix_t grad_matrix = *matrix;
+    vg_lite_test_matrix_multiply(&grad_matrix, &grad->matrix);
+
+    vg_lite_cpu_paint_t paint;
+    VG_LITE_TEST_CHECK_ERROR_RETURN(paint_init_image(&paint, &grad->image, &grad_matrix, 0, VG_LITE_FILTER_BI_LINEAR));
+
+    vg_lite_cpu_draw_t draw;
+    VG_LITE_TEST_CHECK_ERROR_RETURN(draw_init(&draw, target, blend, &paint));
+    return fill_path(&draw, path, fill_rule, matrix);
+}
+
+vg_lite_error_t VG_LITE_CPU_API(set_linear_grad)(vg_lite_ext_linear_gradient_t* grad,
+    vg_lite_uint32_t count,
+    vg_lite_color_ramp_t* color_ramp,
+    vg_lite_linear_gradient_parameter_t linear_gradient,
+    vg_lite_gradient_spreadmode_t spread_mode,
+    vg_lite_uint8_t color_ramp_premultiplied)
+{
+    if (!grad || !color_ramp || !count || count > VLC_MAX_COLOR_RAMP_STOPS) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    memcpy(grad->color_ramp, color_ramp, count * sizeof(vg_lite_color_ramp_t));
+    grad->ramp_length = count;
+    grad->linear_grad = linear_gradient;
+    grad->spread_mode = spread_mode;
+    grad->pre_multiplied = color_ramp_premultiplied;
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(update_linear_grad)(vg_lite_ext_linear_gradient_t* grad)
+{
+    /* The ramp is evaluated per pixel, nothing to upload */
+    return grad ? VG_LITE_SUCCESS : VG_LITE_INVALID_ARGUMENT;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(clear_linear_grad)(vg_lite_ext_linear_gradient_t* grad)
+{
+    if (!grad) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    grad->ramp_length = 0;
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_matrix_t* VG_LITE_CPU_API(get_linear_grad_matrix)(vg_lite_ext_linear_gradient_t* grad)
+{
+    return grad ? &grad->matrix : NULL;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(draw_linear_grad)(vg_lite_buffer_t* target,
+    vg_lite_path_t* path,
+    vg_lite_fill_t fill_rule,
+    vg_lite_matrix_t* path_matrix,
+    vg_lite_ext_linear_gradient_t* grad,
+    vg_lite_color_t paint_color,
+    vg_lite_blend_t blend,
+    vg_lite_filter_t filter)
+{
+    if (!grad) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    vg_lite_cpu_paint_t paint;
+    VG_LITE_TEST_CHECK_ERROR_RETURN(paint_init_ramp(&paint, vg_lite_cpu_paint_linear, path_matrix, &grad->matrix,
+        grad->color_ramp, grad->ramp_length, grad->pre_multiplied, grad->spread_mode));
+    paint.grad_param[0] = grad->linear_grad.X0;
+    paint.grad_param[1] = grad->linear_grad.Y0;
+    paint.grad_param[2] = grad->linear_grad.X1;
+    paint.grad_param[3] = grad->linear_grad.Y1;
+
+    vg_lite_cpu_draw_t draw;
+    VG_LITE_TEST_CHECK_ERROR_RETURN(draw_init(&draw, target, blend, &paint));
+    return fill_path(&draw, path, fill_rule, path_matrix);
+}
+
+vg_lite_error_t VG_LITE_CPU_API(set_radial_grad)(vg_lite_radial_gradient_t* grad,
+    vg_lite_uint32_t count,
+    vg_lite_color_ramp_t* color_ramp,
+    vg_lite_radial_gradient_parameter_t radial_gradient,
+    vg_lite_gradient_spreadmode_t spread_mode,
+    vg_lite_uint8_t color_ramp_premultiplied)
+{
+    if (!grad || !color_ramp || !count || count > VLC_MAX_COLOR_RAMP_STOPS || radial_gradient.r <= 0) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    memcpy(grad->color_ramp, color_ramp, count * sizeof(vg_lite_color_ramp_t));
+    grad->ramp_length = count;
+    grad->radial_grad = radial_gradient;
+    grad->spread_mode = spread_mode;
+    grad->pre_multiplied = color_ramp_premultiplied;
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(update_radial_grad)(vg_lite_radial_gradient_t* grad)
+{
+    return grad ? VG_LITE_SUCCESS : VG_LITE_INVALID_ARGUMENT;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(clear_radial_grad)(vg_lite_radial_gradient_t* grad)
+{
+    if (!grad) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    grad->ramp_length = 0;
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_matrix_t* VG_LITE_CPU_API(get_radial_grad_matrix)(vg_lite_radial_gradient_t* grad)
+{
+    return grad ? &grad->matrix : NULL;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(draw_radial_grad)(vg_lite_buffer_t* target,
+    vg_lite_path_t* path,
+    vg_lite_fill_t fill_rule,
+    vg_lite_matrix_t* path_matrix,
+    vg_lite_radial_gradient_t* grad,
+    vg_lite_color_t paint_color,
+    vg_lite_blend_t blend,
+    vg_lite_filter_t filter)
+{
+    if (!grad) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    vg_lite_cpu_paint_t paint;
+    VG_LITE_TEST_CHECK_ERROR_RETURN(paint_init_ramp(&paint, vg_lite_cpu_paint_radial, path_matrix, &grad->matrix,
+        grad->color_ramp, grad->ramp_length, grad->pre_multiplied, grad->spread_mode));
+    paint.grad_param[0] = grad->radial_grad.cx;
+    paint.grad_param[1] = grad->radial_grad.cy;
+    paint.grad_param[2] = grad->radial_grad.r;
+    paint.grad_param[3] = grad->radial_grad.fx;
+    paint.grad_param[4] = grad->radial_grad.fy;
+
+    vg_lite_cpu_draw_t draw;
+    VG_LITE_TEST_CHECK_ERROR_RETURN(draw_init(&draw, target, blend, &paint));
+    return fill_path(&draw, path, fill_rule, path_matrix);
+}
+
+/* State */
+
+vg_lite_error_t VG_LITE_CPU_API(set_CLUT)(vg_lite_uint32_t count, vg_lite_uint32_t* colors)
+{
+    if (!colors || (count != 2 && count != 4 && count != 16 && count != 256)) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    memcpy(g_ctx.clut, colors, count * sizeof(uint32_t));
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(set_scissor)(vg_lite_int32_t x, vg_lite_int32_t y, vg_lite_int32_t right, vg_lite_int32_t bottom)
+{
+    g_ctx.scissor[0] = x;
+    g_ctx.scissor[1] = y;
+    g_ctx.scissor[2] = right;
+    g_ctx.scissor[3] = bottom;
+    g_ctx.scissor_enabled = true;
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(enable_scissor)(void)
+{
+    g_ctx.scissor_enabled = true;
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(disable_scissor)(void)
+{
+    g_ctx.scissor_enabled = false;
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t VG_LITE_CPU_API(gaussian_filter)(vg_lite_float_t w0, vg_lite_float_t w1, vg_lite_float_t w2)
+{
+    g_ctx.gaussian_weights[0] = w0;
+    g_ctx.gaussian_weights[1] = w1;
+    g_ctx.gaussian_weights[2] = w2;
+    return VG_LITE_SUCCESS;
+}
+
+#ifdef GPU_TEST_VG_LITE_CPU_ENABLE
+
+/* Query, only provided when replacing the vendor library */
+
+vg_lite_uint32_t vg_lite_query_feature(vg_lite_feature_t feature)
+{
+    switch (feature) {
+    case gcFEATURE_BIT_VG_IM_INDEX_FORMAT:
+    case gcFEATURE_BIT_VG_SCISSOR:
+    case gcFEATURE_BIT_VG_RADIAL_GRADIENT:
+    case gcFEATURE_BIT_VG_24BIT:
+    case gcFEATURE_BIT_VG_LINEAR_GRADIENT_EXT:
+    case gcFEATURE_BIT_VG_NEW_BLEND_MODE:
+    case gcFEATURE_BIT_VG_LVGL_SUPPORT:
+    case gcFEATURE_BIT_VG_GAUSSIAN_BLUR:
+    case gcFEATURE_BIT_VG_IM_REPEAT_REFLECT:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+vg_lite_uint32_t vg_lite_get_product_info(vg_lite_char* name, vg_lite_uint32_t* chip_id, vg_lite_uint32_t* chip_rev)
+{
+    if (name) {
+        strcpy(name, "CPU");
+    }
+
+    if (chip_id) {
+        *chip_id = 0;
+    }
+
+    if (chip_rev) {
+        *chip_rev = 0;
+    }
+
+    return 0;
+}
+
+void vg_lite_get_info(vg_lite_info_t* info)
+{
+    if (info) {
+        memset(info, 0, sizeof(vg_lite_info_t));
+        info->release_version = VGLITE_RELEASE_VERSION;
+    }
+}
+
+vg_lite_error_t vg_lite_get_register(vg_lite_uint32_t address, vg_lite_uint32_t* result)
+{
+    if (!result) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    *result = 0;
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_get_mem_size(vg_lite_uint32_t* size)
+{
+    if (!size) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    *size = 0;
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_dump_command_buffer(void)
+{
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_get_parameter(vg_lite_param_type_t type, vg_lite_int32_t count, vg_lite_pointer params)
+{
+    if (!params) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    switch (type) {
+    case VG_LITE_GPU_IDLE_STATE:
+        *(vg_lite_uint32_t*)params = 1;
+        return VG_LITE_SUCCESS;
+    case VG_LITE_SCISSOR_RECT:
+        memcpy(params, g_ctx.scissor, MATH_MIN(count, 4) * sizeof(vg_lite_int32_t));
+        return VG_LITE_SUCCESS;
+    default:
+        return VG_LITE_NOT_SUPPORT;
+    }
+}
+
+#endif /* GPU_TEST_VG_LITE_CPU_ENABLE */
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool matrix_invert(const vg_lite_matrix_t* matrix, float inverse[3][3])
+{
+    const float(*m)[3] = matrix->m;
+    float c00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+    float c01 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+    float c02 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+    float det = m[0][0] * c00 + m[0][1] * c01 + m[0][2] * c02;
+
+    if (math_zero(det)) {
+        return false;
+    }
+
+    float inv_det = 1.0f / det;
+    inverse[0][0] = c00 * inv_det;
+    inverse[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * inv_det;
+    inverse[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * inv_det;
+    inverse[1][0] = c01 * inv_det;
+    inverse[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * inv_det;
+    inverse[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * inv_det;
+    inverse[2][0] = c02 * inv_det;
+    inverse[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * inv_det;
+    inverse[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * inv_det;
+    return true;
+}
+
+static void matrix_map_point(const vg_lite_matrix_t* matrix, float x, float y, float* out_x, float* out_y)
+{
+    float w = matrix->m[2][0] * x + matrix->m[2][1] * y + matrix->m[2][2];
+    if (w == 0) {
+        w = 1;
+    }
+
+    *out_x = (matrix->m[0][0] * x + matrix->m[0][1] * y + matrix->m[0][2]) / w;
+    *out_y = (matrix->m[1][0] * x + matrix->m[1][1] * y + matrix->m[1][2]) / w;
+}
+
+static int path_samples(vg_lite_quality_t quality)
+{
+    switch (quality) {
+    case VG_LITE_HIGH:
+        return 16;
+    case VG_LITE_UPPER:
+        return 8;
+    case VG_LITE_MEDIUM:
+        return 4;
+    default:
+        return 1;
+    }
+}
+
+static vg_lite_error_t draw_init(vg_lite_cpu_draw_t* draw, vg_lite_buffer_t* target, vg_lite_blend_t blend, const vg_lite_cpu_paint_t* paint)
+{
+    if (!target || !target->memory) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    if (!vg_lite_cpu_pixel_is_supported(target->format, true)) {
+        GPU_LOG_WARN("Unsupported target format: %s", vg_lite_test_buffer_format_string(target->format));
+        return VG_LITE_NOT_SUPPORT;
+    }
+
+    memset(draw, 0, sizeof(vg_lite_cpu_draw_t));
+    draw->target = target;
+    draw->paint = paint;
+    draw->blend = blend;
+    draw->samples = 1;
+    draw->clip_x2 = target->width;
+    draw->clip_y2 = target->height;
+
+    if (g_ctx.scissor_enabled) {
+        draw->clip_x1 = MATH_MAX(draw->clip_x1, g_ctx.scissor[0]);
+        draw->clip_y1 = MATH_MAX(draw->clip_y1, g_ctx.scissor[1]);
+        draw->clip_x2 = MATH_MIN(draw->clip_x2, g_ctx.scissor[2]);
+        draw->clip_y2 = MATH_MIN(draw->clip_y2, g_ctx.scissor[3]);
+    }
+
+    if (!g_ctx.edges) {
+        g_ctx.edges = vg_lite_cpu_edges_create();
+    }
+
+    vg_lite_cpu_edges_reset(g_ctx.edges);
+    return VG_LITE_SUCCESS;
+}
+
+static void draw_clip(vg_lite_cpu_draw_t* draw, const float* points, int count)
+{
+    float min_x = INFINITY;
+    float min_y = INFINITY;
+    float max_x = -INFINITY;
+    float max_y = -INFINITY;
+
+    for (int i = 0; i < count; i++) {
+        min_x = MATH_MIN(min_x, points[i * 2]);
+        min_y = MATH_MIN(min_y, points[i * 2 + 1]);
+        max_x = MATH_MAX(max_x, points[i * 2]);
+        max_y = MATH_MAX(max_y, points[i * 2 + 1]);
+    }
+
+    draw->clip_x1 = MATH_MAX(draw->clip_x1, (int)floorf(min_x));
+    draw->clip_y1 = MATH_MAX(draw->clip_y1, (int)floorf(min_y));
+    draw->clip_x2 = MATH_MIN(draw->clip_x2, (int)ceilf(max_x));
+    draw->clip_y2 = MATH_MIN(draw->clip_y2, (int)ceilf(max_y));
+}
+
+static vg_lite_error_t fill_path(vg_lite_cpu_draw_t* draw, const vg_lite_path_t* path, vg_lite_fill_t fill_rule, const vg_lite_matrix_t* matrix)
+{
+    if (!path || !matrix) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    /* Nothing outside of the transformed bounding box is drawn */
+    const float* box = path->bounding_box;
+    float corners[8];
+    matrix_map_point(matrix, box[0], box[1], &corners[0], &corners[1]);
+    matrix_map_point(matrix, box[2], box[1], &corners[2], &corners[3]);
+    matrix_map_point(matrix, box[2], box[3], &corners[4], &corners[5]);
+    matrix_map_point(matrix, box[0], box[3], &corners[6], &corners[7]);
+    draw_clip(draw, corners, 4);
+
+    draw->fill_rule = fill_rule;
+    draw->samples = path_samples(path->quality);
+
+    if (!vg_lite_cpu_edges_add_path(g_ctx.edges, path, matrix)) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    vg_lite_cpu_raster_fill(draw, g_ctx.edges);
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t paint_init_image(vg_lite_cpu_paint_t* paint, const vg_lite_buffer_t* image, const vg_lite_matrix_t* matrix, vg_lite_color_t color, vg_lite_filter_t filter)
+{
+    if (!image || !image->memory || !matrix) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    if (!vg_lite_cpu_pixel_is_supported(image->format, false)) {
+        GPU_LOG_WARN("Unsupported image format: %s", vg_lite_test_buffer_format_string(image->format));
+        return VG_LITE_NOT_SUPPORT;
+    }
+
+    memset(paint, 0, sizeof(vg_lite_cpu_paint_t));
+    paint->cb = vg_lite_cpu_paint_image;
+    paint->image = image;
+    paint->image_rect = (vg_lite_rectangle_t) { 0, 0, image->width, image->height };
+    paint->filter = filter;
+    paint->pattern_mode = VG_LITE_PATTERN_PAD;
+
+    /* A non-zero color is multiplied with every texel, the stencil mode always uses it */
+    paint->color = vg_lite_cpu_color_from_abgr(color, false);
+    paint->has_mix_color = color != 0 || image->image_mode == VG_LITE_STENCIL_MODE;
+    if (image->image_mode == VG_LITE_NONE_IMAGE_MODE) {
+        paint->cb = vg_lite_cpu_paint_solid;
+        paint->color = vg_lite_cpu_color_from_abgr(color, true);
+    }
+
+    if (!matrix_invert(matrix, paint->inverse)) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t paint_init_ramp(vg_lite_cpu_paint_t* paint, vg_lite_cpu_paint_cb_t cb, const vg_lite_matrix_t* matrix, const vg_lite_matrix_t* grad_matrix,
+    const vg_lite_color_ramp_t* ramp, uint32_t ramp_length, uint32_t pre_multiplied, vg_lite_gradient_spreadmode_t spread_mode)
+{
+    if (!matrix || !ramp_length) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    memset(paint, 0, sizeof(vg_lite_cpu_paint_t));
+    paint->cb = cb;
+    paint->ramp = ramp;
+    paint->ramp_length = ramp_length;
+    paint->ramp_premultiplied = pre_multiplied != 0;
+    paint->spread_mode = spread_mode;
+
+    /* The gradient matrix maps gradient space into path space */
+    vg_lite_matrix_t full = *matrix;
+    vg_lite_test_matrix_multiply(&full, grad_matrix);
+    if (!matrix_invert(&full, paint->inverse)) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t blit(vg_lite_buffer_t* target, vg_lite_buffer_t* source, const vg_lite_rectangle_t* rect, vg_lite_matrix_t* matrix,
+    vg_lite_blend_t blend, vg_lite_color_t color, vg_lite_filter_t filter)
+{
+    if (rect->width <= 0 || rect->height <= 0) {
+        return VG_LITE_SUCCESS;
+    }
+
+    vg_lite_cpu_paint_t paint;
+    VG_LITE_TEST_CHECK_ERROR_RETURN(paint_init_image(&paint, source, matrix, color, filter));
+    paint.image_rect = *rect;
+
+    vg_lite_cpu_draw_t draw;
+    VG_LITE_TEST_CHECK_ERROR_RETURN(draw_init(&draw, target, blend, &paint));
+
+    /* The rectangle is drawn at the origin, its edges sample pixel centers */
+    float corners[8];
+    matrix_map_point(matrix, 0, 0, &corners[0], &corners[1]);
+    matrix_map_point(matrix, rect->width, 0, &corners[2], &corners[3]);
+    matrix_map_point(matrix, rect->width, rect->height, &corners[4], &corners[5]);
+    matrix_map_point(matrix, 0, rect->height, &corners[6], &corners[7]);
+    draw_clip(&draw, corners, 4);
+
+    /* Affine blits step through the source directly, the rest goes through the edge list */
+    if (vg_lite_cpu_blit_affine(&draw)) {
+        return VG_LITE_SUCCESS;
+    }
+
+    vg_lite_cpu_edges_add_polygon(g_ctx.edges, corners, 4);
+    vg_lite_cpu_raster_fill(&draw, g_ctx.edges);
+    return VG_LITE_SUCCESS;
+}
+
+#endif /* GPU_TEST_VG_LITE_CPU_ENABLE || GPU_TEST_VG_LITE_CPU_REF_ENABLE */
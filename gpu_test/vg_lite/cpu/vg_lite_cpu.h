@@ -0,0 +1,315 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VG_LITE_CPU_H
+#define VG_LITE_CPU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "vg_lite_cpu_ref.h"
+#include <vg_lite.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#ifdef GPU_TEST_VG_LITE_CPU_ENABLE
+/* The backend replaces the vendor library */
+#define VG_LITE_CPU_API(NAME) vg_lite_##NAME
+#else
+/* The backend runs next to the vendor library, see vg_lite_cpu_ref.h */
+#define VG_LITE_CPU_API(NAME) vg_lite_cpu_##NAME
+#endif
+
+#ifndef VG_LITE_CPU_THREAD_COUNT
+#define VG_LITE_CPU_THREAD_COUNT 4
+#endif
+
+#define VG_LITE_CPU_CLUT_SIZE 256
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/* Premultiplied color, every channel in 0..1 */
+typedef struct {
+    float r;
+    float g;
+    float b;
+    float a;
+} vg_lite_cpu_color_t;
+
+struct vg_lite_cpu_paint_s;
+
+/**
+ * @brief Generate the premultiplied paint colors of a horizontal span.
+ * @param paint The paint object.
+ * @param x The first pixel of the span in target coordinates.
+ * @param y The row of the span in target coordinates.
+ * @param len The number of pixels.
+ * @param colors Filled with len colors.
+ */
+typedef void (*vg_lite_cpu_paint_cb_t)(const struct vg_lite_cpu_paint_s* paint, int x, int y, int len, vg_lite_cpu_color_t* colors);
+
+typedef struct vg_lite_cpu_paint_s {
+    vg_lite_cpu_paint_cb_t cb;
+
+    /* Solid color, or the mix color of images */
+    vg_lite_cpu_color_t color;
+    bool has_mix_color;
+
+    /* Maps a target pixel center to paint space */
+    float inverse[3][3];
+
+    /* Image paint */
+    const vg_lite_buffer_t* image;
+    vg_lite_rectangle_t image_rect;
+    vg_lite_filter_t filter;
+    vg_lite_pattern_mode_t pattern_mode;
+    vg_lite_cpu_color_t pattern_color;
+
+    /* Gradient paint */
+    const vg_lite_color_ramp_t* ramp;
+    uint32_t ramp_length;
+    bool ramp_premultiplied;
+    vg_lite_gradient_spreadmode_t spread_mode;
+    float grad_param[5];
+} vg_lite_cpu_paint_t;
+
+typedef struct {
+    vg_lite_buffer_t* target;
+    const vg_lite_cpu_paint_t* paint;
+    vg_lite_blend_t blend;
+    vg_lite_fill_t fill_rule;
+
+    /* Sub-scanlines per pixel row, 1 samples pixel centers without anti-aliasing */
+    int samples;
+
+    /* Pixels outside of [x1, x2) x [y1, y2) are not touched */
+    int clip_x1;
+    int clip_y1;
+    int clip_x2;
+    int clip_y2;
+} vg_lite_cpu_draw_t;
+
+struct vg_lite_cpu_edges_s;
+
+/**
+ * @brief Process a band of target rows.
+ * @param user_data The user data of the job.
+ * @param y_start The first row.
+ * @param y_end The row after the last one.
+ * @note Called from several threads at once, the bands never overlap.
+ */
+typedef void (*vg_lite_cpu_rows_cb_t)(void* user_data, int y_start, int y_end);
+
+/**
+ * @brief Fetch a texel of a source image.
+ * @param row The first byte of the image row.
+ * @param x The column of the texel.
+ * @return The straight color in 8-bit ARGB, 0xAARRGGBB.
+ */
+typedef uint32_t (*vg_lite_cpu_fetch_cb_t)(const uint8_t* row, int x);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Start the rasterizer worker threads.
+ * @note Without it every draw runs on the calling thread.
+ */
+void vg_lite_cpu_raster_init(void);
+
+/**
+ * @brief Stop the rasterizer worker threads.
+ */
+void vg_lite_cpu_raster_deinit(void);
+
+/**
+ * @brief Create an edge list to collect the outline of a shape.
+ * @return The edge list.
+ */
+struct vg_lite_cpu_edges_s* vg_lite_cpu_edges_create(void);
+
+/**
+ * @brief Destroy an edge list.
+ * @param edges The edge list to destroy.
+ */
+void vg_lite_cpu_edges_destroy(struct vg_lite_cpu_edges_s* edges);
+
+/**
+ * @brief Remove all edges, the memory is kept for the next shape.
+ * @param edges The edge list to reset.
+ */
+void vg_lite_cpu_edges_reset(struct vg_lite_cpu_edges_s* edges);
+
+/**
+ * @brief Add the outline of a path to an edge list, open subpaths are closed.
+ * @param edges The edge list.
+ * @param path The path to add.
+ * @param matrix The path to target transform.
+ * @return True on success, false if the path contains an unknown op code.
+ */
+bool vg_lite_cpu_edges_add_path(struct vg_lite_cpu_edges_s* edges, const vg_lite_path_t* path, const vg_lite_matrix_t* matrix);
+
+/**
+ * @brief Add a closed polygon to an edge list.
+ * @param edges The edge list.
+ * @param points The polygon corners in target coordinates, x and y interleaved.
+ * @param count The number of corners.
+ */
+void vg_lite_cpu_edges_add_polygon(struct vg_lite_cpu_edges_s* edges, const float* points, int count);
+
+/**
+ * @brief Fill the shape of an edge list.
+ * @param draw The target, paint, blend, fill rule and clip of the draw.
+ * @param edges The edge list, it is sorted in place.
+ * @note The rows are split into bands that the worker threads fill concurrently.
+ */
+void vg_lite_cpu_raster_fill(const vg_lite_cpu_draw_t* draw, struct vg_lite_cpu_edges_s* edges);
+
+/**
+ * @brief Split the rows [y1, y2) into bands and process them on the worker threads.
+ * @param y1 The first row.
+ * @param y2 The row after the last one.
+ * @param cb The band callback.
+ * @param user_data The user data passed to the callback.
+ */
+void vg_lite_cpu_raster_run_rows(int y1, int y2, vg_lite_cpu_rows_cb_t cb, void* user_data);
+
+/**
+ * @brief Blit an image paint with an affine transform, without going through the edge list.
+ * @param draw The draw, its clip must already contain the bounding box of the image.
+ * @return True if the image was drawn, false if the draw needs the generic rasterizer.
+ * @note Source positions are stepped in 16.16 fixed point, texels are filtered and blended in 8 bits.
+ */
+bool vg_lite_cpu_blit_affine(const vg_lite_cpu_draw_t* draw);
+
+/**
+ * @brief Check whether the pixels of a format can be read or written.
+ * @param format The buffer format.
+ * @param is_target True to check for writing.
+ * @return True if supported.
+ */
+bool vg_lite_cpu_pixel_is_supported(vg_lite_buffer_format_t format, bool is_target);
+
+/**
+ * @brief Read a span of pixels as stored, without premultiplication.
+ * @param buffer The buffer to read.
+ * @param x The first pixel.
+ * @param y The row.
+ * @param len The number of pixels.
+ * @param colors Filled with len colors, formats without alpha read as opaque.
+ */
+void vg_lite_cpu_pixel_read_span(const vg_lite_buffer_t* buffer, int x, int y, int len, vg_lite_cpu_color_t* colors);
+
+/**
+ * @brief Write a span of pixels as stored, without premultiplication.
+ * @param buffer The buffer to write.
+ * @param x The first pixel.
+ * @param y The row.
+ * @param len The number of pixels.
+ * @param colors The len colors to write.
+ */
+void vg_lite_cpu_pixel_write_span(vg_lite_buffer_t* buffer, int x, int y, int len, const vg_lite_cpu_color_t* colors);
+
+/**
+ * @brief Fill a span of pixels with one color.
+ * @param buffer The buffer to write.
+ * @param x The first pixel.
+ * @param y The row.
+ * @param len The number of pixels.
+ * @param color The color to write, as stored.
+ * @note The color is packed once, the inner loops only store whole pixels.
+ */
+void vg_lite_cpu_pixel_fill_span(vg_lite_buffer_t* buffer, int x, int y, int len, const vg_lite_cpu_color_t* color);
+
+/**
+ * @brief Blend a span of premultiplied source colors onto destination colors.
+ * @param blend The blend mode.
+ * @param src The source colors.
+ * @param dst The destination colors, replaced by the result.
+ * @param coverage The coverage of every pixel in 0..1.
+ * @param len The number of pixels.
+ */
+void vg_lite_cpu_blend_span(vg_lite_blend_t blend, const vg_lite_cpu_color_t* src, vg_lite_cpu_color_t* dst, const float* coverage, int len);
+
+/**
+ * @brief Get the texel fetch function of a source format.
+ * @param format The image format.
+ * @return The fetch function, or NULL if the format has no fast fetch.
+ */
+vg_lite_cpu_fetch_cb_t vg_lite_cpu_pixel_get_fetch(vg_lite_buffer_format_t format);
+
+/**
+ * @brief Convert a vg_lite_color_t (ABGR8888) into a color.
+ * @param color The color value.
+ * @param premultiply True to premultiply the channels by alpha.
+ * @return The converted color.
+ */
+vg_lite_cpu_color_t vg_lite_cpu_color_from_abgr(vg_lite_color_t color, bool premultiply);
+
+/**
+ * @brief Get the color lookup table set by vg_lite_set_CLUT.
+ * @return VG_LITE_CPU_CLUT_SIZE ARGB8888 colors.
+ */
+const uint32_t* vg_lite_cpu_get_clut(void);
+
+/**
+ * @brief Get the 3x3 kernel weights set by vg_lite_gaussian_filter.
+ * @param weights Filled with the center, edge and corner weights.
+ */
+void vg_lite_cpu_get_gaussian_weights(float weights[3]);
+
+/**
+ * @brief Paint callback of solid colors.
+ */
+void vg_lite_cpu_paint_solid(const struct vg_lite_cpu_paint_s* paint, int x, int y, int len, vg_lite_cpu_color_t* colors);
+
+/**
+ * @brief Paint callback of images, see the image fields of vg_lite_cpu_paint_t.
+ */
+void vg_lite_cpu_paint_image(const struct vg_lite_cpu_paint_s* paint, int x, int y, int len, vg_lite_cpu_color_t* colors);
+
+/**
+ * @brief Paint callback of linear gradients, grad_param holds X0, Y0, X1 and Y1.
+ */
+void vg_lite_cpu_paint_linear(const struct vg_lite_cpu_paint_s* paint, int x, int y, int len, vg_lite_cpu_color_t* colors);
+
+/**
+ * @brief Paint callback of radial gradients, grad_param holds cx, cy, r, fx and fy.
+ */
+void vg_lite_cpu_paint_radial(const struct vg_lite_cpu_paint_s* paint, int x, int y, int len, vg_lite_cpu_color_t* colors);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*VG_LITE_CPU_H*/
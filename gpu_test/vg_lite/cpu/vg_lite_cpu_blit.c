@@ -0,0 +1,369 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#if defined(GPU_TEST_VG_LITE_CPU_ENABLE) || defined(GPU_TEST_VG_LITE_CPU_REF_ENABLE)
+
+#include "vg_lite_cpu.h"
+#include "../../gpu_math.h"
+#include <math.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Pixels processed per chunk of a row */
+#define BLIT_CHUNK_SIZE 256
+
+#define FIXED_SHIFT 16
+#define FIXED_ONE (1 << FIXED_SHIFT)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    const vg_lite_cpu_draw_t* draw;
+    vg_lite_cpu_fetch_cb_t fetch;
+    bool bilinear;
+    bool src_over;
+
+    /* The target is BGRA8888 or BGRX8888 and is composited without float conversion */
+    bool direct;
+
+    /* Straight ARGB8888 color multiplied with every texel */
+    bool has_mix_color;
+    uint32_t mix_color;
+
+    /* Source position of the center of the target pixel (0, 0) and its steps, in image rect space */
+    float u0;
+    float v0;
+    float du_dx;
+    float dv_dx;
+    float du_dy;
+    float dv_dy;
+} blit_job_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void blit_rows(void* user_data, int y_start, int y_end);
+static bool blit_row_range(float start, float step, int size, int* x1, int* x2);
+static void blit_sample(const blit_job_t* job, int32_t u, int32_t v, int32_t du, int32_t dv, uint32_t* dst, int len);
+static void blit_composite(const blit_job_t* job, int x, int y, const uint32_t* src, int len);
+static inline uint32_t blit_texel(const blit_job_t* job, const uint8_t* row, int x);
+static inline uint32_t argb_scale(uint32_t c, uint32_t s);
+static inline uint32_t argb_lerp(uint32_t a, uint32_t b, uint32_t f);
+static inline uint32_t argb_mul(uint32_t c, uint32_t m);
+static inline uint32_t argb_premultiply(uint32_t c);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define COORD_CLAMP(v, lo, hi) MATH_MIN(MATH_MAX(v, lo), hi)
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool vg_lite_cpu_blit_affine(const vg_lite_cpu_draw_t* draw)
+{
+    const vg_lite_cpu_paint_t* paint = draw->paint;
+    const float(*m)[3] = paint->inverse;
+
+    if (paint->cb != vg_lite_cpu_paint_image
+        || paint->pattern_mode != VG_LITE_PATTERN_PAD
+        || paint->image->tiled != VG_LITE_LINEAR
+        || m[2][0] != 0 || m[2][1] != 0 || m[2][2] == 0) {
+        return false;
+    }
+
+    blit_job_t job = { .draw = draw };
+
+    switch (paint->filter) {
+    case VG_LITE_FILTER_POINT:
+        break;
+    case VG_LITE_FILTER_LINEAR:
+    case VG_LITE_FILTER_BI_LINEAR:
+        job.bilinear = true;
+        break;
+    default:
+        return false;
+    }
+
+    switch (draw->blend) {
+    case VG_LITE_BLEND_NONE:
+        break;
+    case VG_LITE_BLEND_SRC_OVER:
+    case VG_LITE_BLEND_NORMAL_LVGL:
+        job.src_over = true;
+        break;
+    default:
+        return false;
+    }
+
+    job.fetch = vg_lite_cpu_pixel_get_fetch(paint->image->format);
+    if (!job.fetch) {
+        return false;
+    }
+
+    job.direct = draw->target->tiled == VG_LITE_LINEAR
+        && (draw->target->format == VG_LITE_BGRA8888 || draw->target->format == VG_LITE_BGRX8888);
+
+    job.has_mix_color = paint->has_mix_color;
+    if (paint->has_mix_color) {
+        const vg_lite_cpu_color_t* c = &paint->color;
+        job.mix_color = (uint32_t)(c->a * 255.0f + 0.5f) << 24
+            | (uint32_t)(c->r * 255.0f + 0.5f) << 16
+            | (uint32_t)(c->g * 255.0f + 0.5f) << 8
+            | (uint32_t)(c->b * 255.0f + 0.5f);
+    }
+
+    /* The projective row of an affine inverse is (0, 0, w) */
+    const float inv_w = 1.0f / m[2][2];
+    job.du_dx = m[0][0] * inv_w;
+    job.du_dy = m[0][1] * inv_w;
+    job.dv_dx = m[1][0] * inv_w;
+    job.dv_dy = m[1][1] * inv_w;
+    job.u0 = (m[0][0] * 0.5f + m[0][1] * 0.5f + m[0][2]) * inv_w;
+    job.v0 = (m[1][0] * 0.5f + m[1][1] * 0.5f + m[1][2]) * inv_w;
+
+    vg_lite_cpu_raster_run_rows(draw->clip_y1, draw->clip_y2, blit_rows, &job);
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void blit_rows(void* user_data, int y_start, int y_end)
+{
+    const blit_job_t* job = user_data;
+    const vg_lite_cpu_draw_t* draw = job->draw;
+    const vg_lite_rectangle_t* rect = &draw->paint->image_rect;
+    uint32_t span[BLIT_CHUNK_SIZE];
+
+    /* Texel centers are at half coordinates */
+    const float offset = job->bilinear ? 0.5f : 0.0f;
+    const int32_t du = (int32_t)lroundf(job->du_dx * FIXED_ONE);
+    const int32_t dv = (int32_t)lroundf(job->dv_dx * FIXED_ONE);
+
+    for (int y = y_start; y < y_end; y++) {
+        const float row_u = job->u0 + job->du_dy * y;
+        const float row_v = job->v0 + job->dv_dy * y;
+
+        /* Only the pixels whose center maps inside the image rect are drawn */
+        int x1 = draw->clip_x1;
+        int x2 = draw->clip_x2;
+        if (!blit_row_range(row_u, job->du_dx, rect->width, &x1, &x2)
+            || !blit_row_range(row_v, job->dv_dx, rect->height, &x1, &x2)) {
+            continue;
+        }
+
+        for (int x = x1; x < x2; x += BLIT_CHUNK_SIZE) {
+            int len = MATH_MIN(x2 - x, BLIT_CHUNK_SIZE);
+            int32_t u = (int32_t)lroundf((row_u + job->du_dx * x - offset) * FIXED_ONE);
+            int32_t v = (int32_t)lroundf((row_v + job->dv_dx * x - offset) * FIXED_ONE);
+            blit_sample(job, u, v, du, dv, span, len);
+            blit_composite(job, x, y, span, len);
+        }
+    }
+}
+
+static bool blit_row_range(float start, float step, int size, int* x1, int* x2)
+{
+    /* Narrow [x1, x2) to the pixels with 0 <= start + step * x < size */
+    if (step == 0) {
+        return start >= 0 && start < size;
+    }
+
+    float lo = (0 - start) / step;
+    float hi = (size - start) / step;
+    float first;
+    float last;
+    if (step > 0) {
+        first = ceilf(lo);
+        last = ceilf(hi);
+    } else {
+        first = floorf(hi) + 1;
+        last = floorf(lo) + 1;
+    }
+
+    /* Clamp before the conversion, nearly axis aligned steps put the ends far outside of int */
+    *x1 = (int)MATH_MIN(MATH_MAX(first, (float)*x1), (float)*x2);
+    *x2 = (int)MATH_MAX(MATH_MIN(last, (float)*x2), (float)*x1);
+
+    /* The divisions can round across a pixel center, settle the ends with the exact test */
+    while (*x1 < *x2 && !(start + step * *x1 >= 0 && start + step * *x1 < size)) {
+        (*x1)++;
+    }
+    while (*x2 > *x1 && !(start + step * (*x2 - 1) >= 0 && start + step * (*x2 - 1) < size)) {
+        (*x2)--;
+    }
+
+    return *x1 < *x2;
+}
+
+static void blit_sample(const blit_job_t* job, int32_t u, int32_t v, int32_t du, int32_t dv, uint32_t* dst, int len)
+{
+    const vg_lite_cpu_paint_t* paint = job->draw->paint;
+    const vg_lite_buffer_t* image = paint->image;
+    const vg_lite_rectangle_t* rect = &paint->image_rect;
+    const uint8_t* base = (const uint8_t*)image->memory + (size_t)rect->y * image->stride;
+    const uint32_t stride = image->stride;
+    const int max_x = rect->width - 1;
+    const int max_y = rect->height - 1;
+
+    for (int i = 0; i < len; i++, u += du, v += dv) {
+        /* The bias keeps the position positive so that the shift floors */
+        uint32_t bu = (uint32_t)(u + FIXED_ONE);
+        uint32_t bv = (uint32_t)(v + FIXED_ONE);
+        int tx = (int)(bu >> FIXED_SHIFT) - 1;
+        int ty = (int)(bv >> FIXED_SHIFT) - 1;
+
+        /* PAD repeats the border texels */
+        int x0 = COORD_CLAMP(tx, 0, max_x);
+        int y0 = COORD_CLAMP(ty, 0, max_y);
+        const uint8_t* row0 = base + (size_t)y0 * stride;
+
+        if (!job->bilinear) {
+            dst[i] = blit_texel(job, row0, rect->x + x0);
+            continue;
+        }
+
+        int x1 = COORD_CLAMP(tx + 1, 0, max_x);
+        int y1 = COORD_CLAMP(ty + 1, 0, max_y);
+        const uint8_t* row1 = base + (size_t)y1 * stride;
+        uint32_t fx = (bu >> (FIXED_SHIFT - 8)) & 0xFF;
+        uint32_t fy = (bv >> (FIXED_SHIFT - 8)) & 0xFF;
+
+        uint32_t top = argb_lerp(blit_texel(job, row0, rect->x + x0), blit_texel(job, row0, rect->x + x1), fx);
+        uint32_t bottom = argb_lerp(blit_texel(job, row1, rect->x + x0), blit_texel(job, row1, rect->x + x1), fx);
+        dst[i] = argb_lerp(top, bottom, fy);
+    }
+}
+
+static void blit_composite(const blit_job_t* job, int x, int y, const uint32_t* src, int len)
+{
+    vg_lite_buffer_t* target = job->draw->target;
+
+    if (job->direct) {
+        uint32_t* dst = (uint32_t*)((uint8_t*)target->memory + (size_t)y * target->stride) + x;
+
+        /* The X byte is written opaque and read as opaque */
+        const uint32_t opaque = target->format == VG_LITE_BGRX8888 ? 0xFF000000 : 0;
+
+        if (!job->src_over) {
+            for (int i = 0; i < len; i++) {
+                dst[i] = src[i] | opaque;
+            }
+            return;
+        }
+
+        for (int i = 0; i < len; i++) {
+            uint32_t s = src[i];
+            uint32_t sa = s >> 24;
+            if (sa == 0xFF) {
+                dst[i] = s;
+            } else if (sa != 0) {
+                dst[i] = (s + argb_scale(dst[i] | opaque, 0xFF - sa)) | opaque;
+            }
+        }
+        return;
+    }
+
+    /* Other targets go through the float blender */
+    vg_lite_cpu_color_t colors[BLIT_CHUNK_SIZE];
+    vg_lite_cpu_color_t dst[BLIT_CHUNK_SIZE];
+    float coverage[BLIT_CHUNK_SIZE];
+
+    for (int i = 0; i < len; i++) {
+        uint32_t s = src[i];
+        colors[i].r = ((s >> 16) & 0xFF) / 255.0f;
+        colors[i].g = ((s >> 8) & 0xFF) / 255.0f;
+        colors[i].b = (s & 0xFF) / 255.0f;
+        colors[i].a = (s >> 24) / 255.0f;
+        coverage[i] = 1.0f;
+    }
+
+    vg_lite_cpu_pixel_read_span(target, x, y, len, dst);
+    vg_lite_cpu_blend_span(job->draw->blend, colors, dst, coverage, len);
+    vg_lite_cpu_pixel_write_span(target, x, y, len, dst);
+}
+
+static inline uint32_t blit_texel(const blit_job_t* job, const uint8_t* row, int x)
+{
+    uint32_t c = job->fetch(row, x);
+    if (job->has_mix_color) {
+        c = argb_mul(c, job->mix_color);
+    }
+
+    return argb_premultiply(c);
+}
+
+/* The helpers below work on two 8-bit channels per 32-bit multiply, 0x00RR00BB and 0x00AA00GG */
+
+static inline uint32_t argb_scale(uint32_t c, uint32_t s)
+{
+    /* c * s / 255 with rounding, s in 0..255 */
+    uint32_t rb = (c & 0xFF00FF) * s + 0x800080;
+    uint32_t ag = ((c >> 8) & 0xFF00FF) * s + 0x800080;
+    rb = ((rb + ((rb >> 8) & 0xFF00FF)) >> 8) & 0xFF00FF;
+    ag = (ag + ((ag >> 8) & 0xFF00FF)) & 0xFF00FF00;
+    return rb | ag;
+}
+
+static inline uint32_t argb_lerp(uint32_t a, uint32_t b, uint32_t f)
+{
+    /* a + (b - a) * f / 256, f in 0..255 */
+    uint32_t inv_f = 256 - f;
+    uint32_t rb = (((a & 0xFF00FF) * inv_f + (b & 0xFF00FF) * f) >> 8) & 0xFF00FF;
+    uint32_t ag = (((a >> 8) & 0xFF00FF) * inv_f + ((b >> 8) & 0xFF00FF) * f) & 0xFF00FF00;
+    return rb | ag;
+}
+
+static inline uint32_t argb_mul(uint32_t c, uint32_t m)
+{
+    uint32_t result = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        uint32_t v = ((c >> shift) & 0xFF) * ((m >> shift) & 0xFF) + 0x80;
+        result |= ((v + (v >> 8)) >> 8) << shift;
+    }
+
+    return result;
+}
+
+static inline uint32_t argb_premultiply(uint32_t c)
+{
+    uint32_t a = c >> 24;
+    if (a == 0xFF) {
+        return c;
+    }
+
+    return (argb_scale(c, a) & 0xFFFFFF) | (a << 24);
+}
+
+#endif /* GPU_TEST_VG_LITE_CPU_ENABLE || GPU_TEST_VG_LITE_CPU_REF_ENABLE */
@@ -0,0 +1,306 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#if defined(GPU_TEST_VG_LITE_CPU_ENABLE) || defined(GPU_TEST_VG_LITE_CPU_REF_ENABLE)
+
+#include "vg_lite_cpu.h"
+#include "../../gpu_math.h"
+#include <math.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static inline void paint_map_point(const vg_lite_cpu_paint_t* paint, float x, float y, float* u, float* v);
+static vg_lite_cpu_color_t image_texel(const vg_lite_cpu_paint_t* paint, int tx, int ty);
+static inline int wrap_coord(int value, int size, vg_lite_pattern_mode_t mode);
+static vg_lite_cpu_color_t ramp_color(const vg_lite_cpu_paint_t* paint, float t);
+static inline void color_lerp(vg_lite_cpu_color_t* result, const vg_lite_cpu_color_t* a, const vg_lite_cpu_color_t* b, float f);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void vg_lite_cpu_paint_solid(const struct vg_lite_cpu_paint_s* paint, int x, int y, int len, vg_lite_cpu_color_t* colors)
+{
+    for (int i = 0; i < len; i++) {
+        colors[i] = paint->color;
+    }
+}
+
+void vg_lite_cpu_paint_image(const struct vg_lite_cpu_paint_s* paint, int x, int y, int len, vg_lite_cpu_color_t* colors)
+{
+    for (int i = 0; i < len; i++) {
+        float u;
+        float v;
+        paint_map_point(paint, x + i + 0.5f, y + 0.5f, &u, &v);
+
+        switch (paint->filter) {
+        case VG_LITE_FILTER_LINEAR:
+        case VG_LITE_FILTER_BI_LINEAR: {
+            /* Texel centers are at half coordinates */
+            u -= 0.5f;
+            v -= 0.5f;
+            float fu = floorf(u);
+            float fv = floorf(v);
+            int tx = (int)fu;
+            int ty = (int)fv;
+            vg_lite_cpu_color_t c00 = image_texel(paint, tx, ty);
+            vg_lite_cpu_color_t c10 = image_texel(paint, tx + 1, ty);
+            vg_lite_cpu_color_t c01 = image_texel(paint, tx, ty + 1);
+            vg_lite_cpu_color_t c11 = image_texel(paint, tx + 1, ty + 1);
+            color_lerp(&c00, &c00, &c10, u - fu);
+            color_lerp(&c01, &c01, &c11, u - fu);
+            color_lerp(&colors[i], &c00, &c01, v - fv);
+        } break;
+
+        case VG_LITE_FILTER_GAUSSIAN: {
+            /* 3x3 kernel: center, edge and corner weights */
+            float weights[3];
+            vg_lite_cpu_get_gaussian_weights(weights);
+            int tx = (int)floorf(u);
+            int ty = (int)floorf(v);
+            vg_lite_cpu_color_t sum = { 0 };
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    float w = weights[MATH_ABS(dx) + MATH_ABS(dy)];
+                    vg_lite_cpu_color_t c = image_texel(paint, tx + dx, ty + dy);
+                    sum.r += c.r * w;
+                    sum.g += c.g * w;
+                    sum.b += c.b * w;
+                    sum.a += c.a * w;
+                }
+            }
+            colors[i] = sum;
+        } break;
+
+        default:
+            colors[i] = image_texel(paint, (int)floorf(u), (int)floorf(v));
+            break;
+        }
+    }
+}
+
+void vg_lite_cpu_paint_linear(const struct vg_lite_cpu_paint_s* paint, int x, int y, int len, vg_lite_cpu_color_t* colors)
+{
+    const float* param = paint->grad_param;
+    float dx = param[2] - param[0];
+    float dy = param[3] - param[1];
+    float len_sq = dx * dx + dy * dy;
+    float inv_len_sq = len_sq > 0 ? 1.0f / len_sq : 0;
+
+    for (int i = 0; i < len; i++) {
+        float u;
+        float v;
+        paint_map_point(paint, x + i + 0.5f, y + 0.5f, &u, &v);
+        float t = ((u - param[0]) * dx + (v - param[1]) * dy) * inv_len_sq;
+        colors[i] = ramp_color(paint, t);
+    }
+}
+
+void vg_lite_cpu_paint_radial(const struct vg_lite_cpu_paint_s* paint, int x, int y, int len, vg_lite_cpu_color_t* colors)
+{
+    const float* param = paint->grad_param;
+    const float cx = param[0];
+    const float cy = param[1];
+    const float r = param[2];
+    const float fx = param[3];
+    const float fy = param[4];
+
+    /* Focal point relative to the center */
+    const float ex = fx - cx;
+    const float ey = fy - cy;
+    const float c = ex * ex + ey * ey - r * r;
+
+    for (int i = 0; i < len; i++) {
+        float u;
+        float v;
+        paint_map_point(paint, x + i + 0.5f, y + 0.5f, &u, &v);
+
+        /**
+         * Solve for t where the point lies on the circle scaled by t around the focal point:
+         * |e + d / t| = r with d = p - f, the smaller root in 1 / t gives the visible circle.
+         */
+        float dx = u - fx;
+        float dy = v - fy;
+        float a = dx * dx + dy * dy;
+        float b = ex * dx + ey * dy;
+        float t = 0;
+
+        if (a > 0) {
+            float disc = b * b - a * c;
+            float denom = -b + sqrtf(MATH_MAX(disc, 0.0f));
+            t = denom > 0 ? a / denom : INFINITY;
+        }
+
+        colors[i] = ramp_color(paint, t);
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline void paint_map_point(const vg_lite_cpu_paint_t* paint, float x, float y, float* u, float* v)
+{
+    const float(*m)[3] = paint->inverse;
+    float w = m[2][0] * x + m[2][1] * y + m[2][2];
+    if (w == 0) {
+        w = 1;
+    }
+
+    *u = (m[0][0] * x + m[0][1] * y + m[0][2]) / w;
+    *v = (m[1][0] * x + m[1][1] * y + m[1][2]) / w;
+}
+
+static vg_lite_cpu_color_t image_texel(const vg_lite_cpu_paint_t* paint, int tx, int ty)
+{
+    const vg_lite_rectangle_t* rect = &paint->image_rect;
+
+    if (paint->pattern_mode == VG_LITE_PATTERN_COLOR
+        && (tx < 0 || ty < 0 || tx >= rect->width || ty >= rect->height)) {
+        return paint->pattern_color;
+    }
+
+    tx = wrap_coord(tx, rect->width, paint->pattern_mode);
+    ty = wrap_coord(ty, rect->height, paint->pattern_mode);
+
+    vg_lite_cpu_color_t color;
+    vg_lite_cpu_pixel_read_span(paint->image, rect->x + tx, rect->y + ty, 1, &color);
+
+    if (paint->has_mix_color) {
+        color.r *= paint->color.r;
+        color.g *= paint->color.g;
+        color.b *= paint->color.b;
+        color.a *= paint->color.a;
+    }
+
+    color.r *= color.a;
+    color.g *= color.a;
+    color.b *= color.a;
+    return color;
+}
+
+static inline int wrap_coord(int value, int size, vg_lite_pattern_mode_t mode)
+{
+    switch (mode) {
+    case VG_LITE_PATTERN_REPEAT:
+        value %= size;
+        return value < 0 ? value + size : value;
+    case VG_LITE_PATTERN_REFLECT: {
+        int period = size * 2;
+        value %= period;
+        value = value < 0 ? value + period : value;
+        return value < size ? value : period - 1 - value;
+    }
+    default:
+        return MATH_MIN(MATH_MAX(value, 0), size - 1);
+    }
+}
+
+static vg_lite_cpu_color_t ramp_color(const vg_lite_cpu_paint_t* paint, float t)
+{
+    const vg_lite_cpu_color_t transparent = { 0 };
+
+    switch (paint->spread_mode) {
+    case VG_LITE_GRADIENT_SPREAD_FILL:
+        if (!(t >= 0 && t <= 1)) {
+            return transparent;
+        }
+        break;
+    case VG_LITE_GRADIENT_SPREAD_REPEAT:
+        t = isfinite(t) ? t - floorf(t) : 1;
+        break;
+    case VG_LITE_GRADIENT_SPREAD_REFLECT:
+        t = isfinite(t) ? fmodf(fabsf(t), 2.0f) : 1;
+        t = t > 1 ? 2 - t : t;
+        break;
+    default:
+        t = MATH_MIN(MATH_MAX(t, 0.0f), 1.0f);
+        break;
+    }
+
+    const vg_lite_color_ramp_t* ramp = paint->ramp;
+    const uint32_t count = paint->ramp_length;
+    if (!count) {
+        return transparent;
+    }
+
+    uint32_t i = 0;
+    while (i + 1 < count && ramp[i + 1].stop <= t) {
+        i++;
+    }
+
+    const vg_lite_color_ramp_t* stop0 = &ramp[i];
+    const vg_lite_color_ramp_t* stop1 = &ramp[MATH_MIN(i + 1, count - 1)];
+    float range = stop1->stop - stop0->stop;
+    float f = range > 0 ? MATH_MIN(MATH_MAX((t - stop0->stop) / range, 0.0f), 1.0f) : 0;
+
+    vg_lite_cpu_color_t c0 = { stop0->red, stop0->green, stop0->blue, stop0->alpha };
+    vg_lite_cpu_color_t c1 = { stop1->red, stop1->green, stop1->blue, stop1->alpha };
+
+    /* Interpolate in premultiplied space if requested, the result is premultiplied either way */
+    if (paint->ramp_premultiplied) {
+        c0.r *= c0.a;
+        c0.g *= c0.a;
+        c0.b *= c0.a;
+        c1.r *= c1.a;
+        c1.g *= c1.a;
+        c1.b *= c1.a;
+    }
+
+    vg_lite_cpu_color_t result;
+    color_lerp(&result, &c0, &c1, f);
+
+    if (!paint->ramp_premultiplied) {
+        result.r *= result.a;
+        result.g *= result.a;
+        result.b *= result.a;
+    }
+
+    return result;
+}
+
+static inline void color_lerp(vg_lite_cpu_color_t* result, const vg_lite_cpu_color_t* a, const vg_lite_cpu_color_t* b, float f)
+{
+    result->r = a->r + (b->r - a->r) * f;
+    result->g = a->g + (b->g - a->g) * f;
+    result->b = a->b + (b->b - a->b) * f;
+    result->a = a->a + (b->a - a->a) * f;
+}
+
+#endif /* GPU_TEST_VG_LITE_CPU_ENABLE || GPU_TEST_VG_LITE_CPU_REF_ENABLE */
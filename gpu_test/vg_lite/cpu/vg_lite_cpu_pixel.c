@@ -0,0 +1,545 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#if defined(GPU_TEST_VG_LITE_CPU_ENABLE) || defined(GPU_TEST_VG_LITE_CPU_REF_ENABLE)
+
+#include "vg_lite_cpu.h"
+#include "../../gpu_assert.h"
+#include "../../gpu_math.h"
+#include "../vg_lite_test_convert.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define CHANNEL_NONE -1
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    PIXEL_TYPE_UNKNOWN,
+    PIXEL_TYPE_BYTES, /* One byte per channel, at the given offsets */
+    PIXEL_TYPE_565, /* 16 bits, the first channel in the low bits */
+    PIXEL_TYPE_5658, /* 565 followed by an alpha byte */
+    PIXEL_TYPE_A8,
+    PIXEL_TYPE_A4,
+    PIXEL_TYPE_L8,
+    PIXEL_TYPE_INDEX_8,
+} pixel_type_t;
+
+typedef struct {
+    pixel_type_t type;
+    uint8_t bits;
+    bool is_target;
+
+    /* PIXEL_TYPE_BYTES: byte offsets, PIXEL_TYPE_565(8): true if red is in the low bits */
+    int8_t r;
+    int8_t g;
+    int8_t b;
+    int8_t a;
+} pixel_desc_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static pixel_desc_t pixel_get_desc(vg_lite_buffer_format_t format);
+static inline uint8_t* pixel_ptr(const vg_lite_buffer_t* buffer, int x, int y, int bits);
+static inline uint8_t float_to_u8(float value);
+static void pixel_pack(const pixel_desc_t* desc, const vg_lite_cpu_color_t* color, uint8_t* dst);
+static void pixel_unpack(const pixel_desc_t* desc, const uint8_t* src, int x, vg_lite_cpu_color_t* color);
+static inline void blend_pixel(vg_lite_blend_t blend, const vg_lite_cpu_color_t* s, const vg_lite_cpu_color_t* d, vg_lite_cpu_color_t* r);
+static uint32_t fetch_bgra8888(const uint8_t* row, int x);
+static uint32_t fetch_rgba8888(const uint8_t* row, int x);
+static uint32_t fetch_argb8888(const uint8_t* row, int x);
+static uint32_t fetch_abgr8888(const uint8_t* row, int x);
+static uint32_t fetch_bgrx8888(const uint8_t* row, int x);
+static uint32_t fetch_rgbx8888(const uint8_t* row, int x);
+static uint32_t fetch_bgr888(const uint8_t* row, int x);
+static uint32_t fetch_rgb888(const uint8_t* row, int x);
+static uint32_t fetch_bgr565(const uint8_t* row, int x);
+static uint32_t fetch_rgb565(const uint8_t* row, int x);
+static uint32_t fetch_bgra5658(const uint8_t* row, int x);
+static uint32_t fetch_rgba5658(const uint8_t* row, int x);
+static uint32_t fetch_a8(const uint8_t* row, int x);
+static uint32_t fetch_a4(const uint8_t* row, int x);
+static uint32_t fetch_l8(const uint8_t* row, int x);
+static uint32_t fetch_index8(const uint8_t* row, int x);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define BYTES_DESC(R, G, B, A, BITS, TARGET) \
+    (pixel_desc_t) { .type = PIXEL_TYPE_BYTES, .bits = BITS, .is_target = TARGET, .r = R, .g = G, .b = B, .a = A }
+
+/* Byte formats with the channels at constant offsets, alpha -1 is opaque */
+#define FETCH_BYTES_DEF(NAME, R, G, B, A, SIZE)                                       \
+    static uint32_t fetch_##NAME(const uint8_t* row, int x)                            \
+    {                                                                                  \
+        const uint8_t* src = row + x * (SIZE);                                         \
+        uint32_t a = (A) < 0 ? 0xFF : src[(A) < 0 ? 0 : (A)];                          \
+        return a << 24 | (uint32_t)src[R] << 16 | (uint32_t)src[G] << 8 | src[B];     \
+    }
+
+/* 565 formats, LO_IS_R selects which of red and blue is in the low bits */
+#define FETCH_565_DEF(NAME, LO_IS_R, SIZE, HAS_ALPHA)                                  \
+    static uint32_t fetch_##NAME(const uint8_t* row, int x)                            \
+    {                                                                                  \
+        const uint8_t* src = row + x * (SIZE);                                         \
+        uint32_t value = src[0] | (uint32_t)src[1] << 8;                               \
+        uint32_t color = vg_lite_test_convert_565_to_bgra8888(value, LO_IS_R);         \
+        return (HAS_ALPHA) ? (color & 0xFFFFFF) | (uint32_t)src[2] << 24 : color;      \
+    }
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool vg_lite_cpu_pixel_is_supported(vg_lite_buffer_format_t format, bool is_target)
+{
+    pixel_desc_t desc = pixel_get_desc(format);
+    return desc.type != PIXEL_TYPE_UNKNOWN && (desc.is_target || !is_target);
+}
+
+void vg_lite_cpu_pixel_read_span(const vg_lite_buffer_t* buffer, int x, int y, int len, vg_lite_cpu_color_t* colors)
+{
+    pixel_desc_t desc = pixel_get_desc(buffer->format);
+    GPU_ASSERT(desc.type != PIXEL_TYPE_UNKNOWN);
+
+    for (int i = 0; i < len; i++) {
+        pixel_unpack(&desc, pixel_ptr(buffer, x + i, y, desc.bits), x + i, &colors[i]);
+    }
+}
+
+void vg_lite_cpu_pixel_write_span(vg_lite_buffer_t* buffer, int x, int y, int len, const vg_lite_cpu_color_t* colors)
+{
+    pixel_desc_t desc = pixel_get_desc(buffer->format);
+    GPU_ASSERT(desc.is_target);
+
+    for (int i = 0; i < len; i++) {
+        pixel_pack(&desc, &colors[i], pixel_ptr(buffer, x + i, y, desc.bits));
+    }
+}
+
+void vg_lite_cpu_pixel_fill_span(vg_lite_buffer_t* buffer, int x, int y, int len, const vg_lite_cpu_color_t* color)
+{
+    pixel_desc_t desc = pixel_get_desc(buffer->format);
+    GPU_ASSERT(desc.is_target);
+
+    uint8_t packed[4];
+    pixel_pack(&desc, color, packed);
+
+    if (buffer->tiled == VG_LITE_TILED) {
+        for (int i = 0; i < len; i++) {
+            memcpy(pixel_ptr(buffer, x + i, y, desc.bits), packed, desc.bits / 8);
+        }
+        return;
+    }
+
+    /* Whole-pixel stores in plain loops, which the compiler turns into vector stores */
+    uint8_t* dst = pixel_ptr(buffer, x, y, desc.bits);
+    switch (desc.bits) {
+    case 32: {
+        uint32_t value;
+        memcpy(&value, packed, sizeof(value));
+        uint32_t* dst32 = (uint32_t*)dst;
+        for (int i = 0; i < len; i++) {
+            dst32[i] = value;
+        }
+    } break;
+    case 16: {
+        uint16_t value;
+        memcpy(&value, packed, sizeof(value));
+        uint16_t* dst16 = (uint16_t*)dst;
+        for (int i = 0; i < len; i++) {
+            dst16[i] = value;
+        }
+    } break;
+    case 8:
+        memset(dst, packed[0], len);
+        break;
+    default:
+        for (int i = 0; i < len; i++) {
+            memcpy(dst, packed, desc.bits / 8);
+            dst += desc.bits / 8;
+        }
+        break;
+    }
+}
+
+void vg_lite_cpu_blend_span(vg_lite_blend_t blend, const vg_lite_cpu_color_t* src, vg_lite_cpu_color_t* dst, const float* coverage, int len)
+{
+    for (int i = 0; i < len; i++) {
+        vg_lite_cpu_color_t result;
+        blend_pixel(blend, &src[i], &dst[i], &result);
+
+        /* Partial coverage interpolates between the destination and the blend result */
+        float cov = coverage[i];
+        dst[i].r += (result.r - dst[i].r) * cov;
+        dst[i].g += (result.g - dst[i].g) * cov;
+        dst[i].b += (result.b - dst[i].b) * cov;
+        dst[i].a += (result.a - dst[i].a) * cov;
+    }
+}
+
+vg_lite_cpu_fetch_cb_t vg_lite_cpu_pixel_get_fetch(vg_lite_buffer_format_t format)
+{
+    switch (format) {
+    case VG_LITE_BGRA8888:
+        return fetch_bgra8888;
+    case VG_LITE_RGBA8888:
+        return fetch_rgba8888;
+    case VG_LITE_ARGB8888:
+        return fetch_argb8888;
+    case VG_LITE_ABGR8888:
+        return fetch_abgr8888;
+    case VG_LITE_BGRX8888:
+        return fetch_bgrx8888;
+    case VG_LITE_RGBX8888:
+        return fetch_rgbx8888;
+    case VG_LITE_BGR888:
+        return fetch_bgr888;
+    case VG_LITE_RGB888:
+        return fetch_rgb888;
+    case VG_LITE_BGR565:
+        return fetch_bgr565;
+    case VG_LITE_RGB565:
+        return fetch_rgb565;
+    case VG_LITE_BGRA5658:
+        return fetch_bgra5658;
+    case VG_LITE_RGBA5658:
+        return fetch_rgba5658;
+    case VG_LITE_A8:
+        return fetch_a8;
+    case VG_LITE_A4:
+        return fetch_a4;
+    case VG_LITE_L8:
+        return fetch_l8;
+    case VG_LITE_INDEX_8:
+        return fetch_index8;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
+vg_lite_cpu_color_t vg_lite_cpu_color_from_abgr(vg_lite_color_t color, bool premultiply)
+{
+    vg_lite_cpu_color_t result = {
+        .r = (color & 0xFF) / 255.0f,
+        .g = ((color >> 8) & 0xFF) / 255.0f,
+        .b = ((color >> 16) & 0xFF) / 255.0f,
+        .a = ((color >> 24) & 0xFF) / 255.0f,
+    };
+
+    if (premultiply) {
+        result.r *= result.a;
+        result.g *= result.a;
+        result.b *= result.a;
+    }
+
+    return result;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static pixel_desc_t pixel_get_desc(vg_lite_buffer_format_t format)
+{
+    switch (format) {
+    case VG_LITE_BGRA8888:
+        return BYTES_DESC(2, 1, 0, 3, 32, true);
+    case VG_LITE_RGBA8888:
+        return BYTES_DESC(0, 1, 2, 3, 32, true);
+    case VG_LITE_ARGB8888:
+        return BYTES_DESC(1, 2, 3, 0, 32, true);
+    case VG_LITE_ABGR8888:
+        return BYTES_DESC(3, 2, 1, 0, 32, true);
+    case VG_LITE_BGRX8888:
+        return BYTES_DESC(2, 1, 0, CHANNEL_NONE, 32, true);
+    case VG_LITE_RGBX8888:
+        return BYTES_DESC(0, 1, 2, CHANNEL_NONE, 32, true);
+    case VG_LITE_XRGB8888:
+        return BYTES_DESC(1, 2, 3, CHANNEL_NONE, 32, true);
+    case VG_LITE_XBGR8888:
+        return BYTES_DESC(3, 2, 1, CHANNEL_NONE, 32, true);
+    case VG_LITE_BGR888:
+        return BYTES_DESC(2, 1, 0, CHANNEL_NONE, 24, true);
+    case VG_LITE_RGB888:
+        return BYTES_DESC(0, 1, 2, CHANNEL_NONE, 24, true);
+    case VG_LITE_BGR565:
+        return (pixel_desc_t) { .type = PIXEL_TYPE_565, .bits = 16, .is_target = true, .r = false };
+    case VG_LITE_RGB565:
+        return (pixel_desc_t) { .type = PIXEL_TYPE_565, .bits = 16, .is_target = true, .r = true };
+    case VG_LITE_BGRA5658:
+        return (pixel_desc_t) { .type = PIXEL_TYPE_5658, .bits = 24, .is_target = true, .r = false };
+    case VG_LITE_RGBA5658:
+        return (pixel_desc_t) { .type = PIXEL_TYPE_5658, .bits = 24, .is_target = true, .r = true };
+    case VG_LITE_A8:
+        return (pixel_desc_t) { .type = PIXEL_TYPE_A8, .bits = 8, .is_target = true };
+    case VG_LITE_A4:
+        return (pixel_desc_t) { .type = PIXEL_TYPE_A4, .bits = 4 };
+    case VG_LITE_L8:
+        return (pixel_desc_t) { .type = PIXEL_TYPE_L8, .bits = 8 };
+    case VG_LITE_INDEX_8:
+        return (pixel_desc_t) { .type = PIXEL_TYPE_INDEX_8, .bits = 8 };
+    default:
+        break;
+    }
+
+    return (pixel_desc_t) { .type = PIXEL_TYPE_UNKNOWN };
+}
+
+static inline uint8_t* pixel_ptr(const vg_lite_buffer_t* buffer, int x, int y, int bits)
+{
+    size_t index;
+
+    if (buffer->tiled == VG_LITE_TILED) {
+        /* 4x4 tiles, a row of tiles covers 4 lines of the stride */
+        index = ((size_t)(x >> 2) << 4) + ((y & 3) << 2) + (x & 3);
+        return (uint8_t*)buffer->memory + (size_t)(y & ~3) * buffer->stride + index * bits / 8;
+    }
+
+    index = (size_t)x;
+    return (uint8_t*)buffer->memory + (size_t)y * buffer->stride + index * bits / 8;
+}
+
+static inline uint8_t float_to_u8(float value)
+{
+    return (uint8_t)(MATH_MIN(MATH_MAX(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+}
+
+static void pixel_pack(const pixel_desc_t* desc, const vg_lite_cpu_color_t* color, uint8_t* dst)
+{
+    switch (desc->type) {
+    case PIXEL_TYPE_BYTES:
+        dst[desc->r] = float_to_u8(color->r);
+        dst[desc->g] = float_to_u8(color->g);
+        dst[desc->b] = float_to_u8(color->b);
+        if (desc->bits == 32) {
+            /* The X byte of formats without alpha is written opaque */
+            dst[desc->a == CHANNEL_NONE ? 6 - desc->r - desc->g - desc->b : desc->a]
+                = desc->a == CHANNEL_NONE ? 0xFF : float_to_u8(color->a);
+        }
+        break;
+    case PIXEL_TYPE_565:
+    case PIXEL_TYPE_5658: {
+        uint16_t lo = float_to_u8(desc->r ? color->r : color->b) >> 3;
+        uint16_t hi = float_to_u8(desc->r ? color->b : color->r) >> 3;
+        uint16_t value = lo | (uint16_t)(float_to_u8(color->g) >> 2) << 5 | hi << 11;
+        memcpy(dst, &value, sizeof(value));
+        if (desc->type == PIXEL_TYPE_5658) {
+            dst[2] = float_to_u8(color->a);
+        }
+    } break;
+    case PIXEL_TYPE_A8:
+        dst[0] = float_to_u8(color->a);
+        break;
+    default:
+        GPU_ASSERT(false);
+        break;
+    }
+}
+
+static void pixel_unpack(const pixel_desc_t* desc, const uint8_t* src, int x, vg_lite_cpu_color_t* color)
+{
+    switch (desc->type) {
+    case PIXEL_TYPE_BYTES:
+        color->r = src[desc->r] / 255.0f;
+        color->g = src[desc->g] / 255.0f;
+        color->b = src[desc->b] / 255.0f;
+        color->a = desc->a == CHANNEL_NONE ? 1.0f : src[desc->a] / 255.0f;
+        break;
+    case PIXEL_TYPE_565:
+    case PIXEL_TYPE_5658: {
+        uint16_t value;
+        memcpy(&value, src, sizeof(value));
+        uint32_t c32 = vg_lite_test_convert_565_to_bgra8888(value, desc->r);
+        color->r = ((c32 >> 16) & 0xFF) / 255.0f;
+        color->g = ((c32 >> 8) & 0xFF) / 255.0f;
+        color->b = (c32 & 0xFF) / 255.0f;
+        color->a = desc->type == PIXEL_TYPE_5658 ? src[2] / 255.0f : 1.0f;
+    } break;
+    case PIXEL_TYPE_A8:
+    case PIXEL_TYPE_A4:
+        /* Alpha only images are white, a mix color gives them their color */
+        color->r = color->g = color->b = 1.0f;
+        color->a = desc->type == PIXEL_TYPE_A8 ? src[0] / 255.0f : ((src[0] >> ((x & 1) * 4)) & 0xF) / 15.0f;
+        break;
+    case PIXEL_TYPE_L8:
+        color->r = color->g = color->b = src[0] / 255.0f;
+        color->a = 1.0f;
+        break;
+    case PIXEL_TYPE_INDEX_8: {
+        /* The lookup table is ARGB8888 */
+        uint32_t value = vg_lite_cpu_get_clut()[src[0]];
+        color->b = (value & 0xFF) / 255.0f;
+        color->g = ((value >> 8) & 0xFF) / 255.0f;
+        color->r = ((value >> 16) & 0xFF) / 255.0f;
+        color->a = (value >> 24) / 255.0f;
+    } break;
+    default:
+        GPU_ASSERT(false);
+        break;
+    }
+}
+
+static inline void blend_pixel(vg_lite_blend_t blend, const vg_lite_cpu_color_t* s, const vg_lite_cpu_color_t* d, vg_lite_cpu_color_t* r)
+{
+    /* Premultiplied Porter-Duff and separable modes, the alpha of the color modes is SRC_OVER */
+    const float inv_sa = 1.0f - s->a;
+    const float inv_da = 1.0f - d->a;
+    const float src_over_a = s->a + d->a * inv_sa;
+
+    /* One color channel per mode, from the source channel sc and the destination channel dc */
+#define MIX_SRC_OVER(sc, dc) ((sc) + (dc) * inv_sa)
+#define MIX_DST_OVER(sc, dc) ((sc) * inv_da + (dc))
+#define MIX_SRC_IN(sc, dc) ((sc) * d->a)
+#define MIX_DST_IN(sc, dc) ((dc) * s->a)
+#define MIX_MULTIPLY(sc, dc) ((sc) * inv_da + (dc) * inv_sa + (sc) * (dc))
+#define MIX_SCREEN(sc, dc) ((sc) + (dc) - (sc) * (dc))
+#define MIX_DARKEN(sc, dc) MATH_MIN((sc) + (dc) * inv_sa, (dc) + (sc) * inv_da)
+#define MIX_LIGHTEN(sc, dc) MATH_MAX((sc) + (dc) * inv_sa, (dc) + (sc) * inv_da)
+#define MIX_ADDITIVE(sc, dc) MATH_MIN((sc) + (dc), 1.0f)
+#define MIX_SUBTRACT(sc, dc) ((dc) * (1.0f - (sc)))
+#define MIX_SUBTRACT_LVGL(sc, dc) MATH_MAX((dc) - (sc), 0.0f)
+#define MIX_MULTIPLY_LVGL(sc, dc) ((sc) * (dc) + (dc) * inv_sa)
+
+#define BLEND_COLOR(MIX, ALPHA)       \
+    do {                              \
+        r->r = MIX(s->r, d->r);       \
+        r->g = MIX(s->g, d->g);       \
+        r->b = MIX(s->b, d->b);       \
+        r->a = (ALPHA);               \
+    } while (0)
+
+    switch (blend) {
+    case VG_LITE_BLEND_NONE:
+        *r = *s;
+        break;
+    case VG_LITE_BLEND_SRC_OVER:
+    case VG_LITE_BLEND_NORMAL_LVGL:
+        BLEND_COLOR(MIX_SRC_OVER, src_over_a);
+        break;
+    case VG_LITE_BLEND_DST_OVER:
+        BLEND_COLOR(MIX_DST_OVER, src_over_a);
+        break;
+    case VG_LITE_BLEND_SRC_IN:
+        BLEND_COLOR(MIX_SRC_IN, s->a * d->a);
+        break;
+    case VG_LITE_BLEND_DST_IN:
+        BLEND_COLOR(MIX_DST_IN, d->a * s->a);
+        break;
+    case VG_LITE_BLEND_MULTIPLY:
+        BLEND_COLOR(MIX_MULTIPLY, src_over_a);
+        break;
+    case VG_LITE_BLEND_SCREEN:
+        BLEND_COLOR(MIX_SCREEN, src_over_a);
+        break;
+    case VG_LITE_BLEND_DARKEN:
+        BLEND_COLOR(MIX_DARKEN, src_over_a);
+        break;
+    case VG_LITE_BLEND_LIGHTEN:
+        BLEND_COLOR(MIX_LIGHTEN, src_over_a);
+        break;
+    case VG_LITE_BLEND_ADDITIVE:
+        BLEND_COLOR(MIX_ADDITIVE, MATH_MIN(s->a + d->a, 1.0f));
+        break;
+    case VG_LITE_BLEND_SUBTRACT:
+        BLEND_COLOR(MIX_SUBTRACT, d->a * inv_sa);
+        break;
+    case VG_LITE_BLEND_ADDITIVE_LVGL:
+        BLEND_COLOR(MIX_ADDITIVE, src_over_a);
+        break;
+    case VG_LITE_BLEND_SUBTRACT_LVGL:
+        BLEND_COLOR(MIX_SUBTRACT_LVGL, src_over_a);
+        break;
+    case VG_LITE_BLEND_MULTIPLY_LVGL:
+        BLEND_COLOR(MIX_MULTIPLY_LVGL, src_over_a);
+        break;
+    default:
+        *r = *d;
+        break;
+    }
+
+#undef BLEND_COLOR
+#undef MIX_SRC_OVER
+#undef MIX_DST_OVER
+#undef MIX_SRC_IN
+#undef MIX_DST_IN
+#undef MIX_MULTIPLY
+#undef MIX_SCREEN
+#undef MIX_DARKEN
+#undef MIX_LIGHTEN
+#undef MIX_ADDITIVE
+#undef MIX_SUBTRACT
+#undef MIX_SUBTRACT_LVGL
+#undef MIX_MULTIPLY_LVGL
+}
+
+FETCH_BYTES_DEF(bgra8888, 2, 1, 0, 3, 4)
+FETCH_BYTES_DEF(rgba8888, 0, 1, 2, 3, 4)
+FETCH_BYTES_DEF(argb8888, 1, 2, 3, 0, 4)
+FETCH_BYTES_DEF(abgr8888, 3, 2, 1, 0, 4)
+FETCH_BYTES_DEF(bgrx8888, 2, 1, 0, -1, 4)
+FETCH_BYTES_DEF(rgbx8888, 0, 1, 2, -1, 4)
+FETCH_BYTES_DEF(bgr888, 2, 1, 0, -1, 3)
+FETCH_BYTES_DEF(rgb888, 0, 1, 2, -1, 3)
+
+FETCH_565_DEF(bgr565, false, 2, false)
+FETCH_565_DEF(rgb565, true, 2, false)
+FETCH_565_DEF(bgra5658, false, 3, true)
+FETCH_565_DEF(rgba5658, true, 3, true)
+
+static uint32_t fetch_a8(const uint8_t* row, int x)
+{
+    /* White with alpha, like pixel_unpack */
+    return (uint32_t)row[x] << 24 | 0xFFFFFF;
+}
+
+static uint32_t fetch_a4(const uint8_t* row, int x)
+{
+    uint32_t a = (row[x >> 1] >> ((x & 1) * 4)) & 0xF;
+    return (a * 0x11) << 24 | 0xFFFFFF;
+}
+
+static uint32_t fetch_l8(const uint8_t* row, int x)
+{
+    return 0xFF000000 | row[x] * 0x010101u;
+}
+
+static uint32_t fetch_index8(const uint8_t* row, int x)
+{
+    /* The lookup table is already ARGB8888 */
+    return vg_lite_cpu_get_clut()[row[x]];
+}
+
+#endif /* GPU_TEST_VG_LITE_CPU_ENABLE || GPU_TEST_VG_LITE_CPU_REF_ENABLE */
@@ -0,0 +1,690 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#if defined(GPU_TEST_VG_LITE_CPU_ENABLE) || defined(GPU_TEST_VG_LITE_CPU_REF_ENABLE)
+
+#include "vg_lite_cpu.h"
+#include "../../gpu_assert.h"
+#include "../../gpu_log.h"
+#include "../../gpu_math.h"
+#include "../vg_lite_test_flatten.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define EDGE_COUNT_MIN 64
+
+/* Rows per band, a worker fetches one band at a time */
+#define BAND_HEIGHT 8
+
+/* Draws with fewer rows are not worth waking up the workers */
+#define PARALLEL_ROWS_MIN 32
+
+#define SPAN_LEN_MAX 256
+#define CROSSING_SORT_INSERTION_MAX 16
+#define COVERAGE_FULL (1.0f - 1e-4f)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    float x0;
+    float y0;
+    float y1;
+    float dxdy;
+    int dir;
+} raster_edge_t;
+
+struct vg_lite_cpu_edges_s {
+    raster_edge_t* edges;
+    uint32_t count;
+    uint32_t capacity;
+    float start_x;
+    float start_y;
+    float cur_x;
+    float cur_y;
+    bool has_start;
+    float min_x;
+    float min_y;
+    float max_x;
+    float max_y;
+};
+
+typedef struct {
+    float x;
+    int dir;
+} raster_crossing_t;
+
+typedef struct {
+    /* Coverage of the partial pixels, and coverage steps of the covered runs */
+    float* area;
+    float* step;
+    float* coverage;
+    int width_capacity;
+
+    uint32_t* active;
+    raster_crossing_t* crossings;
+    uint32_t edge_capacity;
+
+    vg_lite_cpu_color_t src[SPAN_LEN_MAX];
+    vg_lite_cpu_color_t dst[SPAN_LEN_MAX];
+} raster_scratch_t;
+
+typedef struct {
+    const vg_lite_cpu_draw_t* draw;
+    const struct vg_lite_cpu_edges_s* edges;
+    int x1;
+    int x2;
+    int y1;
+    int y2;
+    int band_count;
+    int next_band;
+    bool fast_fill;
+
+    /* Set for the row jobs of vg_lite_cpu_raster_run_rows */
+    vg_lite_cpu_rows_cb_t rows_cb;
+    void* user_data;
+} raster_job_t;
+
+typedef struct {
+    bool started;
+    pthread_t threads[VG_LITE_CPU_THREAD_COUNT];
+    int thread_count;
+    pthread_mutex_t lock;
+    pthread_cond_t start_cond;
+    pthread_cond_t done_cond;
+    uint32_t generation;
+    int pending;
+    bool quit;
+    raster_job_t* job;
+} raster_pool_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void edges_add_line(struct vg_lite_cpu_edges_s* edges, float x0, float y0, float x1, float y1);
+static void edges_close(struct vg_lite_cpu_edges_s* edges);
+static void edges_flatten_cb(void* user_data, uint8_t op_code, float x, float y);
+static int edge_compare(const void* a, const void* b);
+static int crossing_compare(const void* a, const void* b);
+static void scratch_reserve(raster_scratch_t* scratch, int width, uint32_t edge_count);
+static void raster_run_job(raster_job_t* job, int worker_count);
+static void raster_run_bands(raster_job_t* job, int worker);
+static void raster_band(raster_job_t* job, raster_scratch_t* scratch, int y_start, int y_end);
+static void raster_add_span(raster_scratch_t* scratch, int width, int samples, float xa, float xb, int* min_x, int* max_x);
+static void raster_compose_row(raster_job_t* job, raster_scratch_t* scratch, int y, int min_x, int max_x);
+static void* raster_worker(void* arg);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static raster_pool_t g_pool;
+static raster_scratch_t g_scratch[VG_LITE_CPU_THREAD_COUNT];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void vg_lite_cpu_raster_init(void)
+{
+    if (g_pool.started) {
+        return;
+    }
+
+    pthread_mutex_init(&g_pool.lock, NULL);
+    pthread_cond_init(&g_pool.start_cond, NULL);
+    pthread_cond_init(&g_pool.done_cond, NULL);
+    g_pool.quit = false;
+
+    /* The calling thread is worker 0 */
+    g_pool.thread_count = 1;
+    for (int i = 1; i < VG_LITE_CPU_THREAD_COUNT; i++) {
+        int ret = pthread_create(&g_pool.threads[i], NULL, raster_worker, (void*)(intptr_t)i);
+        if (ret != 0) {
+            /* Run with the workers that did start */
+            GPU_LOG_ERROR("Create raster worker %d failed: %d", i, ret);
+            break;
+        }
+
+        g_pool.thread_count++;
+    }
+
+    g_pool.started = true;
+}
+
+void vg_lite_cpu_raster_deinit(void)
+{
+    if (!g_pool.started) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_pool.lock);
+    g_pool.quit = true;
+    pthread_cond_broadcast(&g_pool.start_cond);
+    pthread_mutex_unlock(&g_pool.lock);
+
+    for (int i = 1; i < g_pool.thread_count; i++) {
+        pthread_join(g_pool.threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&g_pool.done_cond);
+    pthread_cond_destroy(&g_pool.start_cond);
+    pthread_mutex_destroy(&g_pool.lock);
+    g_pool.started = false;
+
+    for (int i = 0; i < VG_LITE_CPU_THREAD_COUNT; i++) {
+        raster_scratch_t* scratch = &g_scratch[i];
+        free(scratch->area);
+        free(scratch->step);
+        free(scratch->coverage);
+        free(scratch->active);
+        free(scratch->crossings);
+        memset(scratch, 0, sizeof(raster_scratch_t));
+    }
+}
+
+struct vg_lite_cpu_edges_s* vg_lite_cpu_edges_create(void)
+{
+    struct vg_lite_cpu_edges_s* edges = calloc(1, sizeof(struct vg_lite_cpu_edges_s));
+    GPU_ASSERT_NULL(edges);
+    vg_lite_cpu_edges_reset(edges);
+    return edges;
+}
+
+void vg_lite_cpu_edges_destroy(struct vg_lite_cpu_edges_s* edges)
+{
+    GPU_ASSERT_NULL(edges);
+    free(edges->edges);
+    free(edges);
+}
+
+void vg_lite_cpu_edges_reset(struct vg_lite_cpu_edges_s* edges)
+{
+    GPU_ASSERT_NULL(edges);
+    edges->count = 0;
+    edges->has_start = false;
+    edges->min_x = edges->min_y = INFINITY;
+    edges->max_x = edges->max_y = -INFINITY;
+}
+
+bool vg_lite_cpu_edges_add_path(struct vg_lite_cpu_edges_s* edges, const vg_lite_path_t* path, const vg_lite_matrix_t* matrix)
+{
+    GPU_ASSERT_NULL(edges);
+    GPU_ASSERT_NULL(path);
+
+    bool retval = vg_lite_test_flatten_path(path, matrix, VG_LITE_TEST_FLATTEN_TOLERANCE, edges_flatten_cb, edges, NULL);
+
+    /* A fill closes every subpath */
+    edges_close(edges);
+    edges->has_start = false;
+    return retval;
+}
+
+void vg_lite_cpu_edges_add_polygon(struct vg_lite_cpu_edges_s* edges, const float* points, int count)
+{
+    GPU_ASSERT_NULL(edges);
+    GPU_ASSERT_NULL(points);
+
+    for (int i = 0; i < count; i++) {
+        int next = (i + 1) % count;
+        edges_add_line(edges, points[i * 2], points[i * 2 + 1], points[next * 2], points[next * 2 + 1]);
+    }
+}
+
+void vg_lite_cpu_raster_fill(const vg_lite_cpu_draw_t* draw, struct vg_lite_cpu_edges_s* edges)
+{
+    GPU_ASSERT_NULL(draw);
+    GPU_ASSERT_NULL(edges);
+
+    if (!edges->count) {
+        return;
+    }
+
+    /* Only the rows and columns the outline touches */
+    int x1 = MATH_MAX(draw->clip_x1, (int)floorf(edges->min_x));
+    int x2 = MATH_MIN(draw->clip_x2, (int)ceilf(edges->max_x) + 1);
+    int y1 = MATH_MAX(draw->clip_y1, (int)floorf(edges->min_y));
+    int y2 = MATH_MIN(draw->clip_y2, (int)ceilf(edges->max_y));
+    if (x1 >= x2 || y1 >= y2) {
+        return;
+    }
+
+    qsort(edges->edges, edges->count, sizeof(raster_edge_t), edge_compare);
+
+    const vg_lite_cpu_paint_t* paint = draw->paint;
+    raster_job_t job = {
+        .draw = draw,
+        .edges = edges,
+        .x1 = x1,
+        .x2 = x2,
+        .y1 = y1,
+        .y2 = y2,
+        .band_count = (y2 - y1 + BAND_HEIGHT - 1) / BAND_HEIGHT,
+        .next_band = 0,
+        /* Covered pixels of an opaque solid color are stored without blending */
+        .fast_fill = paint->cb == vg_lite_cpu_paint_solid
+            && paint->color.a >= 1.0f
+            && (draw->blend == VG_LITE_BLEND_SRC_OVER || draw->blend == VG_LITE_BLEND_NONE),
+    };
+
+    int worker_count = (g_pool.started && y2 - y1 >= PARALLEL_ROWS_MIN) ? g_pool.thread_count : 1;
+    for (int i = 0; i < worker_count; i++) {
+        scratch_reserve(&g_scratch[i], x2 - x1, edges->count);
+    }
+
+    raster_run_job(&job, worker_count);
+}
+
+void vg_lite_cpu_raster_run_rows(int y1, int y2, vg_lite_cpu_rows_cb_t cb, void* user_data)
+{
+    GPU_ASSERT_NULL(cb);
+
+    if (y1 >= y2) {
+        return;
+    }
+
+    raster_job_t job = {
+        .y1 = y1,
+        .y2 = y2,
+        .band_count = (y2 - y1 + BAND_HEIGHT - 1) / BAND_HEIGHT,
+        .next_band = 0,
+        .rows_cb = cb,
+        .user_data = user_data,
+    };
+
+    raster_run_job(&job, (g_pool.started && y2 - y1 >= PARALLEL_ROWS_MIN) ? g_pool.thread_count : 1);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void edges_add_line(struct vg_lite_cpu_edges_s* edges, float x0, float y0, float x1, float y1)
+{
+    if (y0 == y1 || !isfinite(x0) || !isfinite(y0) || !isfinite(x1) || !isfinite(y1)) {
+        return;
+    }
+
+    if (edges->count == edges->capacity) {
+        uint32_t capacity = MATH_MAX(edges->capacity * 2, EDGE_COUNT_MIN);
+        raster_edge_t* new_edges = realloc(edges->edges, capacity * sizeof(raster_edge_t));
+        GPU_ASSERT_NULL(new_edges);
+        edges->edges = new_edges;
+        edges->capacity = capacity;
+    }
+
+    raster_edge_t* edge = &edges->edges[edges->count++];
+    edge->dir = y1 > y0 ? 1 : -1;
+    if (y1 < y0) {
+        float tmp = x0;
+        x0 = x1;
+        x1 = tmp;
+        tmp = y0;
+        y0 = y1;
+        y1 = tmp;
+    }
+
+    edge->x0 = x0;
+    edge->y0 = y0;
+    edge->y1 = y1;
+    edge->dxdy = (x1 - x0) / (y1 - y0);
+
+    edges->min_x = MATH_MIN(edges->min_x, MATH_MIN(x0, x1));
+    edges->max_x = MATH_MAX(edges->max_x, MATH_MAX(x0, x1));
+    edges->min_y = MATH_MIN(edges->min_y, y0);
+    edges->max_y = MATH_MAX(edges->max_y, y1);
+}
+
+static void edges_close(struct vg_lite_cpu_edges_s* edges)
+{
+    if (edges->has_start) {
+        edges_add_line(edges, edges->cur_x, edges->cur_y, edges->start_x, edges->start_y);
+        edges->cur_x = edges->start_x;
+        edges->cur_y = edges->start_y;
+    }
+}
+
+static void edges_flatten_cb(void* user_data, uint8_t op_code, float x, float y)
+{
+    struct vg_lite_cpu_edges_s* edges = user_data;
+
+    switch (op_code) {
+    case VLC_OP_MOVE:
+        edges_close(edges);
+        edges->start_x = edges->cur_x = x;
+        edges->start_y = edges->cur_y = y;
+        edges->has_start = true;
+        break;
+    case VLC_OP_LINE:
+        edges_add_line(edges, edges->cur_x, edges->cur_y, x, y);
+        edges->cur_x = x;
+        edges->cur_y = y;
+        break;
+    case VLC_OP_CLOSE:
+        edges_close(edges);
+        break;
+    default:
+        break;
+    }
+}
+
+static int edge_compare(const void* a, const void* b)
+{
+    float y_a = ((const raster_edge_t*)a)->y0;
+    float y_b = ((const raster_edge_t*)b)->y0;
+    return (y_a > y_b) - (y_a < y_b);
+}
+
+static int crossing_compare(const void* a, const void* b)
+{
+    float x_a = ((const raster_crossing_t*)a)->x;
+    float x_b = ((const raster_crossing_t*)b)->x;
+    return (x_a > x_b) - (x_a < x_b);
+}
+
+static void scratch_reserve(raster_scratch_t* scratch, int width, uint32_t edge_count)
+{
+    /* One extra cell takes the end steps of spans reaching the right edge */
+    if (width + 1 > scratch->width_capacity) {
+        int capacity = width + 1;
+        free(scratch->area);
+        free(scratch->step);
+        free(scratch->coverage);
+        scratch->area = calloc(capacity, sizeof(float));
+        scratch->step = calloc(capacity, sizeof(float));
+        scratch->coverage = malloc(capacity * sizeof(float));
+        GPU_ASSERT_NULL(scratch->area);
+        GPU_ASSERT_NULL(scratch->step);
+        GPU_ASSERT_NULL(scratch->coverage);
+        scratch->width_capacity = capacity;
+    }
+
+    if (edge_count > scratch->edge_capacity) {
+        free(scratch->active);
+        free(scratch->crossings);
+        scratch->active = malloc(edge_count * sizeof(uint32_t));
+        scratch->crossings = malloc(edge_count * sizeof(raster_crossing_t));
+        GPU_ASSERT_NULL(scratch->active);
+        GPU_ASSERT_NULL(scratch->crossings);
+        scratch->edge_capacity = edge_count;
+    }
+}
+
+static void raster_run_job(raster_job_t* job, int worker_count)
+{
+    if (worker_count == 1) {
+        raster_run_bands(job, 0);
+        return;
+    }
+
+    pthread_mutex_lock(&g_pool.lock);
+    g_pool.job = job;
+    g_pool.pending = worker_count - 1;
+    g_pool.generation++;
+    pthread_cond_broadcast(&g_pool.start_cond);
+    pthread_mutex_unlock(&g_pool.lock);
+
+    raster_run_bands(job, 0);
+
+    pthread_mutex_lock(&g_pool.lock);
+    while (g_pool.pending > 0) {
+        pthread_cond_wait(&g_pool.done_cond, &g_pool.lock);
+    }
+    g_pool.job = NULL;
+    pthread_mutex_unlock(&g_pool.lock);
+}
+
+static void raster_run_bands(raster_job_t* job, int worker)
+{
+    raster_scratch_t* scratch = &g_scratch[worker];
+
+    while (true) {
+        int band = __atomic_fetch_add(&job->next_band, 1, __ATOMIC_RELAXED);
+        if (band >= job->band_count) {
+            break;
+        }
+
+        int y_start = job->y1 + band * BAND_HEIGHT;
+        int y_end = MATH_MIN(y_start + BAND_HEIGHT, job->y2);
+
+        if (job->rows_cb) {
+            job->rows_cb(job->user_data, y_start, y_end);
+        } else {
+            raster_band(job, scratch, y_start, y_end);
+        }
+    }
+}
+
+static void raster_band(raster_job_t* job, raster_scratch_t* scratch, int y_start, int y_end)
+{
+    const vg_lite_cpu_draw_t* draw = job->draw;
+    const raster_edge_t* edges = job->edges->edges;
+    const uint32_t edge_count = job->edges->count;
+    const int width = job->x2 - job->x1;
+    const int samples = draw->samples;
+
+    uint32_t next = 0;
+    uint32_t active_count = 0;
+
+    for (int y = y_start; y < y_end; y++) {
+        int min_x = width;
+        int max_x = -1;
+
+        for (int s = 0; s < samples; s++) {
+            float sample_y = y + (s + 0.5f) / samples;
+
+            /* Activate the edges starting above this sub-scanline */
+            while (next < edge_count && edges[next].y0 <= sample_y) {
+                if (edges[next].y1 > sample_y) {
+                    scratch->active[active_count++] = next;
+                }
+                next++;
+            }
+
+            uint32_t crossing_count = 0;
+            for (uint32_t i = 0; i < active_count;) {
+                const raster_edge_t* edge = &edges[scratch->active[i]];
+                if (edge->y1 <= sample_y) {
+                    scratch->active[i] = scratch->active[--active_count];
+                    continue;
+                }
+
+                raster_crossing_t* crossing = &scratch->crossings[crossing_count++];
+                crossing->x = edge->x0 + (sample_y - edge->y0) * edge->dxdy - job->x1;
+                crossing->dir = edge->dir;
+                i++;
+            }
+
+            if (crossing_count <= CROSSING_SORT_INSERTION_MAX) {
+                for (uint32_t i = 1; i < crossing_count; i++) {
+                    raster_crossing_t key = scratch->crossings[i];
+                    uint32_t j = i;
+                    while (j > 0 && scratch->crossings[j - 1].x > key.x) {
+                        scratch->crossings[j] = scratch->crossings[j - 1];
+                        j--;
+                    }
+                    scratch->crossings[j] = key;
+                }
+            } else {
+                qsort(scratch->crossings, crossing_count, sizeof(raster_crossing_t), crossing_compare);
+            }
+
+            int winding = 0;
+            float span_start = 0;
+            for (uint32_t i = 0; i < crossing_count; i++) {
+                bool was_inside = draw->fill_rule == VG_LITE_FILL_EVEN_ODD ? (winding & 1) : winding != 0;
+                winding += scratch->crossings[i].dir;
+                bool is_inside = draw->fill_rule == VG_LITE_FILL_EVEN_ODD ? (winding & 1) : winding != 0;
+
+                if (is_inside && !was_inside) {
+                    span_start = scratch->crossings[i].x;
+                } else if (!is_inside && was_inside) {
+                    raster_add_span(scratch, width, samples, span_start, scratch->crossings[i].x, &min_x, &max_x);
+                }
+            }
+        }
+
+        if (max_x >= min_x) {
+            raster_compose_row(job, scratch, y, min_x, max_x + 1);
+        }
+    }
+}
+
+static void raster_add_span(raster_scratch_t* scratch, int width, int samples, float xa, float xb, int* min_x, int* max_x)
+{
+    xa = MATH_MAX(xa, 0.0f);
+    xb = MATH_MIN(xb, (float)width);
+    if (xb <= xa) {
+        return;
+    }
+
+    int ia;
+    int ib;
+
+    if (samples == 1) {
+        /* Pixels whose centers are inside */
+        ia = (int)ceilf(xa - 0.5f);
+        ib = (int)ceilf(xb - 0.5f);
+        if (ib <= ia) {
+            return;
+        }
+
+        scratch->step[ia] += 1.0f;
+        scratch->step[ib] -= 1.0f;
+        ib--;
+    } else {
+        /* Exact horizontal coverage, the partial end pixels go to area */
+        const float weight = 1.0f / samples;
+        ia = (int)xa;
+        ib = (int)xb;
+
+        if (ia == ib) {
+            scratch->area[ia] += (xb - xa) * weight;
+        } else {
+            scratch->area[ia] += (ia + 1 - xa) * weight;
+            scratch->step[ia + 1] += weight;
+            scratch->step[ib] -= weight;
+            scratch->area[ib] += (xb - ib) * weight;
+        }
+
+        ib = MATH_MIN(ib, width - 1);
+    }
+
+    *min_x = MATH_MIN(*min_x, ia);
+    *max_x = MATH_MAX(*max_x, ib);
+}
+
+static void raster_compose_row(raster_job_t* job, raster_scratch_t* scratch, int y, int min_x, int max_x)
+{
+    const vg_lite_cpu_draw_t* draw = job->draw;
+    float* coverage = scratch->coverage;
+
+    /* Resolve the coverage and clear the accumulators for the next row */
+    float cover = 0;
+    for (int x = min_x; x < max_x; x++) {
+        cover += scratch->step[x];
+        coverage[x] = MATH_MIN(MATH_MAX(cover + scratch->area[x], 0.0f), 1.0f);
+        scratch->step[x] = 0;
+        scratch->area[x] = 0;
+    }
+
+    scratch->step[max_x] = 0;
+    scratch->area[max_x] = 0;
+
+    int x = min_x;
+    while (x < max_x) {
+        if (coverage[x] <= 0) {
+            x++;
+            continue;
+        }
+
+        if (job->fast_fill && coverage[x] >= COVERAGE_FULL) {
+            int end = x + 1;
+            while (end < max_x && coverage[end] >= COVERAGE_FULL) {
+                end++;
+            }
+
+            vg_lite_cpu_pixel_fill_span(draw->target, job->x1 + x, y, end - x, &draw->paint->color);
+            x = end;
+            continue;
+        }
+
+        /* A run of partial pixels, or of any pixel without the fast path */
+        int end = x + 1;
+        while (end < max_x && end - x < SPAN_LEN_MAX && coverage[end] > 0
+            && !(job->fast_fill && coverage[end] >= COVERAGE_FULL)) {
+            end++;
+        }
+
+        int len = end - x;
+        draw->paint->cb(draw->paint, job->x1 + x, y, len, scratch->src);
+        vg_lite_cpu_pixel_read_span(draw->target, job->x1 + x, y, len, scratch->dst);
+        vg_lite_cpu_blend_span(draw->blend, scratch->src, scratch->dst, &coverage[x], len);
+        vg_lite_cpu_pixel_write_span(draw->target, job->x1 + x, y, len, scratch->dst);
+        x = end;
+    }
+}
+
+static void* raster_worker(void* arg)
+{
+    int worker = (int)(intptr_t)arg;
+    uint32_t generation = 0;
+
+    pthread_mutex_lock(&g_pool.lock);
+
+    while (true) {
+        while (!g_pool.quit && g_pool.generation == generation) {
+            pthread_cond_wait(&g_pool.start_cond, &g_pool.lock);
+        }
+
+        if (g_pool.quit) {
+            break;
+        }
+
+        generation = g_pool.generation;
+        raster_job_t* job = g_pool.job;
+        pthread_mutex_unlock(&g_pool.lock);
+
+        raster_run_bands(job, worker);
+
+        pthread_mutex_lock(&g_pool.lock);
+        if (--g_pool.pending == 0) {
+            pthread_cond_signal(&g_pool.done_cond);
+        }
+    }
+
+    pthread_mutex_unlock(&g_pool.lock);
+    return NULL;
+}
+
+#endif /* GPU_TEST_VG_LITE_CPU_ENABLE || GPU_TEST_VG_LITE_CPU_REF_ENABLE */
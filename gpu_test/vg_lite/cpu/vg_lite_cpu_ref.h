@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VG_LITE_CPU_REF_H
+#define VG_LITE_CPU_REF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <stdbool.h>
+#include <vg_lite.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Start the raster threads of the CPU backend.
+ */
+void vg_lite_cpu_init(void);
+
+/**
+ * @brief Stop the raster threads of the CPU backend and free its memory.
+ */
+void vg_lite_cpu_deinit(void);
+
+#ifdef GPU_TEST_VG_LITE_CPU_REF_ENABLE
+
+/**
+ * @brief Route the VG-Lite calls of the test code to the CPU backend.
+ * @param enable True to replay on the CPU, false to go back to the GPU.
+ * @note Only calls compiled with this header are routed, see the macros below.
+ */
+void vg_lite_cpu_set_replay(bool enable);
+
+/**
+ * @brief Check if the VG-Lite calls are routed to the CPU backend.
+ * @return True while replaying on the CPU.
+ */
+bool vg_lite_cpu_is_replay(void);
+
+/* The CPU backend entry points, same semantics as their vg_lite_* counterparts */
+
+vg_lite_error_t vg_lite_cpu_init_path(vg_lite_path_t* path, vg_lite_format_t data_format, vg_lite_quality_t quality,
+    vg_lite_uint32_t path_length, vg_lite_pointer path_data,
+    vg_lite_float_t min_x, vg_lite_float_t min_y, vg_lite_float_t max_x, vg_lite_float_t max_y);
+vg_lite_error_t vg_lite_cpu_clear_path(vg_lite_path_t* path);
+vg_lite_error_t vg_lite_cpu_set_path_type(vg_lite_path_t* path, vg_lite_path_type_t path_type);
+vg_lite_error_t vg_lite_cpu_set_stroke(vg_lite_path_t* path, vg_lite_cap_style_t cap_style, vg_lite_join_style_t join_style,
+    vg_lite_float_t line_width, vg_lite_float_t miter_limit, vg_lite_float_t* dash_pattern, vg_lite_uint32_t pattern_count,
+    vg_lite_float_t dash_phase, vg_lite_color_t stroke_color);
+vg_lite_error_t vg_lite_cpu_update_stroke(vg_lite_path_t* path);
+vg_lite_error_t vg_lite_cpu_clear(vg_lite_buffer_t* target, vg_lite_rectangle_t* rectangle, vg_lite_color_t color);
+vg_lite_error_t vg_lite_cpu_draw(vg_lite_buffer_t* target, vg_lite_path_t* path, vg_lite_fill_t fill_rule,
+    vg_lite_matrix_t* matrix, vg_lite_blend_t blend, vg_lite_color_t color);
+vg_lite_error_t vg_lite_cpu_draw_pattern(vg_lite_buffer_t* target, vg_lite_path_t* path, vg_lite_fill_t fill_rule,
+    vg_lite_matrix_t* path_matrix, vg_lite_buffer_t* pattern_image, vg_lite_matrix_t* pattern_matrix, vg_lite_blend_t blend,
+    vg_lite_pattern_mode_t pattern_mode, vg_lite_color_t pattern_color, vg_lite_color_t color, vg_lite_filter_t filter);
+vg_lite_error_t vg_lite_cpu_blit(vg_lite_buffer_t* target, vg_lite_buffer_t* source, vg_lite_matrix_t* matrix,
+    vg_lite_blend_t blend, vg_lite_color_t color, vg_lite_filter_t filter);
+vg_lite_error_t vg_lite_cpu_blit_rect(vg_lite_buffer_t* target, vg_lite_buffer_t* source, vg_lite_rectangle_t* rect,
+    vg_lite_matrix_t* matrix, vg_lite_blend_t blend, vg_lite_color_t color, vg_lite_filter_t filter);
+vg_lite_error_t vg_lite_cpu_finish(void);
+vg_lite_error_t vg_lite_cpu_flush(void);
+vg_lite_error_t vg_lite_cpu_init_grad(vg_lite_linear_gradient_t* grad);
+vg_lite_error_t vg_lite_cpu_set_grad(vg_lite_linear_gradient_t* grad, vg_lite_uint32_t count, vg_lite_uint32_t* colors, vg_lite_uint32_t* stops);
+vg_lite_error_t vg_lite_cpu_update_grad(vg_lite_linear_gradient_t* grad);
+vg_lite_error_t vg_lite_cpu_clear_grad(vg_lite_linear_gradient_t* grad);
+vg_lite_matrix_t* vg_lite_cpu_get_grad_matrix(vg_lite_linear_gradient_t* grad);
+vg_lite_error_t vg_lite_cpu_draw_grad(vg_lite_buffer_t* target, vg_lite_path_t* path, vg_lite_fill_t fill_rule,
+    vg_lite_matrix_t* matrix, vg_lite_linear_gradient_t* grad, vg_lite_blend_t blend);
+vg_lite_error_t vg_lite_cpu_set_linear_grad(vg_lite_ext_linear_gradient_t* grad, vg_lite_uint32_t count,
+    vg_lite_color_ramp_t* color_ramp, vg_lite_linear_gradient_parameter_t linear_gradient,
+    vg_lite_gradient_spreadmode_t spread_mode, vg_lite_uint8_t color_ramp_premultiplied);
+vg_lite_error_t vg_lite_cpu_update_linear_grad(vg_lite_ext_linear_gradient_t* grad);
+vg_lite_error_t vg_lite_cpu_clear_linear_grad(vg_lite_ext_linear_gradient_t* grad);
+vg_lite_matrix_t* vg_lite_cpu_get_linear_grad_matrix(vg_lite_ext_linear_gradient_t* grad);
+vg_lite_error_t vg_lite_cpu_draw_linear_grad(vg_lite_buffer_t* target, vg_lite_path_t* path, vg_lite_fill_t fill_rule,
+    vg_lite_matrix_t* path_matrix, vg_lite_ext_linear_gradient_t* grad, vg_lite_color_t paint_color,
+    vg_lite_blend_t blend, vg_lite_filter_t filter);
+vg_lite_error_t vg_lite_cpu_set_radial_grad(vg_lite_radial_gradient_t* grad, vg_lite_uint32_t count,
+    vg_lite_color_ramp_t* color_ramp, vg_lite_radial_gradient_parameter_t radial_gradient,
+    vg_lite_gradient_spreadmode_t spread_mode, vg_lite_uint8_t color_ramp_premultiplied);
+vg_lite_error_t vg_lite_cpu_update_radial_grad(vg_lite_radial_gradient_t* grad);
+vg_lite_error_t vg_lite_cpu_clear_radial_grad(vg_lite_radial_gradient_t* grad);
+vg_lite_matrix_t* vg_lite_cpu_get_radial_grad_matrix(vg_lite_radial_gradient_t* grad);
+vg_lite_error_t vg_lite_cpu_draw_radial_grad(vg_lite_buffer_t* target, vg_lite_path_t* path, vg_lite_fill_t fill_rule,
+    vg_lite_matrix_t* path_matrix, vg_lite_radial_gradient_t* grad, vg_lite_color_t paint_color,
+    vg_lite_blend_t blend, vg_lite_filter_t filter);
+vg_lite_error_t vg_lite_cpu_set_CLUT(vg_lite_uint32_t count, vg_lite_uint32_t* colors);
+vg_lite_error_t vg_lite_cpu_set_scissor(vg_lite_int32_t x, vg_lite_int32_t y, vg_lite_int32_t right, vg_lite_int32_t bottom);
+vg_lite_error_t vg_lite_cpu_enable_scissor(void);
+vg_lite_error_t vg_lite_cpu_disable_scissor(void);
+vg_lite_error_t vg_lite_cpu_gaussian_filter(vg_lite_float_t w0, vg_lite_float_t w1, vg_lite_float_t w2);
+
+#endif /* GPU_TEST_VG_LITE_CPU_REF_ENABLE */
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef GPU_TEST_VG_LITE_CPU_REF_ENABLE
+
+/*
+ * Every call below picks the backend at run time. A macro does not expand
+ * itself again, so the vg_lite_* name inside of it is the vendor function.
+ * The matrix and query calls are not routed, both backends agree on them.
+ */
+#define VG_LITE_CPU_REPLAY(NAME, ...) \
+    (vg_lite_cpu_is_replay() ? vg_lite_cpu_##NAME(__VA_ARGS__) : vg_lite_##NAME(__VA_ARGS__))
+
+#define VG_LITE_CPU_REPLAY_VOID(NAME) \
+    (vg_lite_cpu_is_replay() ? vg_lite_cpu_##NAME() : vg_lite_##NAME())
+
+#define vg_lite_init_path(...) VG_LITE_CPU_REPLAY(init_path, __VA_ARGS__)
+#define vg_lite_clear_path(...) VG_LITE_CPU_REPLAY(clear_path, __VA_ARGS__)
+#define vg_lite_set_path_type(...) VG_LITE_CPU_REPLAY(set_path_type, __VA_ARGS__)
+#define vg_lite_set_stroke(...) VG_LITE_CPU_REPLAY(set_stroke, __VA_ARGS__)
+#define vg_lite_update_stroke(...) VG_LITE_CPU_REPLAY(update_stroke, __VA_ARGS__)
+#define vg_lite_clear(...) VG_LITE_CPU_REPLAY(clear, __VA_ARGS__)
+#define vg_lite_draw(...) VG_LITE_CPU_REPLAY(draw, __VA_ARGS__)
+#define vg_lite_draw_pattern(...) VG_LITE_CPU_REPLAY(draw_pattern, __VA_ARGS__)
+#define vg_lite_blit(...) VG_LITE_CPU_REPLAY(blit, __VA_ARGS__)
+#define vg_lite_blit_rect(...) VG_LITE_CPU_REPLAY(blit_rect, __VA_ARGS__)
+#define vg_lite_finish() VG_LITE_CPU_REPLAY_VOID(finish)
+#define vg_lite_flush() VG_LITE_CPU_REPLAY_VOID(flush)
+#define vg_lite_init_grad(...) VG_LITE_CPU_REPLAY(init_grad, __VA_ARGS__)
+#define vg_lite_set_grad(...) VG_LITE_CPU_REPLAY(set_grad, __VA_ARGS__)
+#define vg_lite_update_grad(...) VG_LITE_CPU_REPLAY(update_grad, __VA_ARGS__)
+#define vg_lite_clear_grad(...) VG_LITE_CPU_REPLAY(clear_grad, __VA_ARGS__)
+#define vg_lite_get_grad_matrix(...) VG_LITE_CPU_REPLAY(get_grad_matrix, __VA_ARGS__)
+#define vg_lite_draw_grad(...) VG_LITE_CPU_REPLAY(draw_grad, __VA_ARGS__)
+#define vg_lite_set_linear_grad(...) VG_LITE_CPU_REPLAY(set_linear_grad, __VA_ARGS__)
+#define vg_lite_update_linear_grad(...) VG_LITE_CPU_REPLAY(update_linear_grad, __VA_ARGS__)
+#define vg_lite_clear_linear_grad(...) VG_LITE_CPU_REPLAY(clear_linear_grad, __VA_ARGS__)
+#define vg_lite_get_linear_grad_matrix(...) VG_LITE_CPU_REPLAY(get_linear_grad_matrix, __VA_ARGS__)
+#define vg_lite_draw_linear_grad(...) VG_LITE_CPU_REPLAY(draw_linear_grad, __VA_ARGS__)
+#define vg_lite_set_radial_grad(...) VG_LITE_CPU_REPLAY(set_radial_grad, __VA_ARGS__)
+#define vg_lite_update_radial_grad(...) VG_LITE_CPU_REPLAY(update_radial_grad, __VA_ARGS__)
+#define vg_lite_clear_radial_grad(...) VG_LITE_CPU_REPLAY(clear_radial_grad, __VA_ARGS__)
+#define vg_lite_get_radial_grad_matrix(...) VG_LITE_CPU_REPLAY(get_radial_grad_matrix, __VA_ARGS__)
+#define vg_lite_draw_radial_grad(...) VG_LITE_CPU_REPLAY(draw_radial_grad, __VA_ARGS__)
+#define vg_lite_set_CLUT(...) VG_LITE_CPU_REPLAY(set_CLUT, __VA_ARGS__)
+#define vg_lite_set_scissor(...) VG_LITE_CPU_REPLAY(set_scissor, __VA_ARGS__)
+#define vg_lite_enable_scissor() VG_LITE_CPU_REPLAY_VOID(enable_scissor)
+#define vg_lite_disable_scissor() VG_LITE_CPU_REPLAY_VOID(disable_scissor)
+#define vg_lite_gaussian_filter(...) VG_LITE_CPU_REPLAY(gaussian_filter, __VA_ARGS__)
+
+#endif /* GPU_TEST_VG_LITE_CPU_REF_ENABLE */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*VG_LITE_CPU_REF_H*/
@@ -0,0 +1,463 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_assert.h"
+#include "../../gpu_cache.h"
+#include "../../gpu_math.h"
+#include "../../gpu_recorder.h"
+#include "../../gpu_tick.h"
+#include "../vg_lite_test_blend.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_path.h"
+#include "../vg_lite_test_utils.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define MODE_COUNT 15
+#define GRID_COLUMNS 4
+#define CIRCLE_RADIUS 50
+#define CIRCLE_SPACING 80
+#define CIRCLE_OFFSET 100
+
+/* Anti-aliased pixels near the circle edges are not checked */
+#define EDGE_MARGIN 1.5f
+#define SAMPLE_STEP 3
+#define DIFF_TOLERANCE 2
+
+#define BACKGROUND_COLOR 0x5A5A5A5A
+#define BENCH_COLOR 0x80406080
+#define BENCH_PIXELS (256 * 256)
+#define REPEAT_COUNT 8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    CPU_DST_PREMULTIPLIED,
+    CPU_DST_STRAIGHT,
+    CPU_DST_BGR565,
+    CPU_DST_COUNT,
+} cpu_dst_t;
+
+typedef struct {
+    bool gpu_supported;
+    uint32_t gpu_tick;
+    uint32_t cpu_tick[CPU_DST_COUNT];
+    uint32_t checked;
+    uint32_t mismatch;
+    uint8_t max_diff;
+} mode_result_t;
+
+typedef struct {
+    vg_lite_test_path_t* rect_path;
+    uint32_t* bench_src;
+    uint32_t* bench_dst;
+    uint16_t* bench_dst16;
+    mode_result_t results[MODE_COUNT];
+    bool validated;
+    bool done;
+} blend_case_t;
+
+typedef struct {
+    float x;
+    float y;
+    float radius;
+} circle_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const vg_lite_blend_t blend_modes[MODE_COUNT] = {
+    VG_LITE_BLEND_NONE,
+    VG_LITE_BLEND_SRC_OVER,
+    VG_LITE_BLEND_DST_OVER,
+    VG_LITE_BLEND_SRC_IN,
+    VG_LITE_BLEND_DST_IN,
+    VG_LITE_BLEND_MULTIPLY,
+    VG_LITE_BLEND_SCREEN,
+    VG_LITE_BLEND_DARKEN,
+    VG_LITE_BLEND_LIGHTEN,
+    VG_LITE_BLEND_ADDITIVE,
+    VG_LITE_BLEND_SUBTRACT,
+    VG_LITE_BLEND_NORMAL_LVGL,
+    VG_LITE_BLEND_ADDITIVE_LVGL,
+    VG_LITE_BLEND_SUBTRACT_LVGL,
+    VG_LITE_BLEND_MULTIPLY_LVGL,
+};
+
+static const vg_lite_color_t circle_colors[] = { 0xFF0000FF, 0xFF00FF00, 0xFFFF0000, 0x80FFFF00 };
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define CIRCLE_COLOR(i) circle_colors[(i) % (sizeof(circle_colors) / sizeof(circle_colors[0]))]
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool mode_is_supported(vg_lite_blend_t blend)
+{
+    switch (blend) {
+    case VG_LITE_BLEND_DARKEN:
+    case VG_LITE_BLEND_LIGHTEN:
+        return vg_lite_query_feature(gcFEATURE_BIT_VG_NEW_BLEND_MODE);
+    case VG_LITE_BLEND_NORMAL_LVGL:
+    case VG_LITE_BLEND_ADDITIVE_LVGL:
+    case VG_LITE_BLEND_SUBTRACT_LVGL:
+    case VG_LITE_BLEND_MULTIPLY_LVGL:
+        return vg_lite_query_feature(gcFEATURE_BIT_VG_LVGL_SUPPORT);
+    default:
+        break;
+    }
+
+    return true;
+}
+
+static void circle_matrix(struct vg_lite_test_context_s* ctx, int index, vg_lite_matrix_t* matrix)
+{
+    vg_lite_test_context_get_transform(ctx, matrix);
+    vg_lite_translate(
+        CIRCLE_OFFSET + CIRCLE_SPACING * (index % GRID_COLUMNS),
+        CIRCLE_OFFSET + CIRCLE_SPACING * (index / GRID_COLUMNS),
+        matrix);
+}
+
+static vg_lite_error_t gpu_bench(struct vg_lite_test_context_s* ctx, blend_case_t* blend_case, int index)
+{
+    mode_result_t* result = &blend_case->results[index];
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+
+    vg_lite_matrix_t matrix;
+    vg_lite_identity(&matrix);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear(target_buffer, NULL, BACKGROUND_COLOR));
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+
+    uint32_t start = gpu_tick_get();
+    for (int i = 0; i < REPEAT_COUNT; i++) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_draw(
+            target_buffer,
+            vg_lite_test_path_get_path(blend_case->rect_path),
+            VG_LITE_FILL_NON_ZERO,
+            &matrix,
+            blend_modes[index],
+            BENCH_COLOR));
+    }
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+    result->gpu_tick = gpu_tick_elaps(start);
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t cpu_bench(blend_case_t* blend_case, int index)
+{
+    mode_result_t* result = &blend_case->results[index];
+
+    for (int dst = 0; dst < CPU_DST_COUNT; dst++) {
+        bool is_565 = dst == CPU_DST_BGR565;
+        void* dst_pixels = is_565 ? (void*)blend_case->bench_dst16 : (void*)blend_case->bench_dst;
+
+        uint32_t start = gpu_tick_get();
+        for (int i = 0; i < REPEAT_COUNT; i++) {
+            bool ok = vg_lite_test_blend_span(
+                blend_modes[index],
+                blend_case->bench_src,
+                dst_pixels,
+                is_565 ? VG_LITE_BGR565 : VG_LITE_BGRA8888,
+                dst != CPU_DST_STRAIGHT,
+                BENCH_PIXELS);
+            if (!ok) {
+                GPU_LOG_ERROR("CPU blend of %s failed", vg_lite_test_blend_string(blend_modes[index]));
+                return VG_LITE_NOT_SUPPORT;
+            }
+        }
+        result->cpu_tick[dst] = gpu_tick_elaps(start);
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static bool expected_pixel(blend_case_t* blend_case, const circle_t* circles, int x, int y, uint32_t* color, int* top)
+{
+    /* Fold the circles that cover the pixel center, in draw order */
+    float px = x + 0.5f;
+    float py = y + 0.5f;
+    *color = vg_lite_test_blend_color(BACKGROUND_COLOR, false);
+    *top = -1;
+
+    for (int i = 0; i < MODE_COUNT; i++) {
+        if (!blend_case->results[i].gpu_supported) {
+            continue;
+        }
+
+        float dist = MATH_SQRTF((px - circles[i].x) * (px - circles[i].x) + (py - circles[i].y) * (py - circles[i].y));
+        if (MATH_FABSF(dist - circles[i].radius) < EDGE_MARGIN) {
+            return false;
+        }
+
+        if (dist < circles[i].radius) {
+            *color = vg_lite_test_blend_pixel(blend_modes[i], vg_lite_test_blend_color(CIRCLE_COLOR(i), true), *color);
+            *top = i;
+        }
+    }
+
+    return true;
+}
+
+static void validate(struct vg_lite_test_context_s* ctx, blend_case_t* blend_case, uint8_t tolerance)
+{
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+    if (target_buffer->format != VG_LITE_BGRA8888 || target_buffer->tiled != VG_LITE_LINEAR) {
+        /* The expected colors are computed in 8 bits per channel */
+        return;
+    }
+
+    circle_t circles[MODE_COUNT];
+    for (int i = 0; i < MODE_COUNT; i++) {
+        vg_lite_matrix_t matrix;
+        circle_matrix(ctx, i, &matrix);
+        float edge_x = CIRCLE_RADIUS;
+        float edge_y = 0;
+        circles[i].x = 0;
+        circles[i].y = 0;
+        vg_lite_test_transform_point(&circles[i].x, &circles[i].y, &matrix);
+        vg_lite_test_transform_point(&edge_x, &edge_y, &matrix);
+        circles[i].radius = MATH_SQRTF((edge_x - circles[i].x) * (edge_x - circles[i].x) + (edge_y - circles[i].y) * (edge_y - circles[i].y));
+    }
+
+    struct gpu_buffer_s buffer;
+    vg_lite_test_vg_buffer_to_gpu_buffer(&buffer, target_buffer);
+    gpu_cache_invalidate(buffer.data, buffer.stride * buffer.height);
+
+    for (uint32_t y = 0; y < buffer.height; y += SAMPLE_STEP) {
+        for (uint32_t x = 0; x < buffer.width; x += SAMPLE_STEP) {
+            uint32_t expected;
+            int top;
+            if (!expected_pixel(blend_case, circles, x, y, &expected, &top) || top < 0) {
+                continue;
+            }
+
+            uint32_t actual = gpu_buffer_get_pixel(&buffer, x, y);
+            uint8_t diff = 0;
+            for (int shift = 0; shift < 32; shift += 8) {
+                int a = (actual >> shift) & 0xFF;
+                int e = (expected >> shift) & 0xFF;
+                diff = MATH_MAX(diff, MATH_ABS(a - e));
+            }
+
+            /* The topmost circle owns the pixel */
+            mode_result_t* result = &blend_case->results[top];
+            result->checked++;
+            result->max_diff = MATH_MAX(result->max_diff, diff);
+            if (diff > tolerance) {
+                result->mismatch++;
+            }
+        }
+    }
+
+    blend_case->validated = true;
+}
+
+static void write_report(struct vg_lite_test_context_s* ctx, blend_case_t* blend_case)
+{
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+    const float gpu_pixels = (float)target_buffer->width * target_buffer->height * REPEAT_COUNT;
+    const float cpu_pixels = (float)BENCH_PIXELS * REPEAT_COUNT;
+
+    struct gpu_recorder_s* recorder = vg_lite_test_context_create_report(ctx, "blend_modes");
+    if (!recorder) {
+        return;
+    }
+
+    gpu_recorder_write_string(recorder,
+        "Blend Mode,GPU(Mpix/s),CPU BGRA8888 Premultiplied(Mpix/s),CPU BGRA8888 Straight(Mpix/s),CPU BGR565(Mpix/s),"
+        "Checked Pixels,Mismatch Pixels,Max Diff\n");
+
+    for (int i = 0; i < MODE_COUNT; i++) {
+        const mode_result_t* result = &blend_case->results[i];
+
+        /* Ticks are microseconds */
+        char gpu_rate[16] = "-";
+        if (result->gpu_supported && result->gpu_tick) {
+            snprintf(gpu_rate, sizeof(gpu_rate), "%0.2f", gpu_pixels / result->gpu_tick);
+        }
+
+        char row[192];
+        snprintf(row, sizeof(row), "%s,%s,%0.2f,%0.2f,%0.2f,%" PRIu32 ",%" PRIu32 ",%d\n",
+            vg_lite_test_blend_string(blend_modes[i]),
+            gpu_rate,
+            result->cpu_tick[CPU_DST_PREMULTIPLIED] ? cpu_pixels / result->cpu_tick[CPU_DST_PREMULTIPLIED] : 0.0f,
+            result->cpu_tick[CPU_DST_STRAIGHT] ? cpu_pixels / result->cpu_tick[CPU_DST_STRAIGHT] : 0.0f,
+            result->cpu_tick[CPU_DST_BGR565] ? cpu_pixels / result->cpu_tick[CPU_DST_BGR565] : 0.0f,
+            result->checked,
+            result->mismatch,
+            result->max_diff);
+        gpu_recorder_write_string(recorder, row);
+    }
+
+    gpu_recorder_delete(recorder);
+}
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    blend_case_t* blend_case = calloc(1, sizeof(blend_case_t));
+    GPU_ASSERT_NULL(blend_case);
+    vg_lite_test_context_set_user_data(ctx, blend_case);
+
+    vg_lite_test_path_t* path = vg_lite_test_context_init_path(ctx, VG_LITE_FP32);
+    vg_lite_test_path_set_bounding_box(path, -240, -240, 240, 240);
+    vg_lite_test_path_append_circle(path, 0, 0, CIRCLE_RADIUS, CIRCLE_RADIUS);
+    vg_lite_test_path_end(path);
+
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+    blend_case->rect_path = vg_lite_test_path_create(VG_LITE_FP32);
+    vg_lite_test_path_set_bounding_box(blend_case->rect_path, 0, 0, target_buffer->width, target_buffer->height);
+    vg_lite_test_path_append_rect(blend_case->rect_path, 0, 0, target_buffer->width, target_buffer->height, 0);
+    vg_lite_test_path_end(blend_case->rect_path);
+
+    blend_case->bench_src = malloc(BENCH_PIXELS * sizeof(uint32_t));
+    blend_case->bench_dst = malloc(BENCH_PIXELS * sizeof(uint32_t));
+    blend_case->bench_dst16 = malloc(BENCH_PIXELS * sizeof(uint16_t));
+    GPU_ASSERT_NULL(blend_case->bench_src);
+    GPU_ASSERT_NULL(blend_case->bench_dst);
+    GPU_ASSERT_NULL(blend_case->bench_dst16);
+
+    /* Translucent premultiplied colors, every alpha level appears */
+    for (int i = 0; i < BENCH_PIXELS; i++) {
+        uint32_t a = i & 0xFF;
+        uint32_t c = (i * 37) & 0xFF;
+        c = MATH_MIN(c, a);
+        blend_case->bench_src[i] = a << 24 | c << 16 | (c / 2) << 8 | (a - c);
+        blend_case->bench_dst[i] = 0xFF000000 | (uint32_t)(i * 2654435761u >> 8);
+        blend_case->bench_dst16[i] = (uint16_t)(i * 40503u);
+    }
+
+    /* The benchmarks finish on their own, the drawing below stays a single frame */
+    for (int i = 0; i < MODE_COUNT; i++) {
+        blend_case->results[i].gpu_supported = mode_is_supported(blend_modes[i]);
+        if (blend_case->results[i].gpu_supported) {
+            VG_LITE_TEST_CHECK_ERROR_RETURN(gpu_bench(ctx, blend_case, i));
+        }
+
+        VG_LITE_TEST_CHECK_ERROR_RETURN(cpu_bench(blend_case, i));
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    blend_case_t* blend_case = vg_lite_test_context_get_user_data(ctx);
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+
+    /* One overlapping circle per mode, every covered pixel has a computable color */
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear(target_buffer, NULL, BACKGROUND_COLOR));
+
+    vg_lite_path_t* vg_path = vg_lite_test_path_get_path(vg_lite_test_context_get_path(ctx));
+    for (int i = 0; i < MODE_COUNT; i++) {
+        if (!blend_case->results[i].gpu_supported) {
+            continue;
+        }
+
+        vg_lite_matrix_t matrix;
+        circle_matrix(ctx, i, &matrix);
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_draw(
+            target_buffer,
+            vg_path,
+            VG_LITE_FILL_NON_ZERO,
+            &matrix,
+            blend_modes[i],
+            CIRCLE_COLOR(i)));
+    }
+
+    blend_case->done = true;
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    blend_case_t* blend_case = vg_lite_test_context_get_user_data(ctx);
+    if (!blend_case) {
+        return VG_LITE_SUCCESS;
+    }
+
+    if (blend_case->done) {
+        /* The drawing is finished before the teardown */
+        uint8_t tolerance = MATH_MIN(DIFF_TOLERANCE + vg_lite_test_context_get_tolerance(ctx), 0xFF);
+        validate(ctx, blend_case, tolerance);
+
+        uint32_t checked = 0;
+        uint32_t mismatch = 0;
+        int worst = 0;
+        for (int i = 0; i < MODE_COUNT; i++) {
+            const mode_result_t* result = &blend_case->results[i];
+            checked += result->checked;
+            mismatch += result->mismatch;
+            if (result->mismatch > blend_case->results[worst].mismatch) {
+                worst = i;
+            }
+        }
+
+        if (!blend_case->validated) {
+            vg_lite_test_context_set_remark(ctx, "Validation needs a linear BGRA8888 target");
+        } else if (mismatch) {
+            vg_lite_test_context_set_remark(ctx, "%" PRIu32 "/%" PRIu32 " pixels mismatch; most in %s",
+                mismatch, checked, vg_lite_test_blend_string(blend_modes[worst]));
+            vg_lite_test_context_set_failed(ctx, "%" PRIu32 " pixels differ from the blend formulas by more than %d",
+                mismatch, tolerance);
+        } else {
+            vg_lite_test_context_set_remark(ctx, "%" PRIu32 " pixels match the blend formulas", checked);
+        }
+
+        write_report(ctx, blend_case);
+    }
+
+    if (blend_case->rect_path) {
+        vg_lite_test_path_destroy(blend_case->rect_path);
+    }
+
+    free(blend_case->bench_src);
+    free(blend_case->bench_dst);
+    free(blend_case->bench_dst16);
+    free(blend_case);
+
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(blend_mode_validate, NONE, "Check every blend mode against computed colors and report GPU and CPU Mpix/s per mode");
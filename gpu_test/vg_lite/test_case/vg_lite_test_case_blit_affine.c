@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_assert.h"
+#include "../../gpu_buffer.h"
+#include "../../gpu_cache.h"
+#include "../../gpu_recorder.h"
+#include "../../gpu_tick.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_utils.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define SRC_SIZE 256
+#define SRC_FORMAT_COUNT 3
+#define TRANSFORM_COUNT 3
+#define FILTER_COUNT 2
+#define RESULT_COUNT (SRC_FORMAT_COUNT * TRANSFORM_COUNT * FILTER_COUNT)
+#define REPEAT_COUNT 8
+#define CLUT_SIZE 256
+
+/* Alpha only sources take their color from the blit color */
+#define A8_COLOR 0xFFC06020
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    TRANSFORM_IDENTITY,
+    TRANSFORM_SCALE,
+    TRANSFORM_ROTATE,
+} transform_t;
+
+typedef struct {
+    vg_lite_buffer_t buffer;
+    struct gpu_buffer_s* gpu_buffer;
+} src_image_t;
+
+typedef struct {
+    transform_t transform;
+    vg_lite_filter_t filter;
+    vg_lite_buffer_format_t format;
+    uint32_t texels;
+    uint32_t tick;
+} blit_result_t;
+
+typedef struct {
+    src_image_t images[SRC_FORMAT_COUNT];
+    blit_result_t results[RESULT_COUNT];
+    int result_count;
+} blit_case_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const vg_lite_buffer_format_t src_formats[SRC_FORMAT_COUNT] = {
+    VG_LITE_BGRA8888,
+    VG_LITE_A8,
+    VG_LITE_INDEX_8,
+};
+
+static const char* const transform_names[TRANSFORM_COUNT] = {
+    "identity",
+    "scale_1.5",
+    "rotate_30",
+};
+
+static const vg_lite_filter_t filters[FILTER_COUNT] = {
+    VG_LITE_FILTER_POINT,
+    VG_LITE_FILTER_BI_LINEAR,
+};
+
+static vg_lite_uint32_t gray_clut[CLUT_SIZE];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void fill_source(vg_lite_buffer_t* buffer)
+{
+    /* Checkers of horizontal and vertical ramps, both filters show on them */
+    for (int y = 0; y < buffer->height; y++) {
+        uint8_t* row = (uint8_t*)buffer->memory + (size_t)y * buffer->stride;
+
+        for (int x = 0; x < buffer->width; x++) {
+            bool odd = ((x >> 5) ^ (y >> 5)) & 1;
+            uint8_t value = odd ? x * 0xFF / buffer->width : 0xFF - y * 0xFF / buffer->height;
+
+            if (buffer->format == VG_LITE_BGRA8888) {
+                row[x * 4 + 0] = value;
+                row[x * 4 + 1] = x * 0xFF / buffer->width;
+                row[x * 4 + 2] = y * 0xFF / buffer->height;
+                row[x * 4 + 3] = 0xFF;
+            } else {
+                row[x] = value;
+            }
+        }
+    }
+
+    gpu_cache_flush(buffer->memory, buffer->stride * buffer->height);
+}
+
+static float transform_matrix(struct vg_lite_test_context_s* ctx, transform_t transform, vg_lite_matrix_t* matrix)
+{
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+    vg_lite_test_context_get_transform(ctx, matrix);
+
+    /* Every transform keeps the source centered on the target */
+    vg_lite_translate(target_buffer->width / 2.0f, target_buffer->height / 2.0f, matrix);
+
+    float area_scale = 1.0f;
+    switch (transform) {
+    case TRANSFORM_SCALE:
+        vg_lite_scale(1.5f, 1.5f, matrix);
+        area_scale = 1.5f * 1.5f;
+        break;
+    case TRANSFORM_ROTATE:
+        vg_lite_rotate(30, matrix);
+        break;
+    default:
+        break;
+    }
+
+    vg_lite_translate(-SRC_SIZE / 2.0f, -SRC_SIZE / 2.0f, matrix);
+
+    /* Target pixels covered by the source, relative to its own size */
+    return area_scale;
+}
+
+static vg_lite_error_t blit_timed(struct vg_lite_test_context_s* ctx, const src_image_t* image, transform_t transform, vg_lite_filter_t filter, blit_result_t* result)
+{
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+    vg_lite_buffer_t* source = (vg_lite_buffer_t*)&image->buffer;
+    vg_lite_color_t color = source->format == VG_LITE_A8 ? A8_COLOR : 0;
+
+    vg_lite_matrix_t matrix;
+    float area_scale = transform_matrix(ctx, transform, &matrix);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear(target_buffer, NULL, 0xFFFFFFFF));
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+
+    uint32_t start = gpu_tick_get();
+    for (int i = 0; i < REPEAT_COUNT; i++) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_blit(target_buffer, source, &matrix, VG_LITE_BLEND_SRC_OVER, color, filter));
+    }
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+
+    result->transform = transform;
+    result->filter = filter;
+    result->format = source->format;
+    result->texels = (uint32_t)(SRC_SIZE * SRC_SIZE * area_scale) * REPEAT_COUNT;
+    result->tick = gpu_tick_elaps(start);
+    return VG_LITE_SUCCESS;
+}
+
+static float result_mtexels(const blit_result_t* result)
+{
+    /* Ticks are microseconds */
+    return result->tick ? (float)result->texels / result->tick : 0.0f;
+}
+
+static void write_report(struct vg_lite_test_context_s* ctx, blit_case_t* blit_case)
+{
+    struct gpu_recorder_s* recorder = vg_lite_test_context_create_report(ctx, "blit_affine");
+    if (!recorder) {
+        return;
+    }
+
+    gpu_recorder_write_string(recorder, "Transform,Filter,Source Format,Texels,Time(ms),MTexel/s\n");
+
+    for (int i = 0; i < blit_case->result_count; i++) {
+        const blit_result_t* result = &blit_case->results[i];
+
+        char row[128];
+        snprintf(row, sizeof(row), "%s,%s,%s,%" PRIu32 ",%0.3f,%0.2f\n",
+            transform_names[result->transform],
+            result->filter == VG_LITE_FILTER_POINT ? "point" : "bilinear",
+            vg_lite_test_buffer_format_string(result->format),
+            result->texels,
+            result->tick / 1000.0f,
+            result_mtexels(result));
+        gpu_recorder_write_string(recorder, row);
+    }
+
+    gpu_recorder_delete(recorder);
+}
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    blit_case_t* blit_case = calloc(1, sizeof(blit_case_t));
+    GPU_ASSERT_NULL(blit_case);
+    vg_lite_test_context_set_user_data(ctx, blit_case);
+
+    for (int i = 0; i < SRC_FORMAT_COUNT; i++) {
+        src_image_t* image = &blit_case->images[i];
+        image->gpu_buffer = vg_lite_test_buffer_alloc(&image->buffer, SRC_SIZE, SRC_SIZE, src_formats[i], VG_LITE_TEST_STRIDE_AUTO);
+        if (!image->gpu_buffer) {
+            return VG_LITE_OUT_OF_MEMORY;
+        }
+
+        fill_source(&image->buffer);
+    }
+
+    /* Gray ramp, the INDEX_8 source looks like an L8 one */
+    for (int i = 0; i < CLUT_SIZE; i++) {
+        gray_clut[i] = 0xFF000000 | (uint32_t)i * 0x010101;
+    }
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_set_CLUT(CLUT_SIZE, gray_clut));
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    blit_case_t* blit_case = vg_lite_test_context_get_user_data(ctx);
+    blit_case->result_count = 0;
+
+    for (int t = 0; t < TRANSFORM_COUNT; t++) {
+        for (int f = 0; f < FILTER_COUNT; f++) {
+            for (int i = 0; i < SRC_FORMAT_COUNT; i++) {
+                VG_LITE_TEST_CHECK_ERROR_RETURN(blit_timed(
+                    ctx,
+                    &blit_case->images[i],
+                    (transform_t)t,
+                    filters[f],
+                    &blit_case->results[blit_case->result_count++]));
+            }
+        }
+    }
+
+    /* The screenshot keeps the last one, rotated and bilinear filtered INDEX_8 */
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    blit_case_t* blit_case = vg_lite_test_context_get_user_data(ctx);
+    if (!blit_case) {
+        return VG_LITE_SUCCESS;
+    }
+
+    if (blit_case->result_count == RESULT_COUNT) {
+        /* Same source format and filter, identity against rotated */
+        const blit_result_t* identity = &blit_case->results[SRC_FORMAT_COUNT];
+        const blit_result_t* rotate = &blit_case->results[RESULT_COUNT - SRC_FORMAT_COUNT];
+        vg_lite_test_context_set_remark(ctx,
+            "BGRA8888 bilinear: identity %0.2f, rotated %0.2f MTexel/s",
+            result_mtexels(identity),
+            result_mtexels(rotate));
+
+        write_report(ctx, blit_case);
+    }
+
+    for (int i = 0; i < SRC_FORMAT_COUNT; i++) {
+        if (blit_case->images[i].gpu_buffer) {
+            gpu_buffer_free(blit_case->images[i].gpu_buffer);
+        }
+    }
+
+    free(blit_case);
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(blit_affine, NONE, "Blit BGRA8888/A8/INDEX_8 sources with identity/scaled/rotated transforms and point/bilinear filters and report MTexel/s");
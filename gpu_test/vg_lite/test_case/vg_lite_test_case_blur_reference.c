@@ -0,0 +1,326 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_assert.h"
+#include "../../gpu_buffer.h"
+#include "../../gpu_cache.h"
+#include "../../gpu_math.h"
+#include "../../gpu_recorder.h"
+#include "../../gpu_tick.h"
+#include "../vg_lite_test_blur.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_utils.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define SIZE_COUNT 4
+#define REPEAT_COUNT 8
+#define DIFF_TOLERANCE 2
+
+/* Separable, the CPU runs it as two 3-tap passes */
+#define BLUR_W0 0.25f
+#define BLUR_W1 0.125f
+#define BLUR_W2 0.0625f
+
+/* The weights of blur_gaussian, not separable */
+#define DIRECT_W0 0.2f
+#define DIRECT_W1 0.1f
+#define DIRECT_W2 0.1f
+
+#define WIDE_RADIUS_SMALL 4
+#define WIDE_RADIUS_LARGE 8
+
+/* The size shown on the screenshot */
+#define SHOW_SIZE_INDEX 2
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    BLUR_BUFFER_SRC,
+    BLUR_BUFFER_GPU,
+    BLUR_BUFFER_CPU,
+    BLUR_BUFFER_WIDE,
+    BLUR_BUFFER_COUNT,
+} blur_buffer_t;
+
+typedef struct {
+    vg_lite_buffer_t buffers[BLUR_BUFFER_COUNT];
+    struct gpu_buffer_s* gpu_buffers[BLUR_BUFFER_COUNT];
+    uint32_t gpu_tick;
+    uint32_t cpu_tick;
+    uint32_t direct_tick;
+    uint32_t wide_small_tick;
+    uint32_t wide_large_tick;
+    uint32_t diff_count;
+    uint8_t max_diff;
+} blur_size_t;
+
+typedef struct {
+    blur_size_t sizes[SIZE_COUNT];
+    uint8_t tolerance;
+    bool done;
+} blur_case_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const int blur_sizes[SIZE_COUNT] = { 32, 64, 128, 256 };
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void fill_source(vg_lite_buffer_t* buffer)
+{
+    /* Opaque checkers with hard edges, the blur shows on every edge */
+    for (int y = 0; y < buffer->height; y++) {
+        uint32_t* row = (uint32_t*)((uint8_t*)buffer->memory + (size_t)y * buffer->stride);
+
+        for (int x = 0; x < buffer->width; x++) {
+            bool odd = ((x >> 3) ^ (y >> 3)) & 1;
+            row[x] = odd ? 0xFF2060C0 : 0xFFFFFFFF;
+        }
+    }
+
+    gpu_cache_flush(buffer->memory, buffer->stride * buffer->height);
+}
+
+static vg_lite_error_t cpu_blur_timed(blur_size_t* size, const float* weights, int radius, float w0, float w1, float w2, blur_buffer_t dst, uint32_t* tick)
+{
+    uint32_t start = gpu_tick_get();
+
+    for (int i = 0; i < REPEAT_COUNT; i++) {
+        bool ok = weights
+            ? vg_lite_test_blur_separable(&size->buffers[dst], &size->buffers[BLUR_BUFFER_SRC], weights, radius)
+            : vg_lite_test_blur_3x3(&size->buffers[dst], &size->buffers[BLUR_BUFFER_SRC], w0, w1, w2);
+        if (!ok) {
+            GPU_LOG_ERROR("CPU blur of radius %d failed", weights ? radius : 1);
+            return VG_LITE_NOT_SUPPORT;
+        }
+    }
+
+    *tick = gpu_tick_elaps(start);
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t run_size(blur_size_t* size, uint8_t tolerance)
+{
+    vg_lite_matrix_t matrix;
+    vg_lite_identity(&matrix);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_gaussian_filter(BLUR_W0, BLUR_W1, BLUR_W2));
+
+    uint32_t start = gpu_tick_get();
+    for (int i = 0; i < REPEAT_COUNT; i++) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_blit(
+            &size->buffers[BLUR_BUFFER_GPU],
+            &size->buffers[BLUR_BUFFER_SRC],
+            &matrix,
+            VG_LITE_BLEND_NONE,
+            0,
+            VG_LITE_FILTER_GAUSSIAN));
+    }
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+    size->gpu_tick = gpu_tick_elaps(start);
+
+    float weights[WIDE_RADIUS_LARGE + 1];
+    vg_lite_test_blur_gaussian_weights(weights, WIDE_RADIUS_SMALL, 0);
+    VG_LITE_TEST_CHECK_ERROR_RETURN(cpu_blur_timed(size, weights, WIDE_RADIUS_SMALL, 0, 0, 0, BLUR_BUFFER_WIDE, &size->wide_small_tick));
+    vg_lite_test_blur_gaussian_weights(weights, WIDE_RADIUS_LARGE, 0);
+    VG_LITE_TEST_CHECK_ERROR_RETURN(cpu_blur_timed(size, weights, WIDE_RADIUS_LARGE, 0, 0, 0, BLUR_BUFFER_WIDE, &size->wide_large_tick));
+
+    /* The 3x3 result is checked against the GPU, so it runs last */
+    VG_LITE_TEST_CHECK_ERROR_RETURN(cpu_blur_timed(size, NULL, 0, DIRECT_W0, DIRECT_W1, DIRECT_W2, BLUR_BUFFER_CPU, &size->direct_tick));
+    VG_LITE_TEST_CHECK_ERROR_RETURN(cpu_blur_timed(size, NULL, 0, BLUR_W0, BLUR_W1, BLUR_W2, BLUR_BUFFER_CPU, &size->cpu_tick));
+
+    size->diff_count = vg_lite_test_buffer_diff(
+        &size->buffers[BLUR_BUFFER_GPU],
+        &size->buffers[BLUR_BUFFER_CPU],
+        tolerance,
+        &size->max_diff);
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t show_buffer(struct vg_lite_test_context_s* ctx, vg_lite_buffer_t* buffer, float x, float y)
+{
+    vg_lite_matrix_t matrix;
+    vg_lite_test_context_get_transform(ctx, &matrix);
+    vg_lite_translate(x, y, &matrix);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_blit(
+        vg_lite_test_context_get_target_buffer(ctx),
+        buffer,
+        &matrix,
+        VG_LITE_BLEND_SRC_OVER,
+        0,
+        VG_LITE_FILTER_POINT));
+
+    return VG_LITE_SUCCESS;
+}
+
+static void write_report(struct vg_lite_test_context_s* ctx, blur_case_t* blur_case)
+{
+    struct gpu_recorder_s* recorder = vg_lite_test_context_create_report(ctx, "blur_reference");
+    if (!recorder) {
+        return;
+    }
+
+    gpu_recorder_write_string(recorder,
+        "Size,GPU 3x3(ms),CPU 3x3(ms),CPU 3x3 Direct(ms),"
+        "CPU Radius 4(ms),CPU Radius 8(ms),"
+        "Diff Pixels,Max Diff\n");
+
+    for (int i = 0; i < SIZE_COUNT; i++) {
+        const blur_size_t* size = &blur_case->sizes[i];
+
+        /* Per blur, the ticks cover REPEAT_COUNT of them */
+        char row[160];
+        snprintf(row, sizeof(row), "%dx%d,%0.3f,%0.3f,%0.3f,%0.3f,%0.3f,%" PRIu32 ",%d\n",
+            blur_sizes[i], blur_sizes[i],
+            size->gpu_tick / 1000.0f / REPEAT_COUNT,
+            size->cpu_tick / 1000.0f / REPEAT_COUNT,
+            size->direct_tick / 1000.0f / REPEAT_COUNT,
+            size->wide_small_tick / 1000.0f / REPEAT_COUNT,
+            size->wide_large_tick / 1000.0f / REPEAT_COUNT,
+            size->diff_count,
+            size->max_diff);
+        gpu_recorder_write_string(recorder, row);
+    }
+
+    gpu_recorder_delete(recorder);
+}
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    blur_case_t* blur_case = calloc(1, sizeof(blur_case_t));
+    GPU_ASSERT_NULL(blur_case);
+    vg_lite_test_context_set_user_data(ctx, blur_case);
+
+    for (int i = 0; i < SIZE_COUNT; i++) {
+        blur_size_t* size = &blur_case->sizes[i];
+
+        for (int j = 0; j < BLUR_BUFFER_COUNT; j++) {
+            size->gpu_buffers[j] = vg_lite_test_buffer_alloc(
+                &size->buffers[j], blur_sizes[i], blur_sizes[i], VG_LITE_BGRA8888, VG_LITE_TEST_STRIDE_AUTO);
+            if (!size->gpu_buffers[j]) {
+                return VG_LITE_OUT_OF_MEMORY;
+            }
+        }
+
+        fill_source(&size->buffers[BLUR_BUFFER_SRC]);
+    }
+
+    /* The blurs finish on their own, on_draw only shows them */
+    blur_case->tolerance = MATH_MIN(DIFF_TOLERANCE + vg_lite_test_context_get_tolerance(ctx), 0xFF);
+    for (int i = 0; i < SIZE_COUNT; i++) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(run_size(&blur_case->sizes[i], blur_case->tolerance));
+    }
+
+    blur_case->done = true;
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    blur_case_t* blur_case = vg_lite_test_context_get_user_data(ctx);
+
+    /* Source, GPU 3x3, CPU 3x3 and the wide CPU blur side by side */
+    blur_size_t* size = &blur_case->sizes[SHOW_SIZE_INDEX];
+    const float step = blur_sizes[SHOW_SIZE_INDEX] + 8;
+    for (int j = 0; j < BLUR_BUFFER_COUNT; j++) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(show_buffer(ctx, &size->buffers[j], (j % 2) * step, (j / 2) * step));
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    blur_case_t* blur_case = vg_lite_test_context_get_user_data(ctx);
+    if (!blur_case) {
+        return VG_LITE_SUCCESS;
+    }
+
+    if (blur_case->done) {
+        /* The smallest size from which the GPU pays off */
+        int crossover = -1;
+        for (int i = SIZE_COUNT - 1; i >= 0 && blur_case->sizes[i].gpu_tick < blur_case->sizes[i].cpu_tick; i--) {
+            crossover = i;
+        }
+
+        uint8_t max_diff = 0;
+        uint32_t diff_count = 0;
+        for (int i = 0; i < SIZE_COUNT; i++) {
+            max_diff = MATH_MAX(max_diff, blur_case->sizes[i].max_diff);
+            diff_count += blur_case->sizes[i].diff_count;
+        }
+
+        if (diff_count) {
+            vg_lite_test_context_set_failed(ctx, "%" PRIu32 " pixels of the GPU blur differ from the CPU by more than %d",
+                diff_count, blur_case->tolerance);
+        }
+
+        if (crossover >= 0) {
+            vg_lite_test_context_set_remark(ctx, "GPU 3x3 faster from %dx%d; max diff %d",
+                blur_sizes[crossover], blur_sizes[crossover], max_diff);
+        } else {
+            vg_lite_test_context_set_remark(ctx, "CPU 3x3 faster up to %dx%d; max diff %d",
+                blur_sizes[SIZE_COUNT - 1], blur_sizes[SIZE_COUNT - 1], max_diff);
+        }
+
+        write_report(ctx, blur_case);
+    }
+
+    for (int i = 0; i < SIZE_COUNT; i++) {
+        for (int j = 0; j < BLUR_BUFFER_COUNT; j++) {
+            if (blur_case->sizes[i].gpu_buffers[j]) {
+                gpu_buffer_free(blur_case->sizes[i].gpu_buffers[j]);
+            }
+        }
+    }
+
+    free(blur_case);
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(blur_reference, GAUSSIAN_BLUR, "Compare the GPU 3x3 gaussian blur with the CPU reference blur at 32..256 px and report both costs");
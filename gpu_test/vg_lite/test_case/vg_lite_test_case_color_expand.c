@@ -0,0 +1,299 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_assert.h"
+#include "../../gpu_buffer.h"
+#include "../../gpu_cache.h"
+#include "../../gpu_color.h"
+#include "../../gpu_recorder.h"
+#include "../../gpu_tick.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_convert.h"
+#include "../vg_lite_test_utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* 256 x 256 BGR565 pixels hold every 16 bits code once */
+#define BUFFER_SIZE 256
+#define REPEAT_COUNT 16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    EXPAND_METHOD_DIVISION,
+    EXPAND_METHOD_LUT,
+    EXPAND_METHOD_LUT_WORD,
+    EXPAND_METHOD_CONVERT,
+    EXPAND_METHOD_COUNT,
+} expand_method_t;
+
+typedef void (*expand_row_t)(uint32_t* dst, const uint16_t* src, int len);
+
+typedef struct {
+    vg_lite_buffer_t src;
+    vg_lite_buffer_t dst;
+    struct gpu_buffer_s* src_buffer;
+    struct gpu_buffer_s* dst_buffer;
+    uint32_t* expected;
+    uint32_t ticks[EXPAND_METHOD_COUNT];
+    uint32_t mismatches[EXPAND_METHOD_COUNT];
+    bool done;
+} expand_case_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void expand_row_division(uint32_t* dst, const uint16_t* src, int len);
+static void expand_row_lut(uint32_t* dst, const uint16_t* src, int len);
+static void expand_row_lut_word(uint32_t* dst, const uint16_t* src, int len);
+static void expand_row_convert(uint32_t* dst, const uint16_t* src, int len);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const char* method_names[EXPAND_METHOD_COUNT] = {
+    "Division",
+    "LUT",
+    "LUT word-wise",
+    "Convert row",
+};
+
+static const expand_row_t method_rows[EXPAND_METHOD_COUNT] = {
+    expand_row_division,
+    expand_row_lut,
+    expand_row_lut_word,
+    expand_row_convert,
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void expand_row_division(uint32_t* dst, const uint16_t* src, int len)
+{
+    /* The rule itself, the screenshot and pixel readers divided like this before the tables */
+    for (int i = 0; i < len; i++) {
+        const uint32_t b = GPU_COLOR_EXPAND(src[i] & 0x1F, 0x1F);
+        const uint32_t g = GPU_COLOR_EXPAND((src[i] >> 5) & 0x3F, 0x3F);
+        const uint32_t r = GPU_COLOR_EXPAND(src[i] >> 11, 0x1F);
+        dst[i] = 0xFF000000 | r << 16 | g << 8 | b;
+    }
+}
+
+static void expand_row_lut(uint32_t* dst, const uint16_t* src, int len)
+{
+    for (int i = 0; i < len; i++) {
+        const uint32_t b = gpu_color_expand_5_lut[src[i] & 0x1F];
+        const uint32_t g = gpu_color_expand_6_lut[(src[i] >> 5) & 0x3F];
+        const uint32_t r = gpu_color_expand_5_lut[src[i] >> 11];
+        dst[i] = 0xFF000000 | r << 16 | g << 8 | b;
+    }
+}
+
+static void expand_row_lut_word(uint32_t* dst, const uint16_t* src, int len)
+{
+    gpu_color_bgr565_to_bgra8888((gpu_color_bgra8888_t*)dst, (const gpu_color_bgr565_t*)src, len);
+}
+
+static void expand_row_convert(uint32_t* dst, const uint16_t* src, int len)
+{
+    /* What the screenshots, diffs and the CPU backend read */
+    vg_lite_test_convert_row_to_bgra8888(dst, src, VG_LITE_BGR565, NULL, len);
+}
+
+static uint32_t expand_timed(expand_case_t* expand_case, expand_row_t expand_row)
+{
+    const vg_lite_buffer_t* src = &expand_case->src;
+    vg_lite_buffer_t* dst = &expand_case->dst;
+
+    uint32_t start = gpu_tick_get();
+
+    for (int i = 0; i < REPEAT_COUNT; i++) {
+        for (int y = 0; y < src->height; y++) {
+            expand_row(
+                (uint32_t*)((uint8_t*)dst->memory + (size_t)y * dst->stride),
+                (const uint16_t*)((const uint8_t*)src->memory + (size_t)y * src->stride),
+                src->width);
+        }
+    }
+
+    return gpu_tick_elaps(start);
+}
+
+static uint32_t count_mismatches(const expand_case_t* expand_case)
+{
+    const vg_lite_buffer_t* dst = &expand_case->dst;
+    uint32_t mismatches = 0;
+
+    for (int y = 0; y < dst->height; y++) {
+        const uint32_t* row = (const uint32_t*)((const uint8_t*)dst->memory + (size_t)y * dst->stride);
+        const uint32_t* expected = expand_case->expected + (size_t)y * dst->width;
+
+        for (int x = 0; x < dst->width; x++) {
+            mismatches += row[x] != expected[x];
+        }
+    }
+
+    return mismatches;
+}
+
+static void write_report(struct vg_lite_test_context_s* ctx, expand_case_t* expand_case)
+{
+    struct gpu_recorder_s* recorder = vg_lite_test_context_create_report(ctx, "color_expand");
+    if (!recorder) {
+        return;
+    }
+
+    gpu_recorder_write_string(recorder, "Method,Mpix/s,Speedup,Mismatches\n");
+
+    const float pixels = (float)BUFFER_SIZE * BUFFER_SIZE * REPEAT_COUNT;
+    const uint32_t base_tick = expand_case->ticks[EXPAND_METHOD_DIVISION];
+
+    for (int i = 0; i < EXPAND_METHOD_COUNT; i++) {
+        const uint32_t tick = expand_case->ticks[i];
+        char row[96];
+        snprintf(row, sizeof(row), "%s,%0.1f,%0.2f,%d\n",
+            method_names[i],
+            tick ? pixels / tick : 0,
+            tick ? (float)base_tick / tick : 0,
+            (int)expand_case->mismatches[i]);
+        gpu_recorder_write_string(recorder, row);
+    }
+
+    gpu_recorder_delete(recorder);
+}
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    expand_case_t* expand_case = calloc(1, sizeof(expand_case_t));
+    GPU_ASSERT_NULL(expand_case);
+    vg_lite_test_context_set_user_data(ctx, expand_case);
+
+    expand_case->src_buffer = vg_lite_test_buffer_alloc(
+        &expand_case->src, BUFFER_SIZE, BUFFER_SIZE, VG_LITE_BGR565, VG_LITE_TEST_STRIDE_AUTO);
+    expand_case->dst_buffer = vg_lite_test_buffer_alloc(
+        &expand_case->dst, BUFFER_SIZE, BUFFER_SIZE, VG_LITE_BGRA8888, VG_LITE_TEST_STRIDE_AUTO);
+    expand_case->expected = malloc(sizeof(uint32_t) * BUFFER_SIZE * BUFFER_SIZE);
+    if (!expand_case->src_buffer || !expand_case->dst_buffer || !expand_case->expected) {
+        return VG_LITE_OUT_OF_MEMORY;
+    }
+
+    for (int y = 0; y < BUFFER_SIZE; y++) {
+        uint16_t* row = (uint16_t*)((uint8_t*)expand_case->src.memory + (size_t)y * expand_case->src.stride);
+        for (int x = 0; x < BUFFER_SIZE; x++) {
+            row[x] = (uint16_t)(y * BUFFER_SIZE + x);
+        }
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    expand_case_t* expand_case = vg_lite_test_context_get_user_data(ctx);
+
+    for (int i = 0; i < EXPAND_METHOD_COUNT; i++) {
+        expand_case->ticks[i] = expand_timed(expand_case, method_rows[i]);
+
+        if (i == EXPAND_METHOD_DIVISION) {
+            /* The division output is the reference of the other methods */
+            for (int y = 0; y < BUFFER_SIZE; y++) {
+                memcpy(expand_case->expected + (size_t)y * BUFFER_SIZE,
+                    (uint8_t*)expand_case->dst.memory + (size_t)y * expand_case->dst.stride,
+                    sizeof(uint32_t) * BUFFER_SIZE);
+            }
+        }
+
+        expand_case->mismatches[i] = count_mismatches(expand_case);
+    }
+
+    vg_lite_buffer_t* dst = &expand_case->dst;
+    gpu_cache_flush(dst->memory, dst->stride * dst->height);
+
+    vg_lite_matrix_t matrix;
+    vg_lite_test_context_get_transform(ctx, &matrix);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_blit(
+        vg_lite_test_context_get_target_buffer(ctx),
+        dst,
+        &matrix,
+        VG_LITE_BLEND_NONE,
+        0,
+        VG_LITE_FILTER_POINT));
+
+    expand_case->done = true;
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    expand_case_t* expand_case = vg_lite_test_context_get_user_data(ctx);
+    if (!expand_case) {
+        return VG_LITE_SUCCESS;
+    }
+
+    if (expand_case->done) {
+        uint32_t mismatches = 0;
+        for (int i = 0; i < EXPAND_METHOD_COUNT; i++) {
+            mismatches += expand_case->mismatches[i];
+        }
+
+        const uint32_t* ticks = expand_case->ticks;
+        vg_lite_test_context_set_remark(ctx, "%d codes; LUT %0.2fx; word-wise %0.2fx; %d mismatches",
+            BUFFER_SIZE * BUFFER_SIZE,
+            ticks[EXPAND_METHOD_LUT] ? (float)ticks[EXPAND_METHOD_DIVISION] / ticks[EXPAND_METHOD_LUT] : 0,
+            ticks[EXPAND_METHOD_LUT_WORD] ? (float)ticks[EXPAND_METHOD_DIVISION] / ticks[EXPAND_METHOD_LUT_WORD] : 0,
+            (int)mismatches);
+
+        write_report(ctx, expand_case);
+    }
+
+    if (expand_case->src_buffer) {
+        gpu_buffer_free(expand_case->src_buffer);
+    }
+
+    if (expand_case->dst_buffer) {
+        gpu_buffer_free(expand_case->dst_buffer);
+    }
+
+    free(expand_case->expected);
+    free(expand_case);
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(color_expand, NONE, "Expand every BGR565 code to BGRA8888 by division and tables and through the convert module; report the throughput and check they agree");
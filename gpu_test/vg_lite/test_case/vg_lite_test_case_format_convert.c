@@ -0,0 +1,392 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_assert.h"
+#include "../../gpu_buffer.h"
+#include "../../gpu_cache.h"
+#include "../../gpu_math.h"
+#include "../../gpu_recorder.h"
+#include "../../gpu_tick.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_convert.h"
+#include "../vg_lite_test_utils.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define BUFFER_SIZE 256
+#define REPEAT_COUNT 8
+#define CLUT_SIZE 256
+
+/* Round trips shown on the screenshot, after the source */
+#define SHOW_COLUMNS 3
+#define SHOW_SCALE 0.5f
+#define SHOW_GAP 8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    vg_lite_buffer_format_t format;
+    uint8_t bits;
+    bool show;
+} format_item_t;
+
+typedef struct {
+    uint32_t read_tick;
+    uint32_t write_tick;
+    uint8_t max_diff;
+    bool stable;
+} format_result_t;
+
+typedef struct {
+    vg_lite_buffer_t src;
+    vg_lite_buffer_t round_trip;
+    struct gpu_buffer_s* src_buffer;
+    struct gpu_buffer_s* round_trip_buffer;
+    uint32_t clut[CLUT_SIZE];
+    uint32_t copy_tick;
+    format_result_t* results;
+    bool done;
+} convert_case_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const format_item_t format_items[] = {
+    { VG_LITE_BGRA8888, 32, true },
+    { VG_LITE_RGBA8888, 32, false },
+    { VG_LITE_ARGB8888, 32, false },
+    { VG_LITE_ABGR8888, 32, false },
+    { VG_LITE_BGRX8888, 32, false },
+    { VG_LITE_RGBX8888, 32, false },
+    { VG_LITE_XRGB8888, 32, false },
+    { VG_LITE_XBGR8888, 32, false },
+    { VG_LITE_BGR888, 24, false },
+    { VG_LITE_RGB888, 24, false },
+    { VG_LITE_BGRA5658, 24, false },
+    { VG_LITE_RGBA5658, 24, false },
+    { VG_LITE_ABGR8565, 24, false },
+    { VG_LITE_ARGB8565, 24, false },
+    { VG_LITE_BGR565, 16, true },
+    { VG_LITE_RGB565, 16, false },
+    { VG_LITE_RGBA4444, 16, true },
+    { VG_LITE_BGRA4444, 16, false },
+    { VG_LITE_ABGR4444, 16, false },
+    { VG_LITE_ARGB4444, 16, false },
+    { VG_LITE_BGRA5551, 16, false },
+    { VG_LITE_RGBA5551, 16, false },
+    { VG_LITE_ABGR1555, 16, true },
+    { VG_LITE_ARGB1555, 16, false },
+    { VG_LITE_RGBA2222, 8, false },
+    { VG_LITE_BGRA2222, 8, true },
+    { VG_LITE_ABGR2222, 8, false },
+    { VG_LITE_ARGB2222, 8, false },
+    { VG_LITE_A8, 8, false },
+    { VG_LITE_L8, 8, true },
+    { VG_LITE_A4, 4, false },
+    { VG_LITE_INDEX_8, 8, false },
+    { VG_LITE_INDEX_4, 4, false },
+    { VG_LITE_INDEX_2, 2, false },
+    { VG_LITE_INDEX_1, 1, false },
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define FORMAT_COUNT (int)(sizeof(format_items) / sizeof(format_items[0]))
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void fill_source(vg_lite_buffer_t* buffer)
+{
+    /* Every channel covers its full range, the alpha steps between quadrants */
+    for (int y = 0; y < buffer->height; y++) {
+        uint32_t* row = (uint32_t*)((uint8_t*)buffer->memory + (size_t)y * buffer->stride);
+
+        for (int x = 0; x < buffer->width; x++) {
+            uint32_t a = 0xFF - ((x / 128) + (y / 128) * 2) * 0x40;
+            row[x] = a << 24 | (uint32_t)(x & 0xFF) << 16 | (uint32_t)(y & 0xFF) << 8 | ((x + y) / 2 & 0xFF);
+        }
+    }
+}
+
+static void fill_index(vg_lite_buffer_t* buffer)
+{
+    for (int y = 0; y < buffer->height; y++) {
+        uint8_t* row = (uint8_t*)buffer->memory + (size_t)y * buffer->stride;
+        for (int x = 0; x < buffer->stride; x++) {
+            row[x] = (uint8_t)(x + y);
+        }
+    }
+}
+
+static bool rows_equal(const vg_lite_buffer_t* a, const vg_lite_buffer_t* b, int bits)
+{
+    /* Only the pixel bytes, the stride padding is not written */
+    const size_t row_size = ((size_t)a->width * bits + 7) / 8;
+
+    for (int y = 0; y < a->height; y++) {
+        if (memcmp((const uint8_t*)a->memory + (size_t)y * a->stride,
+                (const uint8_t*)b->memory + (size_t)y * b->stride, row_size)
+            != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool convert_timed(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src, const uint32_t* clut, uint32_t* tick)
+{
+    uint32_t start = gpu_tick_get();
+
+    for (int i = 0; i < REPEAT_COUNT; i++) {
+        if (!vg_lite_test_convert_buffer(dst, src, clut)) {
+            GPU_LOG_ERROR("Failed to convert %s to %s",
+                vg_lite_test_buffer_format_string(src->format),
+                vg_lite_test_buffer_format_string(dst->format));
+            return false;
+        }
+    }
+
+    *tick = gpu_tick_elaps(start);
+    return true;
+}
+
+static vg_lite_error_t run_format(convert_case_t* convert_case, const format_item_t* item, format_result_t* result)
+{
+    vg_lite_buffer_t buffer;
+    struct gpu_buffer_s* gpu_buffer = vg_lite_test_buffer_alloc(
+        &buffer, BUFFER_SIZE, BUFFER_SIZE, item->format, VG_LITE_TEST_STRIDE_AUTO);
+    if (!gpu_buffer) {
+        return VG_LITE_OUT_OF_MEMORY;
+    }
+
+    const bool writable = vg_lite_test_convert_is_supported(item->format, true);
+    if (writable) {
+        if (!convert_timed(&buffer, &convert_case->src, NULL, &result->write_tick)) {
+            gpu_buffer_free(gpu_buffer);
+            return VG_LITE_NOT_SUPPORT;
+        }
+    } else {
+        fill_index(&buffer);
+    }
+
+    if (!convert_timed(&convert_case->round_trip, &buffer, convert_case->clut, &result->read_tick)) {
+        gpu_buffer_free(gpu_buffer);
+        return VG_LITE_NOT_SUPPORT;
+    }
+
+    vg_lite_test_buffer_diff(&convert_case->src, &convert_case->round_trip, 0, &result->max_diff);
+
+    /* Writing the round trip again must give the same bits */
+    if (writable) {
+        vg_lite_buffer_t again;
+        struct gpu_buffer_s* again_buffer = vg_lite_test_buffer_alloc(
+            &again, BUFFER_SIZE, BUFFER_SIZE, item->format, VG_LITE_TEST_STRIDE_AUTO);
+        if (!again_buffer) {
+            gpu_buffer_free(gpu_buffer);
+            return VG_LITE_OUT_OF_MEMORY;
+        }
+
+        result->stable = vg_lite_test_convert_buffer(&again, &convert_case->round_trip, NULL)
+            && rows_equal(&buffer, &again, item->bits);
+        gpu_buffer_free(again_buffer);
+    }
+
+    gpu_buffer_free(gpu_buffer);
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t show_round_trip(struct vg_lite_test_context_s* ctx, vg_lite_buffer_t* buffer, int index)
+{
+    const float step = BUFFER_SIZE * SHOW_SCALE + SHOW_GAP;
+
+    vg_lite_matrix_t matrix;
+    vg_lite_test_context_get_transform(ctx, &matrix);
+    vg_lite_translate((index % SHOW_COLUMNS) * step, (index / SHOW_COLUMNS) * step, &matrix);
+    vg_lite_scale(SHOW_SCALE, SHOW_SCALE, &matrix);
+
+    gpu_cache_flush(buffer->memory, buffer->stride * buffer->height);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_blit(
+        vg_lite_test_context_get_target_buffer(ctx),
+        buffer,
+        &matrix,
+        VG_LITE_BLEND_SRC_OVER,
+        0,
+        VG_LITE_FILTER_BI_LINEAR));
+
+    /* The round trip buffer is reused by the next format */
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+    return VG_LITE_SUCCESS;
+}
+
+static void write_report(struct vg_lite_test_context_s* ctx, convert_case_t* convert_case)
+{
+    struct gpu_recorder_s* recorder = vg_lite_test_context_create_report(ctx, "format_convert");
+    if (!recorder) {
+        return;
+    }
+
+    gpu_recorder_write_string(recorder,
+        "Format,Bits,To BGRA8888(Mpix/s),To BGRA8888(MB/s),From BGRA8888(Mpix/s),Round Trip Max Diff,Stable\n");
+
+    const float pixels = (float)BUFFER_SIZE * BUFFER_SIZE * REPEAT_COUNT;
+
+    /* The memcpy of the BGRA8888 source is the bandwidth bound */
+    char row[160];
+    snprintf(row, sizeof(row), "memcpy,32,%0.1f,%0.1f,-,-,-\n",
+        convert_case->copy_tick ? pixels / convert_case->copy_tick : 0,
+        convert_case->copy_tick ? pixels * 4 / convert_case->copy_tick : 0);
+    gpu_recorder_write_string(recorder, row);
+
+    for (int i = 0; i < FORMAT_COUNT; i++) {
+        const format_item_t* item = &format_items[i];
+        const format_result_t* result = &convert_case->results[i];
+
+        char write[16] = "-";
+        char stable[8] = "-";
+        if (vg_lite_test_convert_is_supported(item->format, true)) {
+            snprintf(write, sizeof(write), "%0.1f", result->write_tick ? pixels / result->write_tick : 0);
+            snprintf(stable, sizeof(stable), "%s", result->stable ? "Yes" : "No");
+        }
+
+        snprintf(row, sizeof(row), "%s,%d,%0.1f,%0.1f,%s,%d,%s\n",
+            vg_lite_test_buffer_format_string(item->format),
+            item->bits,
+            result->read_tick ? pixels / result->read_tick : 0,
+            result->read_tick ? pixels * item->bits / 8 / result->read_tick : 0,
+            write,
+            result->max_diff,
+            stable);
+        gpu_recorder_write_string(recorder, row);
+    }
+
+    gpu_recorder_delete(recorder);
+}
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    convert_case_t* convert_case = calloc(1, sizeof(convert_case_t));
+    GPU_ASSERT_NULL(convert_case);
+    vg_lite_test_context_set_user_data(ctx, convert_case);
+
+    convert_case->results = calloc(FORMAT_COUNT, sizeof(format_result_t));
+    GPU_ASSERT_NULL(convert_case->results);
+
+    convert_case->src_buffer = vg_lite_test_buffer_alloc(
+        &convert_case->src, BUFFER_SIZE, BUFFER_SIZE, VG_LITE_BGRA8888, VG_LITE_TEST_STRIDE_AUTO);
+    convert_case->round_trip_buffer = vg_lite_test_buffer_alloc(
+        &convert_case->round_trip, BUFFER_SIZE, BUFFER_SIZE, VG_LITE_BGRA8888, VG_LITE_TEST_STRIDE_AUTO);
+    if (!convert_case->src_buffer || !convert_case->round_trip_buffer) {
+        return VG_LITE_OUT_OF_MEMORY;
+    }
+
+    fill_source(&convert_case->src);
+
+    /* Opaque warm to cold ramp for the index formats */
+    for (int i = 0; i < CLUT_SIZE; i++) {
+        convert_case->clut[i] = 0xFF000000 | (uint32_t)i << 16 | (uint32_t)(0xFF - i);
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    convert_case_t* convert_case = vg_lite_test_context_get_user_data(ctx);
+
+    const size_t size = (size_t)convert_case->src.stride * convert_case->src.height;
+    uint32_t start = gpu_tick_get();
+    for (int i = 0; i < REPEAT_COUNT; i++) {
+        memcpy(convert_case->round_trip.memory, convert_case->src.memory, size);
+    }
+    convert_case->copy_tick = gpu_tick_elaps(start);
+
+    int show_index = 0;
+    for (int i = 0; i < FORMAT_COUNT; i++) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(run_format(convert_case, &format_items[i], &convert_case->results[i]));
+
+        if (format_items[i].show) {
+            VG_LITE_TEST_CHECK_ERROR_RETURN(show_round_trip(ctx, &convert_case->round_trip, show_index++));
+        }
+    }
+
+    convert_case->done = true;
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    convert_case_t* convert_case = vg_lite_test_context_get_user_data(ctx);
+    if (!convert_case) {
+        return VG_LITE_SUCCESS;
+    }
+
+    if (convert_case->done) {
+        int unstable = 0;
+        for (int i = 0; i < FORMAT_COUNT; i++) {
+            if (vg_lite_test_convert_is_supported(format_items[i].format, true) && !convert_case->results[i].stable) {
+                unstable++;
+            }
+        }
+
+        const float pixels = (float)BUFFER_SIZE * BUFFER_SIZE * REPEAT_COUNT;
+        vg_lite_test_context_set_remark(ctx, "%d formats; %d unstable round trips; memcpy %0.1f MB/s",
+            FORMAT_COUNT, unstable, convert_case->copy_tick ? pixels * 4 / convert_case->copy_tick : 0);
+
+        write_report(ctx, convert_case);
+    }
+
+    if (convert_case->src_buffer) {
+        gpu_buffer_free(convert_case->src_buffer);
+    }
+
+    if (convert_case->round_trip_buffer) {
+        gpu_buffer_free(convert_case->round_trip_buffer);
+    }
+
+    free(convert_case->results);
+    free(convert_case);
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(format_convert, NONE, "Convert every pixel format to and from BGRA8888 on the CPU; report the throughput and check the round trips");
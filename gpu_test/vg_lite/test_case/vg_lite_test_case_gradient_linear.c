@@ -18,10 +18,12 @@
  *      INCLUDES
  *********************/
 
+#include "../../gpu_assert.h"
 #include "../../gpu_math.h"
 #include "../vg_lite_test_context.h"
 #include "../vg_lite_test_utils.h"
 #include "../vg_lite_test_path.h"
+#include <stdlib.h>
 #include <string.h>
 
 /*********************
@@ -73,10 +75,10 @@ static void grad_point_to_matrix(vg_lite_matrix_t* grad_matrix, float x1, float
 
 static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
 {
-    static vg_lite_linear_gradient_t linear_grad;
-    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_init_grad(&linear_grad));
-
-    vg_lite_test_context_set_user_data(ctx, &linear_grad);
+    vg_lite_linear_gradient_t* linear_grad = calloc(1, sizeof(vg_lite_linear_gradient_t));
+    GPU_ASSERT_NULL(linear_grad);
+    vg_lite_test_context_set_user_data(ctx, linear_grad);
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_init_grad(linear_grad));
 
     vg_lite_uint32_t colors[] = {
         0xFFFF0000,
@@ -90,9 +92,9 @@ static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
         192,
     };
 
-    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_set_grad(&linear_grad, 3, colors, stops));
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_set_grad(linear_grad, 3, colors, stops));
 
-    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_update_grad(&linear_grad));
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_update_grad(linear_grad));
 
     return VG_LITE_SUCCESS;
 }
@@ -128,9 +130,13 @@ static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
 static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
 {
     vg_lite_linear_gradient_t* linear_grad = vg_lite_test_context_get_user_data(ctx);
-    if (linear_grad) {
-        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear_grad(linear_grad));
+    if (!linear_grad) {
+        return VG_LITE_SUCCESS;
     }
+
+    vg_lite_error_t error = vg_lite_clear_grad(linear_grad);
+    free(linear_grad);
+    VG_LITE_TEST_CHECK_ERROR_RETURN(error);
     return VG_LITE_SUCCESS;
 }
 
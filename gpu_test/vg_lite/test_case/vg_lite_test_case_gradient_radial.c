@@ -18,9 +18,11 @@
  *      INCLUDES
  *********************/
 
+#include "../../gpu_assert.h"
 #include "../vg_lite_test_context.h"
 #include "../vg_lite_test_path.h"
 #include "../vg_lite_test_utils.h"
+#include <stdlib.h>
 #include <string.h>
 
 /*********************
@@ -67,21 +69,20 @@ static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
         .fy = 50,
     };
 
-    static vg_lite_radial_gradient_t radial_grad;
-    memset(&radial_grad, 0, sizeof(vg_lite_radial_gradient_t));
+    vg_lite_radial_gradient_t* radial_grad = calloc(1, sizeof(vg_lite_radial_gradient_t));
+    GPU_ASSERT_NULL(radial_grad);
+    vg_lite_test_context_set_user_data(ctx, radial_grad);
 
     VG_LITE_TEST_CHECK_ERROR_RETURN(
         vg_lite_set_radial_grad(
-            &radial_grad,
+            radial_grad,
             sizeof(color_ramp) / sizeof(vg_lite_color_ramp_t),
             color_ramp,
             grad_param,
             VG_LITE_GRADIENT_SPREAD_PAD,
             1));
 
-    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_update_radial_grad(&radial_grad));
-
-    vg_lite_test_context_set_user_data(ctx, &radial_grad);
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_update_radial_grad(radial_grad));
 
     return VG_LITE_SUCCESS;
 }
@@ -118,9 +119,13 @@ static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
 static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
 {
     vg_lite_radial_gradient_t* radial_grad = vg_lite_test_context_get_user_data(ctx);
-    if (radial_grad) {
-        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear_radial_grad(radial_grad));
+    if (!radial_grad) {
+        return VG_LITE_SUCCESS;
     }
+
+    vg_lite_error_t error = vg_lite_clear_radial_grad(radial_grad);
+    free(radial_grad);
+    VG_LITE_TEST_CHECK_ERROR_RETURN(error);
     return VG_LITE_SUCCESS;
 }
 
@@ -0,0 +1,573 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_assert.h"
+#include "../../gpu_buffer.h"
+#include "../../gpu_cache.h"
+#include "../../gpu_math.h"
+#include "../../gpu_recorder.h"
+#include "../../gpu_tick.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_gradient.h"
+#include "../vg_lite_test_path.h"
+#include "../vg_lite_test_utils.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define SIZE_COUNT 3
+#define SPREAD_COUNT 3
+#define STOP_CASE_COUNT 4
+#define REPEAT_COUNT 8
+#define DIFF_TOLERANCE 2
+
+/* The ramp of the fill benchmarks */
+#define FILL_STOP_COUNT 4
+
+/* The size shown on the screenshot */
+#define SHOW_SIZE_INDEX 1
+#define SHOW_GAP 8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    GRADIENT_TYPE_LINEAR,
+    GRADIENT_TYPE_RADIAL,
+    GRADIENT_TYPE_COUNT,
+} gradient_type_t;
+
+typedef struct {
+    bool gpu_done;
+    uint32_t gpu_tick;
+    uint32_t cpu_tick;
+    uint32_t diff_count;
+    uint8_t max_diff;
+} fill_result_t;
+
+typedef struct {
+    uint32_t linear_tick;
+    uint32_t radial_tick;
+    uint32_t cpu_tick;
+} ramp_result_t;
+
+typedef struct {
+    vg_lite_buffer_t gpu_buffer;
+    vg_lite_buffer_t cpu_buffer;
+    struct gpu_buffer_s* gpu_buffer_handle;
+    struct gpu_buffer_s* cpu_buffer_handle;
+    vg_lite_test_path_t* path;
+} gradient_size_t;
+
+typedef struct {
+    vg_lite_buffer_t buffer;
+    struct gpu_buffer_s* buffer_handle;
+} gradient_tile_t;
+
+typedef struct {
+    gradient_size_t sizes[SIZE_COUNT];
+    gradient_tile_t tiles[GRADIENT_TYPE_COUNT][SPREAD_COUNT];
+    fill_result_t fills[GRADIENT_TYPE_COUNT][SPREAD_COUNT][SIZE_COUNT];
+    ramp_result_t ramps[STOP_CASE_COUNT];
+    vg_lite_color_ramp_t color_ramp[VLC_MAX_COLOR_RAMP_STOPS];
+    uint32_t lut[VG_LITE_TEST_GRADIENT_LUT_SIZE];
+    vg_lite_ext_linear_gradient_t linear_grad;
+    vg_lite_radial_gradient_t radial_grad;
+    bool linear_supported;
+    uint8_t tolerance;
+    bool done;
+} gradient_case_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const int gradient_sizes[SIZE_COUNT] = { 64, 128, 256 };
+
+static const int stop_counts[STOP_CASE_COUNT] = { 2, 8, 32, 128 };
+
+static const vg_lite_gradient_spreadmode_t spread_modes[SPREAD_COUNT] = {
+    VG_LITE_GRADIENT_SPREAD_PAD,
+    VG_LITE_GRADIENT_SPREAD_REPEAT,
+    VG_LITE_GRADIENT_SPREAD_REFLECT,
+};
+
+static const char* const spread_names[SPREAD_COUNT] = { "PAD", "REPEAT", "REFLECT" };
+
+static const char* const type_names[GRADIENT_TYPE_COUNT] = { "Linear", "Radial" };
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void make_ramp(vg_lite_color_ramp_t* color_ramp, int count)
+{
+    /* Evenly spaced stops cycling through red, green, blue and half transparent white */
+    static const float colors[][4] = {
+        { 1, 0, 0, 1 },
+        { 0, 1, 0, 1 },
+        { 0, 0, 1, 1 },
+        { 1, 1, 1, 0.5f },
+    };
+
+    for (int i = 0; i < count; i++) {
+        const float* c = colors[i % (sizeof(colors) / sizeof(colors[0]))];
+        color_ramp[i].stop = count > 1 ? (float)i / (count - 1) : 0;
+        color_ramp[i].red = c[0];
+        color_ramp[i].green = c[1];
+        color_ramp[i].blue = c[2];
+        color_ramp[i].alpha = c[3];
+    }
+}
+
+static vg_lite_linear_gradient_parameter_t linear_param(int size)
+{
+    /* A quarter of the size per ramp, so the spread mode covers most of the area */
+    const vg_lite_linear_gradient_parameter_t param = {
+        .X0 = size * 0.25f,
+        .Y0 = size * 0.25f,
+        .X1 = size * 0.5f,
+        .Y1 = size * 0.375f,
+    };
+    return param;
+}
+
+static vg_lite_radial_gradient_parameter_t radial_param(int size)
+{
+    const vg_lite_radial_gradient_parameter_t param = {
+        .cx = size * 0.5f,
+        .cy = size * 0.5f,
+        .r = size * 0.25f,
+        .fx = size * 0.5625f,
+        .fy = size * 0.5f,
+    };
+    return param;
+}
+
+static vg_lite_error_t set_grad(gradient_case_t* gradient_case, gradient_type_t type, int count,
+    vg_lite_gradient_spreadmode_t spread_mode, int size)
+{
+    if (type == GRADIENT_TYPE_LINEAR) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_set_linear_grad(
+            &gradient_case->linear_grad, count, gradient_case->color_ramp, linear_param(size), spread_mode, 0));
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_update_linear_grad(&gradient_case->linear_grad));
+        vg_lite_identity(vg_lite_get_linear_grad_matrix(&gradient_case->linear_grad));
+    } else {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_set_radial_grad(
+            &gradient_case->radial_grad, count, gradient_case->color_ramp, radial_param(size), spread_mode, 0));
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_update_radial_grad(&gradient_case->radial_grad));
+        vg_lite_identity(vg_lite_get_radial_grad_matrix(&gradient_case->radial_grad));
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t clear_grad(gradient_case_t* gradient_case, gradient_type_t type)
+{
+    if (type == GRADIENT_TYPE_LINEAR) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear_linear_grad(&gradient_case->linear_grad));
+    } else {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear_radial_grad(&gradient_case->radial_grad));
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t run_ramp(gradient_case_t* gradient_case, ramp_result_t* result, int count)
+{
+    make_ramp(gradient_case->color_ramp, count);
+
+    /* The driver allocates the ramp image on every update, so each round clears it again */
+    for (int type = 0; type < GRADIENT_TYPE_COUNT; type++) {
+        if (type == GRADIENT_TYPE_LINEAR && !gradient_case->linear_supported) {
+            continue;
+        }
+
+        uint32_t start = gpu_tick_get();
+        for (int i = 0; i < REPEAT_COUNT; i++) {
+            VG_LITE_TEST_CHECK_ERROR_RETURN(set_grad(gradient_case, type, count, VG_LITE_GRADIENT_SPREAD_PAD, 64));
+            VG_LITE_TEST_CHECK_ERROR_RETURN(clear_grad(gradient_case, type));
+        }
+
+        uint32_t tick = gpu_tick_elaps(start);
+        if (type == GRADIENT_TYPE_LINEAR) {
+            result->linear_tick = tick;
+        } else {
+            result->radial_tick = tick;
+        }
+    }
+
+    uint32_t start = gpu_tick_get();
+    for (int i = 0; i < REPEAT_COUNT; i++) {
+        if (!vg_lite_test_gradient_build_lut(gradient_case->lut, gradient_case->color_ramp, count, false)) {
+            GPU_LOG_ERROR("Failed to build the LUT of %d stops", count);
+            return VG_LITE_NOT_SUPPORT;
+        }
+    }
+    result->cpu_tick = gpu_tick_elaps(start);
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t gpu_fill(gradient_case_t* gradient_case, gradient_type_t type, gradient_size_t* size)
+{
+    vg_lite_matrix_t matrix;
+    vg_lite_identity(&matrix);
+
+    if (type == GRADIENT_TYPE_LINEAR) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_draw_linear_grad(
+            &size->gpu_buffer,
+            vg_lite_test_path_get_path(size->path),
+            VG_LITE_FILL_NON_ZERO,
+            &matrix,
+            &gradient_case->linear_grad,
+            0,
+            VG_LITE_BLEND_NONE,
+            VG_LITE_FILTER_BI_LINEAR));
+    } else {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_draw_radial_grad(
+            &size->gpu_buffer,
+            vg_lite_test_path_get_path(size->path),
+            VG_LITE_FILL_NON_ZERO,
+            &matrix,
+            &gradient_case->radial_grad,
+            0,
+            VG_LITE_BLEND_NONE,
+            VG_LITE_FILTER_BI_LINEAR));
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static bool cpu_fill(gradient_case_t* gradient_case, gradient_type_t type, gradient_size_t* size, vg_lite_gradient_spreadmode_t spread_mode)
+{
+    vg_lite_matrix_t matrix;
+    vg_lite_identity(&matrix);
+    const int width = size->cpu_buffer.width;
+
+    if (type == GRADIENT_TYPE_LINEAR) {
+        const vg_lite_linear_gradient_parameter_t param = linear_param(width);
+        return vg_lite_test_gradient_fill_linear(&size->cpu_buffer, NULL, gradient_case->lut, spread_mode, &param, &matrix);
+    }
+
+    const vg_lite_radial_gradient_parameter_t param = radial_param(width);
+    return vg_lite_test_gradient_fill_radial(&size->cpu_buffer, NULL, gradient_case->lut, spread_mode, &param, &matrix);
+}
+
+static vg_lite_error_t show_buffer(struct vg_lite_test_context_s* ctx, vg_lite_buffer_t* buffer, float x, float y)
+{
+    vg_lite_matrix_t matrix;
+    vg_lite_test_context_get_transform(ctx, &matrix);
+    vg_lite_translate(x, y, &matrix);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_blit(
+        vg_lite_test_context_get_target_buffer(ctx),
+        buffer,
+        &matrix,
+        VG_LITE_BLEND_SRC_OVER,
+        0,
+        VG_LITE_FILTER_POINT));
+
+    return VG_LITE_SUCCESS;
+}
+
+static void keep_tile(const vg_lite_buffer_t* src, vg_lite_buffer_t* tile)
+{
+    /* Later fills reuse the buffers, the tile keeps the shown result until on_draw */
+    gpu_cache_invalidate(src->memory, src->stride * src->height);
+    memcpy(tile->memory, src->memory, tile->stride * tile->height);
+    gpu_cache_flush(tile->memory, tile->stride * tile->height);
+}
+
+static vg_lite_error_t run_fill(gradient_case_t* gradient_case, gradient_type_t type, int spread)
+{
+    const vg_lite_gradient_spreadmode_t spread_mode = spread_modes[spread];
+    const bool gpu_enabled = type != GRADIENT_TYPE_LINEAR || gradient_case->linear_supported;
+
+    for (int i = 0; i < SIZE_COUNT; i++) {
+        gradient_size_t* size = &gradient_case->sizes[i];
+        fill_result_t* result = &gradient_case->fills[type][spread][i];
+
+        if (gpu_enabled) {
+            VG_LITE_TEST_CHECK_ERROR_RETURN(set_grad(gradient_case, type, FILL_STOP_COUNT, spread_mode, gradient_sizes[i]));
+
+            uint32_t start = gpu_tick_get();
+            for (int j = 0; j < REPEAT_COUNT; j++) {
+                VG_LITE_TEST_CHECK_ERROR_RETURN(gpu_fill(gradient_case, type, size));
+            }
+            VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+            result->gpu_tick = gpu_tick_elaps(start);
+            result->gpu_done = true;
+
+            VG_LITE_TEST_CHECK_ERROR_RETURN(clear_grad(gradient_case, type));
+        }
+
+        uint32_t start = gpu_tick_get();
+        for (int j = 0; j < REPEAT_COUNT; j++) {
+            if (!cpu_fill(gradient_case, type, size, spread_mode)) {
+                GPU_LOG_ERROR("CPU %s gradient fill failed", type_names[type]);
+                return VG_LITE_NOT_SUPPORT;
+            }
+        }
+        result->cpu_tick = gpu_tick_elaps(start);
+
+        gpu_cache_flush(size->cpu_buffer.memory, size->cpu_buffer.stride * size->cpu_buffer.height);
+
+        if (result->gpu_done) {
+            result->diff_count = vg_lite_test_buffer_diff(
+                &size->gpu_buffer, &size->cpu_buffer, gradient_case->tolerance, &result->max_diff);
+        }
+
+        /* The CPU result if the GPU has no such gradient */
+        if (i == SHOW_SIZE_INDEX) {
+            keep_tile(result->gpu_done ? &size->gpu_buffer : &size->cpu_buffer, &gradient_case->tiles[type][spread].buffer);
+        }
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static void write_ramp_report(struct vg_lite_test_context_s* ctx, gradient_case_t* gradient_case)
+{
+    struct gpu_recorder_s* recorder = vg_lite_test_context_create_report(ctx, "gradient_ramp");
+    if (!recorder) {
+        return;
+    }
+
+    gpu_recorder_write_string(recorder, "Stops,GPU Linear Ramp(us),GPU Radial Ramp(us),CPU LUT(us)\n");
+
+    for (int i = 0; i < STOP_CASE_COUNT; i++) {
+        const ramp_result_t* ramp = &gradient_case->ramps[i];
+
+        /* Per update, the ticks cover REPEAT_COUNT of them */
+        char linear[16] = "-";
+        if (gradient_case->linear_supported) {
+            snprintf(linear, sizeof(linear), "%0.1f", (float)ramp->linear_tick / REPEAT_COUNT);
+        }
+
+        char row[96];
+        snprintf(row, sizeof(row), "%d,%s,%0.1f,%0.1f\n",
+            stop_counts[i],
+            linear,
+            (float)ramp->radial_tick / REPEAT_COUNT,
+            (float)ramp->cpu_tick / REPEAT_COUNT);
+        gpu_recorder_write_string(recorder, row);
+    }
+
+    gpu_recorder_delete(recorder);
+}
+
+static void write_fill_report(struct vg_lite_test_context_s* ctx, gradient_case_t* gradient_case)
+{
+    struct gpu_recorder_s* recorder = vg_lite_test_context_create_report(ctx, "gradient_fill");
+    if (!recorder) {
+        return;
+    }
+
+    gpu_recorder_write_string(recorder,
+        "Gradient,Spread,Size,GPU(ms),CPU(ms),CPU(Mpix/s),Diff Pixels,Max Diff\n");
+
+    for (int type = 0; type < GRADIENT_TYPE_COUNT; type++) {
+        for (int spread = 0; spread < SPREAD_COUNT; spread++) {
+            for (int i = 0; i < SIZE_COUNT; i++) {
+                const fill_result_t* result = &gradient_case->fills[type][spread][i];
+                const uint32_t pixels = (uint32_t)gradient_sizes[i] * gradient_sizes[i] * REPEAT_COUNT;
+
+                char gpu_ms[16] = "-";
+                char diff[32] = "-,-";
+                if (result->gpu_done) {
+                    snprintf(gpu_ms, sizeof(gpu_ms), "%0.3f", result->gpu_tick / 1000.0f / REPEAT_COUNT);
+                    snprintf(diff, sizeof(diff), "%" PRIu32 ",%d", result->diff_count, result->max_diff);
+                }
+
+                char row[160];
+                snprintf(row, sizeof(row), "%s,%s,%dx%d,%s,%0.3f,%0.2f,%s\n",
+                    type_names[type],
+                    spread_names[spread],
+                    gradient_sizes[i], gradient_sizes[i],
+                    gpu_ms,
+                    result->cpu_tick / 1000.0f / REPEAT_COUNT,
+                    result->cpu_tick ? (float)pixels / result->cpu_tick : 0,
+                    diff);
+                gpu_recorder_write_string(recorder, row);
+            }
+        }
+    }
+
+    gpu_recorder_delete(recorder);
+}
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    gradient_case_t* gradient_case = calloc(1, sizeof(gradient_case_t));
+    GPU_ASSERT_NULL(gradient_case);
+    vg_lite_test_context_set_user_data(ctx, gradient_case);
+
+    gradient_case->linear_supported = vg_lite_query_feature(gcFEATURE_BIT_VG_LINEAR_GRADIENT_EXT);
+
+    for (int i = 0; i < SIZE_COUNT; i++) {
+        gradient_size_t* size = &gradient_case->sizes[i];
+        const int s = gradient_sizes[i];
+
+        size->gpu_buffer_handle = vg_lite_test_buffer_alloc(&size->gpu_buffer, s, s, VG_LITE_BGRA8888, VG_LITE_TEST_STRIDE_AUTO);
+        size->cpu_buffer_handle = vg_lite_test_buffer_alloc(&size->cpu_buffer, s, s, VG_LITE_BGRA8888, VG_LITE_TEST_STRIDE_AUTO);
+        if (!size->gpu_buffer_handle || !size->cpu_buffer_handle) {
+            return VG_LITE_OUT_OF_MEMORY;
+        }
+
+        size->path = vg_lite_test_path_create(VG_LITE_FP32);
+        vg_lite_test_path_set_bounding_box(size->path, 0, 0, s, s);
+        vg_lite_test_path_append_rect(size->path, 0, 0, s, s, 0);
+        vg_lite_test_path_end(size->path);
+    }
+
+    const int show_size = gradient_sizes[SHOW_SIZE_INDEX];
+    for (int type = 0; type < GRADIENT_TYPE_COUNT; type++) {
+        for (int spread = 0; spread < SPREAD_COUNT; spread++) {
+            gradient_tile_t* tile = &gradient_case->tiles[type][spread];
+            tile->buffer_handle = vg_lite_test_buffer_alloc(
+                &tile->buffer, show_size, show_size, VG_LITE_BGRA8888, VG_LITE_TEST_STRIDE_AUTO);
+            if (!tile->buffer_handle) {
+                return VG_LITE_OUT_OF_MEMORY;
+            }
+        }
+    }
+
+    /* The timed ramps and fills finish on their own, on_draw only shows the tiles */
+    for (int i = 0; i < STOP_CASE_COUNT; i++) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(run_ramp(gradient_case, &gradient_case->ramps[i], stop_counts[i]));
+    }
+
+    /* The fills share one ramp, its LUT is built once */
+    make_ramp(gradient_case->color_ramp, FILL_STOP_COUNT);
+    if (!vg_lite_test_gradient_build_lut(gradient_case->lut, gradient_case->color_ramp, FILL_STOP_COUNT, false)) {
+        GPU_LOG_ERROR("Failed to build the LUT of %d stops", FILL_STOP_COUNT);
+        return VG_LITE_NOT_SUPPORT;
+    }
+
+    gradient_case->tolerance = MATH_MIN(DIFF_TOLERANCE + vg_lite_test_context_get_tolerance(ctx), 0xFF);
+    for (int type = 0; type < GRADIENT_TYPE_COUNT; type++) {
+        for (int spread = 0; spread < SPREAD_COUNT; spread++) {
+            VG_LITE_TEST_CHECK_ERROR_RETURN(run_fill(gradient_case, type, spread));
+        }
+    }
+
+    gradient_case->done = true;
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    gradient_case_t* gradient_case = vg_lite_test_context_get_user_data(ctx);
+
+    /* One tile per gradient and spread mode */
+    const float step = gradient_sizes[SHOW_SIZE_INDEX] + SHOW_GAP;
+    for (int type = 0; type < GRADIENT_TYPE_COUNT; type++) {
+        for (int spread = 0; spread < SPREAD_COUNT; spread++) {
+            VG_LITE_TEST_CHECK_ERROR_RETURN(show_buffer(
+                ctx, &gradient_case->tiles[type][spread].buffer, spread * step, type * step));
+        }
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    gradient_case_t* gradient_case = vg_lite_test_context_get_user_data(ctx);
+    if (!gradient_case) {
+        return VG_LITE_SUCCESS;
+    }
+
+    if (gradient_case->done) {
+        uint8_t max_diff = 0;
+        uint32_t diff_count = 0;
+        for (int type = 0; type < GRADIENT_TYPE_COUNT; type++) {
+            for (int spread = 0; spread < SPREAD_COUNT; spread++) {
+                for (int i = 0; i < SIZE_COUNT; i++) {
+                    max_diff = MATH_MAX(max_diff, gradient_case->fills[type][spread][i].max_diff);
+                    diff_count += gradient_case->fills[type][spread][i].diff_count;
+                }
+            }
+        }
+
+        if (diff_count) {
+            vg_lite_test_context_set_failed(ctx, "%" PRIu32 " pixels of the GPU gradients differ from the CPU by more than %d",
+                diff_count, gradient_case->tolerance);
+        }
+
+        const ramp_result_t* ramp = &gradient_case->ramps[STOP_CASE_COUNT - 1];
+        vg_lite_test_context_set_remark(ctx, "Max diff %d; %d stop ramp: GPU %0.1f us vs CPU LUT %0.1f us",
+            max_diff,
+            stop_counts[STOP_CASE_COUNT - 1],
+            (float)ramp->radial_tick / REPEAT_COUNT,
+            (float)ramp->cpu_tick / REPEAT_COUNT);
+
+        write_ramp_report(ctx, gradient_case);
+        write_fill_report(ctx, gradient_case);
+    }
+
+    for (int i = 0; i < SIZE_COUNT; i++) {
+        gradient_size_t* size = &gradient_case->sizes[i];
+        if (size->gpu_buffer_handle) {
+            gpu_buffer_free(size->gpu_buffer_handle);
+        }
+
+        if (size->cpu_buffer_handle) {
+            gpu_buffer_free(size->cpu_buffer_handle);
+        }
+
+        if (size->path) {
+            vg_lite_test_path_destroy(size->path);
+        }
+    }
+
+    for (int type = 0; type < GRADIENT_TYPE_COUNT; type++) {
+        for (int spread = 0; spread < SPREAD_COUNT; spread++) {
+            if (gradient_case->tiles[type][spread].buffer_handle) {
+                gpu_buffer_free(gradient_case->tiles[type][spread].buffer_handle);
+            }
+        }
+    }
+
+    free(gradient_case);
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(gradient_reference, RADIAL_GRADIENT, "Compare GPU gradients with the CPU ramp LUT renderer per stop count/size/spread mode and report both costs");
@@ -18,8 +18,10 @@
  *      INCLUDES
  *********************/
 
+#include "../../gpu_cache.h"
 #include "../../gpu_utils.h"
 #include "../vg_lite_test_context.h"
+#include "../vg_lite_test_tile.h"
 #include "../vg_lite_test_utils.h"
 
 /*********************
@@ -62,8 +64,12 @@ static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
 
     vg_lite_test_fill_gray_gradient(image);
 
-    /* Set the image as tiled */
-    image->tiled = VG_LITE_TILED;
+    /* Rearrange the gradient into 4x4 tiles, the GPU reads it back as the same picture */
+    if (!vg_lite_test_tile_set_layout(image, VG_LITE_TILED)) {
+        return VG_LITE_NOT_SUPPORT;
+    }
+
+    gpu_cache_flush(image->memory, image->stride * image->height);
 
     return VG_LITE_SUCCESS;
 }
@@ -0,0 +1,430 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_assert.h"
+#include "../../gpu_buffer.h"
+#include "../../gpu_cache.h"
+#include "../../gpu_math.h"
+#include "../../gpu_recorder.h"
+#include "../../gpu_tick.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_convert.h"
+#include "../vg_lite_test_tile.h"
+#include "../vg_lite_test_utils.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define SRC_SIZE 256
+#define REPEAT_COUNT 8
+#define TRANSFORM_COUNT 2
+#define LAYOUT_COUNT 2
+#define SWIZZLE_FORMAT_COUNT 4
+
+/* Filter rounding may differ by one between the two sampling paths */
+#define DIFF_TOLERANCE 1
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    TRANSFORM_IDENTITY,
+    TRANSFORM_ROTATE_90,
+} transform_t;
+
+typedef struct {
+    uint32_t tick;
+    uint32_t diff_count;
+    uint8_t max_diff;
+} sample_result_t;
+
+typedef struct {
+    uint32_t swizzle_tick;
+    uint32_t deswizzle_tick;
+    bool round_trip;
+} swizzle_result_t;
+
+typedef struct {
+    vg_lite_buffer_t images[LAYOUT_COUNT];
+    struct gpu_buffer_s* image_buffers[LAYOUT_COUNT];
+    vg_lite_buffer_t captures[LAYOUT_COUNT];
+    struct gpu_buffer_s* capture_buffers[LAYOUT_COUNT];
+    sample_result_t samples[TRANSFORM_COUNT][LAYOUT_COUNT];
+    swizzle_result_t swizzles[SWIZZLE_FORMAT_COUNT];
+    uint8_t tolerance;
+    bool done;
+} tiled_case_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const char* const transform_names[TRANSFORM_COUNT] = {
+    "identity",
+    "rotate_90",
+};
+
+static const vg_lite_buffer_layout_t layouts[LAYOUT_COUNT] = {
+    VG_LITE_LINEAR,
+    VG_LITE_TILED,
+};
+
+/* One format per pixel size of the swizzle kernels */
+static const vg_lite_buffer_format_t swizzle_formats[SWIZZLE_FORMAT_COUNT] = {
+    VG_LITE_BGRA8888,
+    VG_LITE_BGR888,
+    VG_LITE_BGR565,
+    VG_LITE_A8,
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void fill_source(vg_lite_buffer_t* buffer)
+{
+    /* Fine checkers over color ramps, a wrong tile order shows at once */
+    const uint32_t bytes = vg_lite_test_buffer_format_bpp(buffer->format) / 8;
+
+    for (int y = 0; y < buffer->height; y++) {
+        uint8_t* row = (uint8_t*)buffer->memory + (size_t)y * buffer->stride;
+
+        for (int x = 0; x < buffer->width; x++) {
+            const bool odd = ((x >> 3) ^ (y >> 3)) & 1;
+            const uint8_t pixel[4] = {
+                (uint8_t)(odd ? 0xFF - x : x),
+                (uint8_t)y,
+                (uint8_t)(odd ? x : 0xFF - y),
+                0xFF,
+            };
+            memcpy(row + x * bytes, pixel, bytes);
+        }
+    }
+}
+
+static bool rows_equal(const vg_lite_buffer_t* a, const vg_lite_buffer_t* b)
+{
+    const size_t row_size = (size_t)a->width * vg_lite_test_buffer_format_bpp(a->format) / 8;
+
+    for (int y = 0; y < a->height; y++) {
+        if (memcmp((const uint8_t*)a->memory + (size_t)y * a->stride,
+                (const uint8_t*)b->memory + (size_t)y * b->stride, row_size)
+            != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static vg_lite_error_t run_swizzle(vg_lite_buffer_format_t format, swizzle_result_t* result)
+{
+    vg_lite_buffer_t linear;
+    vg_lite_buffer_t tiled;
+    vg_lite_buffer_t back;
+    struct gpu_buffer_s* linear_buffer = vg_lite_test_buffer_alloc(&linear, SRC_SIZE, SRC_SIZE, format, VG_LITE_TEST_STRIDE_AUTO);
+    struct gpu_buffer_s* tiled_buffer = vg_lite_test_buffer_alloc(&tiled, SRC_SIZE, SRC_SIZE, format, VG_LITE_TEST_STRIDE_AUTO);
+    struct gpu_buffer_s* back_buffer = vg_lite_test_buffer_alloc(&back, SRC_SIZE, SRC_SIZE, format, VG_LITE_TEST_STRIDE_AUTO);
+
+    vg_lite_error_t error = VG_LITE_OUT_OF_MEMORY;
+    if (linear_buffer && tiled_buffer && back_buffer) {
+        fill_source(&linear);
+
+        uint32_t start = gpu_tick_get();
+        for (int i = 0; i < REPEAT_COUNT; i++) {
+            vg_lite_test_tile_swizzle(&tiled, &linear);
+        }
+        result->swizzle_tick = gpu_tick_elaps(start);
+
+        start = gpu_tick_get();
+        for (int i = 0; i < REPEAT_COUNT; i++) {
+            vg_lite_test_tile_deswizzle(&back, &tiled);
+        }
+        result->deswizzle_tick = gpu_tick_elaps(start);
+
+        /* Swizzling must move the pixels, and deswizzling must bring them back */
+        result->round_trip = !rows_equal(&linear, &tiled) && rows_equal(&linear, &back);
+        error = VG_LITE_SUCCESS;
+    }
+
+    if (linear_buffer) {
+        gpu_buffer_free(linear_buffer);
+    }
+
+    if (tiled_buffer) {
+        gpu_buffer_free(tiled_buffer);
+    }
+
+    if (back_buffer) {
+        gpu_buffer_free(back_buffer);
+    }
+
+    return error;
+}
+
+static void transform_matrix(struct vg_lite_test_context_s* ctx, transform_t transform, vg_lite_matrix_t* matrix)
+{
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+    vg_lite_test_context_get_transform(ctx, matrix);
+
+    /* Centered on the target, a 90 degrees turn walks the source by columns */
+    vg_lite_translate(target_buffer->width / 2.0f, target_buffer->height / 2.0f, matrix);
+    if (transform == TRANSFORM_ROTATE_90) {
+        vg_lite_rotate(90, matrix);
+    }
+    vg_lite_translate(-SRC_SIZE / 2.0f, -SRC_SIZE / 2.0f, matrix);
+}
+
+static vg_lite_error_t blit_timed(struct vg_lite_test_context_s* ctx, vg_lite_buffer_t* image, transform_t transform, sample_result_t* result)
+{
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+
+    vg_lite_matrix_t matrix;
+    transform_matrix(ctx, transform, &matrix);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear(target_buffer, NULL, 0xFFFFFFFF));
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+
+    uint32_t start = gpu_tick_get();
+    for (int i = 0; i < REPEAT_COUNT; i++) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_blit(target_buffer, image, &matrix, VG_LITE_BLEND_SRC_OVER, 0, VG_LITE_FILTER_BI_LINEAR));
+    }
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+
+    result->tick = gpu_tick_elaps(start);
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t run_sampling(struct vg_lite_test_context_s* ctx, tiled_case_t* tiled_case, transform_t transform)
+{
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+
+    for (int i = 0; i < LAYOUT_COUNT; i++) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(blit_timed(ctx, &tiled_case->images[i], transform, &tiled_case->samples[transform][i]));
+
+        gpu_cache_invalidate(target_buffer->memory, target_buffer->stride * target_buffer->height);
+        if (!vg_lite_test_convert_buffer(&tiled_case->captures[i], target_buffer, NULL)) {
+            return VG_LITE_NOT_SUPPORT;
+        }
+    }
+
+    /* Both layouts hold the same picture, so the targets must match */
+    sample_result_t* tiled = &tiled_case->samples[transform][LAYOUT_COUNT - 1];
+    tiled->diff_count = vg_lite_test_buffer_diff(&tiled_case->captures[0], &tiled_case->captures[1], tiled_case->tolerance, &tiled->max_diff);
+    return VG_LITE_SUCCESS;
+}
+
+static float sample_speedup(const tiled_case_t* tiled_case, transform_t transform)
+{
+    const sample_result_t* samples = tiled_case->samples[transform];
+    return samples[1].tick ? (float)samples[0].tick / samples[1].tick : 0;
+}
+
+static void write_sample_report(struct vg_lite_test_context_s* ctx, tiled_case_t* tiled_case)
+{
+    struct gpu_recorder_s* recorder = vg_lite_test_context_create_report(ctx, "tiled_sample");
+    if (!recorder) {
+        return;
+    }
+
+    gpu_recorder_write_string(recorder, "Transform,Layout,GPU(ms),MTexel/s,Speedup,Diff Pixels,Max Diff\n");
+
+    const float texels = (float)SRC_SIZE * SRC_SIZE * REPEAT_COUNT;
+
+    for (int t = 0; t < TRANSFORM_COUNT; t++) {
+        for (int i = 0; i < LAYOUT_COUNT; i++) {
+            const sample_result_t* result = &tiled_case->samples[t][i];
+
+            /* The linear blit is the reference of the tiled one */
+            char diff[32] = "-,-";
+            if (layouts[i] == VG_LITE_TILED) {
+                snprintf(diff, sizeof(diff), "%" PRIu32 ",%d", result->diff_count, result->max_diff);
+            }
+
+            char row[128];
+            snprintf(row, sizeof(row), "%s,%s,%0.3f,%0.2f,%0.2f,%s\n",
+                transform_names[t],
+                layouts[i] == VG_LITE_TILED ? "tiled" : "linear",
+                result->tick / 1000.0f / REPEAT_COUNT,
+                result->tick ? texels / result->tick : 0,
+                layouts[i] == VG_LITE_TILED ? sample_speedup(tiled_case, t) : 1.0f,
+                diff);
+            gpu_recorder_write_string(recorder, row);
+        }
+    }
+
+    gpu_recorder_delete(recorder);
+}
+
+static void write_swizzle_report(struct vg_lite_test_context_s* ctx, tiled_case_t* tiled_case)
+{
+    struct gpu_recorder_s* recorder = vg_lite_test_context_create_report(ctx, "tiled_swizzle");
+    if (!recorder) {
+        return;
+    }
+
+    gpu_recorder_write_string(recorder, "Format,Swizzle(Mpix/s),Deswizzle(Mpix/s),Round Trip\n");
+
+    const float pixels = (float)SRC_SIZE * SRC_SIZE * REPEAT_COUNT;
+
+    for (int i = 0; i < SWIZZLE_FORMAT_COUNT; i++) {
+        const swizzle_result_t* result = &tiled_case->swizzles[i];
+
+        char row[96];
+        snprintf(row, sizeof(row), "%s,%0.1f,%0.1f,%s\n",
+            vg_lite_test_buffer_format_string(swizzle_formats[i]),
+            result->swizzle_tick ? pixels / result->swizzle_tick : 0,
+            result->deswizzle_tick ? pixels / result->deswizzle_tick : 0,
+            result->round_trip ? "OK" : "FAIL");
+        gpu_recorder_write_string(recorder, row);
+    }
+
+    gpu_recorder_delete(recorder);
+}
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    tiled_case_t* tiled_case = calloc(1, sizeof(tiled_case_t));
+    GPU_ASSERT_NULL(tiled_case);
+    vg_lite_test_context_set_user_data(ctx, tiled_case);
+
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+
+    for (int i = 0; i < LAYOUT_COUNT; i++) {
+        tiled_case->image_buffers[i] = vg_lite_test_buffer_alloc(
+            &tiled_case->images[i], SRC_SIZE, SRC_SIZE, VG_LITE_BGRA8888, VG_LITE_TEST_STRIDE_AUTO);
+        tiled_case->capture_buffers[i] = vg_lite_test_buffer_alloc(
+            &tiled_case->captures[i], target_buffer->width, target_buffer->height, VG_LITE_BGRA8888, VG_LITE_TEST_STRIDE_AUTO);
+        if (!tiled_case->image_buffers[i] || !tiled_case->capture_buffers[i]) {
+            return VG_LITE_OUT_OF_MEMORY;
+        }
+
+        vg_lite_buffer_t* image = &tiled_case->images[i];
+        fill_source(image);
+
+        if (!vg_lite_test_tile_set_layout(image, layouts[i])) {
+            return VG_LITE_NOT_SUPPORT;
+        }
+
+        gpu_cache_flush(image->memory, image->stride * image->height);
+    }
+
+    /* The timed swizzles and blits finish on their own, on_draw only draws the last one again */
+    for (int i = 0; i < SWIZZLE_FORMAT_COUNT; i++) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(run_swizzle(swizzle_formats[i], &tiled_case->swizzles[i]));
+    }
+
+    tiled_case->tolerance = MATH_MIN(DIFF_TOLERANCE + vg_lite_test_context_get_tolerance(ctx), 0xFF);
+    for (int t = 0; t < TRANSFORM_COUNT; t++) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(run_sampling(ctx, tiled_case, (transform_t)t));
+    }
+
+    tiled_case->done = true;
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    tiled_case_t* tiled_case = vg_lite_test_context_get_user_data(ctx);
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+
+    /* The screenshot shows the rotated tiled image */
+    vg_lite_matrix_t matrix;
+    transform_matrix(ctx, TRANSFORM_ROTATE_90, &matrix);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear(target_buffer, NULL, 0xFFFFFFFF));
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_blit(
+        target_buffer, &tiled_case->images[LAYOUT_COUNT - 1], &matrix, VG_LITE_BLEND_SRC_OVER, 0, VG_LITE_FILTER_BI_LINEAR));
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    tiled_case_t* tiled_case = vg_lite_test_context_get_user_data(ctx);
+    if (!tiled_case) {
+        return VG_LITE_SUCCESS;
+    }
+
+    if (tiled_case->done) {
+        const swizzle_result_t* swizzle = &tiled_case->swizzles[0];
+        const float pixels = (float)SRC_SIZE * SRC_SIZE * REPEAT_COUNT;
+        uint32_t diff_count = 0;
+        for (int t = 0; t < TRANSFORM_COUNT; t++) {
+            diff_count += tiled_case->samples[t][LAYOUT_COUNT - 1].diff_count;
+        }
+
+        if (diff_count) {
+            vg_lite_test_context_set_failed(ctx, "%" PRIu32 " pixels of the tiled blits differ from the linear ones by more than %d",
+                diff_count, tiled_case->tolerance);
+        }
+
+        for (int i = 0; i < SWIZZLE_FORMAT_COUNT; i++) {
+            if (!tiled_case->swizzles[i].round_trip) {
+                vg_lite_test_context_set_failed(ctx, "%s swizzle round trip failed",
+                    vg_lite_test_buffer_format_string(swizzle_formats[i]));
+            }
+        }
+
+        vg_lite_test_context_set_remark(ctx,
+            "tiled/linear speedup: identity %0.2fx; rotate_90 %0.2fx; BGRA8888 swizzle %0.1f Mpix/s; %" PRIu32 " diff pixels",
+            sample_speedup(tiled_case, TRANSFORM_IDENTITY),
+            sample_speedup(tiled_case, TRANSFORM_ROTATE_90),
+            swizzle->swizzle_tick ? pixels / swizzle->swizzle_tick : 0,
+            diff_count);
+
+        write_sample_report(ctx, tiled_case);
+        write_swizzle_report(ctx, tiled_case);
+    }
+
+    for (int i = 0; i < LAYOUT_COUNT; i++) {
+        if (tiled_case->image_buffers[i]) {
+            gpu_buffer_free(tiled_case->image_buffers[i]);
+        }
+
+        if (tiled_case->capture_buffers[i]) {
+            gpu_buffer_free(tiled_case->capture_buffers[i]);
+        }
+    }
+
+    free(tiled_case);
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(image_tiled_sampling, NONE, "Blit the same image from linear and 4x4 tiled layouts; report the GPU cost of each and the CPU swizzle cost per pixel size");
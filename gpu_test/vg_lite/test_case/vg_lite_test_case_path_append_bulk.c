@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_assert.h"
+#include "../../gpu_math.h"
+#include "../../gpu_tick.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_path.h"
+#include "../vg_lite_test_utils.h"
+#include <stdlib.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define SEGMENT_COUNT 20000
+#define BUILD_ROUNDS 4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint8_t ops[SEGMENT_COUNT + 2];
+    float points[SEGMENT_COUNT * 6];
+    uint32_t op_count;
+    uint32_t point_count;
+} spiral_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void spiral_add_point(spiral_t* spiral, float angle, float radius)
+{
+    float* pt = &spiral->points[spiral->point_count * 2];
+    pt[0] = 240 + radius * MATH_COSF(angle);
+    pt[1] = 240 + radius * MATH_SINF(angle);
+    spiral->point_count++;
+}
+
+static void spiral_generate(spiral_t* spiral)
+{
+    /* Archimedean spiral with a cubic every fourth segment */
+    const float step = 0.05f;
+    const float growth = 200.0f / SEGMENT_COUNT;
+
+    spiral->op_count = 0;
+    spiral->point_count = 0;
+
+    spiral->ops[spiral->op_count++] = VLC_OP_MOVE;
+    spiral_add_point(spiral, 0, 10);
+
+    for (int i = 1; i < SEGMENT_COUNT; i++) {
+        float angle = i * step;
+        float radius = 10 + i * growth;
+
+        if (i % 4 == 0) {
+            spiral->ops[spiral->op_count++] = VLC_OP_CUBIC;
+            spiral_add_point(spiral, angle - step * 2 / 3, radius + 4);
+            spiral_add_point(spiral, angle - step / 3, radius - 4);
+        } else {
+            spiral->ops[spiral->op_count++] = VLC_OP_LINE;
+        }
+
+        spiral_add_point(spiral, angle, radius);
+    }
+
+    spiral->ops[spiral->op_count++] = VLC_OP_CLOSE;
+    spiral->ops[spiral->op_count++] = VLC_OP_END;
+}
+
+static void spiral_build_per_segment(const spiral_t* spiral, vg_lite_test_path_t* path)
+{
+    const float* pt = spiral->points;
+
+    for (uint32_t i = 0; i < spiral->op_count; i++) {
+        switch (spiral->ops[i]) {
+        case VLC_OP_MOVE:
+            vg_lite_test_path_move_to(path, pt[0], pt[1]);
+            pt += 2;
+            break;
+        case VLC_OP_LINE:
+            vg_lite_test_path_line_to(path, pt[0], pt[1]);
+            pt += 2;
+            break;
+        case VLC_OP_CUBIC:
+            vg_lite_test_path_cubic_to(path, pt[0], pt[1], pt[2], pt[3], pt[4], pt[5]);
+            pt += 6;
+            break;
+        case VLC_OP_CLOSE:
+            vg_lite_test_path_close(path);
+            break;
+        case VLC_OP_END:
+            vg_lite_test_path_end(path);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+static void spiral_build_bulk(const spiral_t* spiral, vg_lite_test_path_t* path)
+{
+    vg_lite_test_path_reserve(path, vg_lite_test_path_calc_size(VG_LITE_FP32, spiral->ops, spiral->op_count));
+    vg_lite_test_path_append_ops(path, spiral->ops, spiral->op_count, spiral->points, spiral->point_count);
+}
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    spiral_t* spiral = malloc(sizeof(spiral_t));
+    GPU_ASSERT_NULL(spiral);
+    spiral_generate(spiral);
+
+    uint32_t per_segment_tick = UINT32_MAX;
+    uint32_t bulk_tick = UINT32_MAX;
+
+    /* Fresh paths so that every round includes the buffer growth */
+    for (int i = 0; i < BUILD_ROUNDS; i++) {
+        vg_lite_test_path_t* path = vg_lite_test_path_create(VG_LITE_FP32);
+        uint32_t start = gpu_tick_get();
+        spiral_build_per_segment(spiral, path);
+        per_segment_tick = MATH_MIN(per_segment_tick, gpu_tick_elaps(start));
+        vg_lite_test_path_destroy(path);
+
+        path = vg_lite_test_path_create(VG_LITE_FP32);
+        start = gpu_tick_get();
+        spiral_build_bulk(spiral, path);
+        bulk_tick = MATH_MIN(bulk_tick, gpu_tick_elaps(start));
+        vg_lite_test_path_destroy(path);
+    }
+
+    /* The drawn path is built once more in the context */
+    vg_lite_test_path_t* path = vg_lite_test_context_init_path(ctx, VG_LITE_FP32);
+    vg_lite_test_path_set_bounding_box(path, 0, 0, 480, 480);
+    spiral_build_bulk(spiral, path);
+
+    vg_lite_test_context_set_remark(ctx,
+        "%d segments: per-segment %0.1f ns/seg, bulk %0.1f ns/seg",
+        SEGMENT_COUNT,
+        per_segment_tick * 1000.0f / SEGMENT_COUNT,
+        bulk_tick * 1000.0f / SEGMENT_COUNT);
+
+    free(spiral);
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    vg_lite_matrix_t matrix;
+    vg_lite_test_context_get_transform(ctx, &matrix);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(
+        vg_lite_draw(
+            vg_lite_test_context_get_target_buffer(ctx),
+            vg_lite_test_path_get_path(vg_lite_test_context_get_path(ctx)),
+            VG_LITE_FILL_NON_ZERO,
+            &matrix,
+            VG_LITE_BLEND_SRC_OVER,
+            0xFF3080C0));
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(path_append_bulk, NONE, "Build a 20000 segment spiral path segment by segment and in bulk");
@@ -82,6 +82,8 @@ static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
                 &matrix,
                 VG_LITE_BLEND_SRC_OVER,
                 0xFF0000FF));
+
+        vg_lite_test_context_add_path_stats(ctx, &path, &matrix);
     }
 
     return VG_LITE_SUCCESS;
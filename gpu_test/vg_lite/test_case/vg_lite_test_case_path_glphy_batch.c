@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_assert.h"
+#include "../../gpu_math.h"
+#include "../../gpu_recorder.h"
+#include "../../gpu_tick.h"
+#include "../resource/glphy_paths.h"
+#include "../vg_lite_test_batch.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_utils.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define GLYPH_SCALE 0.0015f
+#define GLYPH_ADVANCE 10000
+#define GLYPH_COLOR 0xFF0000FF
+#define BLOCK_COUNT 3
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t glyph_count;
+    uint32_t draw_count;
+    uint32_t per_glyph_tick;
+    uint32_t build_tick;
+    uint32_t batched_tick;
+} text_block_t;
+
+typedef struct {
+    vg_lite_path_t glyph;
+    float glyph_min_x;
+    float glyph_min_y;
+    uint32_t cols;
+    uint32_t rows;
+    struct vg_lite_test_batch_s* batch;
+    text_block_t blocks[BLOCK_COUNT];
+} batch_case_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const uint32_t block_glyph_counts[BLOCK_COUNT] = { 10, 100, 1000 };
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void glyph_matrix(batch_case_t* batch_case, uint32_t index, vg_lite_matrix_t* matrix)
+{
+    /* Lines of text wrap at the target width, then restart from the top */
+    vg_lite_scale(GLYPH_SCALE, GLYPH_SCALE, matrix);
+    vg_lite_translate(
+        (float)(index % batch_case->cols) * GLYPH_ADVANCE - batch_case->glyph_min_x,
+        (float)(index / batch_case->cols % batch_case->rows) * GLYPH_ADVANCE - batch_case->glyph_min_y,
+        matrix);
+}
+
+static vg_lite_error_t draw_per_glyph(struct vg_lite_test_context_s* ctx, batch_case_t* batch_case, uint32_t glyph_count)
+{
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+
+    for (uint32_t i = 0; i < glyph_count; i++) {
+        vg_lite_matrix_t matrix;
+        vg_lite_test_context_get_transform(ctx, &matrix);
+        glyph_matrix(batch_case, i, &matrix);
+
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_draw(
+            target_buffer,
+            &batch_case->glyph,
+            VG_LITE_FILL_NON_ZERO,
+            &matrix,
+            VG_LITE_BLEND_SRC_OVER,
+            GLYPH_COLOR));
+
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_test_idle_flush());
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static bool build_batch(batch_case_t* batch_case, uint32_t glyph_count)
+{
+    vg_lite_test_batch_reset(batch_case->batch);
+
+    for (uint32_t i = 0; i < glyph_count; i++) {
+        vg_lite_matrix_t matrix;
+        vg_lite_identity(&matrix);
+        glyph_matrix(batch_case, i, &matrix);
+
+        if (!vg_lite_test_batch_add(batch_case->batch, &batch_case->glyph, &matrix, VG_LITE_FILL_NON_ZERO, GLYPH_COLOR)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void write_report(struct vg_lite_test_context_s* ctx, batch_case_t* batch_case)
+{
+    struct gpu_recorder_s* recorder = vg_lite_test_context_create_report(ctx, "glphy_batch");
+    if (!recorder) {
+        return;
+    }
+
+    gpu_recorder_write_string(recorder, "Glyphs,Draw Calls,Per-Glyph Draw(ms),Batch Build(ms),Batched Draw(ms),Speedup\n");
+
+    for (int i = 0; i < BLOCK_COUNT; i++) {
+        text_block_t* block = &batch_case->blocks[i];
+        uint32_t batched_total_tick = block->build_tick + block->batched_tick;
+
+        /* The speedup counts the build, the text is rebuilt for every frame */
+        char row[128];
+        snprintf(row, sizeof(row), "%" PRIu32 ",%" PRIu32 ",%0.3f,%0.3f,%0.3f,%0.2f\n",
+            block->glyph_count,
+            block->draw_count,
+            block->per_glyph_tick / 1000.0f,
+            block->build_tick / 1000.0f,
+            block->batched_tick / 1000.0f,
+            batched_total_tick ? (float)block->per_glyph_tick / batched_total_tick : 0.0f);
+        gpu_recorder_write_string(recorder, row);
+    }
+
+    gpu_recorder_delete(recorder);
+}
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    batch_case_t* batch_case = calloc(1, sizeof(batch_case_t));
+    GPU_ASSERT_NULL(batch_case);
+    vg_lite_test_context_set_user_data(ctx, batch_case);
+
+    /* Float points keep the sub-pixel positions of the small glyphs */
+    batch_case->batch = vg_lite_test_batch_create(VG_LITE_FP32);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_init_path(
+        &batch_case->glyph,
+        VG_LITE_S16,
+        VG_LITE_HIGH,
+        sizeof(glphy_u9f8d_path_data),
+        (void*)glphy_u9f8d_path_data, -10000, -10000, 10000, 10000));
+
+    if (!vg_lite_test_path_calc_bounding_box(&batch_case->glyph,
+            &batch_case->glyph_min_x, &batch_case->glyph_min_y, NULL, NULL)) {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+    batch_case->cols = MATH_MAX((uint32_t)(target_buffer->width / (GLYPH_ADVANCE * GLYPH_SCALE)), 1);
+    batch_case->rows = MATH_MAX((uint32_t)(target_buffer->height / (GLYPH_ADVANCE * GLYPH_SCALE)), 1);
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    batch_case_t* batch_case = vg_lite_test_context_get_user_data(ctx);
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+
+    vg_lite_matrix_t matrix;
+    vg_lite_test_context_get_transform(ctx, &matrix);
+
+    for (int i = 0; i < BLOCK_COUNT; i++) {
+        text_block_t* block = &batch_case->blocks[i];
+        block->glyph_count = block_glyph_counts[i];
+
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear(target_buffer, NULL, 0xFFFFFFFF));
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+
+        uint32_t start = gpu_tick_get();
+        VG_LITE_TEST_CHECK_ERROR_RETURN(draw_per_glyph(ctx, batch_case, block->glyph_count));
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+        block->per_glyph_tick = gpu_tick_elaps(start);
+
+        /* Same text again, the batched result is what stays on the screen */
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear(target_buffer, NULL, 0xFFFFFFFF));
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+
+        start = gpu_tick_get();
+        if (!build_batch(batch_case, block->glyph_count)) {
+            return VG_LITE_INVALID_ARGUMENT;
+        }
+        block->build_tick = gpu_tick_elaps(start);
+
+        start = gpu_tick_get();
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_test_batch_draw(
+            batch_case->batch,
+            target_buffer,
+            &matrix,
+            VG_LITE_BLEND_SRC_OVER));
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+        block->batched_tick = gpu_tick_elaps(start);
+
+        block->draw_count = vg_lite_test_batch_get_draw_count(batch_case->batch);
+    }
+
+    /* Statistics of the last block, outside of the timed draws */
+    for (uint32_t i = 0; i < batch_case->blocks[BLOCK_COUNT - 1].glyph_count; i++) {
+        vg_lite_test_context_get_transform(ctx, &matrix);
+        glyph_matrix(batch_case, i, &matrix);
+        vg_lite_test_context_add_path_stats(ctx, &batch_case->glyph, &matrix);
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    batch_case_t* batch_case = vg_lite_test_context_get_user_data(ctx);
+    if (!batch_case) {
+        return VG_LITE_SUCCESS;
+    }
+
+    text_block_t* block = &batch_case->blocks[BLOCK_COUNT - 1];
+    if (block->draw_count) {
+        vg_lite_test_context_set_remark(ctx,
+            "%" PRIu32 " glyphs: per-glyph %0.3f ms, batched %0.3f + %0.3f ms build in %" PRIu32 " draw",
+            block->glyph_count,
+            block->per_glyph_tick / 1000.0f,
+            block->batched_tick / 1000.0f,
+            block->build_tick / 1000.0f,
+            block->draw_count);
+
+        write_report(ctx, batch_case);
+    }
+
+    vg_lite_test_batch_destroy(batch_case->batch);
+    free(batch_case);
+
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(path_glphy_batch, NONE, "Draw a text block of 10/100/1000 '龍' glphys per glyph and batched into one path");
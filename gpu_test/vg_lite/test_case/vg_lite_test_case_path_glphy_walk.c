@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_math.h"
+#include "../../gpu_tick.h"
+#include "../resource/glphy_paths.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_path.h"
+#include "../vg_lite_test_utils.h"
+#include <float.h>
+#include <inttypes.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define WALK_ROUNDS 1000
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    float min_x;
+    float min_y;
+    float max_x;
+    float max_y;
+    uint32_t op_count;
+} walk_result_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void walk_iter_cb(void* user_data, uint8_t op_code, const float* data, uint32_t len)
+{
+    walk_result_t* result = user_data;
+    result->op_count++;
+
+    for (uint32_t i = 0; i + 1 < len; i += 2) {
+        result->min_x = MATH_MIN(result->min_x, data[i]);
+        result->min_y = MATH_MIN(result->min_y, data[i + 1]);
+        result->max_x = MATH_MAX(result->max_x, data[i]);
+        result->max_y = MATH_MAX(result->max_y, data[i + 1]);
+    }
+}
+
+static void walk_generic(const vg_lite_path_t* path, walk_result_t* result)
+{
+    /* Reference: convert every element through a format switch */
+    result->min_x = FLT_MAX;
+    result->min_y = FLT_MAX;
+    result->max_x = -FLT_MAX;
+    result->max_y = -FLT_MAX;
+    result->op_count = 0;
+
+    uint8_t fmt_len = vg_lite_test_path_format_len(path->format);
+    const uint8_t* cur = path->path;
+    const uint8_t* end = cur + path->path_length;
+    float tmp_data[8];
+
+    while (cur < end) {
+        uint8_t op_code = *cur;
+        uint8_t arg_len = vg_lite_test_vlc_op_arg_len(op_code);
+        cur += fmt_len;
+
+        for (uint8_t i = 0; i < arg_len; i++) {
+            switch (path->format) {
+            case VG_LITE_S8:
+                tmp_data[i] = *((const int8_t*)cur);
+                break;
+            case VG_LITE_S16:
+                tmp_data[i] = *((const int16_t*)cur);
+                break;
+            case VG_LITE_S32:
+                tmp_data[i] = *((const int32_t*)cur);
+                break;
+            default:
+                tmp_data[i] = *((const float*)cur);
+                break;
+            }
+
+            cur += fmt_len;
+        }
+
+        walk_iter_cb(result, op_code, tmp_data, arg_len);
+    }
+}
+
+static void walk_callback(const vg_lite_path_t* path, walk_result_t* result)
+{
+    result->min_x = FLT_MAX;
+    result->min_y = FLT_MAX;
+    result->max_x = -FLT_MAX;
+    result->max_y = -FLT_MAX;
+    result->op_count = 0;
+
+    vg_lite_test_path_for_each_data(path, walk_iter_cb, result);
+}
+
+static void walk_cursor(const vg_lite_path_t* path, walk_result_t* result)
+{
+    /* Stay in native int16 coordinates until the end */
+    int16_t min_x = INT16_MAX;
+    int16_t min_y = INT16_MAX;
+    int16_t max_x = INT16_MIN;
+    int16_t max_y = INT16_MIN;
+    uint32_t op_count = 0;
+
+    vg_lite_test_path_cursor_s16_t cursor;
+    vg_lite_test_path_cursor_s16_init(&cursor, path);
+
+    uint8_t op;
+    const int16_t* args;
+    uint8_t arg_len;
+    while (vg_lite_test_path_cursor_s16_next(&cursor, &op, &args, &arg_len)) {
+        op_count++;
+
+        for (uint8_t i = 0; i + 1 < arg_len; i += 2) {
+            min_x = MATH_MIN(min_x, args[i]);
+            min_y = MATH_MIN(min_y, args[i + 1]);
+            max_x = MATH_MAX(max_x, args[i]);
+            max_y = MATH_MAX(max_y, args[i + 1]);
+        }
+    }
+
+    result->min_x = min_x;
+    result->min_y = min_y;
+    result->max_x = max_x;
+    result->max_y = max_y;
+    result->op_count = op_count;
+}
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    vg_lite_path_t path;
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_init_path(
+        &path,
+        VG_LITE_S16,
+        VG_LITE_HIGH,
+        sizeof(glphy_u9f8d_path_data),
+        (void*)glphy_u9f8d_path_data, -10000, -10000, 10000, 10000));
+
+    walk_result_t generic_result;
+    walk_result_t callback_result;
+    walk_result_t cursor_result;
+
+    uint32_t start = gpu_tick_get();
+    for (int i = 0; i < WALK_ROUNDS; i++) {
+        walk_generic(&path, &generic_result);
+    }
+    uint32_t generic_tick = gpu_tick_elaps(start);
+
+    start = gpu_tick_get();
+    for (int i = 0; i < WALK_ROUNDS; i++) {
+        walk_callback(&path, &callback_result);
+    }
+    uint32_t callback_tick = gpu_tick_elaps(start);
+
+    start = gpu_tick_get();
+    for (int i = 0; i < WALK_ROUNDS; i++) {
+        walk_cursor(&path, &cursor_result);
+    }
+    uint32_t cursor_tick = gpu_tick_elaps(start);
+
+    if (generic_result.op_count != cursor_result.op_count
+        || callback_result.op_count != cursor_result.op_count
+        || !math_equal(callback_result.min_x, cursor_result.min_x)
+        || !math_equal(callback_result.min_y, cursor_result.min_y)
+        || !math_equal(callback_result.max_x, cursor_result.max_x)
+        || !math_equal(callback_result.max_y, cursor_result.max_y)) {
+        GPU_LOG_ERROR("Cursor walk mismatch: %" PRIu32 " ops (%g, %g, %g, %g) vs %" PRIu32 " ops (%g, %g, %g, %g)",
+            callback_result.op_count,
+            callback_result.min_x, callback_result.min_y, callback_result.max_x, callback_result.max_y,
+            cursor_result.op_count,
+            cursor_result.min_x, cursor_result.min_y, cursor_result.max_x, cursor_result.max_y);
+        return VG_LITE_GENERIC_IO;
+    }
+
+    const float op_total = (float)cursor_result.op_count * WALK_ROUNDS;
+    vg_lite_test_context_set_remark(ctx,
+        "%" PRIu32 " ops: generic %0.1f ns/op, callback %0.1f ns/op, cursor %0.1f ns/op, %0.1fx",
+        cursor_result.op_count,
+        generic_tick * 1000.0f / op_total,
+        callback_tick * 1000.0f / op_total,
+        cursor_tick * 1000.0f / op_total,
+        cursor_tick > 0 ? (float)generic_tick / cursor_tick : 0.0f);
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    vg_lite_path_t path;
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_init_path(
+        &path,
+        VG_LITE_S16,
+        VG_LITE_HIGH,
+        sizeof(glphy_u9f8d_path_data),
+        (void*)glphy_u9f8d_path_data, -10000, -10000, 10000, 10000));
+
+    vg_lite_matrix_t matrix;
+    vg_lite_test_context_get_transform(ctx, &matrix);
+    vg_lite_translate(100, 400, &matrix);
+    vg_lite_scale(0.04, 0.04, &matrix);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(
+        vg_lite_draw(
+            vg_lite_test_context_get_target_buffer(ctx),
+            &path,
+            VG_LITE_FILL_NON_ZERO,
+            &matrix,
+            VG_LITE_BLEND_SRC_OVER,
+            0xFF000000));
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(path_glphy_walk, NONE, "Walk an S16 glyph path with the callback iterator and the native cursor");
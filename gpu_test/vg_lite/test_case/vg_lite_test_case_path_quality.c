@@ -20,7 +20,10 @@
 
 #include "../resource/glphy_paths.h"
 #include "../vg_lite_test_context.h"
+#include "../vg_lite_test_flatten.h"
 #include "../vg_lite_test_utils.h"
+#include <inttypes.h>
+#include <stdio.h>
 
 /*********************
  *      DEFINES
@@ -55,20 +58,26 @@ static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
     return VG_LITE_SUCCESS;
 }
 
-static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+static vg_lite_error_t init_glphy(struct vg_lite_test_context_s* ctx, vg_lite_path_t* path, vg_lite_matrix_t* matrix)
 {
-    vg_lite_path_t path;
     VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_init_path(
-        &path,
+        path,
         VG_LITE_S16,
         VG_LITE_HIGH,
         sizeof(glphy_u0030_path_data),
         (void*)glphy_u0030_path_data, -10000, -10000, 10000, 10000));
 
+    vg_lite_test_context_get_transform(ctx, matrix);
+    vg_lite_translate(0, 50, matrix);
+    vg_lite_scale(0.005, 0.005, matrix);
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    vg_lite_path_t path;
     vg_lite_matrix_t matrix;
-    vg_lite_test_context_get_transform(ctx, &matrix);
-    vg_lite_translate(0, 50, &matrix);
-    vg_lite_scale(0.005, 0.005, &matrix);
+    VG_LITE_TEST_CHECK_ERROR_RETURN(init_glphy(ctx, &path, &matrix));
 
     vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
 
@@ -93,6 +102,8 @@ static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
                 &matrix,
                 VG_LITE_BLEND_SRC_OVER,
                 0xFFFFFFFF));
+
+        vg_lite_test_context_add_path_stats(ctx, &path, &matrix);
     }
 
     return VG_LITE_SUCCESS;
@@ -100,6 +111,24 @@ static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
 
 static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
 {
+    vg_lite_path_t path;
+    vg_lite_matrix_t matrix;
+    VG_LITE_TEST_CHECK_ERROR_RETURN(init_glphy(ctx, &path, &matrix));
+
+    /* How the tessellation load grows as the tolerance tightens */
+    const float tolerances[] = { 1.0f, 0.5f, 0.25f, 0.125f };
+    char remark[128];
+    int offset = snprintf(remark, sizeof(remark), "segments@tolerance(px):");
+
+    for (int i = 0; i < sizeof(tolerances) / sizeof(float); i++) {
+        vg_lite_test_flatten_stats_t stats;
+        vg_lite_test_flatten_stats_reset(&stats);
+        vg_lite_test_flatten_path(&path, &matrix, tolerances[i], NULL, NULL, &stats);
+        offset += snprintf(remark + offset, sizeof(remark) - offset, " %" PRIu32 "@%g(err %0.3f)",
+            stats.segment_count, tolerances[i], stats.max_error);
+    }
+
+    vg_lite_test_context_set_remark(ctx, "%s", remark);
     return VG_LITE_SUCCESS;
 }
 
@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_assert.h"
+#include "../../gpu_cache.h"
+#include "../../gpu_math.h"
+#include "../../gpu_tick.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_path.h"
+#include "../vg_lite_test_utils.h"
+#include <inttypes.h>
+#include <math.h>
+#include <stdlib.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Maximum coordinate error, a fraction of a pixel */
+#define QUANTIZE_MAX_ERROR (1.0f / 16)
+
+#define ROW_COUNT 6
+
+/* Coverage resolution of VG_LITE_HIGH, one step per sub-scanline */
+#define COVERAGE_STEPS 16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    vg_lite_test_path_t* path;
+    vg_lite_matrix_t matrix;
+    float error;
+    float error_px;
+    uint32_t fp32_bytes;
+    uint32_t fp32_tick;
+    uint32_t quantized_tick;
+} quantize_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void build_list_geometry(vg_lite_test_path_t* path)
+{
+    /* A settings list: card, icon and toggle per row, off the pixel grid */
+    for (int i = 0; i < ROW_COUNT; i++) {
+        float y = 16.3f + i * 76.7f;
+        vg_lite_test_path_append_rect(path, 20.4f, y, 439.2f, 64.5f, 12.2f);
+        vg_lite_test_path_append_circle(path, 60.6f, y + 32.2f, 20.3f, 20.3f);
+        vg_lite_test_path_append_rect(path, 380.1f, y + 20.2f, 60.3f, 24.4f, 12.2f);
+    }
+
+    vg_lite_test_path_end(path);
+}
+
+static vg_lite_error_t draw_path(vg_lite_buffer_t* buffer, vg_lite_test_path_t* path, const vg_lite_matrix_t* matrix, uint32_t* tick)
+{
+    uint32_t start = gpu_tick_get();
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_draw(
+        buffer,
+        vg_lite_test_path_get_path(path),
+        VG_LITE_FILL_EVEN_ODD,
+        (vg_lite_matrix_t*)matrix,
+        VG_LITE_BLEND_SRC_OVER,
+        0xFF2060A0));
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+    *tick = gpu_tick_elaps(start);
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    quantize_ctx_t* quantize_ctx = calloc(1, sizeof(quantize_ctx_t));
+    GPU_ASSERT_NULL(quantize_ctx);
+    vg_lite_test_context_set_user_data(ctx, quantize_ctx);
+
+    vg_lite_test_path_t* path = vg_lite_test_context_init_path(ctx, VG_LITE_FP32);
+    vg_lite_test_path_set_bounding_box(path, 0, 0, 480, 480);
+    build_list_geometry(path);
+    quantize_ctx->fp32_bytes = vg_lite_test_path_get_path(path)->path_length;
+
+    quantize_ctx->path = vg_lite_test_path_create(VG_LITE_FP32);
+    vg_lite_test_path_set_bounding_box(quantize_ctx->path, 0, 0, 480, 480);
+    vg_lite_test_path_append_path(quantize_ctx->path, path);
+    if (!vg_lite_test_path_quantize(quantize_ctx->path, QUANTIZE_MAX_ERROR, &quantize_ctx->matrix, &quantize_ctx->error)) {
+        return VG_LITE_NOT_SUPPORT;
+    }
+
+    vg_lite_matrix_t matrix;
+    vg_lite_test_context_get_transform(ctx, &matrix);
+
+    /* The error is per coordinate in path units, the larger row of the transform scales it to pixels */
+    quantize_ctx->error_px = quantize_ctx->error
+        * MATH_MAX(MATH_FABSF(matrix.m[0][0]) + MATH_FABSF(matrix.m[0][1]),
+            MATH_FABSF(matrix.m[1][0]) + MATH_FABSF(matrix.m[1][1]));
+
+    vg_lite_test_matrix_multiply(&matrix, &quantize_ctx->matrix);
+    quantize_ctx->matrix = matrix;
+
+    /* FP32 reference in the source buffer, timed against the quantized path */
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+    vg_lite_buffer_t* ref_buffer = vg_lite_test_context_alloc_src_buffer(
+        ctx, target_buffer->width, target_buffer->height, target_buffer->format, VG_LITE_TEST_STRIDE_AUTO);
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear(ref_buffer, NULL, 0));
+
+    vg_lite_test_context_get_transform(ctx, &matrix);
+    VG_LITE_TEST_CHECK_ERROR_RETURN(draw_path(ref_buffer, path, &matrix, &quantize_ctx->fp32_tick));
+    VG_LITE_TEST_CHECK_ERROR_RETURN(draw_path(target_buffer, quantize_ctx->path, &quantize_ctx->matrix, &quantize_ctx->quantized_tick));
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear(target_buffer, NULL, 0));
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    quantize_ctx_t* quantize_ctx = vg_lite_test_context_get_user_data(ctx);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(
+        vg_lite_draw(
+            vg_lite_test_context_get_target_buffer(ctx),
+            vg_lite_test_path_get_path(quantize_ctx->path),
+            VG_LITE_FILL_EVEN_ODD,
+            &quantize_ctx->matrix,
+            VG_LITE_BLEND_SRC_OVER,
+            0xFF2060A0));
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    quantize_ctx_t* quantize_ctx = vg_lite_test_context_get_user_data(ctx);
+    if (!quantize_ctx) {
+        return VG_LITE_SUCCESS;
+    }
+
+    if (!quantize_ctx->path) {
+        free(quantize_ctx);
+        return VG_LITE_SUCCESS;
+    }
+
+    vg_lite_buffer_t* src_buffer = vg_lite_test_context_get_src_buffer(ctx);
+    if (src_buffer->memory) {
+        uint8_t max_diff = 0;
+        uint32_t diff_count = vg_lite_test_buffer_diff(
+            vg_lite_test_context_get_target_buffer(ctx), src_buffer, 0, &max_diff);
+
+        /* An edge moved by the error crosses at most that many sub-scanlines of a pixel */
+        const float coverage_error = ceilf(quantize_ctx->error_px * COVERAGE_STEPS) / COVERAGE_STEPS;
+        const int tolerance = (int)ceilf(coverage_error * 0xFF) + vg_lite_test_context_get_tolerance(ctx);
+        if (max_diff > tolerance) {
+            vg_lite_test_context_set_failed(ctx, "Quantized path differs by %d, more than the %d its error allows",
+                max_diff, tolerance);
+        }
+
+        vg_lite_path_t* path = vg_lite_test_path_get_path(quantize_ctx->path);
+        vg_lite_test_context_set_remark(ctx,
+            "FP32 %" PRIu32 " B %0.3f ms, S%d %" PRIu32 " B %0.3f ms, error %0.4f px, %" PRIu32 " px differ (max %d)",
+            quantize_ctx->fp32_bytes,
+            quantize_ctx->fp32_tick / 1000.0f,
+            vg_lite_test_path_format_len(path->format) * 8,
+            path->path_length,
+            quantize_ctx->quantized_tick / 1000.0f,
+            quantize_ctx->error_px,
+            diff_count,
+            max_diff);
+    }
+
+    vg_lite_test_path_destroy(quantize_ctx->path);
+    free(quantize_ctx);
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(path_quantize, NONE, "Draw UI geometry from FP32 and from a quantized integer path");
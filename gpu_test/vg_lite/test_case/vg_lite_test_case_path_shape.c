@@ -78,6 +78,8 @@ static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
             VG_LITE_BLEND_SRC_OVER,
             0xFFFF0000));
 
+    vg_lite_test_context_add_path_stats(ctx, vg_lite_test_path_get_path(path), &matrix);
+
     vg_lite_translate(120, 0, &matrix);
     vg_lite_test_path_reset(path, VG_LITE_FP32);
     vg_lite_test_path_append_rect(path, 0, 0, 100, 100, 20);
@@ -92,6 +94,8 @@ static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
             VG_LITE_BLEND_SRC_OVER,
             0xFF00FF00));
 
+    vg_lite_test_context_add_path_stats(ctx, vg_lite_test_path_get_path(path), &matrix);
+
     vg_lite_translate(120, 0, &matrix);
     vg_lite_test_path_reset(path, VG_LITE_FP32);
     vg_lite_test_path_append_circle(path, 50, 50, 50, 50);
@@ -107,6 +111,8 @@ static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
             VG_LITE_BLEND_SRC_OVER,
             0xFF0000FF));
 
+    vg_lite_test_context_add_path_stats(ctx, vg_lite_test_path_get_path(path), &matrix);
+
     return VG_LITE_SUCCESS;
 }
 
@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_assert.h"
+#include "../../gpu_math.h"
+#include "../../gpu_tick.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_path.h"
+#include "../vg_lite_test_stroke.h"
+#include "../vg_lite_test_utils.h"
+#include <inttypes.h>
+#include <stdlib.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define STROKE_ITEM_COUNT 4
+#define STROKE_BENCH_ITERATIONS 50
+#define STROKE_TOLERANCE 0.25f
+
+/* The hardware strokes are drawn on the top half, the CPU strokes on the bottom half */
+#define STROKE_CPU_OFFSET_Y 240
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    vg_lite_test_path_t* src;
+    vg_lite_test_path_t* fill;
+    vg_lite_test_stroke_style_t style;
+    uint32_t color;
+} stroke_item_t;
+
+typedef struct {
+    stroke_item_t items[STROKE_ITEM_COUNT];
+    uint32_t segment_count;
+    uint32_t stroke_tick;
+    uint32_t hw_prepare_tick;
+    uint32_t hw_draw_tick;
+    uint32_t cpu_draw_tick;
+    bool hw_supported;
+} stroke_case_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void stroke_case_build(stroke_case_t* stroke_case)
+{
+    static const vg_lite_test_stroke_style_t styles[STROKE_ITEM_COUNT] = {
+        { 6, VG_LITE_CAP_BUTT, VG_LITE_JOIN_MITER, 4 },
+        { 10, VG_LITE_CAP_ROUND, VG_LITE_JOIN_ROUND, 4 },
+        { 8, VG_LITE_CAP_BUTT, VG_LITE_JOIN_BEVEL, 4 },
+        { 4, VG_LITE_CAP_SQUARE, VG_LITE_JOIN_MITER, 10 },
+    };
+
+    static const uint32_t colors[STROKE_ITEM_COUNT] = {
+        0xFF0000FF,
+        0xFF00FF00,
+        0xFFFF0000,
+        0xFF00FFFF,
+    };
+
+    for (int i = 0; i < STROKE_ITEM_COUNT; i++) {
+        stroke_case->items[i].src = vg_lite_test_path_create(VG_LITE_FP32);
+        stroke_case->items[i].fill = vg_lite_test_path_create(VG_LITE_FP32);
+        stroke_case->items[i].style = styles[i];
+        stroke_case->items[i].color = colors[i];
+    }
+
+    /* Line: zigzag polyline */
+    vg_lite_test_path_t* path = stroke_case->items[0].src;
+    vg_lite_test_path_move_to(path, 10, 200);
+    for (int i = 1; i <= 8; i++) {
+        vg_lite_test_path_line_to(path, 10 + i * 12, (i & 1) ? 40 : 200);
+    }
+
+    /* Arc: three quarters of a circle */
+    path = stroke_case->items[1].src;
+    vg_lite_test_path_move_to(path, 180 + 50, 120);
+    vg_lite_test_path_append_arc(path, 180, 120, 50, 0, 270, false);
+
+    /* Ring: full circle */
+    path = stroke_case->items[2].src;
+    vg_lite_test_path_append_circle(path, 300, 120, 50, 50);
+
+    /* Wave: cubic curves */
+    path = stroke_case->items[3].src;
+    vg_lite_test_path_move_to(path, 370, 120);
+    for (int i = 0; i < 4; i++) {
+        float x = 370 + i * 25;
+        vg_lite_test_path_cubic_to(path, x + 8, 40, x + 17, 200, x + 25, 120);
+    }
+
+    for (int i = 0; i < STROKE_ITEM_COUNT; i++) {
+        vg_lite_test_path_end(stroke_case->items[i].src);
+        vg_lite_test_path_update_bounding_box(stroke_case->items[i].src);
+    }
+}
+
+static void stroke_case_run_cpu(stroke_case_t* stroke_case)
+{
+    vg_lite_test_flatten_stats_t stats;
+
+    uint32_t start = gpu_tick_get();
+
+    for (int iter = 0; iter < STROKE_BENCH_ITERATIONS; iter++) {
+        vg_lite_test_flatten_stats_reset(&stats);
+
+        for (int i = 0; i < STROKE_ITEM_COUNT; i++) {
+            stroke_item_t* item = &stroke_case->items[i];
+            vg_lite_test_path_reset(item->fill, VG_LITE_FP32);
+            vg_lite_test_stroke_path(item->fill, vg_lite_test_path_get_path(item->src), &item->style, STROKE_TOLERANCE, &stats);
+            vg_lite_test_path_end(item->fill);
+        }
+    }
+
+    stroke_case->stroke_tick = gpu_tick_elaps(start);
+    stroke_case->segment_count = stats.segment_count;
+
+    for (int i = 0; i < STROKE_ITEM_COUNT; i++) {
+        vg_lite_test_path_update_bounding_box(stroke_case->items[i].fill);
+    }
+}
+
+static vg_lite_error_t stroke_case_prepare_hw(stroke_case_t* stroke_case)
+{
+    uint32_t start = gpu_tick_get();
+
+    for (int i = 0; i < STROKE_ITEM_COUNT; i++) {
+        stroke_item_t* item = &stroke_case->items[i];
+        vg_lite_path_t* path = vg_lite_test_path_get_path(item->src);
+
+        vg_lite_error_t error = vg_lite_set_path_type(path, VG_LITE_DRAW_STROKE_PATH);
+        if (error == VG_LITE_SUCCESS) {
+            error = vg_lite_set_stroke(path,
+                item->style.cap,
+                item->style.join,
+                item->style.width,
+                item->style.miter_limit,
+                NULL, 0, 0,
+                item->color);
+        }
+
+        if (error == VG_LITE_SUCCESS) {
+            error = vg_lite_update_stroke(path);
+        }
+
+        if (error != VG_LITE_SUCCESS) {
+            return error;
+        }
+    }
+
+    stroke_case->hw_prepare_tick = gpu_tick_elaps(start);
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    stroke_case_t* stroke_case = calloc(1, sizeof(stroke_case_t));
+    GPU_ASSERT_NULL(stroke_case);
+    vg_lite_test_context_set_user_data(ctx, stroke_case);
+
+    stroke_case_build(stroke_case);
+    stroke_case_run_cpu(stroke_case);
+
+    /* Without the stroke API only the CPU strokes are drawn */
+    vg_lite_error_t error = stroke_case_prepare_hw(stroke_case);
+    stroke_case->hw_supported = error == VG_LITE_SUCCESS;
+    if (!stroke_case->hw_supported) {
+        GPU_LOG_WARN("Hardware stroke unavailable: %s", vg_lite_test_error_string(error));
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    stroke_case_t* stroke_case = vg_lite_test_context_get_user_data(ctx);
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+
+    vg_lite_matrix_t matrix;
+    vg_lite_test_context_get_transform(ctx, &matrix);
+
+    if (stroke_case->hw_supported) {
+        uint32_t start = gpu_tick_get();
+
+        for (int i = 0; i < STROKE_ITEM_COUNT; i++) {
+            stroke_item_t* item = &stroke_case->items[i];
+            VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_draw(
+                target_buffer,
+                vg_lite_test_path_get_path(item->src),
+                VG_LITE_FILL_NON_ZERO,
+                &matrix,
+                VG_LITE_BLEND_SRC_OVER,
+                item->color));
+        }
+
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+        stroke_case->hw_draw_tick = gpu_tick_elaps(start);
+    }
+
+    vg_lite_translate(0, STROKE_CPU_OFFSET_Y, &matrix);
+
+    uint32_t start = gpu_tick_get();
+
+    for (int i = 0; i < STROKE_ITEM_COUNT; i++) {
+        stroke_item_t* item = &stroke_case->items[i];
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_draw(
+            target_buffer,
+            vg_lite_test_path_get_path(item->fill),
+            VG_LITE_FILL_NON_ZERO,
+            &matrix,
+            VG_LITE_BLEND_SRC_OVER,
+            item->color));
+    }
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+    stroke_case->cpu_draw_tick = gpu_tick_elaps(start);
+
+    for (int i = 0; i < STROKE_ITEM_COUNT; i++) {
+        vg_lite_test_context_add_path_stats(ctx, vg_lite_test_path_get_path(stroke_case->items[i].fill), &matrix);
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    stroke_case_t* stroke_case = vg_lite_test_context_get_user_data(ctx);
+    if (!stroke_case) {
+        return VG_LITE_SUCCESS;
+    }
+
+    /* Nanoseconds per flattened source segment */
+    float stroke_ns = stroke_case->segment_count
+        ? stroke_case->stroke_tick * 1000.0f / STROKE_BENCH_ITERATIONS / stroke_case->segment_count
+        : 0.0f;
+
+    if (stroke_case->hw_supported) {
+        vg_lite_test_context_set_remark(ctx,
+            "%" PRIu32 " segs; cpu stroke %0.1f ns/seg; hw update %0.3f ms; hw draw %0.3f ms; cpu draw %0.3f ms",
+            stroke_case->segment_count,
+            stroke_ns,
+            stroke_case->hw_prepare_tick / 1000.0f,
+            stroke_case->hw_draw_tick / 1000.0f,
+            stroke_case->cpu_draw_tick / 1000.0f);
+    } else {
+        vg_lite_test_context_set_remark(ctx,
+            "%" PRIu32 " segs; cpu stroke %0.1f ns/seg; hw stroke n/a; cpu draw %0.3f ms",
+            stroke_case->segment_count,
+            stroke_ns,
+            stroke_case->cpu_draw_tick / 1000.0f);
+    }
+
+    for (int i = 0; i < STROKE_ITEM_COUNT; i++) {
+        vg_lite_test_path_destroy(stroke_case->items[i].src);
+        vg_lite_test_path_destroy(stroke_case->items[i].fill);
+    }
+
+    free(stroke_case);
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(path_stroke, NONE, "Draw lines/arcs/rings stroked by hardware (top) and by the CPU stroker (bottom)");
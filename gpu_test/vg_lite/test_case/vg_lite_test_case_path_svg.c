@@ -0,0 +1,303 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_assert.h"
+#include "../../gpu_math.h"
+#include "../../gpu_recorder.h"
+#include "../../gpu_tick.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_svg.h"
+#include "../vg_lite_test_utils.h"
+#include <dirent.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define SVG_DIR_NAME "svg"
+#define SVG_DOC_MAX 16
+#define SVG_GRID_COLS 4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    char name[32];
+    struct vg_lite_test_svg_s* svg;
+    uint32_t parse_tick;
+    uint32_t draw_tick;
+} svg_doc_t;
+
+typedef struct {
+    svg_doc_t docs[SVG_DOC_MAX];
+    uint32_t count;
+} svg_case_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void svg_case_add(svg_case_t* svg_case, const char* name, const char* text, size_t len);
+static void svg_case_load_dir(svg_case_t* svg_case, const char* dir_path);
+static void svg_case_write_report(svg_case_t* svg_case, struct vg_lite_test_context_s* ctx);
+static int svg_name_compare(const void* a, const void* b);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/* Exercises every path command in absolute and relative form */
+static const char svg_builtin[] = "<svg xmlns=\"http://www.w3.org/2000/svg\" viewBox=\"0 0 200 200\">\n"
+                                  "  <rect width=\"200\" height=\"200\" fill=\"#eee\"/>\n"
+                                  "  <g transform=\"translate(10 10)\" fill=\"#3366cc\">\n"
+                                  "    <path d=\"M10 10 H90 V90 H10 Z m20 20 h40 v40 h-40 z\" fill-rule=\"evenodd\"/>\n"
+                                  "    <path d=\"M100 50 C100 10 180 10 180 50 S100 90 100 50 z\" fill=\"#cc3333\"/>\n"
+                                  "    <path d=\"M10 140 Q50 100 90 140 T170 140 l0 30 L10 170 z\" style=\"fill:#33aa55\"/>\n"
+                                  "    <path d=\"M110 100 a30 20 30 1 0 50 30 A20 20 0 0 1 110 100 Z\" fill=\"#ffaa00\"/>\n"
+                                  "    <path d=\"M0 0 L10 10\" fill=\"none\"/>\n"
+                                  "  </g>\n"
+                                  "</svg>\n";
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    svg_case_t* svg_case = calloc(1, sizeof(svg_case_t));
+    GPU_ASSERT_NULL(svg_case);
+    vg_lite_test_context_set_user_data(ctx, svg_case);
+
+    svg_case_add(svg_case, "builtin", svg_builtin, sizeof(svg_builtin) - 1);
+
+    char dir_path[128];
+    snprintf(dir_path, sizeof(dir_path), "%s/" SVG_DIR_NAME, vg_lite_test_context_get_output_dir(ctx));
+    svg_case_load_dir(svg_case, dir_path);
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    svg_case_t* svg_case = vg_lite_test_context_get_user_data(ctx);
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+
+    const uint32_t rows = (svg_case->count + SVG_GRID_COLS - 1) / SVG_GRID_COLS;
+    const float cell_w = (float)target_buffer->width / SVG_GRID_COLS;
+    const float cell_h = (float)target_buffer->height / rows;
+
+    for (uint32_t i = 0; i < svg_case->count; i++) {
+        svg_doc_t* doc = &svg_case->docs[i];
+
+        float view_box[4];
+        vg_lite_test_svg_get_view_box(doc->svg, view_box);
+        float scale = 1;
+        if (view_box[2] > 0 && view_box[3] > 0) {
+            scale = MATH_MIN(cell_w / view_box[2], cell_h / view_box[3]);
+        }
+
+        /* Fit the view box into its grid cell */
+        vg_lite_matrix_t matrix;
+        vg_lite_test_context_get_transform(ctx, &matrix);
+        vg_lite_translate((i % SVG_GRID_COLS) * cell_w, (i / SVG_GRID_COLS) * cell_h, &matrix);
+        vg_lite_scale(scale, scale, &matrix);
+        vg_lite_translate(-view_box[0], -view_box[1], &matrix);
+
+        uint32_t start = gpu_tick_get();
+
+        for (uint32_t j = 0; j < vg_lite_test_svg_get_count(doc->svg); j++) {
+            uint32_t color;
+            vg_lite_fill_t fill_rule;
+            vg_lite_test_path_t* path = vg_lite_test_svg_get_path(doc->svg, j, &color, &fill_rule);
+
+            VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_draw(
+                target_buffer,
+                vg_lite_test_path_get_path(path),
+                fill_rule,
+                &matrix,
+                VG_LITE_BLEND_SRC_OVER,
+                color));
+
+            vg_lite_test_context_add_path_stats(ctx, vg_lite_test_path_get_path(path), &matrix);
+            VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_test_idle_flush());
+        }
+
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+        doc->draw_tick = gpu_tick_elaps(start);
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    svg_case_t* svg_case = vg_lite_test_context_get_user_data(ctx);
+    if (!svg_case) {
+        return VG_LITE_SUCCESS;
+    }
+
+    svg_case_write_report(svg_case, ctx);
+
+    for (uint32_t i = 0; i < svg_case->count; i++) {
+        vg_lite_test_svg_destroy(svg_case->docs[i].svg);
+    }
+
+    free(svg_case);
+    return VG_LITE_SUCCESS;
+}
+
+static void svg_case_add(svg_case_t* svg_case, const char* name, const char* text, size_t len)
+{
+    if (svg_case->count >= SVG_DOC_MAX) {
+        GPU_LOG_WARN("Too many SVG files, skip %s", name);
+        return;
+    }
+
+    uint32_t start = gpu_tick_get();
+    struct vg_lite_test_svg_s* svg = vg_lite_test_svg_parse(text, len);
+    uint32_t parse_tick = gpu_tick_elaps(start);
+
+    if (!svg) {
+        GPU_LOG_ERROR("Parse %s failed", name);
+        return;
+    }
+
+    svg_doc_t* doc = &svg_case->docs[svg_case->count++];
+    snprintf(doc->name, sizeof(doc->name), "%s", name);
+    doc->svg = svg;
+    doc->parse_tick = parse_tick;
+}
+
+static void svg_case_load_dir(svg_case_t* svg_case, const char* dir_path)
+{
+    DIR* dir = opendir(dir_path);
+    if (!dir) {
+        GPU_LOG_INFO("No SVG directory: %s", dir_path);
+        return;
+    }
+
+    char names[SVG_DOC_MAX][32];
+    int name_count = 0;
+    struct dirent* entry;
+
+    while ((entry = readdir(dir)) != NULL && name_count < SVG_DOC_MAX - 1) {
+        size_t len = strlen(entry->d_name);
+        if (len > 4 && len < sizeof(names[0]) && strcmp(entry->d_name + len - 4, ".svg") == 0) {
+            strcpy(names[name_count++], entry->d_name);
+        }
+    }
+
+    closedir(dir);
+
+    /* Keep the report rows stable across runs */
+    qsort(names, name_count, sizeof(names[0]), svg_name_compare);
+
+    for (int i = 0; i < name_count; i++) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%.31s", dir_path, names[i]);
+
+        FILE* fp = fopen(path, "rb");
+        if (!fp) {
+            GPU_LOG_ERROR("open %s failed", path);
+            continue;
+        }
+
+        fseek(fp, 0, SEEK_END);
+        long size = ftell(fp);
+        fseek(fp, 0, SEEK_SET);
+
+        /* Read the whole file up front so only the parsing is timed */
+        char* text = size > 0 ? malloc(size) : NULL;
+        if (text && fread(text, 1, size, fp) == (size_t)size) {
+            svg_case_add(svg_case, names[i], text, size);
+        }
+
+        free(text);
+        fclose(fp);
+    }
+}
+
+static void svg_case_write_report(svg_case_t* svg_case, struct vg_lite_test_context_s* ctx)
+{
+    size_t total_bytes = 0;
+    uint32_t total_paths = 0;
+    uint32_t total_parse_tick = 0;
+    uint32_t total_draw_tick = 0;
+
+    for (uint32_t i = 0; i < svg_case->count; i++) {
+        svg_doc_t* doc = &svg_case->docs[i];
+        total_bytes += vg_lite_test_svg_get_text_size(doc->svg);
+        total_paths += vg_lite_test_svg_get_count(doc->svg);
+        total_parse_tick += doc->parse_tick;
+        total_draw_tick += doc->draw_tick;
+    }
+
+    /* bytes per microsecond is MB/s */
+    vg_lite_test_context_set_remark(ctx,
+        "%" PRIu32 " files, %" PRIu32 " paths, parse %0.2f MB/s, draw %0.3f ms",
+        svg_case->count, total_paths,
+        total_parse_tick ? (float)total_bytes / total_parse_tick : 0.0f,
+        total_draw_tick / 1000.0f);
+
+    struct gpu_recorder_s* recorder = vg_lite_test_context_create_report(ctx, "svg");
+    if (!recorder) {
+        return;
+    }
+
+    gpu_recorder_write_string(recorder, "File,Bytes,Paths,Parse Time(ms),Parse Throughput(MB/s),Draw Time(ms)\n");
+
+    for (uint32_t i = 0; i < svg_case->count; i++) {
+        svg_doc_t* doc = &svg_case->docs[i];
+        size_t bytes = vg_lite_test_svg_get_text_size(doc->svg);
+
+        char row[160];
+        snprintf(row, sizeof(row), "%s,%zu,%" PRIu32 ",%0.3f,%0.2f,%0.3f\n",
+            doc->name,
+            bytes,
+            vg_lite_test_svg_get_count(doc->svg),
+            doc->parse_tick / 1000.0f,
+            doc->parse_tick ? (float)bytes / doc->parse_tick : 0.0f,
+            doc->draw_tick / 1000.0f);
+        gpu_recorder_write_string(recorder, row);
+    }
+
+    gpu_recorder_delete(recorder);
+}
+
+static int svg_name_compare(const void* a, const void* b)
+{
+    return strcmp(a, b);
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(path_svg, NONE, "Draw SVG files from the svg directory");
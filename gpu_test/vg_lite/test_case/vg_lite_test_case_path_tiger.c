@@ -73,6 +73,7 @@ static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
             VG_LITE_BLEND_SRC_OVER,
             tiger_color_data[i]));
 
+        vg_lite_test_context_add_path_stats(ctx, &tiger_path[i], &matrix);
         VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_test_idle_flush());
     }
 
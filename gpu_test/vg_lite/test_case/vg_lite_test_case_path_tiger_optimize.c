@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_assert.h"
+#include "../../gpu_tick.h"
+#include "../resource/tiger_paths.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_path.h"
+#include "../vg_lite_test_utils.h"
+#include <inttypes.h>
+#include <stdlib.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Tiger coordinates are integers, so only exact merges happen */
+#define OPTIMIZE_EPSILON 0.1f
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    vg_lite_test_path_t* paths[TIGER_PATH_COUNT];
+    size_t original_bytes;
+    size_t saved_bytes;
+    uint32_t optimize_tick;
+    uint32_t original_draw_tick;
+    uint32_t optimized_draw_tick;
+} optimize_case_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void copy_iter_cb(void* user_data, uint8_t op_code, const float* data, uint32_t len)
+{
+    vg_lite_test_path_t* path = user_data;
+
+    switch (op_code) {
+    case VLC_OP_MOVE:
+        vg_lite_test_path_move_to(path, data[0], data[1]);
+        break;
+    case VLC_OP_LINE:
+        vg_lite_test_path_line_to(path, data[0], data[1]);
+        break;
+    case VLC_OP_QUAD:
+        vg_lite_test_path_quad_to(path, data[0], data[1], data[2], data[3]);
+        break;
+    case VLC_OP_CUBIC:
+        vg_lite_test_path_cubic_to(path, data[0], data[1], data[2], data[3], data[4], data[5]);
+        break;
+    case VLC_OP_CLOSE:
+        vg_lite_test_path_close(path);
+        break;
+    case VLC_OP_END:
+        vg_lite_test_path_end(path);
+        break;
+    default:
+        GPU_LOG_WARN("Unexpected tiger op: 0x%x", op_code);
+        break;
+    }
+}
+
+static vg_lite_error_t draw_tiger(struct vg_lite_test_context_s* ctx, optimize_case_t* optimize_case, float offset_x, bool optimized)
+{
+    vg_lite_matrix_t matrix;
+    vg_lite_test_context_get_transform(ctx, &matrix);
+    vg_lite_translate(offset_x + 75, 150, &matrix);
+    vg_lite_scale(1.75, 1.75, &matrix);
+
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+
+    for (int i = 0; i < TIGER_PATH_COUNT; i++) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_draw(
+            target_buffer,
+            optimized ? vg_lite_test_path_get_path(optimize_case->paths[i]) : &tiger_path[i],
+            VG_LITE_FILL_EVEN_ODD,
+            &matrix,
+            VG_LITE_BLEND_SRC_OVER,
+            tiger_color_data[i]));
+
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_test_idle_flush());
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    optimize_case_t* optimize_case = calloc(1, sizeof(optimize_case_t));
+    GPU_ASSERT_NULL(optimize_case);
+    vg_lite_test_context_set_user_data(ctx, optimize_case);
+
+    for (int i = 0; i < TIGER_PATH_COUNT; i++) {
+        vg_lite_test_path_t* path = vg_lite_test_path_create(tiger_path[i].format);
+        vg_lite_test_path_reserve(path, tiger_path[i].path_length);
+        vg_lite_test_path_set_bounding_box(path,
+            tiger_path[i].bounding_box[0], tiger_path[i].bounding_box[1],
+            tiger_path[i].bounding_box[2], tiger_path[i].bounding_box[3]);
+        vg_lite_test_path_for_each_data(&tiger_path[i], copy_iter_cb, path);
+        optimize_case->paths[i] = path;
+        optimize_case->original_bytes += tiger_path[i].path_length;
+    }
+
+    uint32_t start = gpu_tick_get();
+
+    for (int i = 0; i < TIGER_PATH_COUNT; i++) {
+        optimize_case->saved_bytes += vg_lite_test_path_optimize(optimize_case->paths[i], OPTIMIZE_EPSILON);
+    }
+
+    optimize_case->optimize_tick = gpu_tick_elaps(start);
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    optimize_case_t* optimize_case = vg_lite_test_context_get_user_data(ctx);
+
+    /* Original on the left, optimized on the right, they must look the same */
+    uint32_t start = gpu_tick_get();
+    VG_LITE_TEST_CHECK_ERROR_RETURN(draw_tiger(ctx, optimize_case, 0, false));
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+    optimize_case->original_draw_tick = gpu_tick_elaps(start);
+
+    start = gpu_tick_get();
+    VG_LITE_TEST_CHECK_ERROR_RETURN(draw_tiger(ctx, optimize_case, 240, true));
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+    optimize_case->optimized_draw_tick = gpu_tick_elaps(start);
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    optimize_case_t* optimize_case = vg_lite_test_context_get_user_data(ctx);
+    if (!optimize_case) {
+        return VG_LITE_SUCCESS;
+    }
+
+    vg_lite_test_context_set_remark(ctx,
+        "%zu -> %zu bytes (-%0.1f%%); optimize %0.3f ms; draw %0.3f -> %0.3f ms",
+        optimize_case->original_bytes,
+        optimize_case->original_bytes - optimize_case->saved_bytes,
+        optimize_case->saved_bytes * 100.0f / optimize_case->original_bytes,
+        optimize_case->optimize_tick / 1000.0f,
+        optimize_case->original_draw_tick / 1000.0f,
+        optimize_case->optimized_draw_tick / 1000.0f);
+
+    for (int i = 0; i < TIGER_PATH_COUNT; i++) {
+        vg_lite_test_path_destroy(optimize_case->paths[i]);
+    }
+
+    free(optimize_case);
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(path_tiger_optimize, NONE, "Draw tiger paths(239) before (left) and after (right) path optimization");
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_tick.h"
+#include "../resource/tiger_paths.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_utils.h"
+#include "../vg_lite_test_vgpath.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define TIGER_VGPATH_NAME "tiger.vgpath"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    char path[128];
+    snprintf(path, sizeof(path), "%s/" TIGER_VGPATH_NAME, vg_lite_test_context_get_output_dir(ctx));
+
+    /* Bootstrap the scene file from the built-in header on first run */
+    if (access(path, F_OK) != 0
+        && !vg_lite_test_vgpath_save(path, tiger_path, tiger_color_data, TIGER_PATH_COUNT, VG_LITE_FILL_EVEN_ODD)) {
+        return VG_LITE_GENERIC_IO;
+    }
+
+    uint32_t start = gpu_tick_get();
+    struct vg_lite_test_vgpath_s* vgpath = vg_lite_test_vgpath_load(path);
+    uint32_t load_tick = gpu_tick_elaps(start);
+
+    if (!vgpath) {
+        return VG_LITE_GENERIC_IO;
+    }
+
+    vg_lite_test_context_set_user_data(ctx, vgpath);
+    vg_lite_test_context_set_remark(ctx,
+        "%" PRIu32 " paths, %" PRIu32 " bytes, %" PRIu32 " in place, load %0.3f ms",
+        vg_lite_test_vgpath_get_count(vgpath),
+        vg_lite_test_vgpath_get_file_size(vgpath),
+        vg_lite_test_vgpath_get_mapped_count(vgpath),
+        load_tick / 1000.0f);
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    struct vg_lite_test_vgpath_s* vgpath = vg_lite_test_context_get_user_data(ctx);
+
+    vg_lite_matrix_t matrix;
+    vg_lite_test_context_get_transform(ctx, &matrix);
+    vg_lite_translate(150, 150, &matrix);
+    vg_lite_scale(3.5, 3.5, &matrix);
+
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+
+    for (uint32_t i = 0; i < vg_lite_test_vgpath_get_count(vgpath); i++) {
+        uint32_t color;
+        vg_lite_fill_t fill_rule;
+        vg_lite_path_t* path = vg_lite_test_vgpath_get_path(vgpath, i, &color, &fill_rule);
+
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_draw(
+            target_buffer,
+            path,
+            fill_rule,
+            &matrix,
+            VG_LITE_BLEND_SRC_OVER,
+            color));
+
+        vg_lite_test_context_add_path_stats(ctx, path, &matrix);
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_test_idle_flush());
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    struct vg_lite_test_vgpath_s* vgpath = vg_lite_test_context_get_user_data(ctx);
+    if (vgpath) {
+        vg_lite_test_vgpath_destroy(vgpath);
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(path_tiger_vgpath, NONE, "Draw tiger paths(239) loaded from a .vgpath file");
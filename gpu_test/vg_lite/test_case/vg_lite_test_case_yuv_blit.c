@@ -0,0 +1,406 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../gpu_assert.h"
+#include "../../gpu_buffer.h"
+#include "../../gpu_cache.h"
+#include "../../gpu_math.h"
+#include "../../gpu_recorder.h"
+#include "../../gpu_tick.h"
+#include "../vg_lite_test_context.h"
+#include "../vg_lite_test_utils.h"
+#include "../vg_lite_test_yuv.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define SRC_SIZE 256
+#define REPEAT_COUNT 8
+
+/* The GPU may round the color matrix or filter the chroma a little differently */
+#define GPU_TOLERANCE 8
+
+/* All sources on one screen at the end, the first slot is BGRA8888 */
+#define SHOW_COLUMNS 3
+#define SHOW_SCALE 0.5f
+#define SHOW_GAP 8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    vg_lite_buffer_t yuv;
+    struct gpu_buffer_s* yuv_buffer;
+    uint32_t pack_tick;
+    uint32_t unpack_tick;
+    uint8_t round_trip_diff;
+    uint32_t gpu_tick;
+    uint32_t gpu_diff_count;
+    uint8_t gpu_max_diff;
+    bool gpu_done;
+    bool gpu_checked;
+} yuv_result_t;
+
+typedef struct {
+    vg_lite_buffer_t rgb;
+    vg_lite_buffer_t ref;
+    struct gpu_buffer_s* rgb_buffer;
+    struct gpu_buffer_s* ref_buffer;
+    uint32_t rgb_tick;
+    yuv_result_t* results;
+    uint8_t tolerance;
+    bool done;
+} yuv_case_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const vg_lite_buffer_format_t yuv_formats[] = {
+    VG_LITE_NV12,
+    VG_LITE_NV16,
+    VG_LITE_YV12,
+    VG_LITE_YV16,
+    VG_LITE_YV24,
+    VG_LITE_YUY2,
+    VG_LITE_ANV12,
+    VG_LITE_AYUY2,
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define YUV_FORMAT_COUNT (int)(sizeof(yuv_formats) / sizeof(yuv_formats[0]))
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void fill_source(vg_lite_buffer_t* buffer)
+{
+    /* Hue across, brightness down and sharp color edges, where the chroma subsampling shows */
+    for (int y = 0; y < buffer->height; y++) {
+        uint32_t* row = (uint32_t*)((uint8_t*)buffer->memory + (size_t)y * buffer->stride);
+
+        for (int x = 0; x < buffer->width; x++) {
+            const int light = 0xFF - y * 0xC0 / buffer->height;
+            const int hue = x * 6 * 0x100 / buffer->width;
+            const int ramp = hue & 0xFF;
+            int r, g, b;
+
+            switch (hue >> 8) {
+            case 0: r = 0xFF, g = ramp, b = 0; break;
+            case 1: r = 0xFF - ramp, g = 0xFF, b = 0; break;
+            case 2: r = 0, g = 0xFF, b = ramp; break;
+            case 3: r = 0, g = 0xFF - ramp, b = 0xFF; break;
+            case 4: r = ramp, g = 0, b = 0xFF; break;
+            default: r = 0xFF, g = 0, b = 0xFF - ramp; break;
+            }
+
+            /* One pixel wide stripes every 32 lines */
+            if ((y & 31) == 0) {
+                r = g = b = 0xFF * (x & 1);
+            }
+
+            row[x] = 0xFF000000 | (uint32_t)(r * light / 0xFF) << 16 | (uint32_t)(g * light / 0xFF) << 8 | (uint32_t)(b * light / 0xFF);
+        }
+    }
+}
+
+static void blit_matrix(struct vg_lite_test_context_s* ctx, vg_lite_matrix_t* matrix, int* x, int* y)
+{
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+    *x = ((int)target_buffer->width - SRC_SIZE) / 2;
+    *y = ((int)target_buffer->height - SRC_SIZE) / 2;
+
+    vg_lite_test_context_get_transform(ctx, matrix);
+    vg_lite_translate(*x, *y, matrix);
+}
+
+static vg_lite_error_t blit_timed(struct vg_lite_test_context_s* ctx, vg_lite_buffer_t* source, uint32_t* tick)
+{
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+
+    vg_lite_matrix_t matrix;
+    int x, y;
+    blit_matrix(ctx, &matrix, &x, &y);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear(target_buffer, NULL, 0xFFFFFFFF));
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+
+    uint32_t start = gpu_tick_get();
+    for (int i = 0; i < REPEAT_COUNT; i++) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_blit(target_buffer, source, &matrix, VG_LITE_BLEND_NONE, 0, VG_LITE_FILTER_POINT));
+    }
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_finish());
+
+    *tick = gpu_tick_elaps(start);
+    return VG_LITE_SUCCESS;
+}
+
+static bool check_target(struct vg_lite_test_context_s* ctx, const vg_lite_buffer_t* ref, uint8_t tolerance, yuv_result_t* result)
+{
+    vg_lite_buffer_t* target_buffer = vg_lite_test_context_get_target_buffer(ctx);
+    if (target_buffer->format != VG_LITE_BGRA8888 || target_buffer->tiled != VG_LITE_LINEAR
+        || target_buffer->width < SRC_SIZE || target_buffer->height < SRC_SIZE) {
+        return false;
+    }
+
+    vg_lite_matrix_t matrix;
+    int x, y;
+    blit_matrix(ctx, &matrix, &x, &y);
+
+    /* A view of the blitted area, same size as the reference */
+    vg_lite_buffer_t view = *target_buffer;
+    view.width = SRC_SIZE;
+    view.height = SRC_SIZE;
+    view.memory = (uint8_t*)target_buffer->memory + (size_t)y * target_buffer->stride + (size_t)x * sizeof(uint32_t);
+
+    gpu_cache_invalidate(target_buffer->memory, target_buffer->stride * target_buffer->height);
+    result->gpu_diff_count = vg_lite_test_buffer_diff(&view, ref, tolerance, &result->gpu_max_diff);
+    return true;
+}
+
+static vg_lite_error_t run_format(struct vg_lite_test_context_s* ctx, yuv_case_t* yuv_case, vg_lite_buffer_format_t format, yuv_result_t* result)
+{
+    /* Kept until the teardown, on_draw shows it */
+    vg_lite_buffer_t* yuv = &result->yuv;
+    result->yuv_buffer = vg_lite_test_yuv_buffer_alloc(yuv, SRC_SIZE, SRC_SIZE, format);
+    if (!result->yuv_buffer) {
+        return VG_LITE_OUT_OF_MEMORY;
+    }
+
+    uint32_t start = gpu_tick_get();
+    for (int i = 0; i < REPEAT_COUNT; i++) {
+        if (!vg_lite_test_yuv_from_bgra8888(yuv, &yuv_case->rgb)) {
+            GPU_LOG_ERROR("Failed to pack %s", vg_lite_test_buffer_format_string(format));
+            return VG_LITE_NOT_SUPPORT;
+        }
+    }
+    result->pack_tick = gpu_tick_elaps(start);
+
+    start = gpu_tick_get();
+    for (int i = 0; i < REPEAT_COUNT; i++) {
+        if (!vg_lite_test_yuv_to_bgra8888(&yuv_case->ref, yuv)) {
+            GPU_LOG_ERROR("Failed to unpack %s", vg_lite_test_buffer_format_string(format));
+            return VG_LITE_NOT_SUPPORT;
+        }
+    }
+    result->unpack_tick = gpu_tick_elaps(start);
+
+    vg_lite_test_buffer_diff(&yuv_case->rgb, &yuv_case->ref, 0, &result->round_trip_diff);
+
+    /* The CPU backend has no YUV sampler, the replay only measures the conversions */
+    if (vg_lite_query_feature(vg_lite_test_yuv_get_feature(format)) && !vg_lite_test_context_is_cpu_replay(ctx)) {
+        gpu_cache_flush(yuv->memory, result->yuv_buffer->stride * result->yuv_buffer->height);
+
+        VG_LITE_TEST_CHECK_ERROR_RETURN(blit_timed(ctx, yuv, &result->gpu_tick));
+        result->gpu_done = true;
+        result->gpu_checked = check_target(ctx, &yuv_case->ref, yuv_case->tolerance, result);
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t show_source(struct vg_lite_test_context_s* ctx, vg_lite_buffer_t* source, int index)
+{
+    const float step = SRC_SIZE * SHOW_SCALE + SHOW_GAP;
+
+    vg_lite_matrix_t matrix;
+    vg_lite_test_context_get_transform(ctx, &matrix);
+    vg_lite_translate((index % SHOW_COLUMNS) * step, (index / SHOW_COLUMNS) * step, &matrix);
+    vg_lite_scale(SHOW_SCALE, SHOW_SCALE, &matrix);
+
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_blit(
+        vg_lite_test_context_get_target_buffer(ctx),
+        source,
+        &matrix,
+        VG_LITE_BLEND_SRC_OVER,
+        0,
+        VG_LITE_FILTER_BI_LINEAR));
+
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t show_all(struct vg_lite_test_context_s* ctx, yuv_case_t* yuv_case)
+{
+    VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_clear(vg_lite_test_context_get_target_buffer(ctx), NULL, 0xFFFFFFFF));
+    VG_LITE_TEST_CHECK_ERROR_RETURN(show_source(ctx, &yuv_case->rgb, 0));
+
+    /* Every source the GPU could read, the order of the report */
+    for (int i = 0; i < YUV_FORMAT_COUNT; i++) {
+        if (yuv_case->results[i].gpu_done) {
+            VG_LITE_TEST_CHECK_ERROR_RETURN(show_source(ctx, &yuv_case->results[i].yuv, i + 1));
+        }
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+static void write_report(struct vg_lite_test_context_s* ctx, yuv_case_t* yuv_case)
+{
+    struct gpu_recorder_s* recorder = vg_lite_test_context_create_report(ctx, "yuv_blit");
+    if (!recorder) {
+        return;
+    }
+
+    gpu_recorder_write_string(recorder,
+        "Format,GPU Blit(Mpix/s),vs BGRA8888,GPU Diff Pixels,GPU Max Diff,"
+        "CPU Pack(Mpix/s),CPU Unpack(Mpix/s),Round Trip Max Diff\n");
+
+    const float pixels = (float)SRC_SIZE * SRC_SIZE * REPEAT_COUNT;
+    const float rgb_rate = yuv_case->rgb_tick ? pixels / yuv_case->rgb_tick : 0;
+
+    char row[192];
+    snprintf(row, sizeof(row), "BGRA8888,%0.1f,1.00,-,-,-,-,-\n", rgb_rate);
+    gpu_recorder_write_string(recorder, row);
+
+    for (int i = 0; i < YUV_FORMAT_COUNT; i++) {
+        const yuv_result_t* result = &yuv_case->results[i];
+
+        char gpu[64] = "-,-";
+        char diff[32] = "-,-";
+        if (result->gpu_done) {
+            const float rate = result->gpu_tick ? pixels / result->gpu_tick : 0;
+            snprintf(gpu, sizeof(gpu), "%0.1f,%0.2f", rate, rgb_rate > 0 ? rate / rgb_rate : 0);
+        }
+
+        if (result->gpu_checked) {
+            snprintf(diff, sizeof(diff), "%" PRIu32 ",%d", result->gpu_diff_count, result->gpu_max_diff);
+        }
+
+        snprintf(row, sizeof(row), "%s,%s,%s,%0.1f,%0.1f,%d\n",
+            vg_lite_test_buffer_format_string(yuv_formats[i]),
+            gpu,
+            diff,
+            result->pack_tick ? pixels / result->pack_tick : 0,
+            result->unpack_tick ? pixels / result->unpack_tick : 0,
+            result->round_trip_diff);
+        gpu_recorder_write_string(recorder, row);
+    }
+
+    gpu_recorder_delete(recorder);
+}
+
+static vg_lite_error_t on_setup(struct vg_lite_test_context_s* ctx)
+{
+    yuv_case_t* yuv_case = calloc(1, sizeof(yuv_case_t));
+    GPU_ASSERT_NULL(yuv_case);
+    vg_lite_test_context_set_user_data(ctx, yuv_case);
+
+    yuv_case->results = calloc(YUV_FORMAT_COUNT, sizeof(yuv_result_t));
+    GPU_ASSERT_NULL(yuv_case->results);
+
+    yuv_case->rgb_buffer = vg_lite_test_buffer_alloc(
+        &yuv_case->rgb, SRC_SIZE, SRC_SIZE, VG_LITE_BGRA8888, VG_LITE_TEST_STRIDE_AUTO);
+    yuv_case->ref_buffer = vg_lite_test_buffer_alloc(
+        &yuv_case->ref, SRC_SIZE, SRC_SIZE, VG_LITE_BGRA8888, VG_LITE_TEST_STRIDE_AUTO);
+    if (!yuv_case->rgb_buffer || !yuv_case->ref_buffer) {
+        return VG_LITE_OUT_OF_MEMORY;
+    }
+
+    fill_source(&yuv_case->rgb);
+    gpu_cache_flush(yuv_case->rgb.memory, yuv_case->rgb.stride * yuv_case->rgb.height);
+
+    /* The timed conversions and blits finish on their own, on_draw only shows the sources */
+    VG_LITE_TEST_CHECK_ERROR_RETURN(blit_timed(ctx, &yuv_case->rgb, &yuv_case->rgb_tick));
+
+    yuv_case->tolerance = MATH_MIN(GPU_TOLERANCE + vg_lite_test_context_get_tolerance(ctx), 0xFF);
+    for (int i = 0; i < YUV_FORMAT_COUNT; i++) {
+        VG_LITE_TEST_CHECK_ERROR_RETURN(run_format(ctx, yuv_case, yuv_formats[i], &yuv_case->results[i]));
+    }
+
+    yuv_case->done = true;
+    return VG_LITE_SUCCESS;
+}
+
+static vg_lite_error_t on_draw(struct vg_lite_test_context_s* ctx)
+{
+    yuv_case_t* yuv_case = vg_lite_test_context_get_user_data(ctx);
+    return show_all(ctx, yuv_case);
+}
+
+static vg_lite_error_t on_teardown(struct vg_lite_test_context_s* ctx)
+{
+    yuv_case_t* yuv_case = vg_lite_test_context_get_user_data(ctx);
+    if (!yuv_case) {
+        return VG_LITE_SUCCESS;
+    }
+
+    if (yuv_case->done) {
+        int blitted = 0;
+        int mismatched = 0;
+        for (int i = 0; i < YUV_FORMAT_COUNT; i++) {
+            const yuv_result_t* result = &yuv_case->results[i];
+            blitted += result->gpu_done;
+            mismatched += result->gpu_checked && result->gpu_diff_count;
+        }
+
+        const yuv_result_t* nv12 = &yuv_case->results[0];
+        const float pixels = (float)SRC_SIZE * SRC_SIZE * REPEAT_COUNT;
+        vg_lite_test_context_set_remark(ctx, "%d/%d formats blitted; %d mismatch the reference; NV12 pack %0.1f Mpix/s",
+            blitted, YUV_FORMAT_COUNT, mismatched, nv12->pack_tick ? pixels / nv12->pack_tick : 0);
+
+        if (mismatched) {
+            vg_lite_test_context_set_failed(ctx, "%d formats differ from the CPU reference by more than %d",
+                mismatched, yuv_case->tolerance);
+        }
+
+        write_report(ctx, yuv_case);
+    }
+
+    if (yuv_case->rgb_buffer) {
+        gpu_buffer_free(yuv_case->rgb_buffer);
+    }
+
+    if (yuv_case->ref_buffer) {
+        gpu_buffer_free(yuv_case->ref_buffer);
+    }
+
+    if (yuv_case->results) {
+        for (int i = 0; i < YUV_FORMAT_COUNT; i++) {
+            if (yuv_case->results[i].yuv_buffer) {
+                gpu_buffer_free(yuv_case->results[i].yuv_buffer);
+            }
+        }
+    }
+
+    free(yuv_case->results);
+    free(yuv_case);
+    return VG_LITE_SUCCESS;
+}
+
+VG_LITE_TEST_CASE_ITEM_DEF(yuv_blit, NONE, "Blit NV12/NV16/YV12/YV16/YV24/YUY2 and alpha YUV sources against BGRA8888; check them against a CPU reference and report Mpix/s");
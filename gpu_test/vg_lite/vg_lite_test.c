@@ -18,12 +18,14 @@
  *      INCLUDES
  *********************/
 
+#include "../gpu_assert.h"
 #include "../gpu_context.h"
 #include "../gpu_log.h"
 #include "../gpu_recorder.h"
 #include "../gpu_screenshot.h"
 #include "../gpu_tick.h"
 #include "vg_lite_test_context.h"
+#include "vg_lite_test_sweep.h"
 #include "vg_lite_test_utils.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -44,16 +46,32 @@ struct vg_lite_test_iter_s {
     int group_size;
     int name_to_index;
     int current_index;
+    int item_index;
     int current_loop_count;
     int total_loop_count;
     int failed_count;
 };
 
+struct vg_lite_test_pipeline_s {
+    struct vg_lite_test_context_s* contexts[GPU_TEST_QUEUE_DEPTH_MAX];
+    int depth;
+    struct vg_lite_test_checksum_s* checksums;
+    int submit_count;
+    uint64_t submit_tick;
+    uint64_t total_tick;
+};
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
 static int vg_lite_test_run_group(struct gpu_test_context_s* ctx);
+static int vg_lite_test_run_items(
+    struct vg_lite_test_context_s* vg_lite_ctx,
+    struct vg_lite_test_iter_s* iter,
+    struct vg_lite_test_sweep_s* sweep,
+    int size_index);
+static int vg_lite_test_run_pipeline(struct vg_lite_test_pipeline_s* pipeline, struct vg_lite_test_iter_s* iter);
 
 /**********************
  *  STATIC VARIABLES
@@ -104,7 +122,8 @@ static bool vg_lite_test_iter_next(struct vg_lite_test_iter_s* iter)
                 return false;
             }
 
-            iter->item = iter->group[iter->name_to_index];
+            iter->item_index = iter->name_to_index;
+            iter->item = iter->group[iter->item_index];
             retval = true;
             break;
         }
@@ -113,7 +132,8 @@ static bool vg_lite_test_iter_next(struct vg_lite_test_iter_s* iter)
             return false;
         }
 
-        iter->item = iter->group[iter->current_index++];
+        iter->item_index = iter->current_index++;
+        iter->item = iter->group[iter->item_index];
         retval = true;
     } break;
 
@@ -129,7 +149,8 @@ static bool vg_lite_test_iter_next(struct vg_lite_test_iter_s* iter)
         }
 
         iter->current_index = iter->name_to_index >= 0 ? iter->name_to_index : (rand() % iter->group_size);
-        iter->item = iter->group[iter->current_index];
+        iter->item_index = iter->current_index;
+        iter->item = iter->group[iter->item_index];
         retval = true;
     } break;
 
@@ -143,6 +164,74 @@ static bool vg_lite_test_iter_next(struct vg_lite_test_iter_s* iter)
     return retval;
 }
 
+static int vg_lite_test_run_items(
+    struct vg_lite_test_context_s* vg_lite_ctx,
+    struct vg_lite_test_iter_s* iter,
+    struct vg_lite_test_sweep_s* sweep,
+    int size_index)
+{
+    iter->current_index = 0;
+    iter->current_loop_count = 0;
+
+    while (vg_lite_test_iter_next(iter)) {
+        bool passed = vg_lite_test_context_run_item(vg_lite_ctx, iter->item);
+        if (!passed) {
+            iter->failed_count++;
+        }
+
+        if (sweep && passed) {
+            struct vg_lite_test_result_s result;
+            vg_lite_test_context_get_result(vg_lite_ctx, &result);
+            if (!result.skipped) {
+                vg_lite_test_sweep_add_sample(sweep, iter->item_index, size_index, (result.draw_tick + result.finish_tick) / 1000.0f);
+            }
+        }
+    }
+
+    return iter->current_loop_count;
+}
+
+static int vg_lite_test_run_pipeline(struct vg_lite_test_pipeline_s* pipeline, struct vg_lite_test_iter_s* iter)
+{
+    iter->current_index = 0;
+    iter->current_loop_count = 0;
+
+    uint32_t start_tick = gpu_tick_get();
+
+    while (true) {
+        /* Queue up to depth cases, each into its own target, before waiting for any of them */
+        uint32_t submit_start_tick = gpu_tick_get();
+        int item_indexes[GPU_TEST_QUEUE_DEPTH_MAX];
+        int count = 0;
+
+        while (count < pipeline->depth && vg_lite_test_iter_next(iter)) {
+            vg_lite_test_context_submit_item(pipeline->contexts[count], iter->item);
+            item_indexes[count++] = iter->item_index;
+        }
+
+        pipeline->submit_tick += gpu_tick_elaps(submit_start_tick);
+
+        if (count == 0) {
+            break;
+        }
+
+        VG_LITE_TEST_CHECK_ERROR(vg_lite_finish());
+
+        /* Verify the completed targets only now that the GPU is idle */
+        for (int i = 0; i < count; i++) {
+            if (!vg_lite_test_context_complete_item(pipeline->contexts[i], &pipeline->checksums[item_indexes[i]])) {
+                iter->failed_count++;
+            }
+        }
+
+        pipeline->submit_count += count;
+    }
+
+    pipeline->total_tick += gpu_tick_elaps(start_tick);
+
+    return iter->current_loop_count;
+}
+
 static int vg_lite_test_run_group(struct gpu_test_context_s* ctx)
 {
     /* Import testcase entry */
@@ -177,17 +266,102 @@ static int vg_lite_test_run_group(struct gpu_test_context_s* ctx)
     iter.total_loop_count = ctx->param.run_loop_count;
 
     struct vg_lite_test_context_s* vg_lite_ctx = vg_lite_test_context_create(ctx);
+    vg_lite_test_context_write_header(vg_lite_ctx);
+
+    struct vg_lite_test_pipeline_s pipeline = { 0 };
+    pipeline.depth = iter.mode == GPU_TEST_MODE_STRESS ? ctx->param.queue_depth : 1;
+    if (ctx->target_buffer.data && pipeline.depth > 1) {
+        GPU_LOG_WARN("Queue depth is not supported on external target buffer");
+        pipeline.depth = 1;
+    }
+
+    /* Each queued case renders into the target of its own context */
+    pipeline.contexts[0] = vg_lite_ctx;
+    for (int i = 1; i < pipeline.depth; i++) {
+        pipeline.contexts[i] = vg_lite_test_context_create(ctx);
+    }
+
+    if (pipeline.depth > 1) {
+        pipeline.checksums = malloc(group_size * sizeof(struct vg_lite_test_checksum_s));
+        GPU_ASSERT_NULL(pipeline.checksums);
+    }
+
+    int size_count = ctx->param.target_size_count;
+    int format_count = ctx->param.target_format_count;
+    if (ctx->target_buffer.data && (size_count > 1 || format_count > 1)) {
+        GPU_LOG_WARN("Target size and format sweep is not supported on external target buffer");
+        size_count = 1;
+        format_count = 1;
+    }
+
+    int total_count = 0;
+
+    for (int format_index = 0; format_index < format_count; format_index++) {
+        gpu_color_format_t format = ctx->param.target_formats[format_index];
+
+        /* Only collect the scaling curve when there is more than one size */
+        struct vg_lite_test_sweep_s* sweep = NULL;
+        if (size_count > 1 && iter.mode == GPU_TEST_MODE_DEFAULT) {
+            sweep = vg_lite_test_sweep_create(vg_lite_test_group, group_size, size_count);
+        }
+
+        for (int size_index = 0; size_index < size_count; size_index++) {
+            const struct gpu_test_size_s* size = &ctx->param.target_sizes[size_index];
+            if (size_count > 1 || format_count > 1) {
+                bool target_set = true;
+                for (int i = 0; i < pipeline.depth && target_set; i++) {
+                    target_set = vg_lite_test_context_set_target(
+                        pipeline.contexts[i], size->width, size->height, vg_lite_test_gpu_format_to_vg_format(format));
+                }
+
+                if (!target_set) {
+                    continue;
+                }
+            }
+
+            if (sweep) {
+                vg_lite_buffer_t* target = vg_lite_test_context_get_target_buffer(vg_lite_ctx);
+                vg_lite_test_sweep_set_size(sweep, size_index, target->width, target->height);
+            }
+
+            if (pipeline.depth > 1) {
+                /* The renders of a case are only comparable within the same target layout */
+                memset(pipeline.checksums, 0, group_size * sizeof(struct vg_lite_test_checksum_s));
+                total_count += vg_lite_test_run_pipeline(&pipeline, &iter);
+            } else {
+                total_count += vg_lite_test_run_items(vg_lite_ctx, &iter, sweep, size_index);
+            }
+        }
+
+        if (sweep) {
+            char name[64];
+            if (format_count > 1) {
+                snprintf(name, sizeof(name), "vg_lite_sweep_%s", gpu_color_format_to_string(format));
+            } else {
+                snprintf(name, sizeof(name), "vg_lite_sweep");
+            }
 
-    while (vg_lite_test_iter_next(&iter)) {
-        if (!vg_lite_test_context_run_item(vg_lite_ctx, iter.item)) {
-            iter.failed_count++;
+            vg_lite_test_sweep_write_report(sweep, ctx->param.output_dir, name);
+            vg_lite_test_sweep_destroy(sweep);
         }
     }
 
-    vg_lite_test_context_destroy(vg_lite_ctx);
+    for (int i = 0; i < pipeline.depth; i++) {
+        vg_lite_test_context_destroy(pipeline.contexts[i]);
+    }
+
+    char buf[192];
+    int len = snprintf(buf, sizeof(buf), "Test result: %d failed / %d total", iter.failed_count, total_count);
+
+    if (pipeline.depth > 1 && pipeline.submit_tick > 0 && pipeline.total_tick > 0) {
+        /* Submission rate only counts the CPU side, completion rate includes the GPU waits */
+        snprintf(buf + len, sizeof(buf) - len, " | Queue depth %d: submission rate %0.1f/s completion rate %0.1f/s",
+            pipeline.depth,
+            pipeline.submit_count * 1000000.0f / pipeline.submit_tick,
+            pipeline.submit_count * 1000000.0f / pipeline.total_tick);
+    }
 
-    char buf[128];
-    snprintf(buf, sizeof(buf), "Test result: %d failed / %d total", iter.failed_count, iter.current_loop_count);
+    free(pipeline.checksums);
     GPU_LOG_WARN("%s", buf);
     gpu_recorder_write_string(ctx->recorder, "\n");
     gpu_recorder_write_string(ctx->recorder, buf);
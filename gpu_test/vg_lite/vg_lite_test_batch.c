@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_batch.h"
+#include "../gpu_assert.h"
+#include "vg_lite_test_utils.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define BATCH_RUN_COUNT_MIN 4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    vg_lite_test_path_t* path;
+    uint32_t color;
+    vg_lite_fill_t fill_rule;
+    uint32_t instance_count;
+    bool sealed;
+} batch_run_t;
+
+struct vg_lite_test_batch_s {
+    vg_lite_format_t format;
+    batch_run_t* runs;
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t instance_count;
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static batch_run_t* batch_get_run(struct vg_lite_test_batch_s* batch, vg_lite_fill_t fill_rule, uint32_t color);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+struct vg_lite_test_batch_s* vg_lite_test_batch_create(vg_lite_format_t data_format)
+{
+    struct vg_lite_test_batch_s* batch = calloc(1, sizeof(struct vg_lite_test_batch_s));
+    GPU_ASSERT_NULL(batch);
+    batch->format = data_format;
+    return batch;
+}
+
+void vg_lite_test_batch_destroy(struct vg_lite_test_batch_s* batch)
+{
+    GPU_ASSERT_NULL(batch);
+
+    /* Paths of reset runs are kept beyond count */
+    for (uint32_t i = 0; i < batch->capacity; i++) {
+        if (batch->runs[i].path) {
+            vg_lite_test_path_destroy(batch->runs[i].path);
+        }
+    }
+
+    free(batch->runs);
+    free(batch);
+}
+
+void vg_lite_test_batch_reset(struct vg_lite_test_batch_s* batch)
+{
+    GPU_ASSERT_NULL(batch);
+    batch->count = 0;
+    batch->instance_count = 0;
+}
+
+bool vg_lite_test_batch_add(
+    struct vg_lite_test_batch_s* batch,
+    const vg_lite_path_t* path,
+    const vg_lite_matrix_t* matrix,
+    vg_lite_fill_t fill_rule,
+    uint32_t color)
+{
+    GPU_ASSERT_NULL(batch);
+    GPU_ASSERT_NULL(path);
+
+    batch_run_t* run = batch_get_run(batch, fill_rule, color);
+
+    vg_lite_test_path_set_transform(run->path, matrix);
+    bool retval = vg_lite_test_path_append_transformed(run->path, path);
+    vg_lite_test_path_set_transform(run->path, NULL);
+
+    if (!retval) {
+        /* Drop a run that was opened for this instance only */
+        if (!run->instance_count) {
+            batch->count--;
+        }
+
+        return false;
+    }
+
+    run->instance_count++;
+    batch->instance_count++;
+    return true;
+}
+
+vg_lite_error_t vg_lite_test_batch_draw(
+    struct vg_lite_test_batch_s* batch,
+    vg_lite_buffer_t* target,
+    vg_lite_matrix_t* matrix,
+    vg_lite_blend_t blend)
+{
+    GPU_ASSERT_NULL(batch);
+    GPU_ASSERT_NULL(target);
+
+    for (uint32_t i = 0; i < batch->count; i++) {
+        batch_run_t* run = &batch->runs[i];
+
+        if (!run->sealed) {
+            vg_lite_test_path_end(run->path);
+            vg_lite_test_path_update_bounding_box(run->path);
+            run->sealed = true;
+        }
+
+        VG_LITE_TEST_CHECK_ERROR_RETURN(vg_lite_draw(
+            target,
+            vg_lite_test_path_get_path(run->path),
+            run->fill_rule,
+            matrix,
+            blend,
+            run->color));
+    }
+
+    return VG_LITE_SUCCESS;
+}
+
+uint32_t vg_lite_test_batch_get_draw_count(const struct vg_lite_test_batch_s* batch)
+{
+    GPU_ASSERT_NULL(batch);
+    return batch->count;
+}
+
+uint32_t vg_lite_test_batch_get_instance_count(const struct vg_lite_test_batch_s* batch)
+{
+    GPU_ASSERT_NULL(batch);
+    return batch->instance_count;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static batch_run_t* batch_get_run(struct vg_lite_test_batch_s* batch, vg_lite_fill_t fill_rule, uint32_t color)
+{
+    if (batch->count) {
+        batch_run_t* last = &batch->runs[batch->count - 1];
+        if (!last->sealed && last->color == color && last->fill_rule == fill_rule) {
+            return last;
+        }
+    }
+
+    if (batch->count == batch->capacity) {
+        uint32_t capacity = batch->capacity ? batch->capacity * 2 : BATCH_RUN_COUNT_MIN;
+        batch_run_t* runs = realloc(batch->runs, capacity * sizeof(batch_run_t));
+        GPU_ASSERT_NULL(runs);
+        memset(runs + batch->capacity, 0, (capacity - batch->capacity) * sizeof(batch_run_t));
+        batch->runs = runs;
+        batch->capacity = capacity;
+    }
+
+    batch_run_t* run = &batch->runs[batch->count++];
+
+    if (run->path) {
+        vg_lite_test_path_reset(run->path, batch->format);
+    } else {
+        run->path = vg_lite_test_path_create(batch->format);
+    }
+
+    run->color = color;
+    run->fill_rule = fill_rule;
+    run->instance_count = 0;
+    run->sealed = false;
+    return run;
+}
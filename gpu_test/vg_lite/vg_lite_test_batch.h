@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VG_LITE_TEST_BATCH_H
+#define VG_LITE_TEST_BATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_path.h"
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct vg_lite_test_batch_s;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Create a batch that merges path instances into as few draws as possible.
+ * @param data_format The data format of the merged paths.
+ * @return The batch object.
+ */
+struct vg_lite_test_batch_s* vg_lite_test_batch_create(vg_lite_format_t data_format);
+
+/**
+ * @brief Destroy a batch.
+ * @param batch The batch to destroy.
+ */
+void vg_lite_test_batch_destroy(struct vg_lite_test_batch_s* batch);
+
+/**
+ * @brief Remove all instances, the path memory is kept for the next use.
+ * @param batch The batch to reset.
+ */
+void vg_lite_test_batch_reset(struct vg_lite_test_batch_s* batch);
+
+/**
+ * @brief Add a path instance to the batch.
+ * @param batch The batch object.
+ * @param path The path to add, it must not contain relative or arc operations.
+ * @param matrix The instance transform baked into the points, NULL for identity.
+ * @param fill_rule The fill rule of the instance.
+ * @param color The fill color in the vg_lite_draw format.
+ * @return True on success, false if the path can not be transformed.
+ * @note Only consecutive instances with the same color and fill rule are merged, so the
+ *       paint order is kept. Instances of one merged path are filled together: overlaps
+ *       cancel with VG_LITE_FILL_EVEN_ODD and a translucent color is blended only once.
+ */
+bool vg_lite_test_batch_add(
+    struct vg_lite_test_batch_s* batch,
+    const vg_lite_path_t* path,
+    const vg_lite_matrix_t* matrix,
+    vg_lite_fill_t fill_rule,
+    uint32_t color);
+
+/**
+ * @brief Draw all merged paths of the batch.
+ * @param batch The batch object.
+ * @param target The target buffer.
+ * @param matrix The transform applied on top of the instance transforms.
+ * @param blend The blend mode.
+ * @return The first draw error, VG_LITE_SUCCESS otherwise.
+ * @note The merged paths are ended on the first draw, later instances start new draws.
+ */
+vg_lite_error_t vg_lite_test_batch_draw(
+    struct vg_lite_test_batch_s* batch,
+    vg_lite_buffer_t* target,
+    vg_lite_matrix_t* matrix,
+    vg_lite_blend_t blend);
+
+/**
+ * @brief Get the number of vg_lite_draw calls the batch issues.
+ * @param batch The batch object.
+ * @return The number of merged paths.
+ */
+uint32_t vg_lite_test_batch_get_draw_count(const struct vg_lite_test_batch_s* batch);
+
+/**
+ * @brief Get the number of instances added to the batch.
+ * @param batch The batch object.
+ * @return The number of instances.
+ */
+uint32_t vg_lite_test_batch_get_instance_count(const struct vg_lite_test_batch_s* batch);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*VG_LITE_TEST_BATCH_H*/
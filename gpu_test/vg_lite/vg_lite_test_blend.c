@@ -0,0 +1,372 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_blend.h"
+#include "vg_lite_test_convert.h"
+#include "../gpu_assert.h"
+#include "../gpu_math.h"
+#include <math.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Pixels converted at once for the straight alpha and BGR565 destinations */
+#define BLEND_CHUNK_SIZE 256
+
+/* Pixels per vectorized block of the kernels */
+#define BLEND_BLOCK_SIZE 8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/* Blend premultiplied 0xAARRGGBB colors, dst[i] = blend(src[i], dst[i]), the spans do not overlap */
+typedef void (*blend_kernel_t)(const uint32_t* restrict src, uint32_t* restrict dst, int len);
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static blend_kernel_t blend_get_kernel(vg_lite_blend_t blend);
+static inline uint32_t mul255(uint32_t a, uint32_t b);
+static void premultiply_span(const uint32_t* src, uint32_t* dst, int len);
+static void unpremultiply_span(const uint32_t* src, uint32_t* dst, int len);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/*
+ * One kernel per mode. COLOR_EXPR blends one channel from sc, dc, sa and da, ALPHA_EXPR the
+ * alpha from sa and da. Each pixel only depends on its own src and dst, so the fixed
+ * BLEND_BLOCK_SIZE inner loop is straight-line work the compiler can spread over SIMD lanes.
+ */
+#define BLEND_KERNEL_DEF(NAME, COLOR_EXPR, ALPHA_EXPR)                                          \
+    static inline uint32_t blend_channel_##NAME(uint32_t sc, uint32_t dc, uint32_t sa, uint32_t da) \
+    {                                                                                          \
+        /* Not every mode reads all four */                                                    \
+        (void)sc;                                                                              \
+        (void)dc;                                                                              \
+        (void)sa;                                                                              \
+        (void)da;                                                                              \
+        return MATH_MIN((COLOR_EXPR), 0xFF);                                                   \
+    }                                                                                          \
+                                                                                               \
+    static inline uint32_t blend_pixel_##NAME(uint32_t s, uint32_t d)                          \
+    {                                                                                          \
+        const uint32_t sa = s >> 24;                                                           \
+        const uint32_t da = d >> 24;                                                           \
+        const uint32_t b = blend_channel_##NAME(s & 0xFF, d & 0xFF, sa, da);                   \
+        const uint32_t g = blend_channel_##NAME((s >> 8) & 0xFF, (d >> 8) & 0xFF, sa, da);     \
+        const uint32_t r = blend_channel_##NAME((s >> 16) & 0xFF, (d >> 16) & 0xFF, sa, da);   \
+        return (uint32_t)MATH_MIN((ALPHA_EXPR), 0xFF) << 24 | r << 16 | g << 8 | b;            \
+    }                                                                                          \
+                                                                                               \
+    static void blend_kernel_##NAME(const uint32_t* restrict src, uint32_t* restrict dst, int len) \
+    {                                                                                          \
+        int i = 0;                                                                             \
+        for (; i + BLEND_BLOCK_SIZE <= len; i += BLEND_BLOCK_SIZE) {                           \
+            for (int j = 0; j < BLEND_BLOCK_SIZE; j++) {                                       \
+                dst[i + j] = blend_pixel_##NAME(src[i + j], dst[i + j]);                       \
+            }                                                                                  \
+        }                                                                                      \
+        for (; i < len; i++) {                                                                 \
+            dst[i] = blend_pixel_##NAME(src[i], dst[i]);                                       \
+        }                                                                                      \
+    }
+
+#define SRC_OVER_ALPHA (sa + mul255(da, 0xFF - sa))
+
+BLEND_KERNEL_DEF(none, sc, sa)
+BLEND_KERNEL_DEF(src_over, sc + mul255(dc, 0xFF - sa), SRC_OVER_ALPHA)
+BLEND_KERNEL_DEF(dst_over, mul255(sc, 0xFF - da) + dc, SRC_OVER_ALPHA)
+BLEND_KERNEL_DEF(src_in, mul255(sc, da), mul255(sa, da))
+BLEND_KERNEL_DEF(dst_in, mul255(dc, sa), mul255(da, sa))
+BLEND_KERNEL_DEF(multiply, mul255(sc, 0xFF - da) + mul255(dc, 0xFF - sa) + mul255(sc, dc), SRC_OVER_ALPHA)
+BLEND_KERNEL_DEF(screen, sc + dc - mul255(sc, dc), SRC_OVER_ALPHA)
+BLEND_KERNEL_DEF(darken, MATH_MIN(sc + mul255(dc, 0xFF - sa), dc + mul255(sc, 0xFF - da)), SRC_OVER_ALPHA)
+BLEND_KERNEL_DEF(lighten, MATH_MAX(sc + mul255(dc, 0xFF - sa), dc + mul255(sc, 0xFF - da)), SRC_OVER_ALPHA)
+BLEND_KERNEL_DEF(additive, sc + dc, sa + da)
+BLEND_KERNEL_DEF(subtract, mul255(dc, 0xFF - sc), mul255(da, 0xFF - sa))
+BLEND_KERNEL_DEF(additive_lvgl, sc + dc, SRC_OVER_ALPHA)
+BLEND_KERNEL_DEF(subtract_lvgl, dc > sc ? dc - sc : 0, SRC_OVER_ALPHA)
+BLEND_KERNEL_DEF(multiply_lvgl, mul255(sc, dc) + mul255(dc, 0xFF - sa), SRC_OVER_ALPHA)
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool vg_lite_test_blend_is_supported(vg_lite_blend_t blend)
+{
+    return blend_get_kernel(blend) != NULL;
+}
+
+bool vg_lite_test_blend_span(
+    vg_lite_blend_t blend,
+    const uint32_t* src,
+    void* dst,
+    vg_lite_buffer_format_t dst_format,
+    bool premultiplied,
+    int len)
+{
+    GPU_ASSERT_NULL(src);
+    GPU_ASSERT_NULL(dst);
+
+    blend_kernel_t kernel = blend_get_kernel(blend);
+    if (!kernel || (dst_format != VG_LITE_BGRA8888 && dst_format != VG_LITE_BGR565)) {
+        return false;
+    }
+
+    if (dst_format == VG_LITE_BGRA8888 && premultiplied) {
+        kernel(src, dst, len);
+        return true;
+    }
+
+    uint32_t src_chunk[BLEND_CHUNK_SIZE];
+    uint32_t dst_chunk[BLEND_CHUNK_SIZE];
+
+    for (int x = 0; x < len; x += BLEND_CHUNK_SIZE) {
+        const int count = MATH_MIN(len - x, BLEND_CHUNK_SIZE);
+        const uint32_t* chunk_src = src + x;
+
+        if (!premultiplied) {
+            premultiply_span(chunk_src, src_chunk, count);
+            chunk_src = src_chunk;
+        }
+
+        if (dst_format == VG_LITE_BGR565) {
+            uint16_t* dst16 = (uint16_t*)dst + x;
+            vg_lite_test_convert_row_to_bgra8888(dst_chunk, dst16, VG_LITE_BGR565, NULL, count);
+            kernel(chunk_src, dst_chunk, count);
+            vg_lite_test_convert_row_from_bgra8888(dst16, dst_chunk, VG_LITE_BGR565, count);
+        } else {
+            uint32_t* dst32 = (uint32_t*)dst + x;
+            premultiply_span(dst32, dst_chunk, count);
+            kernel(chunk_src, dst_chunk, count);
+            unpremultiply_span(dst_chunk, dst32, count);
+        }
+    }
+
+    return true;
+}
+
+uint32_t vg_lite_test_blend_pixel(vg_lite_blend_t blend, uint32_t src, uint32_t dst)
+{
+    float s[4];
+    float d[4];
+    float r[4];
+
+    /* Channels in B, G, R, A order */
+    for (int i = 0; i < 4; i++) {
+        s[i] = ((src >> (i * 8)) & 0xFF) / 255.0f;
+        d[i] = ((dst >> (i * 8)) & 0xFF) / 255.0f;
+    }
+
+    const float sa = s[3];
+    const float da = d[3];
+    const float src_over_a = sa + da * (1.0f - sa);
+
+    for (int i = 0; i < 3; i++) {
+        const float sc = s[i];
+        const float dc = d[i];
+
+        switch (blend) {
+        case VG_LITE_BLEND_NONE:
+            r[i] = sc;
+            r[3] = sa;
+            break;
+        case VG_LITE_BLEND_SRC_OVER:
+        case VG_LITE_BLEND_NORMAL_LVGL:
+            r[i] = sc + dc * (1.0f - sa);
+            r[3] = src_over_a;
+            break;
+        case VG_LITE_BLEND_DST_OVER:
+            r[i] = sc * (1.0f - da) + dc;
+            r[3] = src_over_a;
+            break;
+        case VG_LITE_BLEND_SRC_IN:
+            r[i] = sc * da;
+            r[3] = sa * da;
+            break;
+        case VG_LITE_BLEND_DST_IN:
+            r[i] = dc * sa;
+            r[3] = da * sa;
+            break;
+        case VG_LITE_BLEND_MULTIPLY:
+            r[i] = sc * (1.0f - da) + dc * (1.0f - sa) + sc * dc;
+            r[3] = src_over_a;
+            break;
+        case VG_LITE_BLEND_SCREEN:
+            r[i] = sc + dc - sc * dc;
+            r[3] = src_over_a;
+            break;
+        case VG_LITE_BLEND_DARKEN:
+            r[i] = MATH_MIN(sc + dc * (1.0f - sa), dc + sc * (1.0f - da));
+            r[3] = src_over_a;
+            break;
+        case VG_LITE_BLEND_LIGHTEN:
+            r[i] = MATH_MAX(sc + dc * (1.0f - sa), dc + sc * (1.0f - da));
+            r[3] = src_over_a;
+            break;
+        case VG_LITE_BLEND_ADDITIVE:
+            r[i] = sc + dc;
+            r[3] = sa + da;
+            break;
+        case VG_LITE_BLEND_SUBTRACT:
+            r[i] = dc * (1.0f - sc);
+            r[3] = da * (1.0f - sa);
+            break;
+        case VG_LITE_BLEND_ADDITIVE_LVGL:
+            r[i] = sc + dc;
+            r[3] = src_over_a;
+            break;
+        case VG_LITE_BLEND_SUBTRACT_LVGL:
+            r[i] = dc - sc;
+            r[3] = src_over_a;
+            break;
+        case VG_LITE_BLEND_MULTIPLY_LVGL:
+            r[i] = sc * dc + dc * (1.0f - sa);
+            r[3] = src_over_a;
+            break;
+        default:
+            r[i] = dc;
+            r[3] = da;
+            break;
+        }
+    }
+
+    uint32_t result = 0;
+    for (int i = 0; i < 4; i++) {
+        float value = MATH_MIN(MATH_MAX(r[i], 0.0f), 1.0f);
+        result |= (uint32_t)(value * 255.0f + 0.5f) << (i * 8);
+    }
+
+    return result;
+}
+
+uint32_t vg_lite_test_blend_color(vg_lite_color_t color, bool premultiply)
+{
+    /* ABGR8888 to 0xAARRGGBB */
+    uint32_t a = (color >> 24) & 0xFF;
+    uint32_t b = (color >> 16) & 0xFF;
+    uint32_t g = (color >> 8) & 0xFF;
+    uint32_t r = color & 0xFF;
+
+    if (premultiply) {
+        r = mul255(r, a);
+        g = mul255(g, a);
+        b = mul255(b, a);
+    }
+
+    return a << 24 | r << 16 | g << 8 | b;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static blend_kernel_t blend_get_kernel(vg_lite_blend_t blend)
+{
+    switch (blend) {
+    case VG_LITE_BLEND_NONE:
+        return blend_kernel_none;
+    case VG_LITE_BLEND_SRC_OVER:
+    case VG_LITE_BLEND_NORMAL_LVGL:
+        return blend_kernel_src_over;
+    case VG_LITE_BLEND_DST_OVER:
+        return blend_kernel_dst_over;
+    case VG_LITE_BLEND_SRC_IN:
+        return blend_kernel_src_in;
+    case VG_LITE_BLEND_DST_IN:
+        return blend_kernel_dst_in;
+    case VG_LITE_BLEND_MULTIPLY:
+        return blend_kernel_multiply;
+    case VG_LITE_BLEND_SCREEN:
+        return blend_kernel_screen;
+    case VG_LITE_BLEND_DARKEN:
+        return blend_kernel_darken;
+    case VG_LITE_BLEND_LIGHTEN:
+        return blend_kernel_lighten;
+    case VG_LITE_BLEND_ADDITIVE:
+        return blend_kernel_additive;
+    case VG_LITE_BLEND_SUBTRACT:
+        return blend_kernel_subtract;
+    case VG_LITE_BLEND_ADDITIVE_LVGL:
+        return blend_kernel_additive_lvgl;
+    case VG_LITE_BLEND_SUBTRACT_LVGL:
+        return blend_kernel_subtract_lvgl;
+    case VG_LITE_BLEND_MULTIPLY_LVGL:
+        return blend_kernel_multiply_lvgl;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
+static inline uint32_t mul255(uint32_t a, uint32_t b)
+{
+    /* a * b / 255 rounded, exact for 8-bit inputs */
+    uint32_t t = a * b + 0x80;
+    return (t + (t >> 8)) >> 8;
+}
+
+static void premultiply_span(const uint32_t* src, uint32_t* dst, int len)
+{
+    for (int i = 0; i < len; i++) {
+        const uint32_t c = src[i];
+        const uint32_t a = c >> 24;
+        dst[i] = a << 24
+            | mul255((c >> 16) & 0xFF, a) << 16
+            | mul255((c >> 8) & 0xFF, a) << 8
+            | mul255(c & 0xFF, a);
+    }
+}
+
+static void unpremultiply_span(const uint32_t* src, uint32_t* dst, int len)
+{
+    /* 255 / alpha in 16.16 fixed point, replaces three divisions per pixel */
+    static uint32_t recip[256];
+    if (!recip[1]) {
+        for (int a = 1; a < 256; a++) {
+            recip[a] = (0xFF * 0x10000 + a / 2) / a;
+        }
+    }
+
+    for (int i = 0; i < len; i++) {
+        const uint32_t c = src[i];
+        const uint32_t a = c >> 24;
+        const uint32_t inv = recip[a];
+        uint32_t result = a << 24;
+        for (int shift = 0; shift < 24; shift += 8) {
+            uint32_t value = (((c >> shift) & 0xFF) * inv + 0x8000) >> 16;
+            result |= MATH_MIN(value, 0xFF) << shift;
+        }
+
+        /* recip[0] is 0, a transparent result is black */
+        dst[i] = result;
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VG_LITE_TEST_BLEND_H
+#define VG_LITE_TEST_BLEND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_utils.h"
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Check whether a blend mode has a CPU kernel.
+ * @param blend The blend mode.
+ * @return True if vg_lite_test_blend_span and vg_lite_test_blend_pixel support it.
+ */
+bool vg_lite_test_blend_is_supported(vg_lite_blend_t blend);
+
+/**
+ * @brief Blend a span of source colors onto destination pixels on the CPU.
+ * @param blend The blend mode, with the formulas of VG-Lite.
+ * @param src len source colors in BGRA8888 memory order, 0xAARRGGBB as uint32_t.
+ * @param dst len destination pixels, replaced by the result.
+ * @param dst_format VG_LITE_BGRA8888 or VG_LITE_BGR565, BGR565 pixels are opaque.
+ * @param premultiplied True if the source and the BGRA8888 destination hold premultiplied colors,
+ *        false for straight alpha, which is premultiplied around the blend.
+ * @param len The number of pixels.
+ * @return True on success, false if the mode or the format is not supported.
+ * @note The kernels use 8-bit integer math over fixed size chunks, without branches on the
+ *       pixel values, so the compiler can vectorize them.
+ */
+bool vg_lite_test_blend_span(
+    vg_lite_blend_t blend,
+    const uint32_t* src,
+    void* dst,
+    vg_lite_buffer_format_t dst_format,
+    bool premultiplied,
+    int len);
+
+/**
+ * @brief Compute the expected result of one blend, the reference of the kernels and of the GPU.
+ * @param blend The blend mode.
+ * @param src The premultiplied source color, 0xAARRGGBB.
+ * @param dst The premultiplied destination color, 0xAARRGGBB.
+ * @return The premultiplied result, 0xAARRGGBB, computed in float and rounded.
+ */
+uint32_t vg_lite_test_blend_pixel(vg_lite_blend_t blend, uint32_t src, uint32_t dst);
+
+/**
+ * @brief Convert a vg_lite_color_t to the color written to a BGRA8888 target.
+ * @param color The ABGR8888 color.
+ * @param premultiply True for vg_lite_draw, which premultiplies, false for vg_lite_clear.
+ * @return The color, 0xAARRGGBB.
+ */
+uint32_t vg_lite_test_blend_color(vg_lite_color_t color, bool premultiply);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*VG_LITE_TEST_BLEND_H*/
@@ -0,0 +1,316 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_blur.h"
+#include "../gpu_assert.h"
+#include "../gpu_cache.h"
+#include "../gpu_math.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Output rows per strip, the strip plus the kernel rows stay in the cache */
+#define BLUR_STRIP_HEIGHT 16
+
+/* Fixed point weights, the intermediate rows keep 8 fraction bits */
+#define WEIGHT_SHIFT 12
+#define MID_SHIFT 8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    int pixel_size;
+    int width;
+    int height;
+    int row_len;
+} blur_layout_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool blur_layout_init(blur_layout_t* layout, const vg_lite_buffer_t* dst, const vg_lite_buffer_t* src);
+static int blur_pixel_size(vg_lite_buffer_format_t format);
+static void blur_quantize(int32_t* taps, const float* weights, int radius);
+static void blur_pad_row(const blur_layout_t* layout, const uint8_t* src, int radius, uint8_t* pad);
+static void blur_row_taps(const blur_layout_t* layout, const uint8_t* pad, const int32_t* taps, int tap_count, int32_t* acc);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define SRC_ROW(buffer, y) ((const uint8_t*)(buffer)->memory + (size_t)(y) * (buffer)->stride)
+#define DST_ROW(buffer, y) ((uint8_t*)(buffer)->memory + (size_t)(y) * (buffer)->stride)
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool vg_lite_test_blur_3x3(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src, float w0, float w1, float w2)
+{
+    /* Separable as the outer product of (w1 / c, c, w1 / c) with c = sqrt(w0) */
+    if (w0 > 0 && fabsf(w0 * w2 - w1 * w1) <= 1e-6f * w0) {
+        float center = sqrtf(w0);
+        const float weights[2] = { center, w1 / center };
+        return vg_lite_test_blur_separable(dst, src, weights, 1);
+    }
+
+    blur_layout_t layout;
+    if (!blur_layout_init(&layout, dst, src)) {
+        return false;
+    }
+
+    /* Taps indexed by (dy + 1) * 3 + dx + 1, the weight depends on |dx| + |dy| */
+    const float kernel_weights[3] = { w0, w1, w2 };
+    int32_t taps[9];
+    for (int i = 0; i < 9; i++) {
+        int dx = i % 3 - 1;
+        int dy = i / 3 - 1;
+        taps[i] = (int32_t)lroundf(kernel_weights[MATH_ABS(dx) + MATH_ABS(dy)] * (1 << WEIGHT_SHIFT));
+    }
+
+    uint8_t* pad = malloc((size_t)(layout.width + 2) * layout.pixel_size);
+    int32_t* acc = malloc(layout.row_len * sizeof(int32_t));
+    GPU_ASSERT_NULL(pad);
+    GPU_ASSERT_NULL(acc);
+
+    for (int y = 0; y < layout.height; y++) {
+        memset(acc, 0, layout.row_len * sizeof(int32_t));
+
+        for (int dy = -1; dy <= 1; dy++) {
+            int sy = MATH_MIN(MATH_MAX(y + dy, 0), layout.height - 1);
+            blur_pad_row(&layout, SRC_ROW(src, sy), 1, pad);
+            blur_row_taps(&layout, pad, &taps[(dy + 1) * 3], 3, acc);
+        }
+
+        uint8_t* out = DST_ROW(dst, y);
+        for (int i = 0; i < layout.row_len; i++) {
+            int32_t value = (acc[i] + (1 << (WEIGHT_SHIFT - 1))) >> WEIGHT_SHIFT;
+            out[i] = (uint8_t)MATH_MIN(MATH_MAX(value, 0), 0xFF);
+        }
+    }
+
+    free(acc);
+    free(pad);
+
+    gpu_cache_flush(dst->memory, dst->stride * dst->height);
+    return true;
+}
+
+bool vg_lite_test_blur_separable(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src, const float* weights, int radius)
+{
+    GPU_ASSERT_NULL(weights);
+
+    if (radius < 0 || radius > VG_LITE_TEST_BLUR_RADIUS_MAX) {
+        GPU_LOG_WARN("Unsupported blur radius: %d", radius);
+        return false;
+    }
+
+    blur_layout_t layout;
+    if (!blur_layout_init(&layout, dst, src)) {
+        return false;
+    }
+
+    const int tap_count = radius * 2 + 1;
+    int32_t taps[VG_LITE_TEST_BLUR_RADIUS_MAX * 2 + 1];
+    blur_quantize(taps, weights, radius);
+
+    /* The horizontal results of a strip and its radius rows above and below */
+    const int mid_rows = BLUR_STRIP_HEIGHT + radius * 2;
+    uint8_t* pad = malloc((size_t)(layout.width + radius * 2) * layout.pixel_size);
+    int32_t* acc = malloc(layout.row_len * sizeof(int32_t));
+    uint16_t* mid = malloc((size_t)mid_rows * layout.row_len * sizeof(uint16_t));
+    GPU_ASSERT_NULL(pad);
+    GPU_ASSERT_NULL(acc);
+    GPU_ASSERT_NULL(mid);
+
+    for (int y0 = 0; y0 < layout.height; y0 += BLUR_STRIP_HEIGHT) {
+        const int y1 = MATH_MIN(y0 + BLUR_STRIP_HEIGHT, layout.height);
+
+        /* Horizontal pass, the rows outside of the buffer repeat the border rows */
+        for (int y = y0 - radius; y < y1 + radius; y++) {
+            int sy = MATH_MIN(MATH_MAX(y, 0), layout.height - 1);
+            blur_pad_row(&layout, SRC_ROW(src, sy), radius, pad);
+
+            memset(acc, 0, layout.row_len * sizeof(int32_t));
+            blur_row_taps(&layout, pad, taps, tap_count, acc);
+
+            uint16_t* mid_row = mid + (size_t)(y - y0 + radius) * layout.row_len;
+            for (int i = 0; i < layout.row_len; i++) {
+                int32_t value = (acc[i] + (1 << (WEIGHT_SHIFT - MID_SHIFT - 1))) >> (WEIGHT_SHIFT - MID_SHIFT);
+                mid_row[i] = (uint16_t)MATH_MIN(MATH_MAX(value, 0), 0xFFFF);
+            }
+        }
+
+        /* Vertical pass, one tap over a whole row at a time */
+        for (int y = y0; y < y1; y++) {
+            memset(acc, 0, layout.row_len * sizeof(int32_t));
+
+            for (int k = 0; k < tap_count; k++) {
+                const uint16_t* mid_row = mid + (size_t)(y - y0 + k) * layout.row_len;
+                const int32_t tap = taps[k];
+                for (int i = 0; i < layout.row_len; i++) {
+                    acc[i] += tap * mid_row[i];
+                }
+            }
+
+            uint8_t* out = DST_ROW(dst, y);
+            for (int i = 0; i < layout.row_len; i++) {
+                int32_t value = (acc[i] + (1 << (WEIGHT_SHIFT + MID_SHIFT - 1))) >> (WEIGHT_SHIFT + MID_SHIFT);
+                out[i] = (uint8_t)MATH_MIN(MATH_MAX(value, 0), 0xFF);
+            }
+        }
+    }
+
+    free(mid);
+    free(acc);
+    free(pad);
+
+    gpu_cache_flush(dst->memory, dst->stride * dst->height);
+    return true;
+}
+
+void vg_lite_test_blur_gaussian_weights(float* weights, int radius, float sigma)
+{
+    GPU_ASSERT_NULL(weights);
+    GPU_ASSERT(radius >= 0 && radius <= VG_LITE_TEST_BLUR_RADIUS_MAX);
+
+    if (sigma <= 0) {
+        sigma = MATH_MAX(radius / 2.0f, 0.5f);
+    }
+
+    float sum = 0;
+    for (int i = 0; i <= radius; i++) {
+        weights[i] = expf(-(float)(i * i) / (2 * sigma * sigma));
+        sum += i == 0 ? weights[i] : weights[i] * 2;
+    }
+
+    for (int i = 0; i <= radius; i++) {
+        weights[i] /= sum;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool blur_layout_init(blur_layout_t* layout, const vg_lite_buffer_t* dst, const vg_lite_buffer_t* src)
+{
+    GPU_ASSERT_NULL(dst);
+    GPU_ASSERT_NULL(src);
+    GPU_ASSERT_NULL(dst->memory);
+    GPU_ASSERT_NULL(src->memory);
+
+    /* The strips read rows that are already written when working in place */
+    GPU_ASSERT(dst->memory != src->memory);
+
+    if (dst->width != src->width || dst->height != src->height || dst->format != src->format) {
+        GPU_LOG_WARN("Blur source and destination do not match");
+        return false;
+    }
+
+    layout->pixel_size = blur_pixel_size(src->format);
+    if (!layout->pixel_size || src->tiled != VG_LITE_LINEAR || dst->tiled != VG_LITE_LINEAR) {
+        GPU_LOG_WARN("Unsupported blur format: %s", vg_lite_test_buffer_format_string(src->format));
+        return false;
+    }
+
+    layout->width = src->width;
+    layout->height = src->height;
+    layout->row_len = layout->width * layout->pixel_size;
+
+    gpu_cache_invalidate(src->memory, src->stride * src->height);
+    return true;
+}
+
+static int blur_pixel_size(vg_lite_buffer_format_t format)
+{
+    switch (format) {
+    case VG_LITE_BGRA8888:
+    case VG_LITE_RGBA8888:
+    case VG_LITE_ARGB8888:
+    case VG_LITE_ABGR8888:
+    case VG_LITE_BGRX8888:
+    case VG_LITE_RGBX8888:
+    case VG_LITE_XRGB8888:
+    case VG_LITE_XBGR8888:
+        return 4;
+    case VG_LITE_BGR888:
+    case VG_LITE_RGB888:
+        return 3;
+    case VG_LITE_A8:
+    case VG_LITE_L8:
+        return 1;
+    default:
+        break;
+    }
+
+    return 0;
+}
+
+static void blur_quantize(int32_t* taps, const float* weights, int radius)
+{
+    float sum = 0;
+    int32_t side_sum = 0;
+    for (int k = -radius; k <= radius; k++) {
+        taps[k + radius] = (int32_t)lroundf(weights[MATH_ABS(k)] * (1 << WEIGHT_SHIFT));
+        sum += weights[MATH_ABS(k)];
+        side_sum += k ? taps[k + radius] : 0;
+    }
+
+    /* The center takes the rounding error, flat areas keep their value */
+    taps[radius] = (int32_t)lroundf(sum * (1 << WEIGHT_SHIFT)) - side_sum;
+}
+
+static void blur_pad_row(const blur_layout_t* layout, const uint8_t* src, int radius, uint8_t* pad)
+{
+    const int size = layout->pixel_size;
+    const uint8_t* last = src + (layout->width - 1) * size;
+
+    for (int i = 0; i < radius; i++) {
+        memcpy(pad + i * size, src, size);
+        memcpy(pad + (layout->width + radius + i) * size, last, size);
+    }
+
+    memcpy(pad + radius * size, src, layout->row_len);
+}
+
+static void blur_row_taps(const blur_layout_t* layout, const uint8_t* pad, const int32_t* taps, int tap_count, int32_t* acc)
+{
+    /* Tap k of the output byte i reads the padded byte i + k * pixel_size */
+    for (int k = 0; k < tap_count; k++) {
+        const uint8_t* src = pad + k * layout->pixel_size;
+        const int32_t tap = taps[k];
+        for (int i = 0; i < layout->row_len; i++) {
+            acc[i] += tap * src[i];
+        }
+    }
+}
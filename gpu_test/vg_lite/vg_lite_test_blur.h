@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VG_LITE_TEST_BLUR_H
+#define VG_LITE_TEST_BLUR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_utils.h"
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define VG_LITE_TEST_BLUR_RADIUS_MAX 32
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Blur with the 3x3 kernel of vg_lite_gaussian_filter, as a blit with VG_LITE_FILTER_GAUSSIAN does.
+ * @param dst The destination buffer, same size and format as the source.
+ * @param src The source buffer, the border texels are repeated.
+ * @param w0 The weight of the center texel.
+ * @param w1 The weight of the 4 edge texels.
+ * @param w2 The weight of the 4 corner texels.
+ * @return True on success, false if the buffers are not supported.
+ * @note A kernel with w0 * w2 == w1 * w1 is separable and runs as two 3-tap passes.
+ */
+bool vg_lite_test_blur_3x3(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src, float w0, float w1, float w2);
+
+/**
+ * @brief Blur with a symmetric separable kernel, horizontal then vertical.
+ * @param dst The destination buffer, same size and format as the source.
+ * @param src The source buffer, the border texels are repeated.
+ * @param weights radius + 1 weights, weights[0] is the center tap, used as is for both directions.
+ * @param radius The kernel radius, 0..VG_LITE_TEST_BLUR_RADIUS_MAX.
+ * @return True on success, false if the buffers are not supported.
+ * @note Every byte is filtered as one channel, so only the 8-bit per channel formats, A8 and L8
+ *       are supported, in linear layout. Premultiplied sources give premultiplied results.
+ *       The rows are processed in strips that keep the intermediate rows in the cache.
+ */
+bool vg_lite_test_blur_separable(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src, const float* weights, int radius);
+
+/**
+ * @brief Compute normalized gaussian weights.
+ * @param weights Filled with radius + 1 weights, weights[0] is the center tap.
+ * @param radius The kernel radius, 0..VG_LITE_TEST_BLUR_RADIUS_MAX.
+ * @param sigma The standard deviation in pixels, 0 uses radius / 2.
+ */
+void vg_lite_test_blur_gaussian_weights(float* weights, int radius, float sigma);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*VG_LITE_TEST_BLUR_H*/
@@ -20,16 +20,21 @@
 
 #include "vg_lite_test_context.h"
 #include "../gpu_assert.h"
+#include "../gpu_baseline.h"
 #include "../gpu_buffer.h"
 #include "../gpu_cache.h"
 #include "../gpu_context.h"
+#include "../gpu_fb.h"
 #include "../gpu_recorder.h"
 #include "../gpu_screenshot.h"
 #include "../gpu_tick.h"
 #include "../gpu_utils.h"
+#include "vg_lite_test_convert.h"
+#include "vg_lite_test_flatten.h"
 #include "vg_lite_test_path.h"
 #include "vg_lite_test_utils.h"
 #include <inttypes.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -48,6 +53,7 @@ struct vg_lite_test_context_s {
     struct gpu_test_context_s* gpu_ctx;
     struct gpu_buffer_s* target_gpu_buffer;
     struct gpu_buffer_s* src_gpu_buffer;
+    size_t target_mem_size;
     vg_lite_buffer_t target_buffer;
     vg_lite_buffer_t src_buffer;
     struct vg_lite_test_path_s* path;
@@ -55,9 +61,30 @@ struct vg_lite_test_context_s {
     uint32_t setup_tick;
     uint32_t draw_tick;
     uint32_t finish_tick;
+    bool skipped;
+    bool failed;
+    enum gpu_baseline_result_e perf_result;
+    const struct vg_lite_test_item_s* pending_item;
+    vg_lite_error_t pending_error;
+    bool present_en;
+    uint32_t frame_start_tick;
+    uint32_t frame_count;
+    uint32_t frame_tick_sum;
+    uint32_t present_tick_sum;
+    uint32_t missed_vsync_count;
     char vg_error_remark_text[64];
     char screenshot_remark_text[192];
+    char perf_remark_text[96];
+    char case_remark_text[128];
+    vg_lite_test_flatten_stats_t flatten_stats;
+    uint32_t flatten_tick;
     void* user_data;
+    bool cpu_ref_en;
+    bool ref_done;
+    vg_lite_error_t ref_error;
+    uint32_t ref_tick;
+    struct gpu_buffer_s* ref_gpu_buffer;
+    vg_lite_buffer_t ref_buffer;
 };
 
 /**********************
@@ -65,13 +92,32 @@ struct vg_lite_test_context_s {
  **********************/
 
 static void vg_lite_test_context_cleanup(struct vg_lite_test_context_s* ctx);
+static void vg_lite_test_context_reset_scissor(struct vg_lite_test_context_s* ctx);
 static void vg_lite_test_context_record(
     struct vg_lite_test_context_s* ctx,
     const struct vg_lite_test_item_s* item,
     vg_lite_error_t error,
     const char* result_str);
+static void vg_lite_test_context_csv_escape(char* str);
 static void vg_lite_test_context_error_to_remark(struct vg_lite_test_context_s* ctx, vg_lite_error_t error);
 static bool vg_lite_test_context_check_screenshot(struct vg_lite_test_context_s* ctx, const char* name);
+static void vg_lite_test_context_update_matrix(struct vg_lite_test_context_s* ctx);
+static void vg_lite_test_context_begin_frame(struct vg_lite_test_context_s* ctx);
+static void vg_lite_test_context_present(struct vg_lite_test_context_s* ctx);
+static vg_lite_error_t vg_lite_test_context_run_once(struct vg_lite_test_context_s* ctx, const struct vg_lite_test_item_s* item);
+static bool vg_lite_test_context_finish_item(
+    struct vg_lite_test_context_s* ctx,
+    const struct vg_lite_test_item_s* item,
+    vg_lite_error_t error,
+    struct vg_lite_test_checksum_s* checksum);
+static bool vg_lite_test_context_check_checksum(struct vg_lite_test_context_s* ctx, struct vg_lite_test_checksum_s* checksum);
+static bool vg_lite_test_context_check_perf(struct vg_lite_test_context_s* ctx, const struct vg_lite_test_item_s* item);
+#ifdef GPU_TEST_VG_LITE_CPU_REF_ENABLE
+static void vg_lite_test_context_run_ref(struct vg_lite_test_context_s* ctx, const struct vg_lite_test_item_s* item);
+#endif
+static void vg_lite_test_context_ref_to_string(struct vg_lite_test_context_s* ctx, vg_lite_error_t error, char* str, size_t size);
+static uint32_t vg_lite_test_context_median_tick(uint32_t* ticks, int count);
+static size_t vg_lite_test_context_calc_target_mem_size(uint32_t width, uint32_t height, vg_lite_buffer_format_t format);
 
 /**********************
  *  STATIC VARIABLES
@@ -94,37 +140,57 @@ struct vg_lite_test_context_s* vg_lite_test_context_create(struct gpu_test_conte
     memset(ctx, 0, sizeof(struct vg_lite_test_context_s));
     ctx->gpu_ctx = gpu_ctx;
 
+    /* Frames are flipped on the framebuffer that provides the target */
+    ctx->present_en = gpu_ctx->param.present_en && gpu_ctx->fb;
+
     if (gpu_ctx->target_buffer.data) {
         GPU_LOG_INFO("Using external target buffer");
         vg_lite_test_gpu_buffer_to_vg_buffer(&ctx->target_buffer, &gpu_ctx->target_buffer);
     } else {
+        /* Allocate for the largest target layout, the others reuse the same memory */
+        const struct gpu_test_param_s* param = &gpu_ctx->param;
+        const struct gpu_test_size_s* max_size = &param->target_sizes[0];
+        vg_lite_buffer_format_t max_format = vg_lite_test_gpu_format_to_vg_format(param->target_formats[0]);
+        size_t max_mem_size = 0;
+
+        for (int i = 0; i < param->target_size_count; i++) {
+            for (int j = 0; j < param->target_format_count; j++) {
+                const struct gpu_test_size_s* size = &param->target_sizes[i];
+                vg_lite_buffer_format_t format = vg_lite_test_gpu_format_to_vg_format(param->target_formats[j]);
+                size_t mem_size = vg_lite_test_context_calc_target_mem_size(size->width, size->height, format);
+                if (mem_size > max_mem_size) {
+                    max_size = size;
+                    max_format = format;
+                    max_mem_size = mem_size;
+                }
+            }
+        }
+
         ctx->target_gpu_buffer = vg_lite_test_buffer_alloc(
             &ctx->target_buffer,
-            ctx->gpu_ctx->param.target_width,
-            ctx->gpu_ctx->param.target_height,
-            VG_LITE_BGRA8888,
+            max_size->width,
+            max_size->height,
+            max_format,
             VG_LITE_TEST_STRIDE_AUTO);
+        ctx->target_mem_size = (size_t)ctx->target_buffer.stride * ctx->target_buffer.height;
+
+        vg_lite_test_context_set_target(
+            ctx,
+            param->target_sizes[0].width,
+            param->target_sizes[0].height,
+            vg_lite_test_gpu_format_to_vg_format(param->target_formats[0]));
     }
 
-    /* Scale the output image to the design resolution */
-    vg_lite_identity(&ctx->matrix);
-    vg_lite_scale(
-        ctx->target_buffer.width / (float)GPU_TEST_DESIGN_WIDTH,
-        ctx->target_buffer.height / (float)GPU_TEST_DESIGN_HEIGHT,
-        &ctx->matrix);
+    vg_lite_test_context_update_matrix(ctx);
+    vg_lite_test_context_reset_scissor(ctx);
 
-    if (ctx->gpu_ctx->recorder) {
-        gpu_recorder_write_string(ctx->gpu_ctx->recorder,
-            "Testcase,"
-            "Instructions,"
-            "Target Format,Source Format,"
-            "Target Address,Source Address,"
-            "Target Area,Source Area,"
-            "Setup Time(ms),Draw Time(ms),Finish Time(ms),"
-            "VG-Lite Result,VG-Lite Remark,"
-            "Screenshot Result,"
-            "Result"
-            "\n");
+    if (gpu_ctx->param.cpu_ref_en) {
+#ifdef GPU_TEST_VG_LITE_CPU_REF_ENABLE
+        vg_lite_cpu_init();
+        ctx->cpu_ref_en = true;
+#else
+        GPU_LOG_WARN("CPU reference replay not built in, see CONFIG_GPU_TEST_VG_LITE_CPU_REF");
+#endif
     }
 
     char path[256];
@@ -152,17 +218,61 @@ void vg_lite_test_context_destroy(struct vg_lite_test_context_s* ctx)
         ctx->path = NULL;
     }
 
+    if (ctx->ref_gpu_buffer) {
+        gpu_buffer_free(ctx->ref_gpu_buffer);
+        ctx->ref_gpu_buffer = NULL;
+    }
+
+#ifdef GPU_TEST_VG_LITE_CPU_REF_ENABLE
+    if (ctx->cpu_ref_en) {
+        vg_lite_cpu_deinit();
+    }
+#endif
+
     memset(ctx, 0, sizeof(struct vg_lite_test_context_s));
     free(ctx);
 }
 
+void vg_lite_test_context_write_header(struct vg_lite_test_context_s* ctx)
+{
+    GPU_ASSERT_NULL(ctx);
+
+    if (ctx->gpu_ctx->recorder) {
+        gpu_recorder_write_string(ctx->gpu_ctx->recorder,
+            "Testcase,"
+            "Instructions,"
+            "Target Format,Source Format,"
+            "Target Address,Source Address,"
+            "Target Area,Source Area,"
+            "Setup Time(ms),Draw Time(ms),Finish Time(ms),"
+            "Target Bytes Per Pixel,Target Bandwidth(MB/s),"
+            "Frame Time(ms),Missed Vsync,Present Latency(ms),"
+            "Path Segments,Segments Per Path,Flatten Error(px),"
+            "CPU Result,CPU Time(ms),CPU Speedup,CPU Diff Pixels,CPU Max Diff,"
+            "VG-Lite Result,VG-Lite Remark,"
+            "Screenshot Result,"
+            "Result,"
+            "Perf Result,Perf Remark,"
+            "Case Remark"
+            "\n");
+    }
+}
+
 bool vg_lite_test_context_run_item(struct vg_lite_test_context_s* ctx, const struct vg_lite_test_item_s* item)
 {
+    vg_lite_test_context_begin_frame(ctx);
     vg_lite_test_context_cleanup(ctx);
 
+    ctx->frame_count = 0;
+    ctx->frame_tick_sum = 0;
+    ctx->present_tick_sum = 0;
+    ctx->missed_vsync_count = 0;
+    ctx->ref_done = false;
+
     if (item->feature != gcFEATURE_BIT_VG_NONE && !vg_lite_query_feature(item->feature)) {
         snprintf(ctx->vg_error_remark_text, sizeof(ctx->vg_error_remark_text), "Feature '%s' not supported", vg_lite_test_feature_string(item->feature));
         GPU_LOG_WARN("Skipping test case: %s %s", item->name, ctx->vg_error_remark_text);
+        ctx->skipped = true;
         if (ctx->gpu_ctx->param.mode == GPU_TEST_MODE_DEFAULT) {
             vg_lite_test_context_record(ctx, item, VG_LITE_NOT_SUPPORT, "SKIP");
         }
@@ -171,6 +281,76 @@ bool vg_lite_test_context_run_item(struct vg_lite_test_context_s* ctx, const str
 
     GPU_LOG_INFO("Running test case: %s", item->name);
 
+#ifdef GPU_TEST_VG_LITE_CPU_REF_ENABLE
+    if (ctx->cpu_ref_en) {
+        vg_lite_test_context_run_ref(ctx, item);
+    }
+#endif
+
+    const int repeat_count = ctx->gpu_ctx->param.mode == GPU_TEST_MODE_DEFAULT ? ctx->gpu_ctx->param.repeat_count : 1;
+    vg_lite_error_t error = VG_LITE_SUCCESS;
+
+    if (repeat_count <= 1) {
+        error = vg_lite_test_context_run_once(ctx, item);
+    } else {
+        uint32_t* ticks = malloc(3 * repeat_count * sizeof(uint32_t));
+        GPU_ASSERT_NULL(ticks);
+        uint32_t* setup_ticks = ticks;
+        uint32_t* draw_ticks = ticks + repeat_count;
+        uint32_t* finish_ticks = ticks + 2 * repeat_count;
+
+        int count = 0;
+        while (count < repeat_count) {
+            /* Restart from a clean state, the last run is kept for the screenshot */
+            if (count > 0) {
+                vg_lite_test_context_begin_frame(ctx);
+                vg_lite_test_context_cleanup(ctx);
+            }
+
+            error = vg_lite_test_context_run_once(ctx, item);
+            if (error != VG_LITE_SUCCESS) {
+                break;
+            }
+
+            setup_ticks[count] = ctx->setup_tick;
+            draw_ticks[count] = ctx->draw_tick;
+            finish_ticks[count] = ctx->finish_tick;
+            count++;
+        }
+
+        if (error == VG_LITE_SUCCESS) {
+            ctx->setup_tick = vg_lite_test_context_median_tick(setup_ticks, count);
+            ctx->draw_tick = vg_lite_test_context_median_tick(draw_ticks, count);
+            ctx->finish_tick = vg_lite_test_context_median_tick(finish_ticks, count);
+        }
+
+        free(ticks);
+    }
+
+    return vg_lite_test_context_finish_item(ctx, item, error, NULL);
+}
+
+bool vg_lite_test_context_submit_item(struct vg_lite_test_context_s* ctx, const struct vg_lite_test_item_s* item)
+{
+    GPU_ASSERT_NULL(ctx);
+    GPU_ASSERT_NULL(item);
+    GPU_ASSERT(ctx->pending_item == NULL);
+
+    vg_lite_test_context_cleanup(ctx);
+    ctx->pending_item = item;
+    ctx->pending_error = VG_LITE_SUCCESS;
+    ctx->ref_done = false;
+
+    if (item->feature != gcFEATURE_BIT_VG_NONE && !vg_lite_query_feature(item->feature)) {
+        snprintf(ctx->vg_error_remark_text, sizeof(ctx->vg_error_remark_text), "Feature '%s' not supported", vg_lite_test_feature_string(item->feature));
+        GPU_LOG_WARN("Skipping test case: %s %s", item->name, ctx->vg_error_remark_text);
+        ctx->skipped = true;
+        ctx->pending_error = VG_LITE_NOT_SUPPORT;
+        return false;
+    }
+
+    GPU_LOG_INFO("Submitting test case: %s", item->name);
+
     vg_lite_error_t error = VG_LITE_SUCCESS;
     {
         uint32_t start_tick = gpu_tick_get();
@@ -181,35 +361,107 @@ bool vg_lite_test_context_run_item(struct vg_lite_test_context_s* ctx, const str
     if (error == VG_LITE_SUCCESS) {
         uint32_t start_tick = gpu_tick_get();
         error = item->on_draw(ctx);
-        ctx->draw_tick = gpu_tick_elaps(start_tick);
+        ctx->draw_tick = gpu_tick_elaps(start_tick) - ctx->flatten_tick;
     }
 
+    /* Kick off the commands without waiting, the finish time is the submit time */
     if (error == VG_LITE_SUCCESS) {
         uint32_t start_tick = gpu_tick_get();
-        error = vg_lite_finish();
+        error = vg_lite_flush();
         ctx->finish_tick = gpu_tick_elaps(start_tick);
     }
 
+    /* The scissor is global command state, the next queued case must not draw with the one of this case */
+    vg_lite_test_context_reset_scissor(ctx);
+
+    ctx->pending_error = error;
+    return error == VG_LITE_SUCCESS;
+}
+
+bool vg_lite_test_context_complete_item(struct vg_lite_test_context_s* ctx, struct vg_lite_test_checksum_s* checksum)
+{
+    GPU_ASSERT_NULL(ctx);
+    GPU_ASSERT_NULL(ctx->pending_item);
+
+    const struct vg_lite_test_item_s* item = ctx->pending_item;
+    ctx->pending_item = NULL;
+
+    if (ctx->skipped) {
+        if (ctx->gpu_ctx->param.mode == GPU_TEST_MODE_DEFAULT) {
+            vg_lite_test_context_record(ctx, item, VG_LITE_NOT_SUPPORT, "SKIP");
+        }
+        return true;
+    }
+
+    /* The resources of the item may only be released once the GPU is done with them */
     if (item->on_teardown) {
         item->on_teardown(ctx);
     }
 
-    if (error == VG_LITE_SUCCESS) {
-        GPU_LOG_INFO("Test case '%s' render success", item->name);
-    } else {
-        GPU_LOG_ERROR("Test case '%s' render failed: %d (%s)", item->name, error, vg_lite_test_error_string(error));
-        vg_lite_test_context_error_to_remark(ctx, error);
+    return vg_lite_test_context_finish_item(ctx, item, ctx->pending_error, checksum);
+}
+
+void vg_lite_test_context_get_result(struct vg_lite_test_context_s* ctx, struct vg_lite_test_result_s* result)
+{
+    GPU_ASSERT_NULL(ctx);
+    GPU_ASSERT_NULL(result);
+    result->setup_tick = ctx->setup_tick;
+    result->draw_tick = ctx->draw_tick;
+    result->finish_tick = ctx->finish_tick;
+    result->skipped = ctx->skipped;
+}
+
+bool vg_lite_test_context_set_target(struct vg_lite_test_context_s* ctx, uint32_t width, uint32_t height, vg_lite_buffer_format_t format)
+{
+    GPU_ASSERT_NULL(ctx);
+    GPU_ASSERT(width > 0);
+    GPU_ASSERT(height > 0);
+
+    if (!ctx->target_gpu_buffer) {
+        GPU_LOG_WARN("External target buffer W%dxH%d %s can't be changed to W%dxH%d %s",
+            (int)ctx->target_buffer.width, (int)ctx->target_buffer.height,
+            vg_lite_test_buffer_format_string(ctx->target_buffer.format),
+            (int)width, (int)height,
+            vg_lite_test_buffer_format_string(format));
+        return false;
     }
 
-    bool screenshot_cmp_pass = vg_lite_test_context_check_screenshot(ctx, item->name);
+    if ((format == VG_LITE_BGR888 || format == VG_LITE_BGRA5658) && !vg_lite_query_feature(gcFEATURE_BIT_VG_24BIT)) {
+        GPU_LOG_WARN("Target format %s not supported: %s",
+            vg_lite_test_buffer_format_string(format),
+            vg_lite_test_feature_string(gcFEATURE_BIT_VG_24BIT));
+        return false;
+    }
 
-    bool passed = (error == VG_LITE_SUCCESS && screenshot_cmp_pass);
+    uint32_t stride = vg_lite_test_buffer_calc_stride(format, &width);
+    size_t mem_size = (size_t)stride * height;
 
-    if (ctx->gpu_ctx->param.mode == GPU_TEST_MODE_DEFAULT || !passed) {
-        vg_lite_test_context_record(ctx, item, error, passed ? "PASS" : "FAIL");
+    if (mem_size > ctx->target_mem_size) {
+        GPU_LOG_INFO("Target buffer %zu bytes too small for W%dxH%d %s, reallocating",
+            ctx->target_mem_size, (int)width, (int)height, vg_lite_test_buffer_format_string(format));
+        gpu_buffer_free(ctx->target_gpu_buffer);
+        ctx->target_gpu_buffer = vg_lite_test_buffer_alloc(&ctx->target_buffer, width, height, format, stride);
+        ctx->target_mem_size = mem_size;
+    } else {
+        /* Reuse the target memory, only the layout changes */
+        ctx->target_gpu_buffer->width = width;
+        ctx->target_gpu_buffer->height = height;
+        ctx->target_gpu_buffer->stride = stride;
+        ctx->target_gpu_buffer->format = vg_lite_test_vg_format_to_gpu_format(format);
+        ctx->target_buffer.width = width;
+        ctx->target_buffer.height = height;
+        ctx->target_buffer.stride = stride;
+        ctx->target_buffer.format = format;
     }
 
-    return passed;
+    GPU_LOG_INFO("Target buffer: W%dxH%d %s, stride %d",
+        (int)ctx->target_buffer.width, (int)ctx->target_buffer.height,
+        vg_lite_test_buffer_format_string(ctx->target_buffer.format),
+        (int)ctx->target_buffer.stride);
+
+    vg_lite_test_context_update_matrix(ctx);
+    vg_lite_test_context_reset_scissor(ctx);
+    return true;
 }
 
 vg_lite_buffer_t* vg_lite_test_context_get_target_buffer(struct vg_lite_test_context_s* ctx)
@@ -313,6 +565,86 @@ void* vg_lite_test_context_get_user_data(struct vg_lite_test_context_s* ctx)
     return ctx->user_data;
 }
 
+const char* vg_lite_test_context_get_output_dir(struct vg_lite_test_context_s* ctx)
+{
+    GPU_ASSERT_NULL(ctx);
+    return ctx->gpu_ctx->param.output_dir;
+}
+
+struct gpu_recorder_s* vg_lite_test_context_create_report(struct vg_lite_test_context_s* ctx, const char* name)
+{
+    GPU_ASSERT_NULL(ctx);
+    GPU_ASSERT_NULL(name);
+
+    const vg_lite_buffer_t* target = &ctx->target_buffer;
+    char report_name[64];
+    snprintf(report_name, sizeof(report_name), "vg_lite_%s_%dx%d_%s%s",
+        name,
+        (int)target->width, (int)target->height,
+        vg_lite_test_buffer_format_string(target->format),
+        vg_lite_test_context_is_cpu_replay(ctx) ? "_cpu" : "");
+
+    return gpu_recorder_create(ctx->gpu_ctx->param.output_dir, report_name);
+}
+
+void vg_lite_test_context_set_remark(struct vg_lite_test_context_s* ctx, const char* format, ...)
+{
+    GPU_ASSERT_NULL(ctx);
+    GPU_ASSERT_NULL(format);
+
+    va_list ap;
+    va_start(ap, format);
+    vsnprintf(ctx->case_remark_text, sizeof(ctx->case_remark_text), format, ap);
+    va_end(ap);
+
+    vg_lite_test_context_csv_escape(ctx->case_remark_text);
+
+    GPU_LOG_INFO("Remark: %s", ctx->case_remark_text);
+}
+
+uint8_t vg_lite_test_context_get_tolerance(struct vg_lite_test_context_s* ctx)
+{
+    GPU_ASSERT_NULL(ctx);
+    const int tolerance = ctx->gpu_ctx->param.color_tolerance;
+    return tolerance > 0xFF ? 0xFF : (uint8_t)tolerance;
+}
+
+void vg_lite_test_context_set_failed(struct vg_lite_test_context_s* ctx, const char* format, ...)
+{
+    GPU_ASSERT_NULL(ctx);
+    GPU_ASSERT_NULL(format);
+
+    char reason[128];
+    va_list ap;
+    va_start(ap, format);
+    vsnprintf(reason, sizeof(reason), format, ap);
+    va_end(ap);
+
+    GPU_LOG_ERROR("Check failed: %s", reason);
+    ctx->failed = true;
+}
+
+void vg_lite_test_context_add_path_stats(struct vg_lite_test_context_s* ctx, const vg_lite_path_t* path, const vg_lite_matrix_t* matrix)
+{
+    GPU_ASSERT_NULL(ctx);
+    GPU_ASSERT_NULL(path);
+
+    uint32_t start_tick = gpu_tick_get();
+    vg_lite_test_flatten_path(path, matrix, VG_LITE_TEST_FLATTEN_TOLERANCE, NULL, NULL, &ctx->flatten_stats);
+    ctx->flatten_tick += gpu_tick_elaps(start_tick);
+}
+
+bool vg_lite_test_context_is_cpu_replay(struct vg_lite_test_context_s* ctx)
+{
+    GPU_ASSERT_NULL(ctx);
+
+#ifdef GPU_TEST_VG_LITE_CPU_REF_ENABLE
+    return ctx->cpu_ref_en && vg_lite_cpu_is_replay();
+#else
+    return false;
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -331,9 +663,16 @@ static void vg_lite_test_context_cleanup(struct vg_lite_test_context_s* ctx)
 
     ctx->vg_error_remark_text[0] = '\0';
     ctx->screenshot_remark_text[0] = '\0';
+    ctx->perf_remark_text[0] = '\0';
+    ctx->case_remark_text[0] = '\0';
+    ctx->perf_result = GPU_BASELINE_RESULT_NONE;
     ctx->setup_tick = 0;
     ctx->draw_tick = 0;
     ctx->finish_tick = 0;
+    ctx->flatten_tick = 0;
+    vg_lite_test_flatten_stats_reset(&ctx->flatten_stats);
+    ctx->skipped = false;
+    ctx->failed = false;
     ctx->user_data = NULL;
 
     if (ctx->src_gpu_buffer) {
@@ -344,15 +683,20 @@ static void vg_lite_test_context_cleanup(struct vg_lite_test_context_s* ctx)
     if (ctx->path) {
         vg_lite_test_path_reset(ctx->path, VG_LITE_FP32);
     }
+}
+
+static void vg_lite_test_context_reset_scissor(struct vg_lite_test_context_s* ctx)
+{
+    if (!vg_lite_query_feature(gcFEATURE_BIT_VG_SCISSOR)) {
+        return;
+    }
 
-    if (vg_lite_query_feature(gcFEATURE_BIT_VG_SCISSOR)) {
 #if VGLITE_RELEASE_VERSION <= VGLITE_MAKE_VERSION(4, 0, 57)
-        VG_LITE_TEST_CHECK_ERROR(vg_lite_enable_scissor());
+    VG_LITE_TEST_CHECK_ERROR(vg_lite_enable_scissor());
 #endif
 
-        /* Reset the scissor to the full screen */
-        VG_LITE_TEST_CHECK_ERROR(vg_lite_set_scissor(0, 0, ctx->target_buffer.width, ctx->target_buffer.height));
-    }
+    /* Reset the scissor to the full screen */
+    VG_LITE_TEST_CHECK_ERROR(vg_lite_set_scissor(0, 0, ctx->target_buffer.width, ctx->target_buffer.height));
 }
 
 static void vg_lite_test_context_record(
@@ -368,7 +712,39 @@ static void vg_lite_test_context_record(
         return;
     }
 
-    char result[512];
+    /* Effective bandwidth: target bytes covered per unit of render time */
+    const float target_bpp = gpu_color_format_get_bpp(vg_lite_test_vg_format_to_gpu_format(ctx->target_buffer.format)) / 8.0f;
+    const uint32_t render_tick = ctx->draw_tick + ctx->finish_tick;
+    char bandwidth_str[32] = "-";
+    if (render_tick > 0) {
+        float target_bytes = ctx->target_buffer.width * ctx->target_buffer.height * target_bpp;
+        snprintf(bandwidth_str, sizeof(bandwidth_str), "%0.1f", target_bytes / render_tick);
+    }
+
+    char frame_str[64] = "-,-,-";
+    if (ctx->frame_count > 0) {
+        snprintf(frame_str, sizeof(frame_str), "%0.3f,%" PRIu32 ",%0.3f",
+            ctx->frame_tick_sum / 1000.0f / ctx->frame_count,
+            ctx->missed_vsync_count,
+            ctx->present_tick_sum / 1000.0f / ctx->frame_count);
+    }
+
+    char flatten_str[64] = "-,-,-";
+    if (ctx->flatten_stats.path_count > 0) {
+        snprintf(flatten_str, sizeof(flatten_str), "%" PRIu32 ",%0.1f,%0.3f",
+            ctx->flatten_stats.segment_count,
+            (float)ctx->flatten_stats.segment_count / ctx->flatten_stats.path_count,
+            ctx->flatten_stats.max_error);
+    }
+
+    char ref_str[96];
+    vg_lite_test_context_ref_to_string(ctx, error, ref_str, sizeof(ref_str));
+
+    char instructions[256];
+    snprintf(instructions, sizeof(instructions), "%s", item->instructions);
+    vg_lite_test_context_csv_escape(instructions);
+
+    char result[768];
     snprintf(result, sizeof(result),
         "%s," /* Testcase */
         "%s," /* Instructions */
@@ -378,12 +754,20 @@ static void vg_lite_test_context_record(
         "%0.3f," /* Setup Time(ms) */
         "%0.3f," /* Draw Time(ms) */
         "%0.3f," /* Finish Time(ms) */
+        "%0.1f," /* Target Bytes Per Pixel */
+        "%s," /* Target Bandwidth(MB/s) */
+        "%s," /* Frame Time(ms), Missed Vsync, Present Latency(ms) */
+        "%s," /* Path Segments, Segments Per Path, Flatten Error(px) */
+        "%s," /* CPU Result, CPU Time(ms), CPU Speedup, CPU Diff Pixels, CPU Max Diff */
         "%s," /* VG-Lite Result */
         "%s," /* VG-Lite Remark */
         "%s," /* Screenshot Result */
-        "%s\n", /* Result */
+        "%s," /* Result */
+        "%s," /* Perf Result */
+        "%s," /* Perf Remark */
+        "%s\n", /* Case Remark */
         item->name,
-        item->instructions,
+        instructions,
         vg_lite_test_buffer_format_string(ctx->target_buffer.format),
         vg_lite_test_buffer_format_string(ctx->src_buffer.format),
         ctx->target_buffer.memory,
@@ -395,14 +779,32 @@ static void vg_lite_test_context_record(
         ctx->setup_tick / 1000.0f,
         ctx->draw_tick / 1000.0f,
         ctx->finish_tick / 1000.0f,
+        target_bpp,
+        bandwidth_str,
+        frame_str,
+        flatten_str,
+        ref_str,
         vg_lite_test_error_string(error),
         ctx->vg_error_remark_text,
         ctx->screenshot_remark_text,
-        result_str);
+        result_str,
+        gpu_baseline_result_string(ctx->perf_result),
+        ctx->perf_remark_text,
+        ctx->case_remark_text);
 
     gpu_recorder_write_string(ctx->gpu_ctx->recorder, result);
 }
 
+static void vg_lite_test_context_csv_escape(char* str)
+{
+    /* Keep the report a valid CSV row */
+    for (char* p = str; *p; p++) {
+        if (*p == ',') {
+            *p = ';';
+        }
+    }
+}
+
 static void vg_lite_test_context_error_to_remark(struct vg_lite_test_context_s* ctx, vg_lite_error_t error)
 {
     if (error == VG_LITE_SUCCESS) {
@@ -425,48 +827,348 @@ static void vg_lite_test_context_error_to_remark(struct vg_lite_test_context_s*
     }
 }
 
-static bool vg_lite_test_context_check_screenshot(struct vg_lite_test_context_s* ctx, const char* name)
+static void vg_lite_test_context_begin_frame(struct vg_lite_test_context_s* ctx)
+{
+    if (!ctx->present_en) {
+        return;
+    }
+
+    /* Draw into the page that is not on screen */
+    struct gpu_buffer_s back_buffer;
+    gpu_fb_get_buffer(ctx->gpu_ctx->fb, &back_buffer);
+    vg_lite_test_gpu_buffer_to_vg_buffer(&ctx->target_buffer, &back_buffer);
+    ctx->frame_start_tick = gpu_tick_get();
+}
+
+static void vg_lite_test_context_present(struct vg_lite_test_context_s* ctx)
+{
+    if (!ctx->present_en) {
+        return;
+    }
+
+    uint32_t render_tick = gpu_tick_elaps(ctx->frame_start_tick);
+    uint32_t present_tick = 0;
+    if (!gpu_fb_present(ctx->gpu_ctx->fb, &present_tick)) {
+        return;
+    }
+
+    /* Each full vsync period spent rendering is a vsync the frame missed */
+    uint32_t vsync_period = gpu_fb_get_vsync_period(ctx->gpu_ctx->fb);
+    ctx->missed_vsync_count += render_tick / vsync_period;
+    ctx->frame_tick_sum += gpu_tick_elaps(ctx->frame_start_tick);
+    ctx->present_tick_sum += present_tick;
+    ctx->frame_count++;
+}
+
+static vg_lite_error_t vg_lite_test_context_run_once(struct vg_lite_test_context_s* ctx, const struct vg_lite_test_item_s* item)
+{
+    vg_lite_error_t error = VG_LITE_SUCCESS;
+    {
+        uint32_t start_tick = gpu_tick_get();
+        error = item->on_setup(ctx);
+        ctx->setup_tick = gpu_tick_elaps(start_tick);
+    }
+
+    if (error == VG_LITE_SUCCESS) {
+        uint32_t start_tick = gpu_tick_get();
+        error = item->on_draw(ctx);
+        ctx->draw_tick = gpu_tick_elaps(start_tick) - ctx->flatten_tick;
+    }
+
+    if (error == VG_LITE_SUCCESS) {
+        uint32_t start_tick = gpu_tick_get();
+        error = vg_lite_finish();
+        ctx->finish_tick = gpu_tick_elaps(start_tick);
+    }
+
+    if (item->on_teardown) {
+        item->on_teardown(ctx);
+    }
+
+    vg_lite_test_context_reset_scissor(ctx);
+
+    if (error == VG_LITE_SUCCESS) {
+        vg_lite_test_context_present(ctx);
+    }
+
+    return error;
+}
+
+static bool vg_lite_test_context_finish_item(
+    struct vg_lite_test_context_s* ctx,
+    const struct vg_lite_test_item_s* item,
+    vg_lite_error_t error,
+    struct vg_lite_test_checksum_s* checksum)
+{
+    if (error == VG_LITE_SUCCESS) {
+        GPU_LOG_INFO("Test case '%s' render success", item->name);
+    } else {
+        GPU_LOG_ERROR("Test case '%s' render failed: %d (%s)", item->name, error, vg_lite_test_error_string(error));
+        vg_lite_test_context_error_to_remark(ctx, error);
+    }
+
+    bool screenshot_cmp_pass = vg_lite_test_context_check_screenshot(ctx, item->name);
+
+    bool passed = (error == VG_LITE_SUCCESS && screenshot_cmp_pass && !ctx->failed);
+    if (passed && checksum) {
+        passed = vg_lite_test_context_check_checksum(ctx, checksum);
+    }
+
+    bool perf_passed = !passed || vg_lite_test_context_check_perf(ctx, item);
+
+    if (ctx->gpu_ctx->param.mode == GPU_TEST_MODE_DEFAULT || !passed) {
+        vg_lite_test_context_record(ctx, item, error, passed ? "PASS" : "FAIL");
+    }
+
+    return passed && perf_passed;
+}
+
+static bool vg_lite_test_context_check_checksum(struct vg_lite_test_context_s* ctx, struct vg_lite_test_checksum_s* checksum)
+{
+    uint32_t current = vg_lite_test_buffer_checksum(&ctx->target_buffer);
+
+    /* The first completed render of a case is the reference for the later ones */
+    if (!checksum->has_checksum) {
+        checksum->value = current;
+        checksum->has_checksum = true;
+        return true;
+    }
+
+    if (current != checksum->value) {
+        snprintf(ctx->screenshot_remark_text, sizeof(ctx->screenshot_remark_text),
+            "Checksum mismatch: 0x%08" PRIx32 " vs first render: 0x%08" PRIx32, current, checksum->value);
+        GPU_LOG_ERROR("%s", ctx->screenshot_remark_text);
+        return false;
+    }
+
+    return true;
+}
+
+static bool vg_lite_test_context_check_perf(struct vg_lite_test_context_s* ctx, const struct vg_lite_test_item_s* item)
+{
+    if (!ctx->gpu_ctx->baseline || ctx->skipped) {
+        return true;
+    }
+
+    /* Same key as the baseline rows: "<Testcase>,<Target Format>,<Target Area>" */
+    char key[96];
+    snprintf(key, sizeof(key), "%s,%s,%dx%d",
+        item->name,
+        vg_lite_test_buffer_format_string(ctx->target_buffer.format),
+        (int)ctx->target_buffer.width,
+        (int)ctx->target_buffer.height);
+
+    float values[GPU_BASELINE_FIELD_COUNT];
+    values[GPU_BASELINE_FIELD_SETUP] = ctx->setup_tick / 1000.0f;
+    values[GPU_BASELINE_FIELD_DRAW] = ctx->draw_tick / 1000.0f;
+    values[GPU_BASELINE_FIELD_FINISH] = ctx->finish_tick / 1000.0f;
+
+    ctx->perf_result = gpu_baseline_check(
+        ctx->gpu_ctx->baseline, key, values, ctx->perf_remark_text, sizeof(ctx->perf_remark_text));
+
+    return ctx->perf_result != GPU_BASELINE_RESULT_FAIL;
+}
+
+#ifdef GPU_TEST_VG_LITE_CPU_REF_ENABLE
+
+static void vg_lite_test_context_run_ref(struct vg_lite_test_context_s* ctx, const struct vg_lite_test_item_s* item)
+{
+    /* The scratch target follows the layout of the real one */
+    const vg_lite_buffer_t* target = &ctx->target_buffer;
+    if (!ctx->ref_gpu_buffer
+        || ctx->ref_buffer.width != target->width
+        || ctx->ref_buffer.height != target->height
+        || ctx->ref_buffer.format != target->format
+        || ctx->ref_buffer.stride != target->stride) {
+        if (ctx->ref_gpu_buffer) {
+            gpu_buffer_free(ctx->ref_gpu_buffer);
+        }
+
+        ctx->ref_gpu_buffer = vg_lite_test_buffer_alloc(
+            &ctx->ref_buffer, target->width, target->height, target->format, target->stride);
+    }
+
+    /* The case draws into whatever the context hands out as the target */
+    vg_lite_buffer_t gpu_target = ctx->target_buffer;
+    ctx->target_buffer = ctx->ref_buffer;
+    vg_lite_cpu_set_replay(true);
+    vg_lite_test_context_cleanup(ctx);
+
+    vg_lite_error_t error = item->on_setup(ctx);
+
+    if (error == VG_LITE_SUCCESS) {
+        uint32_t start_tick = gpu_tick_get();
+        error = item->on_draw(ctx);
+        if (error == VG_LITE_SUCCESS) {
+            error = vg_lite_finish();
+        }
+        ctx->ref_tick = gpu_tick_elaps(start_tick) - ctx->flatten_tick;
+    }
+
+    if (item->on_teardown) {
+        item->on_teardown(ctx);
+    }
+
+    /* Still in replay, this resets the scissor of the CPU backend */
+    vg_lite_test_context_reset_scissor(ctx);
+    vg_lite_cpu_set_replay(false);
+    ctx->target_buffer = gpu_target;
+    ctx->ref_error = error;
+    ctx->ref_done = true;
+
+    if (error != VG_LITE_SUCCESS) {
+        GPU_LOG_WARN("CPU replay of '%s' failed: %s", item->name, vg_lite_test_error_string(error));
+    }
+
+    /* Start the GPU run from the same state */
+    vg_lite_test_context_cleanup(ctx);
+}
+
+#endif /* GPU_TEST_VG_LITE_CPU_REF_ENABLE */
+
+static void vg_lite_test_context_ref_to_string(struct vg_lite_test_context_s* ctx, vg_lite_error_t error, char* str, size_t size)
+{
+    if (!ctx->ref_done) {
+        snprintf(str, size, "-,-,-,-,-");
+        return;
+    }
+
+    if (ctx->ref_error != VG_LITE_SUCCESS) {
+        snprintf(str, size, "%s,-,-,-,-", vg_lite_test_error_string(ctx->ref_error));
+        return;
+    }
+
+    /* Without a GPU result there is nothing to compare against */
+    const uint32_t render_tick = ctx->draw_tick + ctx->finish_tick;
+    if (error != VG_LITE_SUCCESS || render_tick == 0) {
+        snprintf(str, size, "%s,%0.3f,-,-,-", vg_lite_test_error_string(ctx->ref_error), ctx->ref_tick / 1000.0f);
+        return;
+    }
+
+    uint8_t max_diff = 0;
+    uint32_t diff_count = vg_lite_test_buffer_diff(
+        &ctx->target_buffer, &ctx->ref_buffer, ctx->gpu_ctx->param.color_tolerance, &max_diff);
+
+    snprintf(str, size, "%s,%0.3f,%0.2f,%" PRIu32 ",%d",
+        vg_lite_test_error_string(ctx->ref_error),
+        ctx->ref_tick / 1000.0f,
+        (float)ctx->ref_tick / render_tick,
+        diff_count,
+        max_diff);
+}
+
+static int vg_lite_test_context_tick_compare(const void* a, const void* b)
+{
+    uint32_t tick_a = *(const uint32_t*)a;
+    uint32_t tick_b = *(const uint32_t*)b;
+    return (tick_a > tick_b) - (tick_a < tick_b);
+}
+
+static uint32_t vg_lite_test_context_median_tick(uint32_t* ticks, int count)
+{
+    qsort(ticks, count, sizeof(uint32_t), vg_lite_test_context_tick_compare);
+
+    if (count % 2 == 0) {
+        return (ticks[count / 2 - 1] + ticks[count / 2]) / 2;
+    }
+
+    return ticks[count / 2];
+}
+
+static void vg_lite_test_context_update_matrix(struct vg_lite_test_context_s* ctx)
+{
+    /* Scale the output image to the design resolution */
+    vg_lite_identity(&ctx->matrix);
+    vg_lite_scale(
+        ctx->target_buffer.width / (float)GPU_TEST_DESIGN_WIDTH,
+        ctx->target_buffer.height / (float)GPU_TEST_DESIGN_HEIGHT,
+        &ctx->matrix);
+}
+
+static size_t vg_lite_test_context_calc_target_mem_size(uint32_t width, uint32_t height, vg_lite_buffer_format_t format)
+{
+    uint32_t stride = vg_lite_test_buffer_calc_stride(format, &width);
+    return (size_t)stride * height;
+}
+
+static bool vg_lite_test_context_check_screenshot(struct vg_lite_test_context_s* ctx, const char* case_name)
 {
     if (!ctx->gpu_ctx->param.screenshot_en) {
         return true;
     }
 
+    /* Reference images are namespaced by the target size and format when sweeping them */
+    char name[64];
+    int len = snprintf(name, sizeof(name), "%s", case_name);
+    if (ctx->gpu_ctx->param.target_size_count > 1 && len < (int)sizeof(name)) {
+        len += snprintf(name + len, sizeof(name) - len, "_%dx%d",
+            (int)ctx->target_buffer.width, (int)ctx->target_buffer.height);
+    }
+
+    if (ctx->gpu_ctx->param.target_format_count > 1 && len < (int)sizeof(name)) {
+        snprintf(name + len, sizeof(name) - len, "_%s",
+            vg_lite_test_buffer_format_string(ctx->target_buffer.format));
+    }
+
     bool retval = false;
     char path[128];
     snprintf(path, sizeof(path), "%s" REF_IMAGES_DIR "/%s.png", ctx->gpu_ctx->param.output_dir, name);
 
-    struct gpu_buffer_s target_buffer;
-    vg_lite_test_vg_buffer_to_gpu_buffer(&target_buffer, &ctx->target_buffer);
+    /* Make sure the buffer fully loaded to memory */
+    gpu_cache_invalidate(ctx->target_buffer.memory, ctx->target_buffer.stride * ctx->target_buffer.height);
+
+    /* Every target format is saved and compared as BGRA8888 */
+    struct gpu_buffer_s* target_buffer = gpu_buffer_alloc(
+        ctx->target_buffer.width,
+        ctx->target_buffer.height,
+        GPU_COLOR_FORMAT_BGRA8888,
+        ctx->target_buffer.width * sizeof(uint32_t),
+        64);
+
+    vg_lite_buffer_t converted_buffer;
+    vg_lite_test_gpu_buffer_to_vg_buffer(&converted_buffer, target_buffer);
+    if (!vg_lite_test_convert_buffer(&converted_buffer, &ctx->target_buffer, NULL)) {
+        snprintf(ctx->screenshot_remark_text, sizeof(ctx->screenshot_remark_text),
+            "Unsupported target format: %s", vg_lite_test_buffer_format_string(ctx->target_buffer.format));
+        gpu_buffer_free(target_buffer);
+        return false;
+    }
 
     struct gpu_buffer_s* loaded_buffer = gpu_screenshot_load(path);
     if (!loaded_buffer) {
-        int ret = gpu_screenshot_save(path, &target_buffer);
+        int ret = gpu_screenshot_save(path, target_buffer);
         snprintf(ctx->screenshot_remark_text, sizeof(ctx->screenshot_remark_text),
             "Create: %s - %s", path, ret == 0 ? "SUCCESS" : "FAILED");
+        gpu_buffer_free(target_buffer);
         return true;
     }
 
-    if (target_buffer.width != loaded_buffer->width || target_buffer.height != loaded_buffer->height) {
+    if (target_buffer->width != loaded_buffer->width || target_buffer->height != loaded_buffer->height) {
         snprintf(ctx->screenshot_remark_text, sizeof(ctx->screenshot_remark_text),
             "Size not matched: %s target: W%dxH%d vs loaded: W%dxH%d",
             path,
-            (int)target_buffer.width, (int)target_buffer.height,
+            (int)target_buffer->width, (int)target_buffer->height,
             (int)loaded_buffer->width, (int)loaded_buffer->height);
 
         GPU_LOG_ERROR("%s", ctx->screenshot_remark_text);
         goto failed;
     }
 
-    /* Make sure the buffer fully loaded to memory */
-    gpu_cache_invalidate(target_buffer.data, target_buffer.stride * target_buffer.height);
+    for (int y = 0; y < target_buffer->height; y++) {
+        const uint32_t* target_row = (const uint32_t*)((const uint8_t*)target_buffer->data + y * target_buffer->stride);
+        const uint32_t* loaded_row = (const uint32_t*)((const uint8_t*)loaded_buffer->data + y * loaded_buffer->stride);
+
+        /* Most rows match exactly */
+        if (memcmp(target_row, loaded_row, target_buffer->width * sizeof(uint32_t)) == 0) {
+            continue;
+        }
 
-    for (int y = 0; y < target_buffer.height; y++) {
-        for (int x = 0; x < target_buffer.width; x++) {
+        for (int x = 0; x < target_buffer->width; x++) {
             gpu_color_bgra8888_t target_pixel;
-            target_pixel.full = gpu_buffer_get_pixel(&target_buffer, x, y);
+            target_pixel.full = target_row[x];
 
             gpu_color_bgra8888_t loaded_pixel;
-            loaded_pixel.full = gpu_buffer_get_pixel(loaded_buffer, x, y);
+            loaded_pixel.full = loaded_row[x];
 
             if (!gpu_color_bgra8888_compare(target_pixel, loaded_pixel, ctx->gpu_ctx->param.color_tolerance)) {
                 snprintf(ctx->screenshot_remark_text, sizeof(ctx->screenshot_remark_text),
@@ -479,7 +1181,7 @@ static bool vg_lite_test_context_check_screenshot(struct vg_lite_test_context_s*
                 GPU_LOG_ERROR("%s", ctx->screenshot_remark_text);
 
                 snprintf(path, sizeof(path), "%s" REF_IMAGES_DIR "/%s_err.png", ctx->gpu_ctx->param.output_dir, name);
-                gpu_screenshot_save(path, &target_buffer);
+                gpu_screenshot_save(path, target_buffer);
                 goto failed;
             }
         }
@@ -491,5 +1193,6 @@ static bool vg_lite_test_context_check_screenshot(struct vg_lite_test_context_s*
 
 failed:
     gpu_buffer_free(loaded_buffer);
+    gpu_buffer_free(target_buffer);
     return retval;
 }
@@ -48,12 +48,26 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+struct gpu_recorder_s;
 struct gpu_test_context_s;
 struct vg_lite_test_path_s;
 struct vg_lite_test_context_s;
 
 typedef vg_lite_error_t (*vg_lite_test_func_t)(struct vg_lite_test_context_s* ctx);
 
+struct vg_lite_test_result_s {
+    uint32_t setup_tick;
+    uint32_t draw_tick;
+    uint32_t finish_tick;
+    bool skipped;
+};
+
+/* The target checksum of a case, shared by its renders */
+struct vg_lite_test_checksum_s {
+    uint32_t value;
+    bool has_checksum;
+};
+
 struct vg_lite_test_item_s {
     const char* name;
     const char* instructions;
@@ -80,6 +94,12 @@ struct vg_lite_test_context_s* vg_lite_test_context_create(struct gpu_test_conte
  */
 void vg_lite_test_context_destroy(struct vg_lite_test_context_s* ctx);
 
+/**
+ * @brief Write the report header of the test case records
+ * @param ctx The test context to use
+ */
+void vg_lite_test_context_write_header(struct vg_lite_test_context_s* ctx);
+
 /**
  * @brief Run a test case item
  * @param ctx The test context to use
@@ -88,6 +108,41 @@ void vg_lite_test_context_destroy(struct vg_lite_test_context_s* ctx);
  */
 bool vg_lite_test_context_run_item(struct vg_lite_test_context_s* ctx, const struct vg_lite_test_item_s* item);
 
+/**
+ * @brief Submit a test case item to the GPU without waiting for it
+ * @param ctx The test context to use, owns the resources of the item until it is completed
+ * @param item The test case item to submit
+ * @return True if the test case was submitted, false if it was skipped or failed to submit
+ * @note vg_lite_test_context_complete_item must be called after the GPU is synchronized.
+ */
+bool vg_lite_test_context_submit_item(struct vg_lite_test_context_s* ctx, const struct vg_lite_test_item_s* item);
+
+/**
+ * @brief Complete a submitted test case item after the GPU is synchronized
+ * @param ctx The test context the item was submitted to
+ * @param checksum The target checksum of the case, filled in by the first render that has none. Can be NULL.
+ * @return True if the test case passed, false if it failed
+ */
+bool vg_lite_test_context_complete_item(struct vg_lite_test_context_s* ctx, struct vg_lite_test_checksum_s* checksum);
+
+/**
+ * @brief Get the result of the last test case run
+ * @param ctx The test context to use
+ * @param result The result to fill in
+ */
+void vg_lite_test_context_get_result(struct vg_lite_test_context_s* ctx, struct vg_lite_test_result_s* result);
+
+/**
+ * @brief Change the size and format of the target buffer
+ * @param ctx The test context to use
+ * @param width The new width of the target buffer
+ * @param height The new height of the target buffer
+ * @param format The new format of the target buffer
+ * @return True if the target buffer was changed, false if the target buffer is external or the format is not supported
+ * @note The target memory is only reallocated when the new layout does not fit into it.
+ */
+bool vg_lite_test_context_set_target(struct vg_lite_test_context_s* ctx, uint32_t width, uint32_t height, vg_lite_buffer_format_t format);
+
 /**
  * @brief Get the target buffer for the test case
  * @param ctx The test context to use
@@ -177,6 +232,60 @@ void vg_lite_test_context_set_user_data(struct vg_lite_test_context_s* ctx, void
  */
 void* vg_lite_test_context_get_user_data(struct vg_lite_test_context_s* ctx);
 
+/**
+ * @brief Get the output directory, which also holds the file based resources
+ * @param ctx The test context to use
+ * @return The output directory
+ */
+const char* vg_lite_test_context_get_output_dir(struct vg_lite_test_context_s* ctx);
+
+/**
+ * @brief Create a case report in the output directory, named after the target size and format
+ * @param ctx The test context to use
+ * @param name The report name, e.g. "svg" creates vg_lite_svg_480x480_BGRA8888
+ * @return The recorder of the report, delete it with gpu_recorder_delete. NULL on failure
+ * @note The CPU replay gets a "_cpu" suffix, so it does not overwrite the GPU report
+ */
+struct gpu_recorder_s* vg_lite_test_context_create_report(struct vg_lite_test_context_s* ctx, const char* name);
+
+/**
+ * @brief Set the case specific remark recorded in the report, e.g. CPU side measurements
+ * @param ctx The test context to use
+ * @param format The printf style format of the remark, commas are replaced to keep the CSV valid
+ */
+void vg_lite_test_context_set_remark(struct vg_lite_test_context_s* ctx, const char* format, ...);
+
+/**
+ * @brief Get the color tolerance of the output checks, see --tolerance
+ * @param ctx The test context to use
+ * @return The tolerated difference per color channel
+ */
+uint8_t vg_lite_test_context_get_tolerance(struct vg_lite_test_context_s* ctx);
+
+/**
+ * @brief Fail the test case on a check of its own output, e.g. against a CPU reference
+ * @param ctx The test context to use
+ * @param format The printf style format of the reason, which is logged
+ * @note Call it until the case is torn down, the render result itself is unchanged
+ */
+void vg_lite_test_context_set_failed(struct vg_lite_test_context_s* ctx, const char* format, ...);
+
+/**
+ * @brief Flatten a drawn path on the CPU and add its geometric complexity to the report
+ * @param ctx The test context to use
+ * @param path The path that was drawn
+ * @param matrix The transform it was drawn with
+ * @note The flattening time is excluded from the draw time
+ */
+void vg_lite_test_context_add_path_stats(struct vg_lite_test_context_s* ctx, const vg_lite_path_t* path, const vg_lite_matrix_t* matrix);
+
+/**
+ * @brief Check whether the case is being replayed on the CPU reference, see --cpu-ref
+ * @param ctx The test context to use
+ * @return True during the replay, cases use it to keep their own reports apart
+ */
+bool vg_lite_test_context_is_cpu_replay(struct vg_lite_test_context_s* ctx);
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,606 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_convert.h"
+#include "vg_lite_test_tile.h"
+#include "../gpu_assert.h"
+#include "../gpu_color.h"
+#include "../gpu_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Pixels per vectorized block of the row kernels */
+#define CONVERT_BLOCK_SIZE 8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    CONVERT_TYPE_UNKNOWN,
+    CONVERT_TYPE_PACKED, /* Channels at bit offsets of a little endian pixel */
+    CONVERT_TYPE_ALPHA,
+    CONVERT_TYPE_LUMINANCE,
+    CONVERT_TYPE_INDEX,
+} convert_type_t;
+
+typedef enum {
+    CHANNEL_R,
+    CHANNEL_G,
+    CHANNEL_B,
+    CHANNEL_A,
+    CHANNEL_COUNT,
+} channel_t;
+
+typedef struct {
+    convert_type_t type;
+    uint8_t bits;
+
+    /* CONVERT_TYPE_PACKED: bit offset and width per channel, a width of 0 is a missing channel */
+    uint8_t shift[CHANNEL_COUNT];
+    uint8_t width[CHANNEL_COUNT];
+} convert_desc_t;
+
+/* Per channel constants of the packed formats, a missing channel has a mask of 0 */
+typedef struct {
+    uint32_t shift[CHANNEL_COUNT];
+    uint32_t mask[CHANNEL_COUNT];
+
+    /* Widening to 8 bits as (value * mul) >> down, a missing channel reads fill */
+    uint32_t mul[CHANNEL_COUNT];
+    uint32_t down[CHANNEL_COUNT];
+    uint32_t fill[CHANNEL_COUNT];
+
+    /* The bits without a channel, set on write for the X of formats without alpha */
+    uint32_t unused;
+} packed_params_t;
+
+/* Convert len pixels, the rows do not overlap */
+typedef void (*row_kernel_t)(void* restrict dst, const void* restrict src, int len);
+
+typedef struct {
+    convert_desc_t desc;
+
+    /* Optional fast kernels, the descriptor covers the formats without one */
+    row_kernel_t read;
+    row_kernel_t write;
+} convert_format_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static convert_format_t convert_get_format(vg_lite_buffer_format_t format);
+static void read_generic(const convert_desc_t* desc, uint32_t* dst, const uint8_t* src, const uint32_t* clut, int len);
+static void write_generic(const convert_desc_t* desc, uint8_t* dst, const uint32_t* src, int len);
+static void packed_params_init(packed_params_t* params, const convert_desc_t* desc);
+static void read_packed(const convert_desc_t* desc, uint32_t* restrict dst, const uint8_t* restrict src, int len);
+static void write_packed(const convert_desc_t* desc, uint8_t* restrict dst, const uint32_t* restrict src, int len);
+static inline uint32_t expand_bits(uint32_t value, int width);
+static inline uint32_t sub_byte_get(const uint8_t* src, int x, int bits);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/* Bit offsets of the channels in a BGRA8888 pixel */
+static const uint8_t bgra_shift[CHANNEL_COUNT] = { 16, 8, 0, 24 };
+
+/* (value * mul) >> down is exactly GPU_COLOR_EXPAND(value, max) of a 1..8 bit value, by width */
+static const uint16_t expand_mul[9] = { 0, 255, 85, 583, 17, 1053, 4145, 16449, 1 };
+static const uint8_t expand_down[9] = { 0, 0, 0, 4, 0, 7, 10, 13, 0 };
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define PACKED_DESC(BITS, RS, RW, GS, GW, BS, BW, AS, AW) \
+    { .type = CONVERT_TYPE_PACKED, .bits = BITS, .shift = { RS, GS, BS, AS }, .width = { RW, GW, BW, AW } }
+
+/*
+ * One kernel per format and direction, the statement converts pixel k from src to dst.
+ * The pixels go in blocks of a constant size, which the compiler vectorizes even when
+ * it does not version loops for a runtime trip count.
+ */
+#define ROW_KERNEL_DEF(NAME, DST_TYPE, SRC_TYPE, STATEMENT)                             \
+    static void NAME(void* restrict dst_row, const void* restrict src_row, int len)     \
+    {                                                                                   \
+        DST_TYPE* restrict dst = dst_row;                                               \
+        const SRC_TYPE* restrict src = src_row;                                         \
+        int i = 0;                                                                      \
+        for (; i + CONVERT_BLOCK_SIZE <= len; i += CONVERT_BLOCK_SIZE) {                \
+            for (int j = 0; j < CONVERT_BLOCK_SIZE; j++) {                              \
+                const int k = i + j;                                                    \
+                STATEMENT;                                                              \
+            }                                                                           \
+        }                                                                               \
+        for (int k = i; k < len; k++) {                                                 \
+            STATEMENT;                                                                  \
+        }                                                                               \
+    }
+
+/* Runs STATEMENT for pixel k of a row, in blocks of a constant size as ROW_KERNEL_DEF does */
+#define ROW_LOOP(LEN, STATEMENT)                                                        \
+    do {                                                                                \
+        int i = 0;                                                                      \
+        for (; i + CONVERT_BLOCK_SIZE <= (LEN); i += CONVERT_BLOCK_SIZE) {              \
+            for (int j = 0; j < CONVERT_BLOCK_SIZE; j++) {                              \
+                const int k = i + j;                                                    \
+                STATEMENT;                                                              \
+            }                                                                           \
+        }                                                                               \
+        for (int k = i; k < (LEN); k++) {                                               \
+            STATEMENT;                                                                  \
+        }                                                                               \
+    } while (0)
+
+static inline uint32_t swap_rb(uint32_t c)
+{
+    return (c & 0xFF00FF00) | ((c >> 16) & 0xFF) | (c & 0xFF) << 16;
+}
+
+static inline uint32_t swap_bytes(uint32_t c)
+{
+    return c >> 24 | ((c >> 8) & 0xFF00) | ((c << 8) & 0xFF0000) | c << 24;
+}
+
+static inline uint32_t expand_565(uint32_t value, bool lo_is_r)
+{
+    uint32_t lo = value & 0x1F;
+    uint32_t g = (value >> 5) & 0x3F;
+    uint32_t hi = (value >> 11) & 0x1F;
+    lo = gpu_color_expand_5_lut[lo];
+    g = gpu_color_expand_6_lut[g];
+    hi = gpu_color_expand_5_lut[hi];
+    return (lo_is_r ? lo << 16 | hi : hi << 16 | lo) | g << 8;
+}
+
+static inline uint16_t pack_565(uint32_t c, bool lo_is_r)
+{
+    uint32_t r = (c >> 19) & 0x1F;
+    uint32_t g = (c >> 10) & 0x3F;
+    uint32_t b = (c >> 3) & 0x1F;
+    return (uint16_t)((lo_is_r ? b << 11 | r : r << 11 | b) | g << 5);
+}
+
+static void read_bgr565(void* restrict dst_row, const void* restrict src_row, int len)
+{
+    /* The table lookups of gpu_color, which reads two pixels per word */
+    gpu_color_bgr565_to_bgra8888(dst_row, src_row, len);
+}
+
+static inline uint8_t luma(uint32_t c)
+{
+    /* BT.601 weights in 8 fraction bits */
+    return (uint8_t)((((c >> 16) & 0xFF) * 77 + ((c >> 8) & 0xFF) * 150 + (c & 0xFF) * 29 + 128) >> 8);
+}
+
+ROW_KERNEL_DEF(read_copy32, uint32_t, uint32_t, dst[k] = src[k])
+ROW_KERNEL_DEF(read_bgrx8888, uint32_t, uint32_t, dst[k] = src[k] | 0xFF000000)
+ROW_KERNEL_DEF(read_rgba8888, uint32_t, uint32_t, dst[k] = swap_rb(src[k]))
+ROW_KERNEL_DEF(read_rgbx8888, uint32_t, uint32_t, dst[k] = swap_rb(src[k]) | 0xFF000000)
+ROW_KERNEL_DEF(read_argb8888, uint32_t, uint32_t, dst[k] = swap_bytes(src[k]))
+ROW_KERNEL_DEF(read_xrgb8888, uint32_t, uint32_t, dst[k] = swap_bytes(src[k]) | 0xFF000000)
+ROW_KERNEL_DEF(read_abgr8888, uint32_t, uint32_t, dst[k] = src[k] >> 8 | src[k] << 24)
+ROW_KERNEL_DEF(read_xbgr8888, uint32_t, uint32_t, dst[k] = src[k] >> 8 | 0xFF000000)
+ROW_KERNEL_DEF(read_rgb565, uint32_t, uint16_t, dst[k] = expand_565(src[k], true) | 0xFF000000)
+ROW_KERNEL_DEF(read_bgr888, uint32_t, uint8_t,
+    dst[k] = 0xFF000000 | (uint32_t)src[k * 3 + 2] << 16 | (uint32_t)src[k * 3 + 1] << 8 | src[k * 3])
+ROW_KERNEL_DEF(read_rgb888, uint32_t, uint8_t,
+    dst[k] = 0xFF000000 | (uint32_t)src[k * 3] << 16 | (uint32_t)src[k * 3 + 1] << 8 | src[k * 3 + 2])
+ROW_KERNEL_DEF(read_bgra5658, uint32_t, uint8_t,
+    dst[k] = expand_565(src[k * 3] | (uint32_t)src[k * 3 + 1] << 8, false) | (uint32_t)src[k * 3 + 2] << 24)
+ROW_KERNEL_DEF(read_rgba5658, uint32_t, uint8_t,
+    dst[k] = expand_565(src[k * 3] | (uint32_t)src[k * 3 + 1] << 8, true) | (uint32_t)src[k * 3 + 2] << 24)
+ROW_KERNEL_DEF(read_a8, uint32_t, uint8_t, dst[k] = (uint32_t)src[k] << 24 | 0xFFFFFF)
+ROW_KERNEL_DEF(read_l8, uint32_t, uint8_t, dst[k] = src[k] * 0x010101u | 0xFF000000)
+
+ROW_KERNEL_DEF(write_bgrx8888, uint32_t, uint32_t, dst[k] = src[k] | 0xFF000000)
+ROW_KERNEL_DEF(write_rgba8888, uint32_t, uint32_t, dst[k] = swap_rb(src[k]))
+ROW_KERNEL_DEF(write_rgbx8888, uint32_t, uint32_t, dst[k] = swap_rb(src[k]) | 0xFF000000)
+ROW_KERNEL_DEF(write_argb8888, uint32_t, uint32_t, dst[k] = swap_bytes(src[k]))
+ROW_KERNEL_DEF(write_xrgb8888, uint32_t, uint32_t, dst[k] = swap_bytes(src[k]) | 0xFF)
+ROW_KERNEL_DEF(write_abgr8888, uint32_t, uint32_t, dst[k] = src[k] << 8 | src[k] >> 24)
+ROW_KERNEL_DEF(write_xbgr8888, uint32_t, uint32_t, dst[k] = src[k] << 8 | 0xFF)
+ROW_KERNEL_DEF(write_bgr565, uint16_t, uint32_t, dst[k] = pack_565(src[k], false))
+ROW_KERNEL_DEF(write_rgb565, uint16_t, uint32_t, dst[k] = pack_565(src[k], true))
+ROW_KERNEL_DEF(write_bgr888, uint8_t, uint32_t,
+    dst[k * 3] = (uint8_t)src[k]; dst[k * 3 + 1] = (uint8_t)(src[k] >> 8); dst[k * 3 + 2] = (uint8_t)(src[k] >> 16))
+ROW_KERNEL_DEF(write_rgb888, uint8_t, uint32_t,
+    dst[k * 3] = (uint8_t)(src[k] >> 16); dst[k * 3 + 1] = (uint8_t)(src[k] >> 8); dst[k * 3 + 2] = (uint8_t)src[k])
+ROW_KERNEL_DEF(write_bgra5658, uint8_t, uint32_t,
+    const uint16_t c16 = pack_565(src[k], false);
+    dst[k * 3] = (uint8_t)c16; dst[k * 3 + 1] = (uint8_t)(c16 >> 8); dst[k * 3 + 2] = (uint8_t)(src[k] >> 24))
+ROW_KERNEL_DEF(write_rgba5658, uint8_t, uint32_t,
+    const uint16_t c16 = pack_565(src[k], true);
+    dst[k * 3] = (uint8_t)c16; dst[k * 3 + 1] = (uint8_t)(c16 >> 8); dst[k * 3 + 2] = (uint8_t)(src[k] >> 24))
+ROW_KERNEL_DEF(write_a8, uint8_t, uint32_t, dst[k] = (uint8_t)(src[k] >> 24))
+ROW_KERNEL_DEF(write_l8, uint8_t, uint32_t, dst[k] = luma(src[k]))
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool vg_lite_test_convert_is_supported(vg_lite_buffer_format_t format, bool write)
+{
+    convert_format_t fmt = convert_get_format(format);
+    return fmt.desc.type != CONVERT_TYPE_UNKNOWN && !(write && fmt.desc.type == CONVERT_TYPE_INDEX);
+}
+
+uint32_t vg_lite_test_convert_565_to_bgra8888(uint32_t value, bool lo_is_r)
+{
+    return expand_565(value, lo_is_r) | 0xFF000000;
+}
+
+bool vg_lite_test_convert_row_to_bgra8888(uint32_t* dst, const void* src, vg_lite_buffer_format_t format, const uint32_t* clut, int len)
+{
+    GPU_ASSERT_NULL(dst);
+    GPU_ASSERT_NULL(src);
+
+    convert_format_t fmt = convert_get_format(format);
+    if (fmt.desc.type == CONVERT_TYPE_UNKNOWN) {
+        GPU_LOG_ERROR("Unsupported format: %s", vg_lite_test_buffer_format_string(format));
+        return false;
+    }
+
+    if (fmt.read) {
+        fmt.read(dst, src, len);
+    } else {
+        read_generic(&fmt.desc, dst, src, clut, len);
+    }
+
+    return true;
+}
+
+bool vg_lite_test_convert_row_from_bgra8888(void* dst, const uint32_t* src, vg_lite_buffer_format_t format, int len)
+{
+    GPU_ASSERT_NULL(dst);
+    GPU_ASSERT_NULL(src);
+
+    if (!vg_lite_test_convert_is_supported(format, true)) {
+        GPU_LOG_ERROR("Unsupported format: %s", vg_lite_test_buffer_format_string(format));
+        return false;
+    }
+
+    convert_format_t fmt = convert_get_format(format);
+    if (fmt.write) {
+        fmt.write(dst, src, len);
+    } else {
+        write_generic(&fmt.desc, dst, src, len);
+    }
+
+    return true;
+}
+
+bool vg_lite_test_convert_buffer(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src, const uint32_t* clut)
+{
+    GPU_ASSERT_NULL(dst);
+    GPU_ASSERT_NULL(src);
+
+    if (dst->width != src->width || dst->height != src->height) {
+        GPU_LOG_ERROR("Size not matched: W%dxH%d vs W%dxH%d",
+            (int)dst->width, (int)dst->height, (int)src->width, (int)src->height);
+        return false;
+    }
+
+    if ((dst->tiled != VG_LITE_LINEAR && !vg_lite_test_tile_is_supported(dst))
+        || (src->tiled != VG_LITE_LINEAR && !vg_lite_test_tile_is_supported(src))) {
+        GPU_LOG_ERROR("Unsupported tiled buffer: %s -> %s",
+            vg_lite_test_buffer_format_string(src->format),
+            vg_lite_test_buffer_format_string(dst->format));
+        return false;
+    }
+
+    if (!vg_lite_test_convert_is_supported(src->format, false) || !vg_lite_test_convert_is_supported(dst->format, true)) {
+        GPU_LOG_ERROR("Unsupported conversion: %s -> %s",
+            vg_lite_test_buffer_format_string(src->format),
+            vg_lite_test_buffer_format_string(dst->format));
+        return false;
+    }
+
+    const bool src_tiled = src->tiled != VG_LITE_LINEAR;
+    const bool dst_tiled = dst->tiled != VG_LITE_LINEAR;
+
+    /* A BGRA8888 side is converted in place, otherwise the rows pass through a temporary row */
+    uint32_t* temp = NULL;
+    if (src->format != VG_LITE_BGRA8888 && (dst->format != VG_LITE_BGRA8888 || dst_tiled)) {
+        temp = malloc(src->width * sizeof(uint32_t));
+        GPU_ASSERT_NULL(temp);
+    }
+
+    /* Tiled rows are gathered into or scattered from a linear line first */
+    uint8_t* src_line = src_tiled ? malloc(src->stride) : NULL;
+    uint8_t* dst_line = dst_tiled ? malloc(dst->stride) : NULL;
+    GPU_ASSERT(!src_tiled || src_line);
+    GPU_ASSERT(!dst_tiled || dst_line);
+
+    for (int y = 0; y < src->height; y++) {
+        const uint8_t* src_row = (const uint8_t*)src->memory + (size_t)y * src->stride;
+        uint8_t* dst_row = dst_tiled ? dst_line : (uint8_t*)dst->memory + (size_t)y * dst->stride;
+
+        if (src_tiled) {
+            vg_lite_test_tile_read_row(src_line, src, y);
+            src_row = src_line;
+        }
+
+        if (dst->format == VG_LITE_BGRA8888 && !dst_tiled) {
+            vg_lite_test_convert_row_to_bgra8888((uint32_t*)dst_row, src_row, src->format, clut, src->width);
+        } else if (src->format == VG_LITE_BGRA8888) {
+            vg_lite_test_convert_row_from_bgra8888(dst_row, (const uint32_t*)src_row, dst->format, src->width);
+        } else {
+            vg_lite_test_convert_row_to_bgra8888(temp, src_row, src->format, clut, src->width);
+            vg_lite_test_convert_row_from_bgra8888(dst_row, temp, dst->format, src->width);
+        }
+
+        if (dst_tiled) {
+            vg_lite_test_tile_write_row(dst, y, dst_line);
+        }
+    }
+
+    free(src_line);
+    free(dst_line);
+    free(temp);
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static convert_format_t convert_get_format(vg_lite_buffer_format_t format)
+{
+#define FORMAT_MATCH(FMT, READ, WRITE, ...)                  \
+    case VG_LITE_##FMT: {                                    \
+        const convert_format_t fmt = { __VA_ARGS__, READ, WRITE }; \
+        return fmt;                                          \
+    }
+
+    switch (format) {
+        /* 32 bits: bits, then offset and width of red, green, blue and alpha */
+        FORMAT_MATCH(BGRA8888, read_copy32, read_copy32, PACKED_DESC(32, 16, 8, 8, 8, 0, 8, 24, 8));
+        FORMAT_MATCH(RGBA8888, read_rgba8888, write_rgba8888, PACKED_DESC(32, 0, 8, 8, 8, 16, 8, 24, 8));
+        FORMAT_MATCH(ARGB8888, read_argb8888, write_argb8888, PACKED_DESC(32, 8, 8, 16, 8, 24, 8, 0, 8));
+        FORMAT_MATCH(ABGR8888, read_abgr8888, write_abgr8888, PACKED_DESC(32, 24, 8, 16, 8, 8, 8, 0, 8));
+        FORMAT_MATCH(BGRX8888, read_bgrx8888, write_bgrx8888, PACKED_DESC(32, 16, 8, 8, 8, 0, 8, 0, 0));
+        FORMAT_MATCH(RGBX8888, read_rgbx8888, write_rgbx8888, PACKED_DESC(32, 0, 8, 8, 8, 16, 8, 0, 0));
+        FORMAT_MATCH(XRGB8888, read_xrgb8888, write_xrgb8888, PACKED_DESC(32, 8, 8, 16, 8, 24, 8, 0, 0));
+        FORMAT_MATCH(XBGR8888, read_xbgr8888, write_xbgr8888, PACKED_DESC(32, 24, 8, 16, 8, 8, 8, 0, 0));
+
+        /* 24 bits */
+        FORMAT_MATCH(BGR888, read_bgr888, write_bgr888, PACKED_DESC(24, 16, 8, 8, 8, 0, 8, 0, 0));
+        FORMAT_MATCH(RGB888, read_rgb888, write_rgb888, PACKED_DESC(24, 0, 8, 8, 8, 16, 8, 0, 0));
+        FORMAT_MATCH(BGRA5658, read_bgra5658, write_bgra5658, PACKED_DESC(24, 11, 5, 5, 6, 0, 5, 16, 8));
+        FORMAT_MATCH(RGBA5658, read_rgba5658, write_rgba5658, PACKED_DESC(24, 0, 5, 5, 6, 11, 5, 16, 8));
+        FORMAT_MATCH(ABGR8565, NULL, NULL, PACKED_DESC(24, 19, 5, 13, 6, 8, 5, 0, 8));
+        FORMAT_MATCH(ARGB8565, NULL, NULL, PACKED_DESC(24, 8, 5, 13, 6, 19, 5, 0, 8));
+
+        /* 16 bits */
+        FORMAT_MATCH(BGR565, read_bgr565, write_bgr565, PACKED_DESC(16, 11, 5, 5, 6, 0, 5, 0, 0));
+        FORMAT_MATCH(RGB565, read_rgb565, write_rgb565, PACKED_DESC(16, 0, 5, 5, 6, 11, 5, 0, 0));
+        FORMAT_MATCH(RGBA4444, NULL, NULL, PACKED_DESC(16, 0, 4, 4, 4, 8, 4, 12, 4));
+        FORMAT_MATCH(BGRA4444, NULL, NULL, PACKED_DESC(16, 8, 4, 4, 4, 0, 4, 12, 4));
+        FORMAT_MATCH(ABGR4444, NULL, NULL, PACKED_DESC(16, 12, 4, 8, 4, 4, 4, 0, 4));
+        FORMAT_MATCH(ARGB4444, NULL, NULL, PACKED_DESC(16, 4, 4, 8, 4, 12, 4, 0, 4));
+        FORMAT_MATCH(BGRA5551, NULL, NULL, PACKED_DESC(16, 10, 5, 5, 5, 0, 5, 15, 1));
+        FORMAT_MATCH(RGBA5551, NULL, NULL, PACKED_DESC(16, 0, 5, 5, 5, 10, 5, 15, 1));
+        FORMAT_MATCH(ABGR1555, NULL, NULL, PACKED_DESC(16, 11, 5, 6, 5, 1, 5, 0, 1));
+        FORMAT_MATCH(ARGB1555, NULL, NULL, PACKED_DESC(16, 1, 5, 6, 5, 11, 5, 0, 1));
+
+        /* 8 bits */
+        FORMAT_MATCH(RGBA2222, NULL, NULL, PACKED_DESC(8, 0, 2, 2, 2, 4, 2, 6, 2));
+        FORMAT_MATCH(BGRA2222, NULL, NULL, PACKED_DESC(8, 4, 2, 2, 2, 0, 2, 6, 2));
+        FORMAT_MATCH(ABGR2222, NULL, NULL, PACKED_DESC(8, 6, 2, 4, 2, 2, 2, 0, 2));
+        FORMAT_MATCH(ARGB2222, NULL, NULL, PACKED_DESC(8, 2, 2, 4, 2, 6, 2, 0, 2));
+        FORMAT_MATCH(A8, read_a8, write_a8, { .type = CONVERT_TYPE_ALPHA, .bits = 8 });
+        FORMAT_MATCH(L8, read_l8, write_l8, { .type = CONVERT_TYPE_LUMINANCE, .bits = 8 });
+        FORMAT_MATCH(INDEX_8, NULL, NULL, { .type = CONVERT_TYPE_INDEX, .bits = 8 });
+
+        /* Sub-byte */
+        FORMAT_MATCH(A4, NULL, NULL, { .type = CONVERT_TYPE_ALPHA, .bits = 4 });
+        FORMAT_MATCH(INDEX_4, NULL, NULL, { .type = CONVERT_TYPE_INDEX, .bits = 4 });
+        FORMAT_MATCH(INDEX_2, NULL, NULL, { .type = CONVERT_TYPE_INDEX, .bits = 2 });
+        FORMAT_MATCH(INDEX_1, NULL, NULL, { .type = CONVERT_TYPE_INDEX, .bits = 1 });
+
+    default:
+        break;
+    }
+
+#undef FORMAT_MATCH
+
+    const convert_format_t unknown = { { .type = CONVERT_TYPE_UNKNOWN } };
+    return unknown;
+}
+
+static void read_generic(const convert_desc_t* desc, uint32_t* dst, const uint8_t* src, const uint32_t* clut, int len)
+{
+    switch (desc->type) {
+    case CONVERT_TYPE_PACKED:
+        read_packed(desc, dst, src, len);
+        break;
+
+    case CONVERT_TYPE_ALPHA:
+        for (int i = 0; i < len; i++) {
+            dst[i] = expand_bits(sub_byte_get(src, i, desc->bits), desc->bits) << 24 | 0xFFFFFF;
+        }
+        break;
+
+    case CONVERT_TYPE_LUMINANCE:
+        read_l8(dst, src, len);
+        break;
+
+    case CONVERT_TYPE_INDEX:
+        for (int i = 0; i < len; i++) {
+            const uint32_t index = sub_byte_get(src, i, desc->bits);
+            dst[i] = clut ? clut[index] : expand_bits(index, desc->bits) * 0x010101u | 0xFF000000;
+        }
+        break;
+
+    default:
+        GPU_ASSERT(false);
+        break;
+    }
+}
+
+static void write_generic(const convert_desc_t* desc, uint8_t* dst, const uint32_t* src, int len)
+{
+    switch (desc->type) {
+    case CONVERT_TYPE_PACKED:
+        write_packed(desc, dst, src, len);
+        break;
+
+    case CONVERT_TYPE_ALPHA:
+        for (int i = 0; i < len; i++) {
+            /* Read-modify-write, the neighbor pixels of the byte are kept */
+            const int bit = i * desc->bits;
+            const uint32_t mask = ((1u << desc->bits) - 1) << (bit & 7);
+            const uint32_t value = ((src[i] >> 24) >> (8 - desc->bits)) << (bit & 7);
+            dst[bit >> 3] = (uint8_t)((dst[bit >> 3] & ~mask) | value);
+        }
+        break;
+
+    case CONVERT_TYPE_LUMINANCE:
+        write_l8(dst, src, len);
+        break;
+
+    default:
+        GPU_ASSERT(false);
+        break;
+    }
+}
+
+static void packed_params_init(packed_params_t* params, const convert_desc_t* desc)
+{
+    params->unused = desc->bits == 32 ? 0xFFFFFFFF : (1u << desc->bits) - 1;
+
+    for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+        const int width = desc->width[ch];
+        params->shift[ch] = desc->shift[ch];
+        params->mask[ch] = (1u << width) - 1;
+        params->mul[ch] = expand_mul[width];
+        params->down[ch] = expand_down[width];
+        params->fill[ch] = width ? 0 : 0xFF;
+        params->unused &= ~(params->mask[ch] << desc->shift[ch]);
+    }
+
+    /* Formats with alpha have no X bits */
+    if (desc->width[CHANNEL_A]) {
+        params->unused = 0;
+    }
+}
+
+static inline uint32_t packed_unpack(const packed_params_t* p, uint32_t value)
+{
+    uint32_t color = 0;
+    for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+        const uint32_t c = (((value >> p->shift[ch]) & p->mask[ch]) * p->mul[ch]) >> p->down[ch];
+        color |= (c | p->fill[ch]) << bgra_shift[ch];
+    }
+
+    return color;
+}
+
+static inline uint32_t packed_pack(const packed_params_t* p, uint32_t color)
+{
+    uint32_t value = p->unused;
+    for (int ch = 0; ch < CHANNEL_COUNT; ch++) {
+        /* Keep the high bits of the channel */
+        const uint32_t c = (color >> bgra_shift[ch]) & 0xFF;
+        value |= ((c * (p->mask[ch] + 1)) >> 8) << p->shift[ch];
+    }
+
+    return value;
+}
+
+static void read_packed(const convert_desc_t* desc, uint32_t* restrict dst, const uint8_t* restrict src, int len)
+{
+    /* A local copy, so the constants stay in registers across the stores */
+    packed_params_t p;
+    packed_params_init(&p, desc);
+
+    switch (desc->bits) {
+    case 8:
+        ROW_LOOP(len, dst[k] = packed_unpack(&p, src[k]));
+        break;
+    case 16: {
+        const uint16_t* restrict src16 = (const uint16_t*)src;
+        ROW_LOOP(len, dst[k] = packed_unpack(&p, src16[k]));
+    } break;
+    case 24:
+        ROW_LOOP(len, dst[k] = packed_unpack(&p, src[k * 3] | (uint32_t)src[k * 3 + 1] << 8 | (uint32_t)src[k * 3 + 2] << 16));
+        break;
+    case 32: {
+        const uint32_t* restrict src32 = (const uint32_t*)src;
+        ROW_LOOP(len, dst[k] = packed_unpack(&p, src32[k]));
+    } break;
+    default:
+        GPU_ASSERT(false);
+        break;
+    }
+}
+
+static void write_packed(const convert_desc_t* desc, uint8_t* restrict dst, const uint32_t* restrict src, int len)
+{
+    packed_params_t p;
+    packed_params_init(&p, desc);
+
+    switch (desc->bits) {
+    case 8:
+        ROW_LOOP(len, dst[k] = (uint8_t)packed_pack(&p, src[k]));
+        break;
+    case 16: {
+        uint16_t* restrict dst16 = (uint16_t*)dst;
+        ROW_LOOP(len, dst16[k] = (uint16_t)packed_pack(&p, src[k]));
+    } break;
+    case 24:
+        ROW_LOOP(len,
+            const uint32_t value = packed_pack(&p, src[k]);
+            dst[k * 3] = (uint8_t)value; dst[k * 3 + 1] = (uint8_t)(value >> 8); dst[k * 3 + 2] = (uint8_t)(value >> 16));
+        break;
+    case 32: {
+        uint32_t* restrict dst32 = (uint32_t*)dst;
+        ROW_LOOP(len, dst32[k] = packed_pack(&p, src[k]));
+    } break;
+    default:
+        GPU_ASSERT(false);
+        break;
+    }
+}
+
+static inline uint32_t expand_bits(uint32_t value, int width)
+{
+    /* Replicate the bits down, for the 1, 2 and 4 bits widths this is value * 0xFF / max */
+    uint32_t result = value << (8 - width);
+    for (int shift = width; shift < 8; shift *= 2) {
+        result |= result >> shift;
+    }
+
+    return result;
+}
+
+static inline uint32_t sub_byte_get(const uint8_t* src, int x, int bits)
+{
+    const int bit = x * bits;
+    return (src[bit >> 3] >> (bit & 7)) & ((1u << bits) - 1);
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VG_LITE_TEST_CONVERT_H
+#define VG_LITE_TEST_CONVERT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_utils.h"
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Check whether a format can be converted.
+ * @param format The pixel format.
+ * @param write False to check the conversion to BGRA8888, true for the conversion from BGRA8888.
+ * @return True if the conversion is supported.
+ * @note All RGB orderings of 8888, 888, 565, 4444, 5551, 2222, 5658 and 8565 are supported both ways,
+ *       A4, A8 and L8 as well. INDEX_1, INDEX_2, INDEX_4 and INDEX_8 are read only.
+ */
+bool vg_lite_test_convert_is_supported(vg_lite_buffer_format_t format, bool write);
+
+/**
+ * @brief Convert a 565 pixel to BGRA8888.
+ * @param value The 16 bits of the pixel.
+ * @param lo_is_r True if red is in the low bits (RGB565), false if blue is (BGR565).
+ * @return The opaque pixel, 0xAARRGGBB. The channels widen as vg_lite_test_convert_row_to_bgra8888 does.
+ */
+uint32_t vg_lite_test_convert_565_to_bgra8888(uint32_t value, bool lo_is_r);
+
+/**
+ * @brief Convert a row of pixels to BGRA8888.
+ * @param dst len pixels in BGRA8888 memory order, 0xAARRGGBB as uint32_t.
+ * @param src The source row, starting on a byte boundary.
+ * @param format The source format.
+ * @param clut The ARGB8888 lookup table of the index formats, as passed to vg_lite_set_CLUT.
+ *        NULL reads the indices as gray levels.
+ * @param len The number of pixels.
+ * @return True on success, false if the format is not supported.
+ * @note Narrow channels are widened by GPU_COLOR_EXPAND. Alpha only pixels read as white with that
+ *       alpha, as VG-Lite samples them. Sub-byte pixels start in the low bits of each byte.
+ *       The channels convert as stored, premultiplied values stay premultiplied.
+ */
+bool vg_lite_test_convert_row_to_bgra8888(uint32_t* dst, const void* src, vg_lite_buffer_format_t format, const uint32_t* clut, int len);
+
+/**
+ * @brief Convert a row of BGRA8888 pixels to another format.
+ * @param dst The destination row, starting on a byte boundary.
+ * @param src len pixels in BGRA8888 memory order, 0xAARRGGBB as uint32_t.
+ * @param format The destination format.
+ * @param len The number of pixels.
+ * @return True on success, false if the format is not supported.
+ * @note Narrow channels keep the high bits, the X bits of formats without alpha are set.
+ *       L8 takes the BT.601 luma and A4 and A8 the alpha.
+ */
+bool vg_lite_test_convert_row_from_bgra8888(void* dst, const uint32_t* src, vg_lite_buffer_format_t format, int len);
+
+/**
+ * @brief Convert a buffer into another buffer of the same size, through BGRA8888.
+ * @param dst The destination buffer, linear or tiled layout.
+ * @param src The source buffer, linear or tiled layout.
+ * @param clut The lookup table of index sources, see vg_lite_test_convert_row_to_bgra8888.
+ * @return True on success, false if the formats or the layouts are not supported.
+ * @note The rows go straight into or out of the buffer when either side is BGRA8888.
+ *       Tiled rows are swizzled through a linear line, see vg_lite_test_tile_is_supported.
+ *       The caller handles the cache maintenance.
+ */
+bool vg_lite_test_convert_buffer(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src, const uint32_t* clut);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*VG_LITE_TEST_CONVERT_H*/
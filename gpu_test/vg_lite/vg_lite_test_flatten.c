@@ -0,0 +1,347 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_flatten.h"
+#include "../gpu_assert.h"
+#include "../gpu_math.h"
+#include "vg_lite_test_path.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* 2^16 segments per curve is far beyond any sane tolerance */
+#define FLATTEN_DEPTH_MAX 16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    float x;
+    float y;
+} flatten_point_t;
+
+typedef struct {
+    vg_lite_matrix_t matrix;
+    float tolerance_sq;
+    vg_lite_test_flatten_cb_t cb;
+    void* user_data;
+    vg_lite_test_flatten_stats_t* stats;
+
+    /* Path space, for relative ops */
+    flatten_point_t cur;
+    flatten_point_t start;
+
+    /* Transformed current point */
+    flatten_point_t last;
+    bool has_move;
+    bool valid;
+} flatten_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void flatten_path_cb(void* user_data, uint8_t op_code, const float* data, uint32_t len);
+static flatten_point_t flatten_transform(const flatten_ctx_t* ctx, float x, float y);
+static void flatten_emit(flatten_ctx_t* ctx, uint8_t op_code, flatten_point_t p);
+static void flatten_quad(flatten_ctx_t* ctx, flatten_point_t p0, flatten_point_t p1, flatten_point_t p2, int depth);
+static void flatten_cubic(flatten_ctx_t* ctx,
+    flatten_point_t p0, flatten_point_t p1, flatten_point_t p2, flatten_point_t p3, int depth);
+static float flatten_segment_distance(flatten_point_t p, flatten_point_t a, flatten_point_t b);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define FLATTEN_MID(A, B) ((flatten_point_t) { ((A).x + (B).x) * 0.5f, ((A).y + (B).y) * 0.5f })
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool vg_lite_test_flatten_path(
+    const vg_lite_path_t* path,
+    const vg_lite_matrix_t* matrix,
+    float tolerance,
+    vg_lite_test_flatten_cb_t cb,
+    void* user_data,
+    vg_lite_test_flatten_stats_t* stats)
+{
+    GPU_ASSERT_NULL(path);
+    GPU_ASSERT(tolerance > 0);
+
+    flatten_ctx_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    if (matrix) {
+        ctx.matrix = *matrix;
+    } else {
+        vg_lite_identity(&ctx.matrix);
+    }
+
+    ctx.tolerance_sq = tolerance * tolerance;
+    ctx.cb = cb;
+    ctx.user_data = user_data;
+    ctx.stats = stats;
+    ctx.valid = true;
+
+    vg_lite_test_path_for_each_data(path, flatten_path_cb, &ctx);
+
+    if (stats && ctx.valid) {
+        stats->path_count++;
+    }
+
+    return ctx.valid;
+}
+
+void vg_lite_test_flatten_stats_reset(vg_lite_test_flatten_stats_t* stats)
+{
+    GPU_ASSERT_NULL(stats);
+    memset(stats, 0, sizeof(vg_lite_test_flatten_stats_t));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void flatten_path_cb(void* user_data, uint8_t op_code, const float* data, uint32_t len)
+{
+    flatten_ctx_t* ctx = user_data;
+    if (!ctx->valid) {
+        return;
+    }
+
+    flatten_point_t p[3];
+    const bool rel = op_code == VLC_OP_MOVE_REL || op_code == VLC_OP_LINE_REL
+        || op_code == VLC_OP_QUAD_REL || op_code == VLC_OP_CUBIC_REL
+        || op_code == VLC_OP_SCCWARC_REL || op_code == VLC_OP_SCWARC_REL
+        || op_code == VLC_OP_LCCWARC_REL || op_code == VLC_OP_LCWARC_REL;
+    const float ox = rel ? ctx->cur.x : 0;
+    const float oy = rel ? ctx->cur.y : 0;
+
+    /* A path that does not start with a move starts at the origin */
+    if (!ctx->has_move && op_code != VLC_OP_END && op_code != VLC_OP_MOVE && op_code != VLC_OP_MOVE_REL) {
+        flatten_emit(ctx, VLC_OP_MOVE, flatten_transform(ctx, 0, 0));
+    }
+
+    ctx->has_move = true;
+
+    switch (op_code) {
+    case VLC_OP_END:
+        break;
+
+    case VLC_OP_CLOSE:
+        ctx->cur = ctx->start;
+        ctx->last = flatten_transform(ctx, ctx->start.x, ctx->start.y);
+        if (ctx->cb) {
+            ctx->cb(ctx->user_data, VLC_OP_CLOSE, 0, 0);
+        }
+        break;
+
+    case VLC_OP_MOVE:
+    case VLC_OP_MOVE_REL:
+        ctx->cur.x = ctx->start.x = ox + data[0];
+        ctx->cur.y = ctx->start.y = oy + data[1];
+        flatten_emit(ctx, VLC_OP_MOVE, flatten_transform(ctx, ctx->cur.x, ctx->cur.y));
+        break;
+
+    case VLC_OP_LINE:
+    case VLC_OP_LINE_REL:
+        ctx->cur.x = ox + data[0];
+        ctx->cur.y = oy + data[1];
+        flatten_emit(ctx, VLC_OP_LINE, flatten_transform(ctx, ctx->cur.x, ctx->cur.y));
+        if (ctx->stats) {
+            ctx->stats->line_count++;
+        }
+        break;
+
+    case VLC_OP_QUAD:
+    case VLC_OP_QUAD_REL:
+        p[0] = flatten_transform(ctx, ox + data[0], oy + data[1]);
+        p[1] = flatten_transform(ctx, ox + data[2], oy + data[3]);
+        ctx->cur.x = ox + data[2];
+        ctx->cur.y = oy + data[3];
+        flatten_quad(ctx, ctx->last, p[0], p[1], 0);
+        if (ctx->stats) {
+            ctx->stats->curve_count++;
+        }
+        break;
+
+    case VLC_OP_CUBIC:
+    case VLC_OP_CUBIC_REL:
+        p[0] = flatten_transform(ctx, ox + data[0], oy + data[1]);
+        p[1] = flatten_transform(ctx, ox + data[2], oy + data[3]);
+        p[2] = flatten_transform(ctx, ox + data[4], oy + data[5]);
+        ctx->cur.x = ox + data[4];
+        ctx->cur.y = oy + data[5];
+        flatten_cubic(ctx, ctx->last, p[0], p[1], p[2], 0);
+        if (ctx->stats) {
+            ctx->stats->curve_count++;
+        }
+        break;
+
+    case VLC_OP_SCCWARC:
+    case VLC_OP_SCCWARC_REL:
+    case VLC_OP_SCWARC:
+    case VLC_OP_SCWARC_REL:
+    case VLC_OP_LCCWARC:
+    case VLC_OP_LCCWARC_REL:
+    case VLC_OP_LCWARC:
+    case VLC_OP_LCWARC_REL:
+        /* The end point follows rh, rv and rotation */
+        ctx->cur.x = ox + data[3];
+        ctx->cur.y = oy + data[4];
+        flatten_emit(ctx, VLC_OP_LINE, flatten_transform(ctx, ctx->cur.x, ctx->cur.y));
+        if (ctx->stats) {
+            ctx->stats->arc_count++;
+        }
+        break;
+
+    default:
+        GPU_LOG_ERROR("Unsupported op code: 0x%x", op_code);
+        ctx->valid = false;
+        break;
+    }
+}
+
+static flatten_point_t flatten_transform(const flatten_ctx_t* ctx, float x, float y)
+{
+    const vg_lite_matrix_t* m = &ctx->matrix;
+    flatten_point_t p;
+    p.x = m->m[0][0] * x + m->m[0][1] * y + m->m[0][2];
+    p.y = m->m[1][0] * x + m->m[1][1] * y + m->m[1][2];
+
+    float w = m->m[2][0] * x + m->m[2][1] * y + m->m[2][2];
+    if (!math_equal(w, 1) && !math_zero(w)) {
+        p.x /= w;
+        p.y /= w;
+    }
+
+    return p;
+}
+
+static void flatten_emit(flatten_ctx_t* ctx, uint8_t op_code, flatten_point_t p)
+{
+    if (op_code == VLC_OP_LINE && ctx->stats) {
+        ctx->stats->segment_count++;
+    }
+
+    if (ctx->cb) {
+        ctx->cb(ctx->user_data, op_code, p.x, p.y);
+    }
+
+    ctx->last = p;
+}
+
+static void flatten_quad(flatten_ctx_t* ctx, flatten_point_t p0, flatten_point_t p1, flatten_point_t p2, int depth)
+{
+    /* The curve stays within |p0 - 2p1 + p2| / 4 of its chord */
+    const float dx = p0.x - 2 * p1.x + p2.x;
+    const float dy = p0.y - 2 * p1.y + p2.y;
+
+    if (depth >= FLATTEN_DEPTH_MAX || dx * dx + dy * dy <= 16 * ctx->tolerance_sq) {
+        if (ctx->stats) {
+            flatten_point_t mid = FLATTEN_MID(FLATTEN_MID(p0, p1), FLATTEN_MID(p1, p2));
+            float error = flatten_segment_distance(mid, p0, p2);
+            ctx->stats->max_error = MATH_MAX(ctx->stats->max_error, error);
+        }
+
+        flatten_emit(ctx, VLC_OP_LINE, p2);
+        return;
+    }
+
+    /* de Casteljau split at t = 0.5 */
+    const flatten_point_t p01 = FLATTEN_MID(p0, p1);
+    const flatten_point_t p12 = FLATTEN_MID(p1, p2);
+    const flatten_point_t mid = FLATTEN_MID(p01, p12);
+
+    flatten_quad(ctx, p0, p01, mid, depth + 1);
+    flatten_quad(ctx, mid, p12, p2, depth + 1);
+}
+
+static void flatten_cubic(flatten_ctx_t* ctx,
+    flatten_point_t p0, flatten_point_t p1, flatten_point_t p2, flatten_point_t p3, int depth)
+{
+    /* The curve stays within 3/4 * max(|p0 - 2p1 + p2|, |p1 - 2p2 + p3|) of its chord */
+    const float d1x = p0.x - 2 * p1.x + p2.x;
+    const float d1y = p0.y - 2 * p1.y + p2.y;
+    const float d2x = p1.x - 2 * p2.x + p3.x;
+    const float d2y = p1.y - 2 * p2.y + p3.y;
+    const float d_sq = MATH_MAX(d1x * d1x + d1y * d1y, d2x * d2x + d2y * d2y);
+
+    if (depth >= FLATTEN_DEPTH_MAX || d_sq * 9 <= 16 * ctx->tolerance_sq) {
+        if (ctx->stats) {
+            /* Sample the piece at t = 1/4, 1/2, 3/4 */
+            for (int i = 1; i <= 3; i++) {
+                const float t = i * 0.25f;
+                const float u = 1 - t;
+                const float b0 = u * u * u;
+                const float b1 = 3 * u * u * t;
+                const float b2 = 3 * u * t * t;
+                const float b3 = t * t * t;
+                flatten_point_t p = {
+                    b0 * p0.x + b1 * p1.x + b2 * p2.x + b3 * p3.x,
+                    b0 * p0.y + b1 * p1.y + b2 * p2.y + b3 * p3.y
+                };
+                float error = flatten_segment_distance(p, p0, p3);
+                ctx->stats->max_error = MATH_MAX(ctx->stats->max_error, error);
+            }
+        }
+
+        flatten_emit(ctx, VLC_OP_LINE, p3);
+        return;
+    }
+
+    const flatten_point_t p01 = FLATTEN_MID(p0, p1);
+    const flatten_point_t p12 = FLATTEN_MID(p1, p2);
+    const flatten_point_t p23 = FLATTEN_MID(p2, p3);
+    const flatten_point_t p012 = FLATTEN_MID(p01, p12);
+    const flatten_point_t p123 = FLATTEN_MID(p12, p23);
+    const flatten_point_t mid = FLATTEN_MID(p012, p123);
+
+    flatten_cubic(ctx, p0, p01, p012, mid, depth + 1);
+    flatten_cubic(ctx, mid, p123, p23, p3, depth + 1);
+}
+
+static float flatten_segment_distance(flatten_point_t p, flatten_point_t a, flatten_point_t b)
+{
+    const float abx = b.x - a.x;
+    const float aby = b.y - a.y;
+    const float apx = p.x - a.x;
+    const float apy = p.y - a.y;
+    const float len_sq = abx * abx + aby * aby;
+
+    float t = 0;
+    if (len_sq > 0) {
+        t = (apx * abx + apy * aby) / len_sq;
+        t = MATH_MIN(MATH_MAX(t, 0), 1);
+    }
+
+    const float dx = apx - t * abx;
+    const float dy = apy - t * aby;
+    return MATH_SQRTF(dx * dx + dy * dy);
+}
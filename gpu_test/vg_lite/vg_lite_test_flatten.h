@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VG_LITE_TEST_FLATTEN_H
+#define VG_LITE_TEST_FLATTEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <vg_lite.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Default flattening tolerance in pixels */
+#define VG_LITE_TEST_FLATTEN_TOLERANCE 0.25f
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t path_count;
+    uint32_t line_count;
+    uint32_t curve_count;
+    uint32_t arc_count;
+    uint32_t segment_count;
+    float max_error;
+} vg_lite_test_flatten_stats_t;
+
+/**
+ * @brief Flattened outline callback.
+ * @param op_code VLC_OP_MOVE, VLC_OP_LINE or VLC_OP_CLOSE.
+ * @param x The x coordinate of the point, 0 for VLC_OP_CLOSE.
+ * @param y The y coordinate of the point, 0 for VLC_OP_CLOSE.
+ */
+typedef void (*vg_lite_test_flatten_cb_t)(void* user_data, uint8_t op_code, float x, float y);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Flatten a path into line segments by adaptive subdivision.
+ * @param path The path to flatten, in any data format.
+ * @param matrix The transform applied before flattening, NULL for identity.
+ * @param tolerance The maximum distance between a curve and its segments, in transformed units.
+ * @param cb The outline callback, NULL to only collect statistics.
+ * @param user_data The user data passed to the callback.
+ * @param stats The statistics to accumulate into, NULL to skip measuring the error.
+ * @return True on success, false if the path contains an unknown op code.
+ * @note Arcs are replaced by their chord and counted in arc_count.
+ */
+bool vg_lite_test_flatten_path(
+    const vg_lite_path_t* path,
+    const vg_lite_matrix_t* matrix,
+    float tolerance,
+    vg_lite_test_flatten_cb_t cb,
+    void* user_data,
+    vg_lite_test_flatten_stats_t* stats);
+
+/**
+ * @brief Reset flattening statistics.
+ * @param stats The statistics to reset.
+ */
+void vg_lite_test_flatten_stats_reset(vg_lite_test_flatten_stats_t* stats);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*VG_LITE_TEST_FLATTEN_H*/
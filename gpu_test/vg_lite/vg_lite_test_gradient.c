@@ -0,0 +1,396 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_gradient.h"
+#include "../gpu_assert.h"
+#include "../gpu_math.h"
+#include <inttypes.h>
+#include <math.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Pixels per vectorized block of the span renderers */
+#define GRADIENT_BLOCK_SIZE 8
+
+/* Gradient positions in 16.16 fixed point, one ramp is GRADIENT_ONE */
+#define GRADIENT_ONE 0x10000
+
+/* Positions are clamped to this range before the fixed point conversion */
+#define GRADIENT_T_MAX 32767.0f
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/* Convert GRADIENT_BLOCK_SIZE positions to LUT indices with a spread mode */
+typedef void (*spread_cb_t)(const float* restrict t, int32_t* restrict index);
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static spread_cb_t spread_get_cb(vg_lite_gradient_spreadmode_t spread_mode);
+static bool fill_prepare(vg_lite_buffer_t* buffer, const vg_lite_rectangle_t* rect, vg_lite_gradient_spreadmode_t spread_mode,
+    const vg_lite_matrix_t* matrix, vg_lite_rectangle_t* clip, float inverse[2][3]);
+static inline uint8_t color_channel(float value);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define GRADIENT_ROW(buffer, y) ((uint32_t*)((uint8_t*)(buffer)->memory + (size_t)(y) * (buffer)->stride))
+
+/*
+ * One converter per spread mode, the expression folds the fixed point position tf into
+ * 0..GRADIENT_ONE. NaN and infinite positions end at -GRADIENT_T_MAX or GRADIENT_T_MAX.
+ */
+#define SPREAD_DEF(NAME, EXPR)                                                                 \
+    static void spread_##NAME(const float* restrict t, int32_t* restrict index)                \
+    {                                                                                          \
+        for (int j = 0; j < GRADIENT_BLOCK_SIZE; j++) {                                        \
+            const float clamped = MATH_MIN(MATH_MAX(t[j], -GRADIENT_T_MAX), GRADIENT_T_MAX);   \
+            int32_t tf = (int32_t)(clamped * GRADIENT_ONE);                                    \
+            tf = (EXPR);                                                                       \
+            index[j] = (tf * (VG_LITE_TEST_GRADIENT_LUT_SIZE - 1) + GRADIENT_ONE / 2) >> 16;   \
+        }                                                                                      \
+    }
+
+SPREAD_DEF(pad, MATH_MIN(MATH_MAX(tf, 0), GRADIENT_ONE))
+SPREAD_DEF(repeat, tf & (GRADIENT_ONE - 1))
+SPREAD_DEF(reflect, GRADIENT_ONE - MATH_ABS((tf & (GRADIENT_ONE * 2 - 1)) - GRADIENT_ONE))
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool vg_lite_test_gradient_build_lut(
+    uint32_t* lut,
+    const vg_lite_color_ramp_t* color_ramp,
+    uint32_t count,
+    bool premultiplied)
+{
+    GPU_ASSERT_NULL(lut);
+    GPU_ASSERT_NULL(color_ramp);
+
+    if (!count || count > VLC_MAX_COLOR_RAMP_STOPS) {
+        GPU_LOG_ERROR("Invalid stop count: %" PRIu32, count);
+        return false;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        const float stop = color_ramp[i].stop;
+        if (!(stop >= 0 && stop <= 1) || (i > 0 && stop < color_ramp[i - 1].stop)) {
+            GPU_LOG_ERROR("Invalid stop[%" PRIu32 "]: %f", i, stop);
+            return false;
+        }
+    }
+
+    /* The entries walk the stops in order, so the whole ramp costs one pass */
+    uint32_t s = 0;
+    for (int i = 0; i < VG_LITE_TEST_GRADIENT_LUT_SIZE; i++) {
+        const float t = (float)i / (VG_LITE_TEST_GRADIENT_LUT_SIZE - 1);
+        while (s + 1 < count && color_ramp[s + 1].stop <= t) {
+            s++;
+        }
+
+        const vg_lite_color_ramp_t* stop0 = &color_ramp[s];
+        const vg_lite_color_ramp_t* stop1 = &color_ramp[MATH_MIN(s + 1, count - 1)];
+        const float range = stop1->stop - stop0->stop;
+        const float f = range > 0 ? MATH_MIN(MATH_MAX((t - stop0->stop) / range, 0.0f), 1.0f) : 0;
+
+        float c0[4] = { stop0->red, stop0->green, stop0->blue, stop0->alpha };
+        float c1[4] = { stop1->red, stop1->green, stop1->blue, stop1->alpha };
+
+        if (premultiplied) {
+            for (int j = 0; j < 3; j++) {
+                c0[j] *= c0[3];
+                c1[j] *= c1[3];
+            }
+        }
+
+        float c[4];
+        for (int j = 0; j < 4; j++) {
+            c[j] = c0[j] + (c1[j] - c0[j]) * f;
+        }
+
+        if (!premultiplied) {
+            for (int j = 0; j < 3; j++) {
+                c[j] *= c[3];
+            }
+        }
+
+        lut[i] = (uint32_t)color_channel(c[3]) << 24
+            | (uint32_t)color_channel(c[0]) << 16
+            | (uint32_t)color_channel(c[1]) << 8
+            | color_channel(c[2]);
+    }
+
+    return true;
+}
+
+void vg_lite_test_gradient_linear_span(
+    uint32_t* dst,
+    const uint32_t* lut,
+    vg_lite_gradient_spreadmode_t spread_mode,
+    float t,
+    float dt,
+    int len)
+{
+    GPU_ASSERT_NULL(dst);
+    GPU_ASSERT_NULL(lut);
+
+    spread_cb_t spread = spread_get_cb(spread_mode);
+    GPU_ASSERT_NULL(spread);
+
+    float pos[GRADIENT_BLOCK_SIZE];
+    int32_t index[GRADIENT_BLOCK_SIZE];
+
+    for (int i = 0; i < len; i += GRADIENT_BLOCK_SIZE) {
+        /* From the span start, so the error does not add up along the span */
+        for (int j = 0; j < GRADIENT_BLOCK_SIZE; j++) {
+            pos[j] = t + dt * (i + j);
+        }
+
+        spread(pos, index);
+
+        const int count = MATH_MIN(len - i, GRADIENT_BLOCK_SIZE);
+        for (int j = 0; j < count; j++) {
+            dst[i + j] = lut[index[j]];
+        }
+    }
+}
+
+void vg_lite_test_gradient_radial_span(
+    uint32_t* dst,
+    const uint32_t* lut,
+    vg_lite_gradient_spreadmode_t spread_mode,
+    const vg_lite_radial_gradient_parameter_t* param,
+    float u,
+    float v,
+    float du,
+    float dv,
+    int len)
+{
+    GPU_ASSERT_NULL(dst);
+    GPU_ASSERT_NULL(lut);
+    GPU_ASSERT_NULL(param);
+
+    spread_cb_t spread = spread_get_cb(spread_mode);
+    GPU_ASSERT_NULL(spread);
+
+    /* Focal point relative to the center */
+    const float ex = param->fx - param->cx;
+    const float ey = param->fy - param->cy;
+    const float c = ex * ex + ey * ey - param->r * param->r;
+
+    /* Pixel position relative to the focal point */
+    u -= param->fx;
+    v -= param->fy;
+
+    float pos[GRADIENT_BLOCK_SIZE];
+    int32_t index[GRADIENT_BLOCK_SIZE];
+
+    for (int i = 0; i < len; i += GRADIENT_BLOCK_SIZE) {
+        /**
+         * Solve |e + d / t| = r for the pixel offset d from the focal point,
+         * the same root as vg_lite_cpu_paint_radial.
+         */
+        for (int j = 0; j < GRADIENT_BLOCK_SIZE; j++) {
+            const float dx = u + du * (i + j);
+            const float dy = v + dv * (i + j);
+            const float a = dx * dx + dy * dy;
+            const float b = ex * dx + ey * dy;
+            const float denom = -b + sqrtf(MATH_MAX(b * b - a * c, 0.0f));
+            pos[j] = a > 0 ? (denom > 0 ? a / denom : GRADIENT_T_MAX) : 0;
+        }
+
+        spread(pos, index);
+
+        const int count = MATH_MIN(len - i, GRADIENT_BLOCK_SIZE);
+        for (int j = 0; j < count; j++) {
+            dst[i + j] = lut[index[j]];
+        }
+    }
+}
+
+bool vg_lite_test_gradient_fill_linear(
+    vg_lite_buffer_t* buffer,
+    const vg_lite_rectangle_t* rect,
+    const uint32_t* lut,
+    vg_lite_gradient_spreadmode_t spread_mode,
+    const vg_lite_linear_gradient_parameter_t* param,
+    const vg_lite_matrix_t* matrix)
+{
+    GPU_ASSERT_NULL(lut);
+    GPU_ASSERT_NULL(param);
+
+    vg_lite_rectangle_t clip;
+    float inv[2][3];
+    if (!fill_prepare(buffer, rect, spread_mode, matrix, &clip, inv)) {
+        return false;
+    }
+
+    /* t = tu * u + tv * v + t0 in gradient space, a degenerate gradient is t = 0 everywhere */
+    const float gx = param->X1 - param->X0;
+    const float gy = param->Y1 - param->Y0;
+    const float len_sq = gx * gx + gy * gy;
+    const float tu = len_sq > 0 ? gx / len_sq : 0;
+    const float tv = len_sq > 0 ? gy / len_sq : 0;
+    const float t0 = -(param->X0 * tu + param->Y0 * tv);
+
+    /* The same plane in buffer space: t = tx * x + ty * y + tc */
+    const float tx = tu * inv[0][0] + tv * inv[1][0];
+    const float ty = tu * inv[0][1] + tv * inv[1][1];
+    const float tc = tu * inv[0][2] + tv * inv[1][2] + t0;
+
+    for (int y = clip.y; y < clip.y + clip.height; y++) {
+        const float t = tx * (clip.x + 0.5f) + ty * (y + 0.5f) + tc;
+        vg_lite_test_gradient_linear_span(GRADIENT_ROW(buffer, y) + clip.x, lut, spread_mode, t, tx, clip.width);
+    }
+
+    return true;
+}
+
+bool vg_lite_test_gradient_fill_radial(
+    vg_lite_buffer_t* buffer,
+    const vg_lite_rectangle_t* rect,
+    const uint32_t* lut,
+    vg_lite_gradient_spreadmode_t spread_mode,
+    const vg_lite_radial_gradient_parameter_t* param,
+    const vg_lite_matrix_t* matrix)
+{
+    GPU_ASSERT_NULL(lut);
+    GPU_ASSERT_NULL(param);
+
+    vg_lite_rectangle_t clip;
+    float inv[2][3];
+    if (!fill_prepare(buffer, rect, spread_mode, matrix, &clip, inv)) {
+        return false;
+    }
+
+    for (int y = clip.y; y < clip.y + clip.height; y++) {
+        const float px = clip.x + 0.5f;
+        const float py = y + 0.5f;
+        const float u = inv[0][0] * px + inv[0][1] * py + inv[0][2];
+        const float v = inv[1][0] * px + inv[1][1] * py + inv[1][2];
+        vg_lite_test_gradient_radial_span(
+            GRADIENT_ROW(buffer, y) + clip.x,
+            lut,
+            spread_mode,
+            param,
+            u,
+            v,
+            inv[0][0],
+            inv[1][0],
+            clip.width);
+    }
+
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static spread_cb_t spread_get_cb(vg_lite_gradient_spreadmode_t spread_mode)
+{
+    switch (spread_mode) {
+    case VG_LITE_GRADIENT_SPREAD_PAD:
+        return spread_pad;
+    case VG_LITE_GRADIENT_SPREAD_REPEAT:
+        return spread_repeat;
+    case VG_LITE_GRADIENT_SPREAD_REFLECT:
+        return spread_reflect;
+    default:
+        return NULL;
+    }
+}
+
+static bool fill_prepare(vg_lite_buffer_t* buffer, const vg_lite_rectangle_t* rect, vg_lite_gradient_spreadmode_t spread_mode,
+    const vg_lite_matrix_t* matrix, vg_lite_rectangle_t* clip, float inverse[2][3])
+{
+    GPU_ASSERT_NULL(buffer);
+    GPU_ASSERT_NULL(matrix);
+
+    if ((buffer->format != VG_LITE_BGRA8888 && buffer->format != VG_LITE_BGRX8888) || buffer->tiled != VG_LITE_LINEAR) {
+        GPU_LOG_ERROR("Unsupported buffer: %s", vg_lite_test_buffer_format_string(buffer->format));
+        return false;
+    }
+
+    if (!spread_get_cb(spread_mode)) {
+        GPU_LOG_ERROR("Unsupported spread mode: %d", (int)spread_mode);
+        return false;
+    }
+
+    const float(*m)[3] = matrix->m;
+    if (m[2][0] != 0 || m[2][1] != 0 || m[2][2] == 0) {
+        GPU_LOG_ERROR("Perspective matrix not supported");
+        return false;
+    }
+
+    const float a = m[0][0] / m[2][2];
+    const float b = m[0][1] / m[2][2];
+    const float c = m[0][2] / m[2][2];
+    const float d = m[1][0] / m[2][2];
+    const float e = m[1][1] / m[2][2];
+    const float f = m[1][2] / m[2][2];
+    const float det = a * e - b * d;
+    if (det == 0) {
+        GPU_LOG_ERROR("Singular matrix");
+        return false;
+    }
+
+    const float inv_det = 1.0f / det;
+    inverse[0][0] = e * inv_det;
+    inverse[0][1] = -b * inv_det;
+    inverse[0][2] = (b * f - c * e) * inv_det;
+    inverse[1][0] = -d * inv_det;
+    inverse[1][1] = a * inv_det;
+    inverse[1][2] = (c * d - a * f) * inv_det;
+
+    int32_t x0 = 0;
+    int32_t y0 = 0;
+    int32_t x1 = buffer->width;
+    int32_t y1 = buffer->height;
+    if (rect) {
+        x0 = MATH_MAX(x0, rect->x);
+        y0 = MATH_MAX(y0, rect->y);
+        x1 = MATH_MIN(x1, rect->x + rect->width);
+        y1 = MATH_MIN(y1, rect->y + rect->height);
+    }
+
+    clip->x = x0;
+    clip->y = y0;
+    clip->width = MATH_MAX(x1 - x0, 0);
+    clip->height = MATH_MAX(y1 - y0, 0);
+    return true;
+}
+
+static inline uint8_t color_channel(float value)
+{
+    return (uint8_t)(MATH_MIN(MATH_MAX(value, 0.0f), 1.0f) * 0xFF + 0.5f);
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VG_LITE_TEST_GRADIENT_H
+#define VG_LITE_TEST_GRADIENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_utils.h"
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Entries of a ramp LUT, entry i holds the color at t = i / (VG_LITE_TEST_GRADIENT_LUT_SIZE - 1) */
+#define VG_LITE_TEST_GRADIENT_LUT_SIZE 256
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Build a ramp LUT from color stops, as vg_lite_update_linear_grad and vg_lite_update_radial_grad do.
+ * @param lut Filled with VG_LITE_TEST_GRADIENT_LUT_SIZE premultiplied colors, 0xAARRGGBB.
+ * @param color_ramp The color stops, the stops in 0..1 and non-decreasing.
+ * @param count The number of stops, 1..VLC_MAX_COLOR_RAMP_STOPS.
+ * @param premultiplied True to interpolate premultiplied colors, false to interpolate the straight
+ *        colors and premultiply the result, the color_ramp_premultiplied flag of the driver.
+ * @return True on success, false if the stops are invalid.
+ * @note The color before the first stop and after the last stop is the color of that stop.
+ */
+bool vg_lite_test_gradient_build_lut(
+    uint32_t* lut,
+    const vg_lite_color_ramp_t* color_ramp,
+    uint32_t count,
+    bool premultiplied);
+
+/**
+ * @brief Render a span of a linear gradient from a ramp LUT.
+ * @param dst len pixels in BGRA8888 memory order, replaced by the gradient.
+ * @param lut The ramp LUT from vg_lite_test_gradient_build_lut.
+ * @param spread_mode VG_LITE_GRADIENT_SPREAD_PAD, VG_LITE_GRADIENT_SPREAD_REPEAT or VG_LITE_GRADIENT_SPREAD_REFLECT.
+ * @param t The gradient position of the first pixel.
+ * @param dt The position step between pixels.
+ * @param len The number of pixels.
+ * @note The positions and the LUT indices are computed over fixed size blocks, without branches,
+ *       so the compiler can vectorize them. Only the LUT lookups are scalar.
+ */
+void vg_lite_test_gradient_linear_span(
+    uint32_t* dst,
+    const uint32_t* lut,
+    vg_lite_gradient_spreadmode_t spread_mode,
+    float t,
+    float dt,
+    int len);
+
+/**
+ * @brief Render a span of a radial gradient from a ramp LUT.
+ * @param dst len pixels in BGRA8888 memory order, replaced by the gradient.
+ * @param lut The ramp LUT from vg_lite_test_gradient_build_lut.
+ * @param spread_mode VG_LITE_GRADIENT_SPREAD_PAD, VG_LITE_GRADIENT_SPREAD_REPEAT or VG_LITE_GRADIENT_SPREAD_REFLECT.
+ * @param param The circle and the focal point, in gradient space.
+ * @param u The gradient space X of the first pixel.
+ * @param v The gradient space Y of the first pixel.
+ * @param du The gradient space X step between pixels.
+ * @param dv The gradient space Y step between pixels.
+ * @param len The number of pixels.
+ */
+void vg_lite_test_gradient_radial_span(
+    uint32_t* dst,
+    const uint32_t* lut,
+    vg_lite_gradient_spreadmode_t spread_mode,
+    const vg_lite_radial_gradient_parameter_t* param,
+    float u,
+    float v,
+    float du,
+    float dv,
+    int len);
+
+/**
+ * @brief Fill a rectangle of a buffer with a linear gradient, like vg_lite_draw_linear_grad with VG_LITE_BLEND_NONE.
+ * @param buffer The BGRA8888 or BGRX8888 buffer, linear layout.
+ * @param rect The rectangle to fill, clipped to the buffer. NULL for the whole buffer.
+ * @param lut The ramp LUT from vg_lite_test_gradient_build_lut.
+ * @param spread_mode VG_LITE_GRADIENT_SPREAD_PAD, VG_LITE_GRADIENT_SPREAD_REPEAT or VG_LITE_GRADIENT_SPREAD_REFLECT.
+ * @param param The start and the end point, in gradient space.
+ * @param matrix The affine matrix from gradient space to buffer space, the path matrix times the gradient matrix.
+ * @return True on success, false if the buffer, the spread mode or the matrix is not supported.
+ * @note Pixels are sampled at their centers.
+ */
+bool vg_lite_test_gradient_fill_linear(
+    vg_lite_buffer_t* buffer,
+    const vg_lite_rectangle_t* rect,
+    const uint32_t* lut,
+    vg_lite_gradient_spreadmode_t spread_mode,
+    const vg_lite_linear_gradient_parameter_t* param,
+    const vg_lite_matrix_t* matrix);
+
+/**
+ * @brief Fill a rectangle of a buffer with a radial gradient, like vg_lite_draw_radial_grad with VG_LITE_BLEND_NONE.
+ * @param buffer The BGRA8888 or BGRX8888 buffer, linear layout.
+ * @param rect The rectangle to fill, clipped to the buffer. NULL for the whole buffer.
+ * @param lut The ramp LUT from vg_lite_test_gradient_build_lut.
+ * @param spread_mode VG_LITE_GRADIENT_SPREAD_PAD, VG_LITE_GRADIENT_SPREAD_REPEAT or VG_LITE_GRADIENT_SPREAD_REFLECT.
+ * @param param The circle and the focal point, in gradient space.
+ * @param matrix The affine matrix from gradient space to buffer space, the path matrix times the gradient matrix.
+ * @return True on success, false if the buffer, the spread mode or the matrix is not supported.
+ * @note Pixels are sampled at their centers.
+ */
+bool vg_lite_test_gradient_fill_radial(
+    vg_lite_buffer_t* buffer,
+    const vg_lite_rectangle_t* rect,
+    const uint32_t* lut,
+    vg_lite_gradient_spreadmode_t spread_mode,
+    const vg_lite_radial_gradient_parameter_t* param,
+    const vg_lite_matrix_t* matrix);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*VG_LITE_TEST_GRADIENT_H*/
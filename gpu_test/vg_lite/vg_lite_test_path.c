@@ -36,37 +36,75 @@
 
 #define PATH_MEM_SIZE_MIN 128
 
+/* Largest integer magnitudes used when quantizing, S32 is kept within float precision */
+#define PATH_QUANTIZE_S8_MAX 127
+#define PATH_QUANTIZE_S16_MAX 32767
+#define PATH_QUANTIZE_S32_MAX (1 << 24)
+
 #define SIGN(x) (math_zero(x) ? 0 : ((x) > 0 ? 1 : -1))
 
 #define VLC_OP_ARG_LEN(OP, LEN) \
     case VLC_OP_##OP:           \
         return (LEN)
 
-#define VLC_GET_OP_CODE(ptr) (*((uint8_t*)ptr))
-
 /**********************
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    float min_x;
+    float min_y;
+    float max_x;
+    float max_y;
+} vg_lite_test_path_bounds_t;
+
 struct vg_lite_test_path_s {
     vg_lite_path_t base;
     vg_lite_matrix_t matrix;
     size_t mem_size;
     uint8_t format_len;
     bool has_transform;
+
+    /* Running bounds of the appended points, stale after raw data is appended */
+    vg_lite_test_path_bounds_t bounds;
+    bool bounds_stale;
 };
 
 typedef struct {
-    float min_x;
-    float min_y;
-    float max_x;
-    float max_y;
-} vg_lite_test_path_bounds_t;
+    /* Output view of the path, without the builder transform */
+    vg_lite_test_path_t out;
+    uint8_t* dst;
+    float epsilon;
+
+    float cur_x;
+    float cur_y;
+    float start_x;
+    float start_y;
+
+    /* Pending run of collinear lines, from run to line */
+    float run_x;
+    float run_y;
+    float line_x;
+    float line_y;
+    bool has_line;
+
+    /* Move that is written only if the subpath draws something */
+    bool has_move;
+    uint32_t segment_count;
+} vg_lite_test_path_optimize_ctx_t;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
+static void vg_lite_test_path_bounds_init(vg_lite_test_path_bounds_t* bounds);
+static float vg_lite_test_path_read_value(vg_lite_format_t format, const uint8_t* src);
+static bool vg_lite_test_path_append_points(vg_lite_test_path_t* dest, const vg_lite_path_t* src, bool keep_end);
+static void vg_lite_test_path_optimize_flush_move(vg_lite_test_path_optimize_ctx_t* ctx);
+static void vg_lite_test_path_optimize_flush_line(vg_lite_test_path_optimize_ctx_t* ctx);
+static void vg_lite_test_path_optimize_line_to(vg_lite_test_path_optimize_ctx_t* ctx, float x, float y);
+static float vg_lite_test_path_segment_distance(float px, float py, float ax, float ay, float bx, float by);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -75,6 +113,43 @@ typedef struct {
  *      MACROS
  **********************/
 
+/**
+ * Arc arguments are (rh, rv, rot, x, y), only the end point contributes.
+ */
+#define PATH_CALC_BOUNDS_FUNC_DEF(NAME, TYPE, FORMAT)                                   \
+    static void vg_lite_test_path_calc_bounds_##NAME(                                   \
+        const vg_lite_path_t* path, vg_lite_test_path_bounds_t* bounds)                 \
+    {                                                                                   \
+        vg_lite_test_path_cursor_##NAME##_t cursor;                                     \
+        vg_lite_test_path_cursor_##NAME##_init(&cursor, path);                          \
+        uint8_t op;                                                                     \
+        const TYPE* args;                                                               \
+        uint8_t arg_len;                                                                \
+        while (vg_lite_test_path_cursor_##NAME##_next(&cursor, &op, &args, &arg_len)) { \
+            for (uint8_t i = arg_len & 1 ? 3 : 0; i + 1 < arg_len; i += 2) {            \
+                vg_lite_test_path_bounds_expand(bounds, args[i], args[i + 1]);          \
+            }                                                                           \
+        }                                                                               \
+    }
+
+#define PATH_FOR_EACH_FUNC_DEF(NAME, TYPE, FORMAT)                                      \
+    static void vg_lite_test_path_for_each_##NAME(                                      \
+        const vg_lite_path_t* path, vg_lite_test_path_iter_cb_t cb, void* user_data)    \
+    {                                                                                   \
+        vg_lite_test_path_cursor_##NAME##_t cursor;                                     \
+        vg_lite_test_path_cursor_##NAME##_init(&cursor, path);                          \
+        uint8_t op;                                                                     \
+        const TYPE* args;                                                               \
+        uint8_t arg_len;                                                                \
+        float tmp_data[8];                                                              \
+        while (vg_lite_test_path_cursor_##NAME##_next(&cursor, &op, &args, &arg_len)) { \
+            for (uint8_t i = 0; i < arg_len; i++) {                                     \
+                tmp_data[i] = args[i];                                                  \
+            }                                                                           \
+            cb(user_data, op, tmp_data, arg_len);                                       \
+        }                                                                               \
+    }
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -85,6 +160,7 @@ vg_lite_test_path_t* vg_lite_test_path_create(vg_lite_format_t data_format)
     GPU_ASSERT_NULL(path);
     memset(path, 0, sizeof(vg_lite_test_path_t));
     path->format_len = vg_lite_test_path_format_len(data_format);
+    vg_lite_test_path_bounds_init(&path->bounds);
     GPU_ASSERT(vg_lite_init_path(
                    &path->base,
                    data_format,
@@ -118,6 +194,8 @@ void vg_lite_test_path_reset(vg_lite_test_path_t* path, vg_lite_format_t data_fo
     path->base.path_type = VG_LITE_DRAW_ZERO;
     path->format_len = vg_lite_test_path_format_len(data_format);
     path->has_transform = false;
+    vg_lite_test_path_bounds_init(&path->bounds);
+    path->bounds_stale = false;
 }
 
 vg_lite_path_t* vg_lite_test_path_get_path(vg_lite_test_path_t* path)
@@ -152,38 +230,6 @@ void vg_lite_test_path_get_bounding_box(vg_lite_test_path_t* path,
         *max_y = path->base.bounding_box[3];
 }
 
-static void path_bounds_iter_cb(void* user_data, uint8_t op_code, const float* data, uint32_t len)
-{
-    if (len == 0) {
-        return;
-    }
-
-    typedef struct {
-        float x;
-        float y;
-    } point_t;
-
-    const int pt_len = sizeof(point_t) / sizeof(float);
-
-    GPU_ASSERT(len % pt_len == 0);
-
-    const point_t* pt = (point_t*)data;
-    len /= pt_len;
-
-    vg_lite_test_path_bounds_t* bounds = user_data;
-
-    for (uint32_t i = 0; i < len; i++) {
-        if (pt[i].x < bounds->min_x)
-            bounds->min_x = pt[i].x;
-        if (pt[i].y < bounds->min_y)
-            bounds->min_y = pt[i].y;
-        if (pt[i].x > bounds->max_x)
-            bounds->max_x = pt[i].x;
-        if (pt[i].y > bounds->max_y)
-            bounds->max_y = pt[i].y;
-    }
-}
-
 bool vg_lite_test_path_update_bounding_box(vg_lite_test_path_t* path)
 {
     GPU_ASSERT_NULL(path);
@@ -192,19 +238,22 @@ bool vg_lite_test_path_update_bounding_box(vg_lite_test_path_t* path)
         return false;
     }
 
-    vg_lite_test_path_bounds_t bounds;
-
-    /* init bounds */
-    bounds.min_x = FLT_MAX;
-    bounds.min_y = FLT_MAX;
-    bounds.max_x = FLT_MIN;
-    bounds.max_y = FLT_MIN;
+    if (path->bounds_stale) {
+        /* Raw data was appended, fall back to a full walk */
+        if (!vg_lite_test_path_calc_bounding_box(&path->base,
+                &path->bounds.min_x, &path->bounds.min_y,
+                &path->bounds.max_x, &path->bounds.max_y)) {
+            return false;
+        }
 
-    /* calc bounds */
-    vg_lite_test_path_for_each_data(vg_lite_test_path_get_path(path), path_bounds_iter_cb, &bounds);
+        path->bounds_stale = false;
+    } else if (path->bounds.min_x > path->bounds.max_x) {
+        /* No points */
+        return false;
+    }
 
     /* set bounds */
-    vg_lite_test_path_set_bounding_box(path, bounds.min_x, bounds.min_y, bounds.max_x, bounds.max_y);
+    vg_lite_test_path_set_bounding_box(path, path->bounds.min_x, path->bounds.min_y, path->bounds.max_x, path->bounds.max_y);
 
     return true;
 }
@@ -225,32 +274,48 @@ void vg_lite_test_path_set_quality(vg_lite_test_path_t* path, vg_lite_quality_t
     path->base.quality = quality;
 }
 
-static void vg_lite_test_path_append_data(vg_lite_test_path_t* path, const void* data, size_t len)
+static inline void vg_lite_test_path_bounds_expand(vg_lite_test_path_bounds_t* bounds, float x, float y)
+{
+    bounds->min_x = MATH_MIN(bounds->min_x, x);
+    bounds->min_y = MATH_MIN(bounds->min_y, y);
+    bounds->max_x = MATH_MAX(bounds->max_x, x);
+    bounds->max_y = MATH_MAX(bounds->max_y, y);
+}
+
+VG_LITE_TEST_PATH_FORMAT_LIST(PATH_CALC_BOUNDS_FUNC_DEF)
+VG_LITE_TEST_PATH_FORMAT_LIST(PATH_FOR_EACH_FUNC_DEF)
+
+static uint8_t* vg_lite_test_path_grow(vg_lite_test_path_t* path, size_t len)
 {
     GPU_ASSERT_NULL(path);
-    GPU_ASSERT_NULL(data);
 
-    if (path->base.path_length + len > path->mem_size) {
-        if (path->mem_size == 0) {
-            path->mem_size = MATH_MAX(len, PATH_MEM_SIZE_MIN);
-        } else {
-            /* Increase memory size by 1.5 times */
-            path->mem_size = path->mem_size * 3 / 2;
-        }
-        path->base.path = realloc(path->base.path, path->mem_size);
-        GPU_ASSERT_NULL(path->base.path);
+    size_t required = path->base.path_length + len;
+    if (required > path->mem_size) {
+        /* Increase memory size by 1.5 times, but never less than required */
+        size_t mem_size = MATH_MAX(path->mem_size * 3 / 2, PATH_MEM_SIZE_MIN);
+        vg_lite_test_path_reserve(path, MATH_MAX(mem_size, required));
     }
 
-    memcpy((uint8_t*)path->base.path + path->base.path_length, data, len);
+    uint8_t* dst = (uint8_t*)path->base.path + path->base.path_length;
     path->base.path_length += len;
+    return dst;
+}
+
+static void vg_lite_test_path_append_data(vg_lite_test_path_t* path, const void* data, size_t len)
+{
+    GPU_ASSERT_NULL(data);
+    memcpy(vg_lite_test_path_grow(path, len), data, len);
 }
 
-static void vg_lite_test_path_append_op(vg_lite_test_path_t* path, uint32_t op)
+static uint8_t* vg_lite_test_path_write_op(const vg_lite_test_path_t* path, uint8_t* dst, uint8_t op)
 {
-    vg_lite_test_path_append_data(path, &op, path->format_len);
+    /* The op code occupies the first byte of a full-width element */
+    memset(dst, 0, path->format_len);
+    *dst = op;
+    return dst + path->format_len;
 }
 
-static void vg_lite_test_path_append_point(vg_lite_test_path_t* path, float x, float y)
+static uint8_t* vg_lite_test_path_write_point(vg_lite_test_path_t* path, uint8_t* dst, float x, float y)
 {
     if (path->has_transform) {
         /* transform point */
@@ -260,32 +325,185 @@ static void vg_lite_test_path_append_point(vg_lite_test_path_t* path, float x, f
         y = ori_x * path->matrix.m[1][0] + ori_y * path->matrix.m[1][1] + path->matrix.m[1][2];
     }
 
-    if (path->base.format == VG_LITE_FP32) {
-        vg_lite_test_path_append_data(path, &x, sizeof(x));
-        vg_lite_test_path_append_data(path, &y, sizeof(y));
+    switch (path->base.format) {
+    case VG_LITE_S8: {
+        int8_t data[2] = { (int8_t)(int32_t)x, (int8_t)(int32_t)y };
+        memcpy(dst, data, sizeof(data));
+        vg_lite_test_path_bounds_expand(&path->bounds, data[0], data[1]);
+    } break;
+    case VG_LITE_S16: {
+        int16_t data[2] = { (int16_t)(int32_t)x, (int16_t)(int32_t)y };
+        memcpy(dst, data, sizeof(data));
+        vg_lite_test_path_bounds_expand(&path->bounds, data[0], data[1]);
+    } break;
+    case VG_LITE_S32: {
+        int32_t data[2] = { (int32_t)x, (int32_t)y };
+        memcpy(dst, data, sizeof(data));
+        vg_lite_test_path_bounds_expand(&path->bounds, data[0], data[1]);
+    } break;
+    case VG_LITE_FP32: {
+        float data[2] = { x, y };
+        memcpy(dst, data, sizeof(data));
+        vg_lite_test_path_bounds_expand(&path->bounds, x, y);
+    } break;
+    default:
+        GPU_LOG_ERROR("UNKNOW_FORMAT(%d)", path->base.format);
+        GPU_ASSERT(false);
+        break;
+    }
+
+    return dst + path->format_len * 2;
+}
+
+static uint8_t* vg_lite_test_path_write_value(const vg_lite_test_path_t* path, uint8_t* dst, float value)
+{
+    switch (path->base.format) {
+    case VG_LITE_S8:
+        *(int8_t*)dst = (int8_t)(int32_t)value;
+        break;
+    case VG_LITE_S16: {
+        int16_t data = (int16_t)(int32_t)value;
+        memcpy(dst, &data, sizeof(data));
+    } break;
+    case VG_LITE_S32: {
+        int32_t data = (int32_t)value;
+        memcpy(dst, &data, sizeof(data));
+    } break;
+    case VG_LITE_FP32:
+        memcpy(dst, &value, sizeof(value));
+        break;
+    default:
+        GPU_LOG_ERROR("UNKNOW_FORMAT(%d)", path->base.format);
+        GPU_ASSERT(false);
+        break;
+    }
+
+    return dst + path->format_len;
+}
+
+static void vg_lite_test_path_append_op(vg_lite_test_path_t* path, uint8_t op)
+{
+    vg_lite_test_path_write_op(path, vg_lite_test_path_grow(path, path->format_len), op);
+}
+
+void vg_lite_test_path_reserve(vg_lite_test_path_t* path, size_t size)
+{
+    GPU_ASSERT_NULL(path);
+
+    if (size <= path->mem_size) {
         return;
     }
 
-    int32_t ix = (int32_t)(x);
-    int32_t iy = (int32_t)(y);
-    vg_lite_test_path_append_data(path, &ix, path->format_len);
-    vg_lite_test_path_append_data(path, &iy, path->format_len);
+    path->base.path = realloc(path->base.path, size);
+    GPU_ASSERT_NULL(path->base.path);
+    path->mem_size = size;
+}
+
+size_t vg_lite_test_path_calc_size(vg_lite_format_t data_format, const uint8_t* ops, uint32_t op_count)
+{
+    GPU_ASSERT_NULL(ops);
+
+    uint32_t arg_count = 0;
+    for (uint32_t i = 0; i < op_count; i++) {
+        arg_count += vg_lite_test_vlc_op_arg_len(ops[i]);
+    }
+
+    return (size_t)(op_count + arg_count) * vg_lite_test_path_format_len(data_format);
+}
+
+void vg_lite_test_path_append_ops(vg_lite_test_path_t* path,
+    const uint8_t* ops, uint32_t op_count,
+    const float* points, uint32_t point_count)
+{
+    GPU_ASSERT_NULL(path);
+    GPU_ASSERT_NULL(ops);
+
+    /* Single capacity check for the whole batch */
+    uint8_t* dst = vg_lite_test_path_grow(path, (size_t)(op_count + point_count * 2) * path->format_len);
+
+    /* Untransformed FP32 points are stored as is */
+    const bool copy_points = path->base.format == VG_LITE_FP32 && !path->has_transform;
+    const float* points_end = points + point_count * 2;
+
+    for (uint32_t i = 0; i < op_count; i++) {
+        uint8_t op = ops[i];
+        uint8_t pt_count = 0;
+
+        switch (op) {
+        case VLC_OP_END:
+            path->base.add_end = 1;
+            break;
+        case VLC_OP_CLOSE:
+            break;
+        case VLC_OP_MOVE:
+        case VLC_OP_LINE:
+            pt_count = 1;
+            break;
+        case VLC_OP_QUAD:
+            pt_count = 2;
+            break;
+        case VLC_OP_CUBIC:
+            pt_count = 3;
+            break;
+        default:
+            /* Relative and arc arguments are not plain points */
+            GPU_LOG_ERROR("Unsupported bulk op: 0x%x", op);
+            GPU_ASSERT(false);
+            break;
+        }
+
+        if (points + pt_count * 2 > points_end) {
+            GPU_LOG_ERROR("Op %d needs %d points, %d are left", (int)i, pt_count, (int)(points_end - points) / 2);
+            GPU_ASSERT(false);
+
+            /* Keep the ops written so far */
+            path->base.path_length = dst - (uint8_t*)path->base.path;
+            return;
+        }
+
+        dst = vg_lite_test_path_write_op(path, dst, op);
+
+        if (copy_points) {
+            for (uint8_t j = 0; j < pt_count * 2; j += 2) {
+                vg_lite_test_path_bounds_expand(&path->bounds, points[j], points[j + 1]);
+            }
+
+            memcpy(dst, points, pt_count * 2 * sizeof(float));
+            dst += pt_count * 2 * sizeof(float);
+            points += pt_count * 2;
+            continue;
+        }
+
+        for (uint8_t j = 0; j < pt_count; j++) {
+            dst = vg_lite_test_path_write_point(path, dst, points[0], points[1]);
+            points += 2;
+        }
+    }
+
+    if (points != points_end) {
+        GPU_LOG_WARN("%d points are not used by the ops", (int)(points_end - points) / 2);
+    }
+
+    /* Drop the space reserved for ops and points that were not written */
+    path->base.path_length = dst - (uint8_t*)path->base.path;
 }
 
 void vg_lite_test_path_move_to(vg_lite_test_path_t* path,
     float x, float y)
 {
     GPU_ASSERT_NULL(path);
-    vg_lite_test_path_append_op(path, VLC_OP_MOVE);
-    vg_lite_test_path_append_point(path, x, y);
+    uint8_t* dst = vg_lite_test_path_grow(path, path->format_len * 3);
+    dst = vg_lite_test_path_write_op(path, dst, VLC_OP_MOVE);
+    vg_lite_test_path_write_point(path, dst, x, y);
 }
 
 void vg_lite_test_path_line_to(vg_lite_test_path_t* path,
     float x, float y)
 {
     GPU_ASSERT_NULL(path);
-    vg_lite_test_path_append_op(path, VLC_OP_LINE);
-    vg_lite_test_path_append_point(path, x, y);
+    uint8_t* dst = vg_lite_test_path_grow(path, path->format_len * 3);
+    dst = vg_lite_test_path_write_op(path, dst, VLC_OP_LINE);
+    vg_lite_test_path_write_point(path, dst, x, y);
 }
 
 void vg_lite_test_path_quad_to(vg_lite_test_path_t* path,
@@ -293,9 +511,10 @@ void vg_lite_test_path_quad_to(vg_lite_test_path_t* path,
     float x, float y)
 {
     GPU_ASSERT_NULL(path);
-    vg_lite_test_path_append_op(path, VLC_OP_QUAD);
-    vg_lite_test_path_append_point(path, cx, cy);
-    vg_lite_test_path_append_point(path, x, y);
+    uint8_t* dst = vg_lite_test_path_grow(path, path->format_len * 5);
+    dst = vg_lite_test_path_write_op(path, dst, VLC_OP_QUAD);
+    dst = vg_lite_test_path_write_point(path, dst, cx, cy);
+    vg_lite_test_path_write_point(path, dst, x, y);
 }
 
 void vg_lite_test_path_cubic_to(vg_lite_test_path_t* path,
@@ -304,10 +523,11 @@ void vg_lite_test_path_cubic_to(vg_lite_test_path_t* path,
     float x, float y)
 {
     GPU_ASSERT_NULL(path);
-    vg_lite_test_path_append_op(path, VLC_OP_CUBIC);
-    vg_lite_test_path_append_point(path, cx1, cy1);
-    vg_lite_test_path_append_point(path, cx2, cy2);
-    vg_lite_test_path_append_point(path, x, y);
+    uint8_t* dst = vg_lite_test_path_grow(path, path->format_len * 7);
+    dst = vg_lite_test_path_write_op(path, dst, VLC_OP_CUBIC);
+    dst = vg_lite_test_path_write_point(path, dst, cx1, cy1);
+    dst = vg_lite_test_path_write_point(path, dst, cx2, cy2);
+    vg_lite_test_path_write_point(path, dst, x, y);
 }
 
 void vg_lite_test_path_close(vg_lite_test_path_t* path)
@@ -423,40 +643,41 @@ void vg_lite_test_path_append_arc_right_angle(vg_lite_test_path_t* path,
         end_x, end_y);
 }
 
-void vg_lite_test_path_append_arc(vg_lite_test_path_t* path,
+void vg_lite_test_path_append_elliptical_arc(vg_lite_test_path_t* path,
     float cx, float cy,
-    float radius,
+    float rx, float ry,
+    float rotation,
     float start_angle,
-    float sweep,
-    bool pie)
+    float sweep)
 {
-    /* just circle */
-    if (sweep >= 360.0f || sweep <= -360.0f) {
-        vg_lite_test_path_append_circle(path, cx, cy, radius, radius);
-        return;
-    }
-
     start_angle = MATH_RADIANS(start_angle);
     sweep = MATH_RADIANS(sweep);
+    rotation = MATH_RADIANS(rotation);
 
     int n_curves = (int)ceil(MATH_FABSF(sweep / MATH_HALF_PI));
     float sweep_sign = sweep < 0 ? -1.f : 1.f;
     float fract = fmodf(sweep, MATH_HALF_PI);
     fract = (math_zero(fract)) ? MATH_HALF_PI * sweep_sign : fract;
 
-    /* Start from here */
-    float start_x = radius * MATH_COSF(start_angle);
-    float start_y = radius * MATH_SINF(start_angle);
+    /* The curves are built on the unit circle, then mapped onto the ellipse */
+    const float cos_r = MATH_COSF(rotation);
+    const float sin_r = MATH_SINF(rotation);
+    const float m00 = rx * cos_r;
+    const float m01 = -ry * sin_r;
+    const float m10 = rx * sin_r;
+    const float m11 = ry * cos_r;
 
-    if (pie) {
-        vg_lite_test_path_move_to(path, cx, cy);
-        vg_lite_test_path_line_to(path, start_x + cx, start_y + cy);
-    }
+#define ELLIPSE_X(ux, uy) (cx + (ux)*m00 + (uy)*m01)
+#define ELLIPSE_Y(ux, uy) (cy + (ux)*m10 + (uy)*m11)
+
+    /* Start from here */
+    float start_x = MATH_COSF(start_angle);
+    float start_y = MATH_SINF(start_angle);
 
     for (int i = 0; i < n_curves; ++i) {
         float end_angle = start_angle + ((i != n_curves - 1) ? MATH_HALF_PI * sweep_sign : fract);
-        float end_x = radius * MATH_COSF(end_angle);
-        float end_y = radius * MATH_SINF(end_angle);
+        float end_x = MATH_COSF(end_angle);
+        float end_y = MATH_SINF(end_angle);
 
         /* variables needed to calculate bezier control points */
 
@@ -475,23 +696,317 @@ void vg_lite_test_path_append_arc(vg_lite_test_path_t* path,
         start_x = end_x;
         start_y = end_y;
 
-        end_x += cx;
-        end_y += cy;
-
-        float ctrl1_x = ax - k2 * ay + cx;
-        float ctrl1_y = ay + k2 * ax + cy;
-        float ctrl2_x = bx + k2 * by + cx;
-        float ctrl2_y = by - k2 * bx + cy;
+        float ctrl1_x = ax - k2 * ay;
+        float ctrl1_y = ay + k2 * ax;
+        float ctrl2_x = bx + k2 * by;
+        float ctrl2_y = by - k2 * bx;
 
-        vg_lite_test_path_cubic_to(path, ctrl1_x, ctrl1_y, ctrl2_x, ctrl2_y, end_x, end_y);
+        vg_lite_test_path_cubic_to(path,
+            ELLIPSE_X(ctrl1_x, ctrl1_y), ELLIPSE_Y(ctrl1_x, ctrl1_y),
+            ELLIPSE_X(ctrl2_x, ctrl2_y), ELLIPSE_Y(ctrl2_x, ctrl2_y),
+            ELLIPSE_X(end_x, end_y), ELLIPSE_Y(end_x, end_y));
         start_angle = end_angle;
     }
 
+#undef ELLIPSE_X
+#undef ELLIPSE_Y
+}
+
+void vg_lite_test_path_append_arc(vg_lite_test_path_t* path,
+    float cx, float cy,
+    float radius,
+    float start_angle,
+    float sweep,
+    bool pie)
+{
+    /* just circle */
+    if (sweep >= 360.0f || sweep <= -360.0f) {
+        vg_lite_test_path_append_circle(path, cx, cy, radius, radius);
+        return;
+    }
+
+    if (pie) {
+        /* Start from here */
+        float start_x = radius * MATH_COSF(MATH_RADIANS(start_angle));
+        float start_y = radius * MATH_SINF(MATH_RADIANS(start_angle));
+        vg_lite_test_path_move_to(path, cx, cy);
+        vg_lite_test_path_line_to(path, start_x + cx, start_y + cy);
+    }
+
+    vg_lite_test_path_append_elliptical_arc(path, cx, cy, radius, radius, 0, start_angle, sweep);
+
     if (pie) {
         vg_lite_test_path_close(path);
     }
 }
 
+bool vg_lite_test_path_quantize(vg_lite_test_path_t* path, float max_error, vg_lite_matrix_t* matrix, float* error)
+{
+    GPU_ASSERT_NULL(path);
+    GPU_ASSERT_NULL(matrix);
+
+    if (path->base.format != VG_LITE_FP32 || max_error <= 0) {
+        return false;
+    }
+
+    /* Only absolute point operations scale linearly */
+    vg_lite_test_path_cursor_fp32_t cursor;
+    vg_lite_test_path_cursor_fp32_init(&cursor, &path->base);
+    uint8_t op;
+    const float* args;
+    uint8_t arg_len;
+    while (vg_lite_test_path_cursor_fp32_next(&cursor, &op, &args, &arg_len)) {
+        if (op != VLC_OP_END && op != VLC_OP_CLOSE && op != VLC_OP_MOVE
+            && op != VLC_OP_LINE && op != VLC_OP_QUAD && op != VLC_OP_CUBIC) {
+            GPU_LOG_WARN("Path op 0x%x can not be quantized", op);
+            return false;
+        }
+    }
+
+    vg_lite_test_path_bounds_t bounds = path->bounds;
+    if (path->bounds_stale) {
+        vg_lite_test_path_calc_bounding_box(&path->base, &bounds.min_x, &bounds.min_y, &bounds.max_x, &bounds.max_y);
+    }
+
+    float extent = 0;
+    if (bounds.min_x <= bounds.max_x) {
+        extent = MATH_MAX(MATH_MAX(MATH_FABSF(bounds.min_x), MATH_FABSF(bounds.max_x)),
+            MATH_MAX(MATH_FABSF(bounds.min_y), MATH_FABSF(bounds.max_y)));
+    }
+
+    static const struct {
+        vg_lite_format_t format;
+        int32_t limit;
+    } candidates[] = {
+        { VG_LITE_S8, PATH_QUANTIZE_S8_MAX },
+        { VG_LITE_S16, PATH_QUANTIZE_S16_MAX },
+        { VG_LITE_S32, PATH_QUANTIZE_S32_MAX },
+    };
+
+    /**
+     * Use the finest power of two scale that fits the format, so the inverse
+     * is exact. Rounding to nearest bounds the error by half a step.
+     */
+    vg_lite_format_t format = VG_LITE_FP32;
+    float scale = 1.0f;
+    for (int i = 0; i < (int)(sizeof(candidates) / sizeof(candidates[0])); i++) {
+        scale = extent > 0 ? exp2f(floorf(log2f(candidates[i].limit / extent))) : 1.0f;
+        if (0.5f / scale <= max_error) {
+            format = candidates[i].format;
+            break;
+        }
+    }
+
+    if (format == VG_LITE_FP32) {
+        GPU_LOG_WARN("No integer format keeps the error below %f for extent %f", max_error, extent);
+        return false;
+    }
+
+    /* Same element count, narrower elements */
+    uint8_t format_len = vg_lite_test_path_format_len(format);
+    size_t element_count = path->base.path_length / sizeof(float);
+    size_t mem_size = MATH_MAX(element_count * format_len, 1);
+    uint8_t* data = malloc(mem_size);
+    GPU_ASSERT_NULL(data);
+
+    vg_lite_test_path_t quantized = *path;
+    quantized.base.path = data;
+    quantized.base.path_length = 0;
+    quantized.base.format = format;
+    quantized.format_len = format_len;
+    quantized.mem_size = mem_size;
+
+    /* The stored points are already transformed, the returned matrix undoes the scale */
+    quantized.has_transform = false;
+    vg_lite_test_path_bounds_init(&quantized.bounds);
+    quantized.bounds_stale = false;
+
+    float max_diff = 0;
+    uint8_t* dst = data;
+    vg_lite_test_path_cursor_fp32_init(&cursor, &path->base);
+    while (vg_lite_test_path_cursor_fp32_next(&cursor, &op, &args, &arg_len)) {
+        dst = vg_lite_test_path_write_op(&quantized, dst, op);
+        for (uint8_t i = 0; i < arg_len; i += 2) {
+            float x = rintf(args[i] * scale);
+            float y = rintf(args[i + 1] * scale);
+            max_diff = MATH_MAX(max_diff, MATH_FABSF(x / scale - args[i]));
+            max_diff = MATH_MAX(max_diff, MATH_FABSF(y / scale - args[i + 1]));
+            dst = vg_lite_test_path_write_point(&quantized, dst, x, y);
+        }
+    }
+
+    quantized.base.path_length = dst - data;
+    GPU_ASSERT(quantized.base.path_length == element_count * format_len);
+    for (int i = 0; i < 4; i++) {
+        quantized.base.bounding_box[i] = path->base.bounding_box[i] * scale;
+    }
+
+    free(path->base.path);
+    *path = quantized;
+
+    vg_lite_identity(matrix);
+    vg_lite_scale(1.0f / scale, 1.0f / scale, matrix);
+
+    if (error) {
+        *error = max_diff;
+    }
+
+    GPU_LOG_INFO("Path quantized to %s with scale %f, error %f",
+        format == VG_LITE_S8 ? "S8" : (format == VG_LITE_S16 ? "S16" : "S32"), scale, max_diff);
+
+    return true;
+}
+
+size_t vg_lite_test_path_optimize(vg_lite_test_path_t* path, float epsilon)
+{
+    GPU_ASSERT_NULL(path);
+    GPU_ASSERT(epsilon >= 0);
+
+    vg_lite_test_path_optimize_ctx_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+
+    /* The stored points are already transformed */
+    ctx.out = *path;
+    ctx.out.has_transform = false;
+    vg_lite_test_path_bounds_init(&ctx.out.bounds);
+    ctx.out.bounds_stale = false;
+    ctx.epsilon = epsilon;
+
+    const vg_lite_format_t format = path->base.format;
+    const uint8_t format_len = path->format_len;
+    const uint8_t* src = path->base.path;
+    const uint8_t* end = src + path->base.path_length;
+    ctx.dst = path->base.path;
+
+    /* Every written op comes from an op at or after its position, so this runs in place */
+    while (src < end) {
+        const uint8_t* op_src = src;
+        uint8_t op = *src;
+        uint8_t arg_len = vg_lite_test_vlc_op_arg_len(op);
+        size_t op_size = (size_t)(arg_len + 1) * format_len;
+        src += format_len;
+
+        float args[6] = { 0 };
+        for (uint8_t i = 0; i < arg_len && i < 6; i++) {
+            args[i] = vg_lite_test_path_read_value(format, src + i * format_len);
+        }
+
+        src += arg_len * format_len;
+
+        switch (op) {
+        case VLC_OP_END:
+            vg_lite_test_path_optimize_flush_line(&ctx);
+            ctx.has_move = false;
+            ctx.dst = vg_lite_test_path_write_op(&ctx.out, ctx.dst, VLC_OP_END);
+            break;
+
+        case VLC_OP_MOVE:
+            vg_lite_test_path_optimize_flush_line(&ctx);
+            ctx.has_move = true;
+            ctx.cur_x = ctx.start_x = args[0];
+            ctx.cur_y = ctx.start_y = args[1];
+            ctx.segment_count = 0;
+            break;
+
+        case VLC_OP_LINE:
+            vg_lite_test_path_optimize_line_to(&ctx, args[0], args[1]);
+            break;
+
+        case VLC_OP_QUAD:
+        case VLC_OP_CUBIC: {
+            const uint8_t end_index = arg_len - 2;
+            bool flat = true;
+            for (uint8_t i = 0; i < end_index && flat; i += 2) {
+                flat = vg_lite_test_path_segment_distance(args[i], args[i + 1],
+                           ctx.cur_x, ctx.cur_y, args[end_index], args[end_index + 1])
+                    <= epsilon;
+            }
+
+            if (flat) {
+                vg_lite_test_path_optimize_line_to(&ctx, args[end_index], args[end_index + 1]);
+                break;
+            }
+
+            vg_lite_test_path_optimize_flush_line(&ctx);
+            vg_lite_test_path_optimize_flush_move(&ctx);
+            ctx.dst = vg_lite_test_path_write_op(&ctx.out, ctx.dst, op);
+            for (uint8_t i = 0; i < arg_len; i += 2) {
+                ctx.dst = vg_lite_test_path_write_point(&ctx.out, ctx.dst, args[i], args[i + 1]);
+            }
+
+            ctx.cur_x = args[end_index];
+            ctx.cur_y = args[end_index + 1];
+            ctx.segment_count++;
+        } break;
+
+        case VLC_OP_CLOSE:
+            if (ctx.segment_count == 0) {
+                /* Nothing to close */
+                ctx.has_move = false;
+                break;
+            }
+
+            /* The close draws the line back to the start anyway */
+            if (ctx.has_line
+                && MATH_FABSF(ctx.line_x - ctx.start_x) <= epsilon
+                && MATH_FABSF(ctx.line_y - ctx.start_y) <= epsilon) {
+                ctx.has_line = false;
+            }
+
+            vg_lite_test_path_optimize_flush_line(&ctx);
+            ctx.dst = vg_lite_test_path_write_op(&ctx.out, ctx.dst, VLC_OP_CLOSE);
+            ctx.cur_x = ctx.start_x;
+            ctx.cur_y = ctx.start_y;
+            ctx.segment_count = 0;
+            break;
+
+        default: {
+            /* Relative and arc ops are kept as they are */
+            vg_lite_test_path_optimize_flush_line(&ctx);
+            vg_lite_test_path_optimize_flush_move(&ctx);
+            memmove(ctx.dst, op_src, op_size);
+            ctx.dst += op_size;
+
+            const bool is_arc = arg_len == 5;
+            const bool is_rel = op == VLC_OP_MOVE_REL || op == VLC_OP_LINE_REL
+                || op == VLC_OP_QUAD_REL || op == VLC_OP_CUBIC_REL
+                || op == VLC_OP_SCCWARC_REL || op == VLC_OP_SCWARC_REL
+                || op == VLC_OP_LCCWARC_REL || op == VLC_OP_LCWARC_REL;
+            const float ox = is_rel ? ctx.cur_x : 0;
+            const float oy = is_rel ? ctx.cur_y : 0;
+
+            /* The current point is known, so the points resolve exactly. Arcs add their end point, like the full walk */
+            for (uint8_t i = is_arc ? 3 : 0; i + 1 < arg_len; i += 2) {
+                vg_lite_test_path_bounds_expand(&ctx.out.bounds, ox + args[i], oy + args[i + 1]);
+            }
+
+            ctx.cur_x = ox + args[is_arc ? 3 : arg_len - 2];
+            ctx.cur_y = oy + args[is_arc ? 4 : arg_len - 1];
+
+            if (op == VLC_OP_MOVE_REL) {
+                ctx.start_x = ctx.cur_x;
+                ctx.start_y = ctx.cur_y;
+                ctx.segment_count = 0;
+            } else {
+                ctx.segment_count++;
+            }
+        } break;
+        }
+    }
+
+    vg_lite_test_path_optimize_flush_line(&ctx);
+
+    size_t old_length = path->base.path_length;
+    size_t new_length = ctx.dst - (uint8_t*)path->base.path;
+    GPU_ASSERT(new_length <= old_length);
+
+    path->base.path_length = new_length;
+    path->base.path_changed = 1;
+    path->bounds = ctx.out.bounds;
+    path->bounds_stale = false;
+    return old_length - new_length;
+}
+
 uint8_t vg_lite_test_vlc_op_arg_len(uint8_t vlc_op)
 {
     switch (vlc_op) {
@@ -547,58 +1062,273 @@ void vg_lite_test_path_for_each_data(const vg_lite_path_t* path, vg_lite_test_pa
     GPU_ASSERT_NULL(path);
     GPU_ASSERT_NULL(cb);
 
-    uint8_t fmt_len = vg_lite_test_path_format_len(path->format);
-    uint8_t* cur = path->path;
-    uint8_t* end = cur + path->path_length;
-    float tmp_data[8];
-
-    while (cur < end) {
-        /* get op code */
-        uint8_t op_code = VLC_GET_OP_CODE(cur);
-
-        /* get arguments length */
-        uint8_t arg_len = vg_lite_test_vlc_op_arg_len(op_code);
-
-        /* skip op code */
-        cur += fmt_len;
+    /* Dispatch once, the walk itself runs in the native element type */
+    switch (path->format) {
+    case VG_LITE_S8:
+        vg_lite_test_path_for_each_s8(path, cb, user_data);
+        break;
+    case VG_LITE_S16:
+        vg_lite_test_path_for_each_s16(path, cb, user_data);
+        break;
+    case VG_LITE_S32:
+        vg_lite_test_path_for_each_s32(path, cb, user_data);
+        break;
+    case VG_LITE_FP32:
+        vg_lite_test_path_for_each_fp32(path, cb, user_data);
+        break;
+    default:
+        GPU_LOG_ERROR("UNKNOW_FORMAT(%d)", path->format);
+        GPU_ASSERT(false);
+        break;
+    }
+}
 
-        /* print arguments */
-        for (uint8_t i = 0; i < arg_len; i++) {
-            switch (path->format) {
-            case VG_LITE_S8:
-                tmp_data[i] = *((int8_t*)cur);
-                break;
-            case VG_LITE_S16:
-                tmp_data[i] = *((int16_t*)cur);
-                break;
-            case VG_LITE_S32:
-                tmp_data[i] = *((int32_t*)cur);
-                break;
-            case VG_LITE_FP32:
-                tmp_data[i] = *((float*)cur);
-                break;
-            default:
-                GPU_LOG_ERROR("UNKNOW_FORMAT(%d)", path->format);
-                GPU_ASSERT(false);
-                break;
-            }
+void vg_lite_test_path_append_path(vg_lite_test_path_t* dest, const vg_lite_test_path_t* src)
+{
+    GPU_ASSERT_NULL(dest);
+    GPU_ASSERT_NULL(src);
 
-            cur += fmt_len;
+    /* Points have to be rewritten when they move or change format */
+    if (dest->has_transform || dest->base.format != src->base.format) {
+        const bool appended = vg_lite_test_path_append_points(dest, &src->base, true);
+        if (!appended) {
+            GPU_LOG_ERROR("Append path failed, dest is unchanged");
         }
+        return;
+    }
 
-        cb(user_data, op_code, tmp_data, arg_len);
+    vg_lite_test_path_append_data(dest, src->base.path, src->base.path_length);
+
+    /* The source data is stored as is, so its bounds can be merged */
+    if (src->bounds_stale) {
+        dest->bounds_stale = true;
+    } else if (src->bounds.min_x <= src->bounds.max_x) {
+        vg_lite_test_path_bounds_expand(&dest->bounds, src->bounds.min_x, src->bounds.min_y);
+        vg_lite_test_path_bounds_expand(&dest->bounds, src->bounds.max_x, src->bounds.max_y);
     }
 }
 
-void vg_lite_test_path_append_path(vg_lite_test_path_t* dest, const vg_lite_test_path_t* src)
+bool vg_lite_test_path_append_transformed(vg_lite_test_path_t* dest, const vg_lite_path_t* src)
 {
     GPU_ASSERT_NULL(dest);
     GPU_ASSERT_NULL(src);
+    return vg_lite_test_path_append_points(dest, src, false);
+}
 
-    GPU_ASSERT(dest->base.format == dest->base.format);
-    vg_lite_test_path_append_data(dest, src->base.path, src->base.path_length);
+bool vg_lite_test_path_calc_bounding_box(const vg_lite_path_t* path,
+    float* min_x, float* min_y,
+    float* max_x, float* max_y)
+{
+    GPU_ASSERT_NULL(path);
+
+    vg_lite_test_path_bounds_t bounds;
+    vg_lite_test_path_bounds_init(&bounds);
+
+    switch (path->format) {
+    case VG_LITE_S8:
+        vg_lite_test_path_calc_bounds_s8(path, &bounds);
+        break;
+    case VG_LITE_S16:
+        vg_lite_test_path_calc_bounds_s16(path, &bounds);
+        break;
+    case VG_LITE_S32:
+        vg_lite_test_path_calc_bounds_s32(path, &bounds);
+        break;
+    case VG_LITE_FP32:
+        vg_lite_test_path_calc_bounds_fp32(path, &bounds);
+        break;
+    default:
+        GPU_LOG_ERROR("UNKNOW_FORMAT(%d)", path->format);
+        GPU_ASSERT(false);
+        return false;
+    }
+
+    if (bounds.min_x > bounds.max_x) {
+        /* No points */
+        return false;
+    }
+
+    if (min_x)
+        *min_x = bounds.min_x;
+    if (min_y)
+        *min_y = bounds.min_y;
+    if (max_x)
+        *max_x = bounds.max_x;
+    if (max_y)
+        *max_y = bounds.max_y;
+
+    return true;
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+static void vg_lite_test_path_bounds_init(vg_lite_test_path_bounds_t* bounds)
+{
+    /* Inverted so that the first point sets all edges */
+    bounds->min_x = FLT_MAX;
+    bounds->min_y = FLT_MAX;
+    bounds->max_x = -FLT_MAX;
+    bounds->max_y = -FLT_MAX;
+}
+
+static float vg_lite_test_path_read_value(vg_lite_format_t format, const uint8_t* src)
+{
+    switch (format) {
+    case VG_LITE_S8:
+        return *(const int8_t*)src;
+    case VG_LITE_S16: {
+        int16_t value;
+        memcpy(&value, src, sizeof(value));
+        return value;
+    }
+    case VG_LITE_S32: {
+        int32_t value;
+        memcpy(&value, src, sizeof(value));
+        return value;
+    }
+    default: {
+        float value;
+        memcpy(&value, src, sizeof(value));
+        return value;
+    }
+    }
+}
+
+static void vg_lite_test_path_optimize_flush_move(vg_lite_test_path_optimize_ctx_t* ctx)
+{
+    if (!ctx->has_move) {
+        return;
+    }
+
+    ctx->dst = vg_lite_test_path_write_op(&ctx->out, ctx->dst, VLC_OP_MOVE);
+    ctx->dst = vg_lite_test_path_write_point(&ctx->out, ctx->dst, ctx->start_x, ctx->start_y);
+    ctx->has_move = false;
+}
+
+static void vg_lite_test_path_optimize_flush_line(vg_lite_test_path_optimize_ctx_t* ctx)
+{
+    if (!ctx->has_line) {
+        return;
+    }
+
+    ctx->dst = vg_lite_test_path_write_op(&ctx->out, ctx->dst, VLC_OP_LINE);
+    ctx->dst = vg_lite_test_path_write_point(&ctx->out, ctx->dst, ctx->line_x, ctx->line_y);
+    ctx->has_line = false;
+}
+
+static void vg_lite_test_path_optimize_line_to(vg_lite_test_path_optimize_ctx_t* ctx, float x, float y)
+{
+    /* Empty segment */
+    if (MATH_FABSF(x - ctx->cur_x) <= ctx->epsilon && MATH_FABSF(y - ctx->cur_y) <= ctx->epsilon) {
+        return;
+    }
+
+    if (ctx->has_line) {
+        /* Extend the run if it keeps going the same way and stays on the line */
+        const float dx = x - ctx->run_x;
+        const float dy = y - ctx->run_y;
+        const float forward = (x - ctx->line_x) * (ctx->line_x - ctx->run_x) + (y - ctx->line_y) * (ctx->line_y - ctx->run_y);
+        const float cross = (ctx->line_x - ctx->run_x) * dy - (ctx->line_y - ctx->run_y) * dx;
+        if (forward > 0 && MATH_FABSF(cross) <= ctx->epsilon * MATH_SQRTF(dx * dx + dy * dy)) {
+            ctx->line_x = ctx->cur_x = x;
+            ctx->line_y = ctx->cur_y = y;
+            return;
+        }
+
+        vg_lite_test_path_optimize_flush_line(ctx);
+    }
+
+    vg_lite_test_path_optimize_flush_move(ctx);
+    ctx->run_x = ctx->cur_x;
+    ctx->run_y = ctx->cur_y;
+    ctx->line_x = ctx->cur_x = x;
+    ctx->line_y = ctx->cur_y = y;
+    ctx->has_line = true;
+    ctx->segment_count++;
+}
+
+static float vg_lite_test_path_segment_distance(float px, float py, float ax, float ay, float bx, float by)
+{
+    const float abx = bx - ax;
+    const float aby = by - ay;
+    const float len_sq = abx * abx + aby * aby;
+
+    float t = 0;
+    if (len_sq > 0) {
+        t = ((px - ax) * abx + (py - ay) * aby) / len_sq;
+        t = MATH_MIN(MATH_MAX(t, 0), 1);
+    }
+
+    const float dx = px - ax - t * abx;
+    const float dy = py - ay - t * aby;
+    return MATH_SQRTF(dx * dx + dy * dy);
+}
+
+static bool vg_lite_test_path_append_points(vg_lite_test_path_t* dest, const vg_lite_path_t* src, bool keep_end)
+{
+    const uint8_t src_format_len = vg_lite_test_path_format_len(src->format);
+    const size_t old_length = dest->base.path_length;
+    const vg_lite_test_path_bounds_t old_bounds = dest->bounds;
+    const bool old_bounds_stale = dest->bounds_stale;
+
+    /* Same element count at most, the destination element width */
+    vg_lite_test_path_grow(dest, src->path_length / src_format_len * dest->format_len);
+    uint8_t* dst = (uint8_t*)dest->base.path + old_length;
+
+    const uint8_t* cur = src->path;
+    const uint8_t* end = cur + src->path_length;
+
+    while (cur < end) {
+        uint8_t op = *cur;
+        uint8_t arg_len = vg_lite_test_vlc_op_arg_len(op);
+        cur += src_format_len;
+
+        switch (op) {
+        case VLC_OP_END:
+            if (keep_end) {
+                dst = vg_lite_test_path_write_op(dest, dst, op);
+            }
+            break;
+
+        case VLC_OP_CLOSE:
+        case VLC_OP_MOVE:
+        case VLC_OP_LINE:
+        case VLC_OP_QUAD:
+        case VLC_OP_CUBIC:
+            dst = vg_lite_test_path_write_op(dest, dst, op);
+            for (uint8_t i = 0; i < arg_len; i += 2) {
+                float x = vg_lite_test_path_read_value(src->format, cur + i * src_format_len);
+                float y = vg_lite_test_path_read_value(src->format, cur + (i + 1) * src_format_len);
+                dst = vg_lite_test_path_write_point(dest, dst, x, y);
+            }
+            break;
+
+        default:
+            if (!dest->has_transform) {
+                /* Only the format changes, the arguments are converted like raw data */
+                dst = vg_lite_test_path_write_op(dest, dst, op);
+                for (uint8_t i = 0; i < arg_len; i++) {
+                    dst = vg_lite_test_path_write_value(dest, dst,
+                        vg_lite_test_path_read_value(src->format, cur + i * src_format_len));
+                }
+
+                dest->bounds_stale = true;
+                break;
+            }
+
+            /* Relative and arc arguments do not map through a matrix point by point */
+            GPU_LOG_ERROR("Unsupported op to transform: 0x%x", op);
+            dest->base.path_length = old_length;
+            dest->bounds = old_bounds;
+            dest->bounds_stale = old_bounds_stale;
+            return false;
+        }
+
+        cur += arg_len * src_format_len;
+    }
+
+    dest->base.path_length = dst - (uint8_t*)dest->base.path;
+    return true;
+}
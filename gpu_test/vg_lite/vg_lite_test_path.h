@@ -36,10 +36,33 @@ typedef struct vg_lite_test_path_s vg_lite_test_path_t;
 
 typedef void (*vg_lite_test_path_iter_cb_t)(void* user_data, uint8_t op_code, const float* data, uint32_t len);
 
+/**
+ * X(NAME, TYPE, FORMAT) for every path data format, used to generate
+ * the format specialized cursors below.
+ */
+#define VG_LITE_TEST_PATH_FORMAT_LIST(X) \
+    X(s8, int8_t, VG_LITE_S8)            \
+    X(s16, int16_t, VG_LITE_S16)         \
+    X(s32, int32_t, VG_LITE_S32)         \
+    X(fp32, float, VG_LITE_FP32)
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Cursor over the raw command stream of a path in its native element type,
+ * e.g. vg_lite_test_path_cursor_s16_t. Every op code occupies one element
+ * and is followed by its arguments.
+ */
+#define VG_LITE_TEST_PATH_CURSOR_TYPE_DEF(NAME, TYPE, FORMAT) \
+    typedef struct {                                          \
+        const TYPE* cur;                                      \
+        const TYPE* end;                                      \
+    } vg_lite_test_path_cursor_##NAME##_t;
+
+VG_LITE_TEST_PATH_FORMAT_LIST(VG_LITE_TEST_PATH_CURSOR_TYPE_DEF)
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -89,9 +112,10 @@ void vg_lite_test_path_get_bounding_box(vg_lite_test_path_t* path,
     float* max_x, float* max_y);
 
 /**
- * @brief Update the bounding box of a path object.
+ * @brief Update the bounding box of a path object from the points appended so far.
  * @param path The path object to update the bounding box.
- * @return True if the bounding box is updated, false otherwise.
+ * @return True if the bounding box is updated, false if the path has no points.
+ * @note This is O(1) unless raw data was appended with vg_lite_test_path_append_path.
  */
 bool vg_lite_test_path_update_bounding_box(vg_lite_test_path_t* path);
 
@@ -109,6 +133,34 @@ void vg_lite_test_path_set_transform(vg_lite_test_path_t* path, const vg_lite_ma
  */
 void vg_lite_test_path_set_quality(vg_lite_test_path_t* path, vg_lite_quality_t quality);
 
+/**
+ * @brief Reserve memory for the path data, the buffer is grown to exactly this size.
+ * @param path The path object to reserve memory for.
+ * @param size The total size of the path data in bytes.
+ */
+void vg_lite_test_path_reserve(vg_lite_test_path_t* path, size_t size);
+
+/**
+ * @brief Calculate the size of the path data encoded from a list of operation codes.
+ * @param data_format The data format of the path.
+ * @param ops The operation codes.
+ * @param op_count The number of operation codes.
+ * @return The size of the path data in bytes.
+ */
+size_t vg_lite_test_path_calc_size(vg_lite_format_t data_format, const uint8_t* ops, uint32_t op_count);
+
+/**
+ * @brief Append a batch of operations to the path with a single capacity check.
+ * @param path The path object to append to.
+ * @param ops The operation codes, only MOVE, LINE, QUAD, CUBIC, CLOSE and END are supported.
+ * @param op_count The number of operation codes.
+ * @param points The x, y pairs consumed by the operations in order.
+ * @param point_count The number of points, must match the operations.
+ */
+void vg_lite_test_path_append_ops(vg_lite_test_path_t* path,
+    const uint8_t* ops, uint32_t op_count,
+    const float* points, uint32_t point_count);
+
 /**
  * @brief Get vg-lite path object.
  * @param path The path object to get the vg-lite path object.
@@ -229,13 +281,68 @@ void vg_lite_test_path_append_arc(vg_lite_test_path_t* path,
     float sweep,
     bool pie);
 
+/**
+ * @brief Append an elliptical arc to the path, continuing from its start point.
+ * @param path The path object to append an arc.
+ * @param cx The x value of the center of the ellipse.
+ * @param cy The y value of the center of the ellipse.
+ * @param rx The radius of the x axis of the ellipse.
+ * @param ry The radius of the y axis of the ellipse.
+ * @param rotation The rotation of the x axis of the ellipse in degrees.
+ * @param start_angle The start angle of the arc in degrees.
+ * @param sweep The sweep angle of the arc in degrees.
+ */
+void vg_lite_test_path_append_elliptical_arc(vg_lite_test_path_t* path,
+    float cx, float cy,
+    float rx, float ry,
+    float rotation,
+    float start_angle,
+    float sweep);
+
 /**
  * @brief Append a path to the path.
  * @param dest The destination path object to append a path.
  * @param src The source path object to append.
+ * @note The data is copied as is, unless dest has a transform or another format,
+ *       then every point is mapped through the transform and converted.
+ *       Relative and arc operations cannot be transformed, dest is left unchanged then.
  */
 void vg_lite_test_path_append_path(vg_lite_test_path_t* dest, const vg_lite_test_path_t* src);
 
+/**
+ * @brief Append the outline of a raw path, mapping every point through the path transform.
+ * @param dest The destination path object, its transform and format apply to the points.
+ * @param src The raw path to append, in any data format.
+ * @return True on success, false if src has relative or arc operations and dest has a transform.
+ *         dest is unchanged then.
+ * @note END operations are skipped so that several paths merge into one, end dest when done.
+ */
+bool vg_lite_test_path_append_transformed(vg_lite_test_path_t* dest, const vg_lite_path_t* src);
+
+/**
+ * @brief Convert an FP32 path to the smallest integer format that keeps the coordinate error in bounds.
+ * @param path The FP32 path object to convert, after all points are appended.
+ * @param max_error The maximum coordinate error allowed, in path units.
+ * @param matrix Filled with the scale that maps the converted coordinates back, multiply it into the draw matrix.
+ * @param error The maximum coordinate error of the conversion. Can be NULL.
+ * @return True if the path is converted, false if it is not FP32, has relative or arc operations,
+ *         or no integer format is precise enough.
+ * @note The path transform is cleared. Points appended afterwards are stored as given, in the scaled units.
+ */
+bool vg_lite_test_path_quantize(vg_lite_test_path_t* path, float max_error, vg_lite_matrix_t* matrix, float* error);
+
+/**
+ * @brief Simplify the command stream of a path in one linear pass.
+ * @param path The path object to optimize, after all points are appended.
+ * @param epsilon The distance within which points are merged or considered collinear, in path units.
+ * @return The number of bytes removed.
+ * @note Collinear runs of lines are merged, empty segments, repeated moves and redundant
+ *       closes are dropped, and quads or cubics with control points within epsilon of
+ *       their chord become lines. Relative and arc operations are kept unchanged,
+ *       their resolved points are added to the bounds, so the bounds stay current.
+ */
+size_t vg_lite_test_path_optimize(vg_lite_test_path_t* path, float epsilon);
+
 /**
  * @brief Get operation code and argument length of a vg-lite path object.
  * @param vlc_op The operation code
@@ -250,6 +357,20 @@ uint8_t vg_lite_test_vlc_op_arg_len(uint8_t vlc_op);
  */
 uint8_t vg_lite_test_path_format_len(vg_lite_format_t format);
 
+/**
+ * @brief Calculate the bounding box of a raw vg-lite path by walking all of its data.
+ * @param path The vg-lite path object, e.g. one of the static resource paths.
+ * @param min_x The minimum x value of the bounding box. Can be NULL.
+ * @param min_y The minimum y value of the bounding box. Can be NULL.
+ * @param max_x The maximum x value of the bounding box. Can be NULL.
+ * @param max_y The maximum y value of the bounding box. Can be NULL.
+ * @return True if the bounding box is calculated, false if the path has no points.
+ * @note Relative operations are treated as absolute coordinates.
+ */
+bool vg_lite_test_path_calc_bounding_box(const vg_lite_path_t* path,
+    float* min_x, float* min_y,
+    float* max_x, float* max_y);
+
 /**
  * @brief Iterate over the data of a vg-lite path object.
  * @param path The path object to iterate over.
@@ -262,6 +383,68 @@ void vg_lite_test_path_for_each_data(const vg_lite_path_t* path, vg_lite_test_pa
  *      MACROS
  **********************/
 
+/**
+ * @brief Get the argument length of the common operation codes without a call.
+ * @param vlc_op The operation code
+ * @return The length of the argument of the operation code.
+ */
+static inline uint8_t vg_lite_test_vlc_op_arg_len_inline(uint8_t vlc_op)
+{
+    switch (vlc_op) {
+    case VLC_OP_END:
+    case VLC_OP_CLOSE:
+        return 0;
+    case VLC_OP_MOVE:
+    case VLC_OP_LINE:
+        return 2;
+    case VLC_OP_QUAD:
+        return 4;
+    case VLC_OP_CUBIC:
+        return 6;
+    default:
+        break;
+    }
+
+    return vg_lite_test_vlc_op_arg_len(vlc_op);
+}
+
+/**
+ * vg_lite_test_path_cursor_<NAME>_init(cursor, path):
+ *   Start a cursor at the first op, false if the path has another format.
+ *
+ * vg_lite_test_path_cursor_<NAME>_next(cursor, &op, &args, &arg_len):
+ *   Fetch the next op and point args at its arguments in place,
+ *   false at the end of the stream.
+ */
+#define VG_LITE_TEST_PATH_CURSOR_FUNC_DEF(NAME, TYPE, FORMAT)                       \
+    static inline bool vg_lite_test_path_cursor_##NAME##_init(                      \
+        vg_lite_test_path_cursor_##NAME##_t* cursor, const vg_lite_path_t* path)    \
+    {                                                                               \
+        if (path->format != (FORMAT)) {                                             \
+            cursor->cur = cursor->end = NULL;                                       \
+            return false;                                                           \
+        }                                                                           \
+        cursor->cur = (const TYPE*)path->path;                                      \
+        cursor->end = cursor->cur + path->path_length / sizeof(TYPE);               \
+        return true;                                                                \
+    }                                                                               \
+                                                                                    \
+    static inline bool vg_lite_test_path_cursor_##NAME##_next(                      \
+        vg_lite_test_path_cursor_##NAME##_t* cursor,                                \
+        uint8_t* op, const TYPE** args, uint8_t* arg_len)                           \
+    {                                                                               \
+        if (cursor->cur >= cursor->end) {                                           \
+            return false;                                                           \
+        }                                                                           \
+        *op = *(const uint8_t*)cursor->cur;                                         \
+        *arg_len = vg_lite_test_vlc_op_arg_len_inline(*op);                         \
+        *args = cursor->cur + 1;                                                    \
+        cursor->cur += 1 + *arg_len;                                                \
+        return true;                                                                \
+    }
+
+VG_LITE_TEST_PATH_FORMAT_LIST(VG_LITE_TEST_PATH_CURSOR_FUNC_DEF)
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -0,0 +1,372 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_stroke.h"
+#include "../gpu_assert.h"
+#include "../gpu_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define STROKE_POINT_COUNT_MIN 16
+
+/* Points closer than this are merged, so every segment has a direction */
+#define STROKE_POINT_EPSILON 1e-4f
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    float x;
+    float y;
+} stroke_point_t;
+
+typedef struct {
+    vg_lite_test_path_t* dest;
+    const vg_lite_test_stroke_style_t* style;
+    float half_width;
+    float tolerance;
+
+    /* Polyline of the current subpath */
+    stroke_point_t* points;
+    uint32_t count;
+    uint32_t capacity;
+
+    /* A lone move draws nothing, a zero length segment draws a dot */
+    bool has_segment;
+
+    /* Last point written to dest, to skip zero length lines */
+    stroke_point_t last;
+} stroke_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void stroke_flatten_cb(void* user_data, uint8_t op_code, float x, float y);
+static void stroke_push(stroke_ctx_t* ctx, float x, float y);
+static void stroke_flush(stroke_ctx_t* ctx, bool closed);
+static void stroke_side(stroke_ctx_t* ctx, uint32_t n, bool reverse, bool closed);
+static void stroke_join(stroke_ctx_t* ctx, stroke_point_t p, stroke_point_t d0, stroke_point_t d1);
+static void stroke_cap(stroke_ctx_t* ctx, stroke_point_t p, stroke_point_t d);
+static void stroke_dot(stroke_ctx_t* ctx, stroke_point_t p);
+static stroke_point_t stroke_get(const stroke_ctx_t* ctx, uint32_t n, uint32_t i, bool reverse);
+static stroke_point_t stroke_dir(const stroke_ctx_t* ctx, uint32_t n, uint32_t i, bool reverse);
+static void stroke_move_to(stroke_ctx_t* ctx, float x, float y);
+static void stroke_line_to(stroke_ctx_t* ctx, float x, float y);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/* Left normal of a unit direction, scaled to the half width */
+#define STROKE_NORMAL(ctx, d) ((stroke_point_t) { -(d).y * (ctx)->half_width, (d).x * (ctx)->half_width })
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool vg_lite_test_stroke_path(
+    vg_lite_test_path_t* dest,
+    const vg_lite_path_t* src,
+    const vg_lite_test_stroke_style_t* style,
+    float tolerance,
+    vg_lite_test_flatten_stats_t* stats)
+{
+    GPU_ASSERT_NULL(dest);
+    GPU_ASSERT_NULL(src);
+    GPU_ASSERT_NULL(style);
+    GPU_ASSERT(style->width > 0);
+
+    stroke_ctx_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.dest = dest;
+    ctx.style = style;
+    ctx.half_width = style->width / 2;
+    ctx.tolerance = tolerance;
+
+    bool retval = vg_lite_test_flatten_path(src, NULL, tolerance, stroke_flatten_cb, &ctx, stats);
+    stroke_flush(&ctx, false);
+
+    free(ctx.points);
+    return retval;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void stroke_flatten_cb(void* user_data, uint8_t op_code, float x, float y)
+{
+    stroke_ctx_t* ctx = user_data;
+
+    switch (op_code) {
+    case VLC_OP_MOVE:
+        stroke_flush(ctx, false);
+        stroke_push(ctx, x, y);
+        break;
+
+    case VLC_OP_LINE:
+        stroke_push(ctx, x, y);
+        ctx->has_segment = true;
+        break;
+
+    case VLC_OP_CLOSE: {
+        /* Drawing continues from the start point of the closed subpath */
+        bool has_start = ctx->count > 0;
+        stroke_point_t start = has_start ? ctx->points[0] : (stroke_point_t) { 0, 0 };
+        ctx->has_segment = true;
+        stroke_flush(ctx, true);
+        if (has_start) {
+            stroke_push(ctx, start.x, start.y);
+        }
+    } break;
+
+    default:
+        break;
+    }
+}
+
+static void stroke_push(stroke_ctx_t* ctx, float x, float y)
+{
+    if (ctx->count > 0) {
+        const stroke_point_t* last = &ctx->points[ctx->count - 1];
+        if (MATH_FABSF(last->x - x) < STROKE_POINT_EPSILON && MATH_FABSF(last->y - y) < STROKE_POINT_EPSILON) {
+            return;
+        }
+    }
+
+    if (ctx->count == ctx->capacity) {
+        ctx->capacity = MATH_MAX(ctx->capacity * 2, STROKE_POINT_COUNT_MIN);
+        ctx->points = realloc(ctx->points, ctx->capacity * sizeof(stroke_point_t));
+        GPU_ASSERT_NULL(ctx->points);
+    }
+
+    ctx->points[ctx->count].x = x;
+    ctx->points[ctx->count].y = y;
+    ctx->count++;
+}
+
+static void stroke_flush(stroke_ctx_t* ctx, bool closed)
+{
+    uint32_t n = ctx->count;
+    bool has_segment = ctx->has_segment;
+    ctx->count = 0;
+    ctx->has_segment = false;
+
+    if (n == 0 || !has_segment) {
+        return;
+    }
+
+    /* The closing segment is implicit */
+    if (closed && n > 1) {
+        const stroke_point_t* first = &ctx->points[0];
+        const stroke_point_t* last = &ctx->points[n - 1];
+        if (MATH_FABSF(last->x - first->x) < STROKE_POINT_EPSILON && MATH_FABSF(last->y - first->y) < STROKE_POINT_EPSILON) {
+            n--;
+        }
+    }
+
+    if (n == 1) {
+        stroke_dot(ctx, ctx->points[0]);
+        return;
+    }
+
+    if (closed && n >= 3) {
+        /* Two loops of opposite direction, the inner one cancels out under non-zero */
+        stroke_side(ctx, n, false, true);
+        vg_lite_test_path_close(ctx->dest);
+        stroke_side(ctx, n, true, true);
+        vg_lite_test_path_close(ctx->dest);
+        return;
+    }
+
+    stroke_side(ctx, n, false, false);
+    stroke_cap(ctx, stroke_get(ctx, n, n - 1, false), stroke_dir(ctx, n, n - 2, false));
+    stroke_side(ctx, n, true, false);
+    stroke_cap(ctx, stroke_get(ctx, n, n - 1, true), stroke_dir(ctx, n, n - 2, true));
+    vg_lite_test_path_close(ctx->dest);
+}
+
+static void stroke_side(stroke_ctx_t* ctx, uint32_t n, bool reverse, bool closed)
+{
+    const uint32_t seg_count = closed ? n : n - 1;
+    stroke_point_t p0 = stroke_get(ctx, n, 0, reverse);
+    stroke_point_t d = stroke_dir(ctx, n, 0, reverse);
+    stroke_point_t normal = STROKE_NORMAL(ctx, d);
+
+    /* An open outline continues from the cap */
+    if (closed || !reverse) {
+        stroke_move_to(ctx, p0.x + normal.x, p0.y + normal.y);
+    } else {
+        stroke_line_to(ctx, p0.x + normal.x, p0.y + normal.y);
+    }
+
+    for (uint32_t i = 1; i < seg_count; i++) {
+        stroke_point_t next_d = stroke_dir(ctx, n, i, reverse);
+        stroke_join(ctx, stroke_get(ctx, n, i, reverse), d, next_d);
+        d = next_d;
+    }
+
+    if (closed) {
+        stroke_join(ctx, p0, d, stroke_dir(ctx, n, 0, reverse));
+    } else {
+        stroke_point_t p = stroke_get(ctx, n, n - 1, reverse);
+        normal = STROKE_NORMAL(ctx, d);
+        stroke_line_to(ctx, p.x + normal.x, p.y + normal.y);
+    }
+}
+
+static void stroke_join(stroke_ctx_t* ctx, stroke_point_t p, stroke_point_t d0, stroke_point_t d1)
+{
+    const stroke_point_t n0 = STROKE_NORMAL(ctx, d0);
+    const stroke_point_t n1 = STROKE_NORMAL(ctx, d1);
+    const float cross = d0.x * d1.y - d0.y * d1.x;
+    const float dot = d0.x * d1.x + d0.y * d1.y;
+
+    stroke_line_to(ctx, p.x + n0.x, p.y + n0.y);
+
+    if (MATH_FABSF(cross) < STROKE_POINT_EPSILON && dot > 0) {
+        return;
+    }
+
+    /* Turning towards the normal, this side is the inner one: pivot around the vertex */
+    if (cross > 0) {
+        stroke_line_to(ctx, p.x, p.y);
+        stroke_line_to(ctx, p.x + n1.x, p.y + n1.y);
+        return;
+    }
+
+    switch (ctx->style->join) {
+    case VG_LITE_JOIN_ROUND: {
+        /* A flattened curve turns a little at every vertex, a bevel is close enough there */
+        float sweep = atan2f(cross, dot);
+        if (ctx->half_width * (1 - MATH_COSF(sweep / 2)) <= ctx->tolerance) {
+            stroke_line_to(ctx, p.x + n1.x, p.y + n1.y);
+            break;
+        }
+
+        float start = MATH_DEGREES(atan2f(n0.y, n0.x));
+        vg_lite_test_path_append_arc(ctx->dest, p.x, p.y, ctx->half_width, start, MATH_DEGREES(sweep), false);
+        ctx->last.x = p.x + n1.x;
+        ctx->last.y = p.y + n1.y;
+    } break;
+
+    case VG_LITE_JOIN_MITER: {
+        /* The miter length over the width is 1 / cos(turn / 2) */
+        float cos_half = MATH_SQRTF((1 + dot) / 2);
+        if (cos_half * ctx->style->miter_limit >= 1) {
+            float k = 1 / (1 + dot);
+            stroke_line_to(ctx, p.x + (n0.x + n1.x) * k, p.y + (n0.y + n1.y) * k);
+        }
+
+        stroke_line_to(ctx, p.x + n1.x, p.y + n1.y);
+    } break;
+
+    default:
+        stroke_line_to(ctx, p.x + n1.x, p.y + n1.y);
+        break;
+    }
+}
+
+static void stroke_cap(stroke_ctx_t* ctx, stroke_point_t p, stroke_point_t d)
+{
+    const stroke_point_t normal = STROKE_NORMAL(ctx, d);
+
+    switch (ctx->style->cap) {
+    case VG_LITE_CAP_ROUND:
+        /* From +normal to -normal through the direction */
+        vg_lite_test_path_append_arc(ctx->dest, p.x, p.y, ctx->half_width,
+            MATH_DEGREES(atan2f(normal.y, normal.x)), -180.0f, false);
+        ctx->last.x = p.x - normal.x;
+        ctx->last.y = p.y - normal.y;
+        break;
+
+    case VG_LITE_CAP_SQUARE: {
+        const float ex = d.x * ctx->half_width;
+        const float ey = d.y * ctx->half_width;
+        stroke_line_to(ctx, p.x + normal.x + ex, p.y + normal.y + ey);
+        stroke_line_to(ctx, p.x - normal.x + ex, p.y - normal.y + ey);
+    } break;
+
+    default:
+        break;
+    }
+}
+
+static void stroke_dot(stroke_ctx_t* ctx, stroke_point_t p)
+{
+    const float hw = ctx->half_width;
+
+    switch (ctx->style->cap) {
+    case VG_LITE_CAP_ROUND:
+        vg_lite_test_path_append_circle(ctx->dest, p.x, p.y, hw, hw);
+        break;
+
+    case VG_LITE_CAP_SQUARE:
+        vg_lite_test_path_append_rect(ctx->dest, p.x - hw, p.y - hw, hw * 2, hw * 2, 0);
+        break;
+
+    default:
+        break;
+    }
+}
+
+static stroke_point_t stroke_get(const stroke_ctx_t* ctx, uint32_t n, uint32_t i, bool reverse)
+{
+    return ctx->points[reverse ? n - 1 - i : i];
+}
+
+static stroke_point_t stroke_dir(const stroke_ctx_t* ctx, uint32_t n, uint32_t i, bool reverse)
+{
+    stroke_point_t a = stroke_get(ctx, n, i, reverse);
+    stroke_point_t b = stroke_get(ctx, n, (i + 1) % n, reverse);
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    float len = MATH_SQRTF(dx * dx + dy * dy);
+    return (stroke_point_t) { dx / len, dy / len };
+}
+
+static void stroke_move_to(stroke_ctx_t* ctx, float x, float y)
+{
+    vg_lite_test_path_move_to(ctx->dest, x, y);
+    ctx->last.x = x;
+    ctx->last.y = y;
+}
+
+static void stroke_line_to(stroke_ctx_t* ctx, float x, float y)
+{
+    if (MATH_FABSF(ctx->last.x - x) < STROKE_POINT_EPSILON && MATH_FABSF(ctx->last.y - y) < STROKE_POINT_EPSILON) {
+        return;
+    }
+
+    vg_lite_test_path_line_to(ctx->dest, x, y);
+    ctx->last.x = x;
+    ctx->last.y = y;
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VG_LITE_TEST_STROKE_H
+#define VG_LITE_TEST_STROKE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_flatten.h"
+#include "vg_lite_test_path.h"
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    float width;
+    vg_lite_cap_style_t cap;
+    vg_lite_join_style_t join;
+    float miter_limit;
+} vg_lite_test_stroke_style_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Convert the stroke of a path into a fill path.
+ * @param dest The path to append the outline to, it must be drawn with VG_LITE_FILL_NON_ZERO.
+ * @param src The path to stroke, in any data format.
+ * @param style The stroke width, cap, join and miter limit.
+ * @param tolerance The flattening tolerance of the source curves, in path units.
+ * @param stats The flattening statistics of the source to accumulate into, can be NULL.
+ * @return True on success, false if the source contains an unknown op code.
+ * @note Curves are flattened before offsetting, round joins and caps are built with
+ *       vg_lite_test_path_append_arc. The caller ends the destination path.
+ */
+bool vg_lite_test_stroke_path(
+    vg_lite_test_path_t* dest,
+    const vg_lite_path_t* src,
+    const vg_lite_test_stroke_style_t* style,
+    float tolerance,
+    vg_lite_test_flatten_stats_t* stats);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*VG_LITE_TEST_STROKE_H*/
@@ -0,0 +1,846 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_svg.h"
+#include "../gpu_assert.h"
+#include "../gpu_math.h"
+#include "vg_lite_test_utils.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define SVG_GROUP_DEPTH_MAX 16
+#define SVG_ITEM_COUNT_MIN 8
+#define SVG_COLOR_BLACK 0xFF000000
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    const char* cur;
+    const char* end;
+} svg_reader_t;
+
+typedef struct {
+    vg_lite_matrix_t matrix;
+    uint32_t color;
+    bool fill_none;
+    vg_lite_fill_t fill_rule;
+} svg_style_t;
+
+typedef struct {
+    vg_lite_test_path_t* path;
+    uint32_t color;
+    vg_lite_fill_t fill_rule;
+} svg_item_t;
+
+struct vg_lite_test_svg_s {
+    svg_item_t* items;
+    uint32_t count;
+    uint32_t capacity;
+    float view_box[4];
+    size_t text_size;
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void svg_skip_separators(svg_reader_t* reader);
+static bool svg_read_number(svg_reader_t* reader, float* value);
+static bool svg_read_flag(svg_reader_t* reader, bool* flag);
+static float svg_vector_angle(float ux, float uy, float vx, float vy);
+static void svg_arc_to(vg_lite_test_path_t* path,
+    float x0, float y0, float rx, float ry, float angle,
+    bool large_arc, bool sweep, float x, float y);
+static bool svg_find_attr(const char* tag, const char* tag_end, const char* name, const char** value, size_t* value_len);
+static bool svg_find_style(const char* style, size_t style_len, const char* name, const char** value, size_t* value_len);
+static void svg_apply_fill(svg_style_t* style, const char* value, size_t value_len);
+static void svg_apply_fill_rule(svg_style_t* style, const char* value, size_t value_len);
+static void svg_parse_style(svg_style_t* style, const char* tag, const char* tag_end);
+static void svg_parse_transform(vg_lite_matrix_t* matrix, const char* text, size_t len);
+static bool svg_parse_color(const char* text, size_t len, uint32_t* color);
+static void svg_add_item(struct vg_lite_test_svg_s* svg, const svg_style_t* style, const char* d, size_t d_len);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define SVG_IS_SPACE(c) ((c) == ' ' || (c) == '\t' || (c) == '\n' || (c) == '\r')
+#define SVG_IS_DIGIT(c) ((c) >= '0' && (c) <= '9')
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool vg_lite_test_svg_parse_path_data(vg_lite_test_path_t* path, const char* data, size_t len)
+{
+    GPU_ASSERT_NULL(path);
+    GPU_ASSERT_NULL(data);
+
+    svg_reader_t reader = { data, data + len };
+    char cmd = 0;
+    char last_cmd = 0;
+    float cur_x = 0, cur_y = 0;
+    float start_x = 0, start_y = 0;
+    float ctrl_x = 0, ctrl_y = 0;
+
+    while (true) {
+        svg_skip_separators(&reader);
+        if (reader.cur >= reader.end) {
+            break;
+        }
+
+        char c = *reader.cur;
+        if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')) {
+            cmd = c;
+            reader.cur++;
+        } else if (!cmd) {
+            /* At the start, or a number after Z */
+            GPU_LOG_ERROR("Expected a path command");
+            return false;
+        }
+
+        /* Relative commands are offset by the current point */
+        const bool rel = cmd >= 'a';
+        const float ox = rel ? cur_x : 0;
+        const float oy = rel ? cur_y : 0;
+        const char upper = rel ? cmd - ('a' - 'A') : cmd;
+        float v[7];
+
+#define SVG_READ_ARGS(N)                                  \
+    for (int i = 0; i < (N); i++) {                       \
+        if (!svg_read_number(&reader, &v[i])) {           \
+            GPU_LOG_ERROR("Bad arguments of '%c'", cmd); \
+            return false;                                 \
+        }                                                 \
+    }
+
+        switch (upper) {
+        case 'Z':
+            vg_lite_test_path_close(path);
+            cur_x = start_x;
+            cur_y = start_y;
+
+            /* Z takes no arguments, the next one has to be a command */
+            cmd = 0;
+            break;
+        case 'M':
+            SVG_READ_ARGS(2);
+            cur_x = start_x = ox + v[0];
+            cur_y = start_y = oy + v[1];
+            vg_lite_test_path_move_to(path, cur_x, cur_y);
+
+            /* Further pairs are implicit line-tos */
+            cmd = rel ? 'l' : 'L';
+            break;
+        case 'L':
+            SVG_READ_ARGS(2);
+            cur_x = ox + v[0];
+            cur_y = oy + v[1];
+            vg_lite_test_path_line_to(path, cur_x, cur_y);
+            break;
+        case 'H':
+            SVG_READ_ARGS(1);
+            cur_x = ox + v[0];
+            vg_lite_test_path_line_to(path, cur_x, cur_y);
+            break;
+        case 'V':
+            SVG_READ_ARGS(1);
+            cur_y = oy + v[0];
+            vg_lite_test_path_line_to(path, cur_x, cur_y);
+            break;
+        case 'C':
+            SVG_READ_ARGS(6);
+            ctrl_x = ox + v[2];
+            ctrl_y = oy + v[3];
+            vg_lite_test_path_cubic_to(path, ox + v[0], oy + v[1], ctrl_x, ctrl_y, ox + v[4], oy + v[5]);
+            cur_x = ox + v[4];
+            cur_y = oy + v[5];
+            break;
+        case 'S': {
+            SVG_READ_ARGS(4);
+            /* Reflect the previous control point */
+            bool smooth = last_cmd == 'C' || last_cmd == 'S';
+            float x1 = smooth ? 2 * cur_x - ctrl_x : cur_x;
+            float y1 = smooth ? 2 * cur_y - ctrl_y : cur_y;
+            ctrl_x = ox + v[0];
+            ctrl_y = oy + v[1];
+            vg_lite_test_path_cubic_to(path, x1, y1, ctrl_x, ctrl_y, ox + v[2], oy + v[3]);
+            cur_x = ox + v[2];
+            cur_y = oy + v[3];
+        } break;
+        case 'Q':
+            SVG_READ_ARGS(4);
+            ctrl_x = ox + v[0];
+            ctrl_y = oy + v[1];
+            vg_lite_test_path_quad_to(path, ctrl_x, ctrl_y, ox + v[2], oy + v[3]);
+            cur_x = ox + v[2];
+            cur_y = oy + v[3];
+            break;
+        case 'T': {
+            SVG_READ_ARGS(2);
+            bool smooth = last_cmd == 'Q' || last_cmd == 'T';
+            ctrl_x = smooth ? 2 * cur_x - ctrl_x : cur_x;
+            ctrl_y = smooth ? 2 * cur_y - ctrl_y : cur_y;
+            vg_lite_test_path_quad_to(path, ctrl_x, ctrl_y, ox + v[0], oy + v[1]);
+            cur_x = ox + v[0];
+            cur_y = oy + v[1];
+        } break;
+        case 'A': {
+            bool large_arc;
+            bool sweep;
+            if (!svg_read_number(&reader, &v[0]) || !svg_read_number(&reader, &v[1])
+                || !svg_read_number(&reader, &v[2]) || !svg_read_flag(&reader, &large_arc)
+                || !svg_read_flag(&reader, &sweep) || !svg_read_number(&reader, &v[3])
+                || !svg_read_number(&reader, &v[4])) {
+                GPU_LOG_ERROR("Bad arguments of '%c'", cmd);
+                return false;
+            }
+
+            float x = ox + v[3];
+            float y = oy + v[4];
+            svg_arc_to(path, cur_x, cur_y, v[0], v[1], v[2], large_arc, sweep, x, y);
+            cur_x = x;
+            cur_y = y;
+        } break;
+        default:
+            GPU_LOG_ERROR("Unsupported path command '%c'", cmd);
+            return false;
+        }
+
+#undef SVG_READ_ARGS
+
+        last_cmd = upper;
+    }
+
+    return true;
+}
+
+struct vg_lite_test_svg_s* vg_lite_test_svg_parse(const char* text, size_t len)
+{
+    GPU_ASSERT_NULL(text);
+
+    struct vg_lite_test_svg_s* svg = calloc(1, sizeof(struct vg_lite_test_svg_s));
+    GPU_ASSERT_NULL(svg);
+    svg->text_size = len;
+
+    svg_style_t stack[SVG_GROUP_DEPTH_MAX];
+    int depth = 0;
+    vg_lite_identity(&stack[0].matrix);
+    stack[0].color = SVG_COLOR_BLACK;
+    stack[0].fill_none = false;
+    stack[0].fill_rule = VG_LITE_FILL_NON_ZERO;
+
+    const char* cur = text;
+    const char* end = text + len;
+
+    while (cur < end) {
+        const char* tag = memchr(cur, '<', end - cur);
+        if (!tag) {
+            break;
+        }
+
+        const char* tag_end = memchr(tag, '>', end - tag);
+        if (!tag_end) {
+            GPU_LOG_ERROR("Unterminated tag");
+            break;
+        }
+
+        cur = tag_end + 1;
+        tag++;
+        const bool self_closing = tag_end[-1] == '/';
+        const size_t tag_len = tag_end - tag;
+
+#define SVG_TAG_IS(NAME) (tag_len >= sizeof(NAME) - 1 \
+    && memcmp(tag, NAME, sizeof(NAME) - 1) == 0       \
+    && (tag + sizeof(NAME) - 1 == tag_end || SVG_IS_SPACE(tag[sizeof(NAME) - 1]) || tag[sizeof(NAME) - 1] == '/'))
+
+        if (SVG_TAG_IS("svg")) {
+            const char* value;
+            size_t value_len;
+            if (svg_find_attr(tag, tag_end, "viewBox", &value, &value_len)) {
+                svg_reader_t reader = { value, value + value_len };
+                for (int i = 0; i < 4; i++) {
+                    svg_read_number(&reader, &svg->view_box[i]);
+                }
+            } else {
+                svg_reader_t reader;
+                if (svg_find_attr(tag, tag_end, "width", &reader.cur, &value_len)) {
+                    reader.end = reader.cur + value_len;
+                    svg_read_number(&reader, &svg->view_box[2]);
+                }
+
+                if (svg_find_attr(tag, tag_end, "height", &reader.cur, &value_len)) {
+                    reader.end = reader.cur + value_len;
+                    svg_read_number(&reader, &svg->view_box[3]);
+                }
+            }
+        } else if (SVG_TAG_IS("g")) {
+            if (!self_closing) {
+                if (depth + 1 >= SVG_GROUP_DEPTH_MAX) {
+                    GPU_LOG_ERROR("Groups nested deeper than %d", SVG_GROUP_DEPTH_MAX);
+                    vg_lite_test_svg_destroy(svg);
+                    return NULL;
+                }
+
+                stack[depth + 1] = stack[depth];
+                depth++;
+                svg_parse_style(&stack[depth], tag, tag_end);
+            }
+        } else if (SVG_TAG_IS("/g")) {
+            if (depth > 0) {
+                depth--;
+            }
+        } else if (SVG_TAG_IS("path")) {
+            const char* d;
+            size_t d_len;
+            if (svg_find_attr(tag, tag_end, "d", &d, &d_len)) {
+                svg_style_t style = stack[depth];
+                svg_parse_style(&style, tag, tag_end);
+                if (!style.fill_none) {
+                    svg_add_item(svg, &style, d, d_len);
+                }
+            }
+        }
+
+#undef SVG_TAG_IS
+    }
+
+    return svg;
+}
+
+struct vg_lite_test_svg_s* vg_lite_test_svg_load(const char* path)
+{
+    GPU_ASSERT_NULL(path);
+
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+        GPU_LOG_ERROR("open %s failed: %d", path, errno);
+        return NULL;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    if (size <= 0) {
+        GPU_LOG_ERROR("%s is empty", path);
+        fclose(fp);
+        return NULL;
+    }
+
+    char* text = malloc(size);
+    GPU_ASSERT_NULL(text);
+
+    struct vg_lite_test_svg_s* svg = NULL;
+    if (fread(text, 1, size, fp) == (size_t)size) {
+        svg = vg_lite_test_svg_parse(text, size);
+    } else {
+        GPU_LOG_ERROR("read %s failed: %d", path, errno);
+    }
+
+    free(text);
+    fclose(fp);
+    return svg;
+}
+
+void vg_lite_test_svg_destroy(struct vg_lite_test_svg_s* svg)
+{
+    GPU_ASSERT_NULL(svg);
+
+    for (uint32_t i = 0; i < svg->count; i++) {
+        vg_lite_test_path_destroy(svg->items[i].path);
+    }
+
+    free(svg->items);
+    free(svg);
+}
+
+uint32_t vg_lite_test_svg_get_count(const struct vg_lite_test_svg_s* svg)
+{
+    GPU_ASSERT_NULL(svg);
+    return svg->count;
+}
+
+vg_lite_test_path_t* vg_lite_test_svg_get_path(
+    struct vg_lite_test_svg_s* svg,
+    uint32_t index,
+    uint32_t* color,
+    vg_lite_fill_t* fill_rule)
+{
+    GPU_ASSERT_NULL(svg);
+    GPU_ASSERT(index < svg->count);
+
+    svg_item_t* item = &svg->items[index];
+    if (color) {
+        *color = item->color;
+    }
+
+    if (fill_rule) {
+        *fill_rule = item->fill_rule;
+    }
+
+    return item->path;
+}
+
+void vg_lite_test_svg_get_view_box(const struct vg_lite_test_svg_s* svg, float view_box[4])
+{
+    GPU_ASSERT_NULL(svg);
+    GPU_ASSERT_NULL(view_box);
+    memcpy(view_box, svg->view_box, sizeof(svg->view_box));
+}
+
+size_t vg_lite_test_svg_get_text_size(const struct vg_lite_test_svg_s* svg)
+{
+    GPU_ASSERT_NULL(svg);
+    return svg->text_size;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void svg_skip_separators(svg_reader_t* reader)
+{
+    while (reader->cur < reader->end && (SVG_IS_SPACE(*reader->cur) || *reader->cur == ',')) {
+        reader->cur++;
+    }
+}
+
+static bool svg_read_number(svg_reader_t* reader, float* value)
+{
+    svg_skip_separators(reader);
+
+    const char* p = reader->cur;
+    const char* end = reader->end;
+    float sign = 1;
+
+    if (p < end && (*p == '-' || *p == '+')) {
+        sign = *p == '-' ? -1 : 1;
+        p++;
+    }
+
+    /* Digits are accumulated by hand, strtof is locale dependent and slow */
+    double number = 0;
+    bool has_digits = false;
+    while (p < end && SVG_IS_DIGIT(*p)) {
+        number = number * 10 + (*p - '0');
+        has_digits = true;
+        p++;
+    }
+
+    if (p < end && *p == '.') {
+        p++;
+        double scale = 0.1;
+        while (p < end && SVG_IS_DIGIT(*p)) {
+            number += (*p - '0') * scale;
+            scale *= 0.1;
+            has_digits = true;
+            p++;
+        }
+    }
+
+    if (!has_digits) {
+        return false;
+    }
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char* exp_start = p++;
+        int exp_sign = 1;
+        if (p < end && (*p == '-' || *p == '+')) {
+            exp_sign = *p == '-' ? -1 : 1;
+            p++;
+        }
+
+        if (p < end && SVG_IS_DIGIT(*p)) {
+            int exponent = 0;
+            while (p < end && SVG_IS_DIGIT(*p)) {
+                exponent = exponent * 10 + (*p - '0');
+                p++;
+            }
+
+            number *= pow(10, exp_sign * exponent);
+        } else {
+            /* Not an exponent, e.g. the start of "em" */
+            p = exp_start;
+        }
+    }
+
+    *value = sign * (float)number;
+    reader->cur = p;
+    return true;
+}
+
+static bool svg_read_flag(svg_reader_t* reader, bool* flag)
+{
+    /* Flags may be packed without separators, e.g. "a1 1 0 11 2 2" */
+    svg_skip_separators(reader);
+    if (reader->cur >= reader->end || (*reader->cur != '0' && *reader->cur != '1')) {
+        return false;
+    }
+
+    *flag = *reader->cur == '1';
+    reader->cur++;
+    return true;
+}
+
+static float svg_vector_angle(float ux, float uy, float vx, float vy)
+{
+    return atan2f(ux * vy - uy * vx, ux * vx + uy * vy);
+}
+
+static void svg_arc_to(vg_lite_test_path_t* path,
+    float x0, float y0, float rx, float ry, float angle,
+    bool large_arc, bool sweep, float x, float y)
+{
+    /* Endpoint to center parameterization, SVG 1.1 appendix F.6.5 */
+    if (math_zero(rx) || math_zero(ry)) {
+        vg_lite_test_path_line_to(path, x, y);
+        return;
+    }
+
+    if (math_equal(x0, x) && math_equal(y0, y)) {
+        return;
+    }
+
+    rx = MATH_FABSF(rx);
+    ry = MATH_FABSF(ry);
+
+    const float phi = MATH_RADIANS(angle);
+    const float cos_phi = MATH_COSF(phi);
+    const float sin_phi = MATH_SINF(phi);
+    const float dx = (x0 - x) / 2;
+    const float dy = (y0 - y) / 2;
+    const float x1p = cos_phi * dx + sin_phi * dy;
+    const float y1p = -sin_phi * dx + cos_phi * dy;
+
+    /* Scale up radii that can't reach the end point */
+    float lambda = (x1p * x1p) / (rx * rx) + (y1p * y1p) / (ry * ry);
+    if (lambda > 1) {
+        rx *= MATH_SQRTF(lambda);
+        ry *= MATH_SQRTF(lambda);
+    }
+
+    float num = rx * rx * ry * ry - rx * rx * y1p * y1p - ry * ry * x1p * x1p;
+    float den = rx * rx * y1p * y1p + ry * ry * x1p * x1p;
+    float coef = den > 0 ? MATH_SQRTF(MATH_MAX(num / den, 0)) : 0;
+    if (large_arc == sweep) {
+        coef = -coef;
+    }
+
+    const float cxp = coef * rx * y1p / ry;
+    const float cyp = -coef * ry * x1p / rx;
+    const float cx = cos_phi * cxp - sin_phi * cyp + (x0 + x) / 2;
+    const float cy = sin_phi * cxp + cos_phi * cyp + (y0 + y) / 2;
+
+    const float ux = (x1p - cxp) / rx;
+    const float uy = (y1p - cyp) / ry;
+    const float vx = (-x1p - cxp) / rx;
+    const float vy = (-y1p - cyp) / ry;
+
+    float theta = svg_vector_angle(1, 0, ux, uy);
+    float delta = svg_vector_angle(ux, uy, vx, vy);
+    if (!sweep && delta > 0) {
+        delta -= 2 * MATH_PI;
+    } else if (sweep && delta < 0) {
+        delta += 2 * MATH_PI;
+    }
+
+    vg_lite_test_path_append_elliptical_arc(path, cx, cy, rx, ry, angle,
+        MATH_DEGREES(theta), MATH_DEGREES(delta));
+}
+
+static bool svg_find_attr(const char* tag, const char* tag_end, const char* name, const char** value, size_t* value_len)
+{
+    const size_t name_len = strlen(name);
+    const char* p = tag;
+
+    while (p + name_len + 2 < tag_end) {
+        /* Attribute names follow a space and are followed by '=' */
+        if (SVG_IS_SPACE(p[0]) && memcmp(p + 1, name, name_len) == 0) {
+            const char* q = p + 1 + name_len;
+            while (q < tag_end && SVG_IS_SPACE(*q)) {
+                q++;
+            }
+
+            if (q < tag_end && *q == '=') {
+                q++;
+                while (q < tag_end && SVG_IS_SPACE(*q)) {
+                    q++;
+                }
+
+                if (q < tag_end && (*q == '"' || *q == '\'')) {
+                    const char* close = memchr(q + 1, *q, tag_end - q - 1);
+                    if (close) {
+                        *value = q + 1;
+                        *value_len = close - q - 1;
+                        return true;
+                    }
+                }
+            }
+        }
+
+        p++;
+    }
+
+    return false;
+}
+
+static bool svg_find_style(const char* style, size_t style_len, const char* name, const char** value, size_t* value_len)
+{
+    const size_t name_len = strlen(name);
+    const char* p = style;
+    const char* end = style + style_len;
+
+    while (p < end) {
+        const char* decl_end = memchr(p, ';', end - p);
+        if (!decl_end) {
+            decl_end = end;
+        }
+
+        while (p < decl_end && SVG_IS_SPACE(*p)) {
+            p++;
+        }
+
+        const char* colon = memchr(p, ':', decl_end - p);
+        if (colon) {
+            const char* name_end = colon;
+            while (name_end > p && SVG_IS_SPACE(name_end[-1])) {
+                name_end--;
+            }
+
+            if ((size_t)(name_end - p) == name_len && memcmp(p, name, name_len) == 0) {
+                const char* v = colon + 1;
+                while (v < decl_end && SVG_IS_SPACE(*v)) {
+                    v++;
+                }
+
+                *value = v;
+                *value_len = decl_end - v;
+                return true;
+            }
+        }
+
+        p = decl_end + 1;
+    }
+
+    return false;
+}
+
+static void svg_apply_fill(svg_style_t* style, const char* value, size_t value_len)
+{
+    if (value_len == 4 && memcmp(value, "none", 4) == 0) {
+        style->fill_none = true;
+        return;
+    }
+
+    style->fill_none = false;
+    if (!svg_parse_color(value, value_len, &style->color)) {
+        style->color = SVG_COLOR_BLACK;
+    }
+}
+
+static void svg_apply_fill_rule(svg_style_t* style, const char* value, size_t value_len)
+{
+    style->fill_rule = (value_len >= 7 && memcmp(value, "evenodd", 7) == 0)
+        ? VG_LITE_FILL_EVEN_ODD
+        : VG_LITE_FILL_NON_ZERO;
+}
+
+static void svg_parse_style(svg_style_t* style, const char* tag, const char* tag_end)
+{
+    const char* value;
+    size_t value_len;
+
+    if (svg_find_attr(tag, tag_end, "transform", &value, &value_len)) {
+        vg_lite_matrix_t matrix;
+        svg_parse_transform(&matrix, value, value_len);
+        vg_lite_test_matrix_multiply(&style->matrix, &matrix);
+    }
+
+    if (svg_find_attr(tag, tag_end, "fill", &value, &value_len)) {
+        svg_apply_fill(style, value, value_len);
+    }
+
+    if (svg_find_attr(tag, tag_end, "fill-rule", &value, &value_len)) {
+        svg_apply_fill_rule(style, value, value_len);
+    }
+
+    /* Style declarations override the presentation attributes */
+    const char* css;
+    size_t css_len;
+    if (svg_find_attr(tag, tag_end, "style", &css, &css_len)) {
+        if (svg_find_style(css, css_len, "fill", &value, &value_len)) {
+            svg_apply_fill(style, value, value_len);
+        }
+
+        if (svg_find_style(css, css_len, "fill-rule", &value, &value_len)) {
+            svg_apply_fill_rule(style, value, value_len);
+        }
+    }
+}
+
+static void svg_parse_transform(vg_lite_matrix_t* matrix, const char* text, size_t len)
+{
+    vg_lite_identity(matrix);
+
+    const char* p = text;
+    const char* end = text + len;
+
+    while (p < end) {
+        const char* open = memchr(p, '(', end - p);
+        if (!open) {
+            break;
+        }
+
+        const char* close = memchr(open, ')', end - open);
+        if (!close) {
+            break;
+        }
+
+        while (p < open && (SVG_IS_SPACE(*p) || *p == ',')) {
+            p++;
+        }
+
+        float v[6] = { 0 };
+        int count = 0;
+        svg_reader_t reader = { open + 1, close };
+        while (count < 6 && svg_read_number(&reader, &v[count])) {
+            count++;
+        }
+
+        const size_t name_len = open - p;
+        vg_lite_matrix_t m;
+        vg_lite_identity(&m);
+
+#define SVG_NAME_IS(NAME) (name_len >= sizeof(NAME) - 1 && memcmp(p, NAME, sizeof(NAME) - 1) == 0)
+
+        if (SVG_NAME_IS("matrix") && count == 6) {
+            m.m[0][0] = v[0];
+            m.m[1][0] = v[1];
+            m.m[0][1] = v[2];
+            m.m[1][1] = v[3];
+            m.m[0][2] = v[4];
+            m.m[1][2] = v[5];
+        } else if (SVG_NAME_IS("translate") && count >= 1) {
+            vg_lite_translate(v[0], count > 1 ? v[1] : 0, &m);
+        } else if (SVG_NAME_IS("scale") && count >= 1) {
+            vg_lite_scale(v[0], count > 1 ? v[1] : v[0], &m);
+        } else if (SVG_NAME_IS("rotate") && count >= 1) {
+            if (count == 3) {
+                vg_lite_translate(v[1], v[2], &m);
+            }
+
+            vg_lite_rotate(v[0], &m);
+
+            if (count == 3) {
+                vg_lite_translate(-v[1], -v[2], &m);
+            }
+        } else {
+            GPU_LOG_WARN("Unsupported transform: %.*s", (int)(close - p + 1), p);
+        }
+
+#undef SVG_NAME_IS
+
+        vg_lite_test_matrix_multiply(matrix, &m);
+        p = close + 1;
+    }
+}
+
+static bool svg_parse_color(const char* text, size_t len, uint32_t* color)
+{
+    if (len == 0 || text[0] != '#') {
+        if (len == 5 && memcmp(text, "white", 5) == 0) {
+            *color = 0xFFFFFFFF;
+            return true;
+        }
+
+        return false;
+    }
+
+    uint32_t rgb = 0;
+    for (size_t i = 1; i < len; i++) {
+        char c = text[i];
+        uint32_t nibble;
+        if (SVG_IS_DIGIT(c)) {
+            nibble = c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            nibble = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            nibble = c - 'A' + 10;
+        } else {
+            return false;
+        }
+
+        rgb = (rgb << 4) | nibble;
+    }
+
+    if (len == 4) {
+        /* #rgb */
+        uint32_t r = (rgb >> 8) & 0xF;
+        uint32_t g = (rgb >> 4) & 0xF;
+        uint32_t b = rgb & 0xF;
+        rgb = (r * 0x11) << 16 | (g * 0x11) << 8 | (b * 0x11);
+    } else if (len != 7) {
+        return false;
+    }
+
+    /* vg_lite_draw takes ABGR8888 */
+    *color = 0xFF000000 | (rgb & 0xFF) << 16 | (rgb & 0xFF00) | (rgb >> 16 & 0xFF);
+    return true;
+}
+
+static void svg_add_item(struct vg_lite_test_svg_s* svg, const svg_style_t* style, const char* d, size_t d_len)
+{
+    if (svg->count == svg->capacity) {
+        svg->capacity = MATH_MAX(svg->capacity * 2, SVG_ITEM_COUNT_MIN);
+        svg->items = realloc(svg->items, svg->capacity * sizeof(svg_item_t));
+        GPU_ASSERT_NULL(svg->items);
+    }
+
+    vg_lite_test_path_t* path = vg_lite_test_path_create(VG_LITE_FP32);
+    vg_lite_test_path_set_transform(path, &style->matrix);
+
+    /* A path with an error is drawn up to the error, as browsers do */
+    vg_lite_test_svg_parse_path_data(path, d, d_len);
+    vg_lite_test_path_end(path);
+
+    if (!vg_lite_test_path_update_bounding_box(path)) {
+        vg_lite_test_path_destroy(path);
+        return;
+    }
+
+    svg_item_t* item = &svg->items[svg->count++];
+    item->path = path;
+    item->color = style->color;
+    item->fill_rule = style->fill_rule;
+}
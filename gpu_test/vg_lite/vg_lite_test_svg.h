@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VG_LITE_TEST_SVG_H
+#define VG_LITE_TEST_SVG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_path.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct vg_lite_test_svg_s;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Parse SVG path data into a path object.
+ * @param path The path object to append to, its transform is applied to every point.
+ * @param data The path data, the value of a d attribute.
+ * @param len The length of the path data.
+ * @return True on success, false on a syntax error. The commands before the error are kept.
+ * @note M/L/H/V/C/S/Q/T/A/Z are supported in absolute and relative form, arcs become cubics.
+ */
+bool vg_lite_test_svg_parse_path_data(vg_lite_test_path_t* path, const char* data, size_t len);
+
+/**
+ * @brief Parse an SVG document.
+ * @param text The SVG document text.
+ * @param len The length of the text.
+ * @return The parsed document, NULL on error.
+ * @note Only <path> elements are drawn. fill, fill-rule and transform are taken
+ *       from the element, its style attribute and the enclosing <g> elements.
+ */
+struct vg_lite_test_svg_s* vg_lite_test_svg_parse(const char* text, size_t len);
+
+/**
+ * @brief Load and parse an SVG file.
+ * @param path The path of the file.
+ * @return The parsed document, NULL on error.
+ */
+struct vg_lite_test_svg_s* vg_lite_test_svg_load(const char* path);
+
+/**
+ * @brief Destroy a parsed document.
+ * @param svg The document to destroy.
+ */
+void vg_lite_test_svg_destroy(struct vg_lite_test_svg_s* svg);
+
+/**
+ * @brief Get the number of drawable paths of a document.
+ * @param svg The document.
+ * @return The number of paths.
+ */
+uint32_t vg_lite_test_svg_get_count(const struct vg_lite_test_svg_s* svg);
+
+/**
+ * @brief Get a drawable path of a document.
+ * @param svg The document.
+ * @param index The index of the path.
+ * @param color The fill color in the vg_lite_draw format. Can be NULL.
+ * @param fill_rule The fill rule. Can be NULL.
+ * @return The path object, its bounding box is updated.
+ */
+vg_lite_test_path_t* vg_lite_test_svg_get_path(
+    struct vg_lite_test_svg_s* svg,
+    uint32_t index,
+    uint32_t* color,
+    vg_lite_fill_t* fill_rule);
+
+/**
+ * @brief Get the view box of a document, from the viewBox or the width and height attributes.
+ * @param svg The document.
+ * @param view_box Filled with x, y, width and height.
+ */
+void vg_lite_test_svg_get_view_box(const struct vg_lite_test_svg_s* svg, float view_box[4]);
+
+/**
+ * @brief Get the size of the source text of a document.
+ * @param svg The document.
+ * @return The size in bytes.
+ */
+size_t vg_lite_test_svg_get_text_size(const struct vg_lite_test_svg_s* svg);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*VG_LITE_TEST_SVG_H*/
@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_sweep.h"
+#include "../gpu_assert.h"
+#include "../gpu_context.h"
+#include "../gpu_log.h"
+#include "../gpu_math.h"
+#include "../gpu_recorder.h"
+#include "vg_lite_test_context.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* A case is fill-bound if the per-pixel part dominates at the largest size */
+#define SWEEP_FILL_BOUND_RATIO 0.5f
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct vg_lite_test_sweep_s {
+    const struct vg_lite_test_item_s** group;
+    int group_size;
+    int size_count;
+    struct gpu_test_size_s* sizes;
+    float* samples;
+};
+
+typedef struct {
+    float overhead_ms;
+    float pixel_cost_ns;
+    float r2;
+    float fill_ratio;
+    bool valid;
+} vg_lite_test_sweep_fit_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void vg_lite_test_sweep_fit(const struct vg_lite_test_sweep_s* sweep, int case_index, vg_lite_test_sweep_fit_t* fit);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define SWEEP_SAMPLE(sweep, case_index, size_index) \
+    ((sweep)->samples[(case_index) * (sweep)->size_count + (size_index)])
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+struct vg_lite_test_sweep_s* vg_lite_test_sweep_create(
+    const struct vg_lite_test_item_s** group,
+    int group_size,
+    int size_count)
+{
+    GPU_ASSERT_NULL(group);
+    GPU_ASSERT(group_size > 0);
+    GPU_ASSERT(size_count > 0);
+
+    struct vg_lite_test_sweep_s* sweep = calloc(1, sizeof(struct vg_lite_test_sweep_s));
+    GPU_ASSERT_NULL(sweep);
+    sweep->group = group;
+    sweep->group_size = group_size;
+    sweep->size_count = size_count;
+
+    sweep->sizes = calloc(size_count, sizeof(struct gpu_test_size_s));
+    GPU_ASSERT_NULL(sweep->sizes);
+
+    sweep->samples = malloc(group_size * size_count * sizeof(float));
+    GPU_ASSERT_NULL(sweep->samples);
+
+    /* NAN marks the samples that were skipped or failed */
+    for (int i = 0; i < group_size * size_count; i++) {
+        sweep->samples[i] = NAN;
+    }
+
+    return sweep;
+}
+
+void vg_lite_test_sweep_destroy(struct vg_lite_test_sweep_s* sweep)
+{
+    GPU_ASSERT_NULL(sweep);
+    free(sweep->sizes);
+    free(sweep->samples);
+    memset(sweep, 0, sizeof(struct vg_lite_test_sweep_s));
+    free(sweep);
+}
+
+void vg_lite_test_sweep_set_size(struct vg_lite_test_sweep_s* sweep, int size_index, uint32_t width, uint32_t height)
+{
+    GPU_ASSERT_NULL(sweep);
+    GPU_ASSERT(size_index >= 0 && size_index < sweep->size_count);
+    sweep->sizes[size_index].width = width;
+    sweep->sizes[size_index].height = height;
+}
+
+void vg_lite_test_sweep_add_sample(struct vg_lite_test_sweep_s* sweep, int case_index, int size_index, float time_ms)
+{
+    GPU_ASSERT_NULL(sweep);
+    GPU_ASSERT(case_index >= 0 && case_index < sweep->group_size);
+    GPU_ASSERT(size_index >= 0 && size_index < sweep->size_count);
+    SWEEP_SAMPLE(sweep, case_index, size_index) = time_ms;
+}
+
+int vg_lite_test_sweep_write_report(struct vg_lite_test_sweep_s* sweep, const char* output_dir, const char* name)
+{
+    GPU_ASSERT_NULL(sweep);
+    GPU_ASSERT_NULL(output_dir);
+    GPU_ASSERT_NULL(name);
+
+    struct gpu_recorder_s* recorder = gpu_recorder_create(output_dir, name);
+    if (!recorder) {
+        return -1;
+    }
+
+    char buf[64];
+    gpu_recorder_write_string(recorder, "Testcase,");
+    for (int i = 0; i < sweep->size_count; i++) {
+        snprintf(buf, sizeof(buf), "%dx%d(ms),", sweep->sizes[i].width, sweep->sizes[i].height);
+        gpu_recorder_write_string(recorder, buf);
+    }
+    gpu_recorder_write_string(recorder, "Fixed Overhead(ms),Per-Pixel Cost(ns),R2,Bound\n");
+
+    for (int case_index = 0; case_index < sweep->group_size; case_index++) {
+        gpu_recorder_write_string(recorder, sweep->group[case_index]->name);
+        gpu_recorder_write_string(recorder, ",");
+
+        for (int size_index = 0; size_index < sweep->size_count; size_index++) {
+            float sample = SWEEP_SAMPLE(sweep, case_index, size_index);
+            if (isnan(sample)) {
+                gpu_recorder_write_string(recorder, "-,");
+            } else {
+                snprintf(buf, sizeof(buf), "%0.3f,", sample);
+                gpu_recorder_write_string(recorder, buf);
+            }
+        }
+
+        vg_lite_test_sweep_fit_t fit;
+        vg_lite_test_sweep_fit(sweep, case_index, &fit);
+
+        if (!fit.valid) {
+            gpu_recorder_write_string(recorder, "-,-,-,-\n");
+            continue;
+        }
+
+        char result[128];
+        snprintf(result, sizeof(result),
+            "%0.3f," /* Fixed Overhead(ms) */
+            "%0.3f," /* Per-Pixel Cost(ns) */
+            "%0.3f," /* R2 */
+            "%s\n", /* Bound */
+            fit.overhead_ms,
+            fit.pixel_cost_ns,
+            fit.r2,
+            fit.fill_ratio >= SWEEP_FILL_BOUND_RATIO ? "FILL" : "SETUP");
+        gpu_recorder_write_string(recorder, result);
+
+        GPU_LOG_INFO("Sweep %s: overhead %0.3f ms, %0.3f ns/px, R2 %0.3f, fill ratio %0.2f",
+            sweep->group[case_index]->name, fit.overhead_ms, fit.pixel_cost_ns, fit.r2, fit.fill_ratio);
+    }
+
+    gpu_recorder_delete(recorder);
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void vg_lite_test_sweep_fit(const struct vg_lite_test_sweep_s* sweep, int case_index, vg_lite_test_sweep_fit_t* fit)
+{
+    memset(fit, 0, sizeof(vg_lite_test_sweep_fit_t));
+
+    /* Least squares fit of: time = overhead + pixels * pixel_cost */
+    double sum_x = 0;
+    double sum_y = 0;
+    double sum_xx = 0;
+    double sum_xy = 0;
+    double max_x = 0;
+    int n = 0;
+
+    for (int i = 0; i < sweep->size_count; i++) {
+        float y = SWEEP_SAMPLE(sweep, case_index, i);
+        if (isnan(y)) {
+            continue;
+        }
+
+        double x = (double)sweep->sizes[i].width * sweep->sizes[i].height;
+        sum_x += x;
+        sum_y += y;
+        sum_xx += x * x;
+        sum_xy += x * y;
+        max_x = MATH_MAX(max_x, x);
+        n++;
+    }
+
+    double denom = n * sum_xx - sum_x * sum_x;
+    if (n < 2 || denom <= 0) {
+        return;
+    }
+
+    double slope = (n * sum_xy - sum_x * sum_y) / denom;
+    double intercept = (sum_y - slope * sum_x) / n;
+
+    /* Coefficient of determination */
+    double mean_y = sum_y / n;
+    double ss_tot = 0;
+    double ss_res = 0;
+    for (int i = 0; i < sweep->size_count; i++) {
+        float y = SWEEP_SAMPLE(sweep, case_index, i);
+        if (isnan(y)) {
+            continue;
+        }
+
+        double pred = intercept + slope * sweep->sizes[i].width * sweep->sizes[i].height;
+        ss_tot += (y - mean_y) * (y - mean_y);
+        ss_res += (y - pred) * (y - pred);
+    }
+
+    double fill_ms = MATH_MAX(slope, 0) * max_x;
+    double total_ms = MATH_MAX(intercept, 0) + fill_ms;
+
+    fit->overhead_ms = intercept;
+    fit->pixel_cost_ns = slope * 1e6;
+    fit->r2 = ss_tot > 0 ? 1.0 - ss_res / ss_tot : 1.0;
+    fit->fill_ratio = total_ms > 0 ? fill_ms / total_ms : 0;
+    fit->valid = true;
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VG_LITE_TEST_SWEEP_H
+#define VG_LITE_TEST_SWEEP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct vg_lite_test_item_s;
+struct vg_lite_test_sweep_s;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Create a target size sweep table
+ * @param group The test case group
+ * @param group_size The number of test cases in the group
+ * @param size_count The number of target sizes
+ * @return The sweep table
+ */
+struct vg_lite_test_sweep_s* vg_lite_test_sweep_create(
+    const struct vg_lite_test_item_s** group,
+    int group_size,
+    int size_count);
+
+/**
+ * @brief Destroy a target size sweep table
+ * @param sweep The sweep table to destroy
+ */
+void vg_lite_test_sweep_destroy(struct vg_lite_test_sweep_s* sweep);
+
+/**
+ * @brief Set the actual target size of a sweep step
+ * @param sweep The sweep table
+ * @param size_index The index of the target size
+ * @param width The width of the target
+ * @param height The height of the target
+ */
+void vg_lite_test_sweep_set_size(struct vg_lite_test_sweep_s* sweep, int size_index, uint32_t width, uint32_t height);
+
+/**
+ * @brief Add the render time of a test case at a target size
+ * @param sweep The sweep table
+ * @param case_index The index of the test case in the group
+ * @param size_index The index of the target size
+ * @param time_ms The render time (draw + finish) in milliseconds
+ */
+void vg_lite_test_sweep_add_sample(struct vg_lite_test_sweep_s* sweep, int case_index, int size_index, float time_ms);
+
+/**
+ * @brief Fit time against pixel count per test case and write the table
+ * @param sweep The sweep table
+ * @param output_dir The directory to write the report to
+ * @param name The name of the report
+ * @return 0 on success, -1 on failure
+ */
+int vg_lite_test_sweep_write_report(struct vg_lite_test_sweep_s* sweep, const char* output_dir, const char* name);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*VG_LITE_TEST_SWEEP_H*/
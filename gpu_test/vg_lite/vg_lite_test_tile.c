@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_tile.h"
+#include "../gpu_assert.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define TILE_PIXELS (VG_LITE_TEST_TILE_SIZE * VG_LITE_TEST_TILE_SIZE)
+
+/* Whole byte pixels up to 4 bytes */
+#define TILE_MAX_PIXEL_SIZE 4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/* Moves one line of a group of 4 lines between the tiled and the linear layout */
+typedef void (*tile_line_t)(uint8_t* restrict dst, const uint8_t* restrict src, int row, int tiles);
+
+typedef struct {
+    tile_line_t gather;
+    tile_line_t scatter;
+} tile_kernel_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static const tile_kernel_t* tile_get_kernel(const vg_lite_buffer_t* buffer);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/* A tile row is a copy of a constant size, 16 bytes for 32 bits pixels, which compiles to single moves */
+#define TILE_KERNEL_DEF(BYTES)                                                                               \
+    static void tile_gather_##BYTES(uint8_t* restrict dst, const uint8_t* restrict src, int row, int tiles)  \
+    {                                                                                                        \
+        src += row * VG_LITE_TEST_TILE_SIZE * (BYTES);                                                       \
+        for (int t = 0; t < tiles; t++) {                                                                    \
+            memcpy(dst + t * VG_LITE_TEST_TILE_SIZE * (BYTES), src + t * TILE_PIXELS * (BYTES),              \
+                VG_LITE_TEST_TILE_SIZE * (BYTES));                                                           \
+        }                                                                                                    \
+    }                                                                                                        \
+    static void tile_scatter_##BYTES(uint8_t* restrict dst, const uint8_t* restrict src, int row, int tiles) \
+    {                                                                                                        \
+        dst += row * VG_LITE_TEST_TILE_SIZE * (BYTES);                                                       \
+        for (int t = 0; t < tiles; t++) {                                                                    \
+            memcpy(dst + t * TILE_PIXELS * (BYTES), src + t * VG_LITE_TEST_TILE_SIZE * (BYTES),              \
+                VG_LITE_TEST_TILE_SIZE * (BYTES));                                                           \
+        }                                                                                                    \
+    }
+
+TILE_KERNEL_DEF(1)
+TILE_KERNEL_DEF(2)
+TILE_KERNEL_DEF(3)
+TILE_KERNEL_DEF(4)
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool vg_lite_test_tile_is_supported(const vg_lite_buffer_t* buffer)
+{
+    GPU_ASSERT_NULL(buffer);
+    return tile_get_kernel(buffer) != NULL;
+}
+
+void vg_lite_test_tile_read_row(void* dst, const vg_lite_buffer_t* src, int y)
+{
+    GPU_ASSERT_NULL(dst);
+    GPU_ASSERT(y >= 0 && y < src->height);
+
+    const tile_kernel_t* kernel = tile_get_kernel(src);
+    GPU_ASSERT_NULL(kernel);
+
+    const uint8_t* band = (const uint8_t*)src->memory + (size_t)(y & ~(VG_LITE_TEST_TILE_SIZE - 1)) * src->stride;
+    kernel->gather(dst, band, y & (VG_LITE_TEST_TILE_SIZE - 1), src->width / VG_LITE_TEST_TILE_SIZE);
+}
+
+void vg_lite_test_tile_write_row(vg_lite_buffer_t* dst, int y, const void* src)
+{
+    GPU_ASSERT_NULL(src);
+    GPU_ASSERT(y >= 0 && y < dst->height);
+
+    const tile_kernel_t* kernel = tile_get_kernel(dst);
+    GPU_ASSERT_NULL(kernel);
+
+    uint8_t* band = (uint8_t*)dst->memory + (size_t)(y & ~(VG_LITE_TEST_TILE_SIZE - 1)) * dst->stride;
+    kernel->scatter(band, src, y & (VG_LITE_TEST_TILE_SIZE - 1), dst->width / VG_LITE_TEST_TILE_SIZE);
+}
+
+bool vg_lite_test_tile_swizzle(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src)
+{
+    GPU_ASSERT_NULL(dst);
+    GPU_ASSERT_NULL(src);
+    GPU_ASSERT(dst->memory != src->memory);
+
+    if (dst->width != src->width || dst->height != src->height || dst->format != src->format
+        || src->tiled != VG_LITE_LINEAR || !tile_get_kernel(src)) {
+        GPU_LOG_ERROR("Unsupported swizzle: %s W%dxH%d",
+            vg_lite_test_buffer_format_string(src->format), (int)src->width, (int)src->height);
+        return false;
+    }
+
+    dst->tiled = VG_LITE_TILED;
+    for (int y = 0; y < src->height; y++) {
+        vg_lite_test_tile_write_row(dst, y, (const uint8_t*)src->memory + (size_t)y * src->stride);
+    }
+
+    return true;
+}
+
+bool vg_lite_test_tile_deswizzle(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src)
+{
+    GPU_ASSERT_NULL(dst);
+    GPU_ASSERT_NULL(src);
+    GPU_ASSERT(dst->memory != src->memory);
+
+    if (dst->width != src->width || dst->height != src->height || dst->format != src->format
+        || src->tiled != VG_LITE_TILED || !tile_get_kernel(src)) {
+        GPU_LOG_ERROR("Unsupported deswizzle: %s W%dxH%d",
+            vg_lite_test_buffer_format_string(src->format), (int)src->width, (int)src->height);
+        return false;
+    }
+
+    dst->tiled = VG_LITE_LINEAR;
+    for (int y = 0; y < src->height; y++) {
+        vg_lite_test_tile_read_row((uint8_t*)dst->memory + (size_t)y * dst->stride, src, y);
+    }
+
+    return true;
+}
+
+bool vg_lite_test_tile_set_layout(vg_lite_buffer_t* buffer, vg_lite_buffer_layout_t layout)
+{
+    GPU_ASSERT_NULL(buffer);
+
+    if (buffer->tiled == layout) {
+        return true;
+    }
+
+    const tile_kernel_t* kernel = tile_get_kernel(buffer);
+    if (!kernel) {
+        GPU_LOG_ERROR("Unsupported layout change: %s W%dxH%d",
+            vg_lite_test_buffer_format_string(buffer->format), (int)buffer->width, (int)buffer->height);
+        return false;
+    }
+
+    const size_t band_size = (size_t)buffer->stride * VG_LITE_TEST_TILE_SIZE;
+    uint8_t* temp = malloc(band_size);
+    GPU_ASSERT_NULL(temp);
+
+    const int tiles = buffer->width / VG_LITE_TEST_TILE_SIZE;
+    for (int y = 0; y < buffer->height; y += VG_LITE_TEST_TILE_SIZE) {
+        uint8_t* band = (uint8_t*)buffer->memory + (size_t)y * buffer->stride;
+        memcpy(temp, band, band_size);
+
+        for (int row = 0; row < VG_LITE_TEST_TILE_SIZE; row++) {
+            if (layout == VG_LITE_TILED) {
+                kernel->scatter(band, temp + (size_t)row * buffer->stride, row, tiles);
+            } else {
+                kernel->gather(band + (size_t)row * buffer->stride, temp, row, tiles);
+            }
+        }
+    }
+
+    free(temp);
+    buffer->tiled = layout;
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static const tile_kernel_t* tile_get_kernel(const vg_lite_buffer_t* buffer)
+{
+    const uint32_t bpp = vg_lite_test_buffer_format_bpp(buffer->format);
+    if (bpp % 8 || bpp / 8 == 0 || bpp / 8 > TILE_MAX_PIXEL_SIZE) {
+        return NULL;
+    }
+
+    if (buffer->width % VG_LITE_TEST_TILE_SIZE || buffer->height % VG_LITE_TEST_TILE_SIZE
+        || (uint32_t)buffer->stride < buffer->width * bpp / 8) {
+        return NULL;
+    }
+
+    static const tile_kernel_t kernels[TILE_MAX_PIXEL_SIZE] = {
+        { tile_gather_1, tile_scatter_1 },
+        { tile_gather_2, tile_scatter_2 },
+        { tile_gather_3, tile_scatter_3 },
+        { tile_gather_4, tile_scatter_4 },
+    };
+
+    return &kernels[bpp / 8 - 1];
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VG_LITE_TEST_TILE_H
+#define VG_LITE_TEST_TILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_utils.h"
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Edge of the square tiles of VG_LITE_TILED buffers, in pixels */
+#define VG_LITE_TEST_TILE_SIZE 4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Check whether a buffer can be swizzled between the linear and the tiled layout.
+ * @param buffer The buffer.
+ * @return True if the pixels are whole bytes and the size is a multiple of the tile size.
+ * @note A tiled buffer keeps the stride of the linear one. Each group of 4 lines holds
+ *       the tiles of those lines left to right, each tile 4 rows of 4 pixels.
+ */
+bool vg_lite_test_tile_is_supported(const vg_lite_buffer_t* buffer);
+
+/**
+ * @brief Gather one line of a tiled buffer into linear pixels.
+ * @param dst width pixels in the format of the buffer.
+ * @param src The tiled buffer.
+ * @param y The line to gather.
+ */
+void vg_lite_test_tile_read_row(void* dst, const vg_lite_buffer_t* src, int y);
+
+/**
+ * @brief Scatter linear pixels into one line of a tiled buffer.
+ * @param dst The tiled buffer.
+ * @param y The line to scatter.
+ * @param src width pixels in the format of the buffer.
+ */
+void vg_lite_test_tile_write_row(vg_lite_buffer_t* dst, int y, const void* src);
+
+/**
+ * @brief Copy a linear buffer into the tiled layout.
+ * @param dst The destination buffer, same size and format as src. Marked VG_LITE_TILED.
+ * @param src The source buffer, linear layout.
+ * @return True on success, false if the buffers are not supported.
+ * @note The caller handles the cache maintenance.
+ */
+bool vg_lite_test_tile_swizzle(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src);
+
+/**
+ * @brief Copy a tiled buffer into the linear layout.
+ * @param dst The destination buffer, same size and format as src. Marked VG_LITE_LINEAR.
+ * @param src The source buffer, tiled layout.
+ * @return True on success, false if the buffers are not supported.
+ * @note The caller handles the cache maintenance.
+ */
+bool vg_lite_test_tile_deswizzle(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src);
+
+/**
+ * @brief Rearrange the pixels of a buffer in place into another layout.
+ * @param buffer The buffer to rearrange.
+ * @param layout VG_LITE_LINEAR or VG_LITE_TILED.
+ * @return True on success, false if the buffer is not supported.
+ * @note Needs a temporary copy of 4 lines only, the tiles never cross a group of 4 lines.
+ */
+bool vg_lite_test_tile_set_layout(vg_lite_buffer_t* buffer, vg_lite_buffer_layout_t layout);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*VG_LITE_TEST_TILE_H*/
@@ -19,12 +19,14 @@
  *********************/
 
 #include "vg_lite_test_utils.h"
+#include "vg_lite_test_convert.h"
 #include "../gpu_assert.h"
 #include "../gpu_cache.h"
 #include "../gpu_math.h"
 #include "../gpu_utils.h"
 #include <inttypes.h>
 #include <stdbool.h>
+#include <stdlib.h>
 #include <string.h>
 
 /*********************
@@ -57,9 +59,6 @@ static void vg_lite_test_buffer_format_bytes(
     uint32_t* div,
     uint32_t* bytes_align);
 
-static enum gpu_color_format_e vg_lite_test_vg_format_to_gpu_format(vg_lite_buffer_format_t format);
-static vg_lite_buffer_format_t vg_lite_test_gpu_format_to_vg_format(enum gpu_color_format_e format);
-
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -222,15 +221,10 @@ const char* vg_lite_test_feature_string(vg_lite_feature_t feature)
 struct gpu_buffer_s* vg_lite_test_buffer_alloc(vg_lite_buffer_t* buffer, uint32_t width, uint32_t height, vg_lite_buffer_format_t format, uint32_t stride)
 {
     GPU_ASSERT_NULL(buffer);
-    if (vg_lite_query_feature(gcFEATURE_BIT_VG_16PIXELS_ALIGN)) {
-        width = GPU_ALIGN_UP(width, 16);
-    }
+    uint32_t auto_stride = vg_lite_test_buffer_calc_stride(format, &width);
 
     if (stride == VG_LITE_TEST_STRIDE_AUTO) {
-        uint32_t mul, div, align;
-        vg_lite_test_buffer_format_bytes(format, &mul, &div, &align);
-
-        stride = GPU_ALIGN_UP(((width * mul + div - 1) / div), align);
+        stride = auto_stride;
     }
 
     struct gpu_buffer_s* gpu_buffer = gpu_buffer_alloc(
@@ -257,6 +251,26 @@ struct gpu_buffer_s* vg_lite_test_buffer_alloc(vg_lite_buffer_t* buffer, uint32_
     return gpu_buffer;
 }
 
+uint32_t vg_lite_test_buffer_calc_stride(vg_lite_buffer_format_t format, uint32_t* width)
+{
+    GPU_ASSERT_NULL(width);
+    if (vg_lite_query_feature(gcFEATURE_BIT_VG_16PIXELS_ALIGN)) {
+        *width = GPU_ALIGN_UP(*width, 16);
+    }
+
+    uint32_t mul, div, align;
+    vg_lite_test_buffer_format_bytes(format, &mul, &div, &align);
+
+    return GPU_ALIGN_UP(((*width * mul + div - 1) / div), align);
+}
+
+uint32_t vg_lite_test_buffer_format_bpp(vg_lite_buffer_format_t format)
+{
+    uint32_t mul, div, align;
+    vg_lite_test_buffer_format_bytes(format, &mul, &div, &align);
+    return mul * 8 / div;
+}
+
 void vg_lite_test_vg_buffer_to_gpu_buffer(struct gpu_buffer_s* gpu_buffer, const vg_lite_buffer_t* vg_buffer)
 {
     GPU_ASSERT_NULL(gpu_buffer);
@@ -348,6 +362,31 @@ const char* vg_lite_test_buffer_format_string(vg_lite_buffer_format_t format)
     return "-";
 }
 
+const char* vg_lite_test_blend_string(vg_lite_blend_t blend)
+{
+    switch (blend) {
+        VG_LITE_ENUM_TO_STRING(BLEND_NONE);
+        VG_LITE_ENUM_TO_STRING(BLEND_SRC_OVER);
+        VG_LITE_ENUM_TO_STRING(BLEND_DST_OVER);
+        VG_LITE_ENUM_TO_STRING(BLEND_SRC_IN);
+        VG_LITE_ENUM_TO_STRING(BLEND_DST_IN);
+        VG_LITE_ENUM_TO_STRING(BLEND_MULTIPLY);
+        VG_LITE_ENUM_TO_STRING(BLEND_SCREEN);
+        VG_LITE_ENUM_TO_STRING(BLEND_DARKEN);
+        VG_LITE_ENUM_TO_STRING(BLEND_LIGHTEN);
+        VG_LITE_ENUM_TO_STRING(BLEND_ADDITIVE);
+        VG_LITE_ENUM_TO_STRING(BLEND_SUBTRACT);
+        VG_LITE_ENUM_TO_STRING(BLEND_NORMAL_LVGL);
+        VG_LITE_ENUM_TO_STRING(BLEND_ADDITIVE_LVGL);
+        VG_LITE_ENUM_TO_STRING(BLEND_SUBTRACT_LVGL);
+        VG_LITE_ENUM_TO_STRING(BLEND_MULTIPLY_LVGL);
+    default:
+        break;
+    }
+
+    return "-";
+}
+
 vg_lite_error_t vg_lite_test_idle_flush(void)
 {
     vg_lite_uint32_t is_gpu_idle = 0;
@@ -394,6 +433,76 @@ void vg_lite_test_transform_retangle(vg_lite_rectangle_t* rect, const vg_lite_ma
     rect->height = trans_y2 - trans_y1 + 1;
 }
 
+void vg_lite_test_matrix_multiply(vg_lite_matrix_t* matrix, const vg_lite_matrix_t* mult)
+{
+    GPU_ASSERT_NULL(matrix);
+    GPU_ASSERT_NULL(mult);
+
+    vg_lite_matrix_t result;
+    for (int row = 0; row < 3; row++) {
+        for (int col = 0; col < 3; col++) {
+            result.m[row][col] = matrix->m[row][0] * mult->m[0][col]
+                + matrix->m[row][1] * mult->m[1][col]
+                + matrix->m[row][2] * mult->m[2][col];
+        }
+    }
+
+    *matrix = result;
+}
+
+enum gpu_color_format_e vg_lite_test_vg_format_to_gpu_format(vg_lite_buffer_format_t format)
+{
+#define COLOR_FORMAT_MATCH(FMT) \
+    case VG_LITE_##FMT:         \
+        return GPU_COLOR_FORMAT_##FMT;
+
+    switch (format) {
+        COLOR_FORMAT_MATCH(BGR565);
+        COLOR_FORMAT_MATCH(BGR888);
+        COLOR_FORMAT_MATCH(BGRA8888);
+        COLOR_FORMAT_MATCH(BGRX8888);
+        COLOR_FORMAT_MATCH(BGRA5658);
+        COLOR_FORMAT_MATCH(INDEX_8);
+        COLOR_FORMAT_MATCH(A4);
+        COLOR_FORMAT_MATCH(A8);
+
+    default:
+        /* Not an error by itself, vg_lite_test_convert reads the formats gpu_buffer does not know */
+        GPU_LOG_DEBUG("unsupport color format: %d", (int)format);
+        break;
+    }
+
+#undef COLOR_FORMAT_MATCH
+
+    return GPU_COLOR_FORMAT_UNKNOWN;
+}
+
+vg_lite_buffer_format_t vg_lite_test_gpu_format_to_vg_format(enum gpu_color_format_e format)
+{
+#define COLOR_FORMAT_MATCH(FMT)  \
+    case GPU_COLOR_FORMAT_##FMT: \
+        return VG_LITE_##FMT;
+
+    switch (format) {
+        COLOR_FORMAT_MATCH(BGR565);
+        COLOR_FORMAT_MATCH(BGR888);
+        COLOR_FORMAT_MATCH(BGRA8888);
+        COLOR_FORMAT_MATCH(BGRX8888);
+        COLOR_FORMAT_MATCH(BGRA5658);
+        COLOR_FORMAT_MATCH(INDEX_8);
+        COLOR_FORMAT_MATCH(A4);
+        COLOR_FORMAT_MATCH(A8);
+
+    default:
+        GPU_LOG_ERROR("unsupport color format: %d", (int)format);
+        break;
+    }
+
+#undef COLOR_FORMAT_MATCH
+
+    return VG_LITE_BGRA8888;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -445,6 +554,11 @@ static void vg_lite_test_buffer_format_bytes(
         break;
     case VG_LITE_NV12:
     case VG_LITE_NV12_TILED:
+    case VG_LITE_NV16:
+    case VG_LITE_YV12:
+    case VG_LITE_YV16:
+    case VG_LITE_YV24:
+        /* The luma plane, the chroma planes are described by the yuv info */
         *mul = 1;
         break;
     case VG_LITE_ANV12:
@@ -487,56 +601,88 @@ static void vg_lite_test_buffer_format_bytes(
     }
 }
 
-static enum gpu_color_format_e vg_lite_test_vg_format_to_gpu_format(vg_lite_buffer_format_t format)
+uint32_t vg_lite_test_buffer_checksum(const vg_lite_buffer_t* buffer)
 {
-#define COLOR_FORMAT_MATCH(FMT) \
-    case VG_LITE_##FMT:         \
-        return GPU_COLOR_FORMAT_##FMT;
+    GPU_ASSERT_NULL(buffer);
 
-    switch (format) {
-        COLOR_FORMAT_MATCH(BGR565);
-        COLOR_FORMAT_MATCH(BGR888);
-        COLOR_FORMAT_MATCH(BGRA8888);
-        COLOR_FORMAT_MATCH(BGRX8888);
-        COLOR_FORMAT_MATCH(BGRA5658);
-        COLOR_FORMAT_MATCH(INDEX_8);
-        COLOR_FORMAT_MATCH(A4);
-        COLOR_FORMAT_MATCH(A8);
+    size_t size = buffer->stride * buffer->height;
+    gpu_cache_invalidate(buffer->memory, size);
 
-    default:
-        GPU_LOG_ERROR("unsupport color format: %d", (int)format);
-        break;
+    /* FNV-1a */
+    uint32_t hash = 2166136261u;
+    const uint8_t* data = buffer->memory;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
     }
 
-#undef COLOR_FORMAT_MATCH
-
-    return GPU_COLOR_FORMAT_UNKNOWN;
+    return hash;
 }
 
-static vg_lite_buffer_format_t vg_lite_test_gpu_format_to_vg_format(enum gpu_color_format_e format)
+uint32_t vg_lite_test_buffer_diff(const vg_lite_buffer_t* a, const vg_lite_buffer_t* b, uint8_t tolerance, uint8_t* max_diff)
 {
-#define COLOR_FORMAT_MATCH(FMT)  \
-    case GPU_COLOR_FORMAT_##FMT: \
-        return VG_LITE_##FMT;
+    GPU_ASSERT_NULL(a);
+    GPU_ASSERT_NULL(b);
+    GPU_ASSERT(a->width == b->width && a->height == b->height);
 
-    switch (format) {
-        COLOR_FORMAT_MATCH(BGR565);
-        COLOR_FORMAT_MATCH(BGR888);
-        COLOR_FORMAT_MATCH(BGRA8888);
-        COLOR_FORMAT_MATCH(BGRX8888);
-        COLOR_FORMAT_MATCH(BGRA5658);
-        COLOR_FORMAT_MATCH(INDEX_8);
-        COLOR_FORMAT_MATCH(A4);
-        COLOR_FORMAT_MATCH(A8);
+    const uint32_t pixel_count = (uint32_t)a->width * a->height;
+    if (max_diff) {
+        *max_diff = 0;
+    }
 
-    default:
-        GPU_LOG_ERROR("unsupport color format: %d", (int)format);
-        break;
+    if (a->tiled != VG_LITE_LINEAR || b->tiled != VG_LITE_LINEAR
+        || !vg_lite_test_convert_is_supported(a->format, false)
+        || !vg_lite_test_convert_is_supported(b->format, false)) {
+        GPU_LOG_ERROR("Unsupported buffers: %s vs %s",
+            vg_lite_test_buffer_format_string(a->format), vg_lite_test_buffer_format_string(b->format));
+        return pixel_count;
     }
 
-#undef COLOR_FORMAT_MATCH
+    gpu_cache_invalidate(a->memory, a->stride * a->height);
+    gpu_cache_invalidate(b->memory, b->stride * b->height);
 
-    return VG_LITE_BGRA8888;
+    /* Both sides are compared as BGRA8888 rows, identical rows are skipped with one memcmp */
+    uint32_t* row_a = malloc(a->width * sizeof(uint32_t));
+    uint32_t* row_b = malloc(a->width * sizeof(uint32_t));
+    GPU_ASSERT_NULL(row_a);
+    GPU_ASSERT_NULL(row_b);
+
+    uint32_t diff_count = 0;
+    uint8_t diff_max = 0;
+
+    for (int y = 0; y < a->height; y++) {
+        vg_lite_test_convert_row_to_bgra8888(row_a, (const uint8_t*)a->memory + (size_t)y * a->stride, a->format, NULL, a->width);
+        vg_lite_test_convert_row_to_bgra8888(row_b, (const uint8_t*)b->memory + (size_t)y * b->stride, b->format, NULL, b->width);
+
+        if (memcmp(row_a, row_b, a->width * sizeof(uint32_t)) == 0) {
+            continue;
+        }
+
+        for (int x = 0; x < a->width; x++) {
+            gpu_color_bgra8888_t pa;
+            gpu_color_bgra8888_t pb;
+            pa.full = row_a[x];
+            pb.full = row_b[x];
+
+            uint8_t diff = MATH_MAX(
+                MATH_MAX(MATH_ABS(pa.ch.alpha - pb.ch.alpha), MATH_ABS(pa.ch.red - pb.ch.red)),
+                MATH_MAX(MATH_ABS(pa.ch.green - pb.ch.green), MATH_ABS(pa.ch.blue - pb.ch.blue)));
+
+            diff_max = MATH_MAX(diff_max, diff);
+            if (diff > tolerance) {
+                diff_count++;
+            }
+        }
+    }
+
+    free(row_a);
+    free(row_b);
+
+    if (max_diff) {
+        *max_diff = diff_max;
+    }
+
+    return diff_count;
 }
 
 void vg_lite_test_fill_gray_gradient(vg_lite_buffer_t* buffer)
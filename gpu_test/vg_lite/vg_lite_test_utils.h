@@ -23,6 +23,7 @@
 
 #include "../gpu_buffer.h"
 #include "../gpu_log.h"
+#include "cpu/vg_lite_cpu_ref.h"
 #include <vg_lite.h>
 
 #ifdef __cplusplus
@@ -98,6 +99,21 @@ void vg_lite_test_error_dump_info(vg_lite_error_t error);
  */
 struct gpu_buffer_s* vg_lite_test_buffer_alloc(vg_lite_buffer_t* buffer, uint32_t width, uint32_t height, vg_lite_buffer_format_t format, uint32_t stride);
 
+/**
+ * @brief Calculate the stride of a VG Lite buffer.
+ * @param format The format of the buffer.
+ * @param width The width of the buffer. It will be aligned in place if the GPU requires it.
+ * @return The stride of the buffer in bytes.
+ */
+uint32_t vg_lite_test_buffer_calc_stride(vg_lite_buffer_format_t format, uint32_t* width);
+
+/**
+ * @brief Get the bits per pixel of a VG Lite buffer format.
+ * @param format The VG Lite buffer format.
+ * @return The bits per pixel of the first plane, as used by vg_lite_test_buffer_calc_stride.
+ */
+uint32_t vg_lite_test_buffer_format_bpp(vg_lite_buffer_format_t format);
+
 /**
  * @brief Convert a VG Lite buffer to a GPU buffer.
  * @param gpu_buffer The GPU buffer to be copied.
@@ -112,6 +128,20 @@ void vg_lite_test_vg_buffer_to_gpu_buffer(struct gpu_buffer_s* gpu_buffer, const
  */
 void vg_lite_test_gpu_buffer_to_vg_buffer(vg_lite_buffer_t* vg_buffer, const struct gpu_buffer_s* gpu_buffer);
 
+/**
+ * @brief Convert a VG Lite buffer format to a GPU color format.
+ * @param format The VG Lite buffer format.
+ * @return The GPU color format, or GPU_COLOR_FORMAT_UNKNOWN if not supported.
+ */
+enum gpu_color_format_e vg_lite_test_vg_format_to_gpu_format(vg_lite_buffer_format_t format);
+
+/**
+ * @brief Convert a GPU color format to a VG Lite buffer format.
+ * @param format The GPU color format.
+ * @return The VG Lite buffer format.
+ */
+vg_lite_buffer_format_t vg_lite_test_gpu_format_to_vg_format(enum gpu_color_format_e format);
+
 /**
  * @breif Convert a VG Lite buffer format to a string.
  * @param format The VG Lite buffer format.
@@ -119,6 +149,13 @@ void vg_lite_test_gpu_buffer_to_vg_buffer(vg_lite_buffer_t* vg_buffer, const str
  */
 const char* vg_lite_test_buffer_format_string(vg_lite_buffer_format_t format);
 
+/**
+ * @brief Convert a VG Lite blend mode to a string.
+ * @param blend The VG Lite blend mode.
+ * @return The string of the VG Lite blend mode.
+ */
+const char* vg_lite_test_blend_string(vg_lite_blend_t blend);
+
 /**
  * @breif Flush the GPU command queue if GPU is idle.
  * @return VG_LITE_SUCCESS if the flush is successful, otherwise the error code.
@@ -142,6 +179,30 @@ void vg_lite_test_transform_point(float* x, float* y, const vg_lite_matrix_t* ma
  */
 void vg_lite_test_transform_retangle(vg_lite_rectangle_t* rect, const vg_lite_matrix_t* matrix);
 
+/**
+ * @brief Multiply a matrix by another matrix on the right.
+ * @param matrix The matrix to be multiplied, matrix = matrix * mult.
+ * @param mult The matrix applied to points before matrix.
+ */
+void vg_lite_test_matrix_multiply(vg_lite_matrix_t* matrix, const vg_lite_matrix_t* mult);
+
+/**
+ * @brief Calculate the checksum of a buffer.
+ * @param buffer The buffer to be checked.
+ * @return The FNV-1a checksum of the buffer memory, including the stride padding.
+ */
+uint32_t vg_lite_test_buffer_checksum(const vg_lite_buffer_t* buffer);
+
+/**
+ * @brief Compare two buffers of the same size pixel by pixel.
+ * @param a The first buffer.
+ * @param b The second buffer.
+ * @param tolerance The maximum channel difference of matching pixels.
+ * @param max_diff The maximum channel difference found. Can be NULL.
+ * @return The number of pixels that differ by more than the tolerance.
+ */
+uint32_t vg_lite_test_buffer_diff(const vg_lite_buffer_t* a, const vg_lite_buffer_t* b, uint8_t tolerance, uint8_t* max_diff);
+
 /**
  * @breif Fill a buffer with a gray gradient.
  * @param buffer The buffer to be filled.
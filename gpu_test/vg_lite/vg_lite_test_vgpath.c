@@ -0,0 +1,370 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_vgpath.h"
+#include "../gpu_assert.h"
+#include "../gpu_utils.h"
+#include "vg_lite_test_path.h"
+#include "vg_lite_test_utils.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct vg_lite_test_vgpath_item_s {
+    vg_lite_path_t path;
+    uint32_t color;
+    vg_lite_fill_t fill_rule;
+    void* copied_data;
+};
+
+struct vg_lite_test_vgpath_s {
+    void* file_data;
+    size_t file_size;
+    bool mapped;
+    uint32_t count;
+    uint32_t mapped_count;
+    struct vg_lite_test_vgpath_item_s items[];
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void* vg_lite_test_vgpath_map_file(const char* path, size_t* size, bool* mapped);
+static bool vg_lite_test_vgpath_check_entry(const struct vg_lite_test_vgpath_entry_s* entry, size_t file_size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+struct vg_lite_test_vgpath_s* vg_lite_test_vgpath_load(const char* path)
+{
+    GPU_ASSERT_NULL(path);
+
+    size_t file_size = 0;
+    bool mapped = false;
+    uint8_t* file_data = vg_lite_test_vgpath_map_file(path, &file_size, &mapped);
+    if (!file_data) {
+        return NULL;
+    }
+
+    struct vg_lite_test_vgpath_header_s header;
+    if (file_size < sizeof(header)) {
+        GPU_LOG_ERROR("%s: file too small", path);
+        goto failed;
+    }
+
+    memcpy(&header, file_data, sizeof(header));
+    if (header.magic != VG_LITE_TEST_VGPATH_MAGIC
+        || header.version != VG_LITE_TEST_VGPATH_VERSION
+        || header.file_size != file_size
+        || header.table_offset + (size_t)header.path_count * sizeof(struct vg_lite_test_vgpath_entry_s) > file_size) {
+        GPU_LOG_ERROR("%s: bad header, magic 0x%08x version %d size %u/%u",
+            path, (unsigned)header.magic, header.version, (unsigned)header.file_size, (unsigned)file_size);
+        goto failed;
+    }
+
+    struct vg_lite_test_vgpath_s* vgpath = malloc(sizeof(struct vg_lite_test_vgpath_s)
+        + header.path_count * sizeof(struct vg_lite_test_vgpath_item_s));
+    GPU_ASSERT_NULL(vgpath);
+    memset(vgpath, 0, sizeof(struct vg_lite_test_vgpath_s));
+    vgpath->file_data = file_data;
+    vgpath->file_size = file_size;
+    vgpath->mapped = mapped;
+
+    for (uint32_t i = 0; i < header.path_count; i++) {
+        struct vg_lite_test_vgpath_entry_s entry;
+        memcpy(&entry, file_data + header.table_offset + i * sizeof(entry), sizeof(entry));
+
+        if (!vg_lite_test_vgpath_check_entry(&entry, file_size)) {
+            GPU_LOG_ERROR("%s: bad path entry %" PRIu32, path, i);
+            vg_lite_test_vgpath_destroy(vgpath);
+            return NULL;
+        }
+
+        struct vg_lite_test_vgpath_item_s* item = &vgpath->items[i];
+        memset(item, 0, sizeof(struct vg_lite_test_vgpath_item_s));
+        item->color = entry.color;
+        item->fill_rule = entry.fill_rule;
+        vgpath->count++;
+
+        /* Use the stream in place when the element type allows it */
+        void* data = file_data + entry.data_offset;
+        if ((uintptr_t)data % vg_lite_test_path_format_len(entry.format) != 0) {
+            item->copied_data = malloc(entry.data_size);
+            GPU_ASSERT_NULL(item->copied_data);
+            memcpy(item->copied_data, data, entry.data_size);
+            data = item->copied_data;
+        } else {
+            vgpath->mapped_count++;
+        }
+
+        VG_LITE_TEST_CHECK_ERROR(vg_lite_init_path(
+            &item->path,
+            entry.format,
+            entry.quality,
+            entry.data_size,
+            data,
+            entry.bounding_box[0], entry.bounding_box[1],
+            entry.bounding_box[2], entry.bounding_box[3]));
+    }
+
+    GPU_LOG_INFO("%s: %" PRIu32 " paths, %" PRIu32 " used in place, %zu bytes %s",
+        path, vgpath->count, vgpath->mapped_count, file_size, mapped ? "mapped" : "read");
+
+    return vgpath;
+
+failed:
+    if (mapped) {
+        munmap(file_data, file_size);
+    } else {
+        free(file_data);
+    }
+
+    return NULL;
+}
+
+bool vg_lite_test_vgpath_save(
+    const char* path,
+    const vg_lite_path_t* paths,
+    const uint32_t* colors,
+    uint32_t count,
+    vg_lite_fill_t fill_rule)
+{
+    GPU_ASSERT_NULL(path);
+    GPU_ASSERT_NULL(paths);
+    GPU_ASSERT_NULL(colors);
+    GPU_ASSERT(count <= UINT16_MAX);
+
+    FILE* fp = fopen(path, "wb");
+    if (!fp) {
+        GPU_LOG_ERROR("open %s failed: %d", path, errno);
+        return false;
+    }
+
+    struct vg_lite_test_vgpath_header_s header;
+    memset(&header, 0, sizeof(header));
+    header.magic = VG_LITE_TEST_VGPATH_MAGIC;
+    header.version = VG_LITE_TEST_VGPATH_VERSION;
+    header.path_count = count;
+    header.table_offset = sizeof(header);
+
+    /* Lay out the streams after the table */
+    uint32_t offset = header.table_offset + count * sizeof(struct vg_lite_test_vgpath_entry_s);
+    for (uint32_t i = 0; i < count; i++) {
+        offset = GPU_ALIGN_UP(offset, VG_LITE_TEST_VGPATH_ALIGN) + paths[i].path_length;
+    }
+
+    header.file_size = offset;
+
+    bool retval = fwrite(&header, sizeof(header), 1, fp) == 1;
+
+    offset = header.table_offset + count * sizeof(struct vg_lite_test_vgpath_entry_s);
+    for (uint32_t i = 0; i < count && retval; i++) {
+        struct vg_lite_test_vgpath_entry_s entry;
+        memset(&entry, 0, sizeof(entry));
+        memcpy(entry.bounding_box, paths[i].bounding_box, sizeof(entry.bounding_box));
+        entry.color = colors[i];
+        entry.data_offset = GPU_ALIGN_UP(offset, VG_LITE_TEST_VGPATH_ALIGN);
+        entry.data_size = paths[i].path_length;
+        entry.format = paths[i].format;
+        entry.fill_rule = fill_rule;
+        entry.quality = paths[i].quality;
+        offset = entry.data_offset + entry.data_size;
+
+        retval = fwrite(&entry, sizeof(entry), 1, fp) == 1;
+    }
+
+    static const uint8_t padding[VG_LITE_TEST_VGPATH_ALIGN] = { 0 };
+    offset = header.table_offset + count * sizeof(struct vg_lite_test_vgpath_entry_s);
+    for (uint32_t i = 0; i < count && retval; i++) {
+        uint32_t aligned = GPU_ALIGN_UP(offset, VG_LITE_TEST_VGPATH_ALIGN);
+        if (aligned > offset) {
+            retval = fwrite(padding, aligned - offset, 1, fp) == 1;
+        }
+
+        if (retval && paths[i].path_length > 0) {
+            retval = fwrite(paths[i].path, paths[i].path_length, 1, fp) == 1;
+        }
+
+        offset = aligned + paths[i].path_length;
+    }
+
+    if (fclose(fp) != 0) {
+        retval = false;
+    }
+
+    if (!retval) {
+        GPU_LOG_ERROR("write %s failed: %d", path, errno);
+        return false;
+    }
+
+    GPU_LOG_INFO("%s: %" PRIu32 " paths saved, %" PRIu32 " bytes", path, count, header.file_size);
+    return true;
+}
+
+void vg_lite_test_vgpath_destroy(struct vg_lite_test_vgpath_s* vgpath)
+{
+    GPU_ASSERT_NULL(vgpath);
+
+    for (uint32_t i = 0; i < vgpath->count; i++) {
+        struct vg_lite_test_vgpath_item_s* item = &vgpath->items[i];
+
+        /* Release the driver side resources, the data is owned here */
+        item->path.path = NULL;
+        VG_LITE_TEST_CHECK_ERROR(vg_lite_clear_path(&item->path));
+
+        if (item->copied_data) {
+            free(item->copied_data);
+        }
+    }
+
+    if (vgpath->mapped) {
+        munmap(vgpath->file_data, vgpath->file_size);
+    } else {
+        free(vgpath->file_data);
+    }
+
+    free(vgpath);
+}
+
+uint32_t vg_lite_test_vgpath_get_count(const struct vg_lite_test_vgpath_s* vgpath)
+{
+    GPU_ASSERT_NULL(vgpath);
+    return vgpath->count;
+}
+
+vg_lite_path_t* vg_lite_test_vgpath_get_path(
+    struct vg_lite_test_vgpath_s* vgpath,
+    uint32_t index,
+    uint32_t* color,
+    vg_lite_fill_t* fill_rule)
+{
+    GPU_ASSERT_NULL(vgpath);
+    GPU_ASSERT(index < vgpath->count);
+
+    struct vg_lite_test_vgpath_item_s* item = &vgpath->items[index];
+    if (color) {
+        *color = item->color;
+    }
+
+    if (fill_rule) {
+        *fill_rule = item->fill_rule;
+    }
+
+    return &item->path;
+}
+
+uint32_t vg_lite_test_vgpath_get_mapped_count(const struct vg_lite_test_vgpath_s* vgpath)
+{
+    GPU_ASSERT_NULL(vgpath);
+    return vgpath->mapped_count;
+}
+
+uint32_t vg_lite_test_vgpath_get_file_size(const struct vg_lite_test_vgpath_s* vgpath)
+{
+    GPU_ASSERT_NULL(vgpath);
+    return vgpath->file_size;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void* vg_lite_test_vgpath_map_file(const char* path, size_t* size, bool* mapped)
+{
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        GPU_LOG_WARN("open %s failed: %d", path, errno);
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size <= 0) {
+        GPU_LOG_ERROR("stat %s failed: %d", path, errno);
+        close(fd);
+        return NULL;
+    }
+
+    *size = st.st_size;
+    void* data = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data != MAP_FAILED) {
+        *mapped = true;
+        close(fd);
+        return data;
+    }
+
+    /* Not every file system supports mapping, read it instead */
+    GPU_LOG_WARN("mmap %s failed: %d, reading instead", path, errno);
+    *mapped = false;
+    data = malloc(*size);
+    GPU_ASSERT_NULL(data);
+
+    size_t total = 0;
+    while (total < *size) {
+        ssize_t ret = read(fd, (uint8_t*)data + total, *size - total);
+        if (ret <= 0) {
+            GPU_LOG_ERROR("read %s failed: %d", path, errno);
+            free(data);
+            close(fd);
+            return NULL;
+        }
+
+        total += ret;
+    }
+
+    close(fd);
+    return data;
+}
+
+static bool vg_lite_test_vgpath_check_entry(const struct vg_lite_test_vgpath_entry_s* entry, size_t file_size)
+{
+    if (entry->format > VG_LITE_FP32
+        || (entry->fill_rule != VG_LITE_FILL_NON_ZERO && entry->fill_rule != VG_LITE_FILL_EVEN_ODD)
+        || entry->quality > VG_LITE_LOW) {
+        return false;
+    }
+
+    return (size_t)entry->data_offset + entry->data_size <= file_size
+        && entry->data_size % vg_lite_test_path_format_len(entry->format) == 0;
+}
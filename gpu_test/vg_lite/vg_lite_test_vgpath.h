@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VG_LITE_TEST_VGPATH_H
+#define VG_LITE_TEST_VGPATH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <vg_lite.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**
+ * .vgpath container, all fields little-endian:
+ *
+ *   header       struct vg_lite_test_vgpath_header_s
+ *   path table   struct vg_lite_test_vgpath_entry_s[path_count]
+ *   streams      raw vg-lite command streams, each aligned to
+ *                VG_LITE_TEST_VGPATH_ALIGN from the start of the file
+ *
+ * scripts/vgpath_convert.py produces it from the resource headers and SVG files.
+ */
+#define VG_LITE_TEST_VGPATH_MAGIC 0x48544150 /* "PATH" */
+#define VG_LITE_TEST_VGPATH_VERSION 1
+#define VG_LITE_TEST_VGPATH_ALIGN 4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct vg_lite_test_vgpath_s;
+
+struct vg_lite_test_vgpath_header_s {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t path_count;
+    uint32_t table_offset;
+    uint32_t file_size;
+};
+
+struct vg_lite_test_vgpath_entry_s {
+    float bounding_box[4];
+    uint32_t color;
+    uint32_t data_offset;
+    uint32_t data_size;
+    uint8_t format; /* vg_lite_format_t */
+    uint8_t fill_rule; /* vg_lite_fill_t */
+    uint8_t quality; /* vg_lite_quality_t */
+    uint8_t reserved;
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Load a .vgpath file
+ * @param path The path of the file
+ * @return The loaded paths, NULL if the file can't be loaded or is malformed
+ * @note The file is mapped and the command streams are used in place when
+ *       they are aligned for their format, otherwise they are copied.
+ */
+struct vg_lite_test_vgpath_s* vg_lite_test_vgpath_load(const char* path);
+
+/**
+ * @brief Save paths to a .vgpath file
+ * @param path The path of the file
+ * @param paths The vg-lite paths to save
+ * @param colors The fill color of each path
+ * @param count The number of paths
+ * @param fill_rule The fill rule shared by all paths
+ * @return True on success, false otherwise
+ */
+bool vg_lite_test_vgpath_save(
+    const char* path,
+    const vg_lite_path_t* paths,
+    const uint32_t* colors,
+    uint32_t count,
+    vg_lite_fill_t fill_rule);
+
+/**
+ * @brief Destroy loaded paths and unmap the file
+ * @param vgpath The loaded paths
+ */
+void vg_lite_test_vgpath_destroy(struct vg_lite_test_vgpath_s* vgpath);
+
+/**
+ * @brief Get the number of loaded paths
+ * @param vgpath The loaded paths
+ * @return The number of paths
+ */
+uint32_t vg_lite_test_vgpath_get_count(const struct vg_lite_test_vgpath_s* vgpath);
+
+/**
+ * @brief Get a loaded path
+ * @param vgpath The loaded paths
+ * @param index The index of the path
+ * @param color The fill color of the path. Can be NULL.
+ * @param fill_rule The fill rule of the path. Can be NULL.
+ * @return The vg-lite path
+ */
+vg_lite_path_t* vg_lite_test_vgpath_get_path(
+    struct vg_lite_test_vgpath_s* vgpath,
+    uint32_t index,
+    uint32_t* color,
+    vg_lite_fill_t* fill_rule);
+
+/**
+ * @brief Get the number of command streams used in place from the mapped file
+ * @param vgpath The loaded paths
+ * @return The number of paths that were not copied
+ */
+uint32_t vg_lite_test_vgpath_get_mapped_count(const struct vg_lite_test_vgpath_s* vgpath);
+
+/**
+ * @brief Get the size of the loaded file
+ * @param vgpath The loaded paths
+ * @return The size in bytes
+ */
+uint32_t vg_lite_test_vgpath_get_file_size(const struct vg_lite_test_vgpath_s* vgpath);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*VG_LITE_TEST_VGPATH_H*/
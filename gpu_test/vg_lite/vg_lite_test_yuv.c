@@ -0,0 +1,488 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_yuv.h"
+#include "../gpu_assert.h"
+#include "../gpu_buffer.h"
+#include "../gpu_utils.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* 16 bytes of 8 bits samples, the widening to 32 bits needs a whole vector of them */
+#define YUV_BLOCK_SIZE 16
+#define YUV_PLANE_ALIGN 64
+#define YUV_WIDTH_ALIGN 16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    YUV_LAYOUT_UNKNOWN,
+    YUV_LAYOUT_PACKED,
+    YUV_LAYOUT_SEMI_PLANAR,
+    YUV_LAYOUT_PLANAR,
+} yuv_layout_t;
+
+typedef struct {
+    yuv_layout_t layout;
+    uint8_t shift_x; /* Chroma subsampling, log2 */
+    uint8_t shift_y;
+    bool alpha;
+} yuv_desc_t;
+
+/* Where the samples of each component are, the packed and interleaved ones have a step */
+typedef struct {
+    uint8_t* y;
+    uint8_t* u;
+    uint8_t* v;
+    uint8_t* a;
+    uint32_t y_stride;
+    uint32_t c_stride;
+    uint32_t a_stride;
+    uint8_t y_step;
+    uint8_t c_step;
+} yuv_planes_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static yuv_desc_t yuv_get_desc(vg_lite_buffer_format_t format);
+static void yuv_get_planes(const vg_lite_buffer_t* buffer, const yuv_desc_t* desc, yuv_planes_t* planes);
+static void plane_store(uint8_t* restrict dst, const uint8_t* restrict src, int len, int step);
+static void plane_load(uint8_t* restrict dst, const uint8_t* restrict src, int len, int step, int shift);
+static void rgb_to_y_row(uint8_t* restrict y, const uint32_t* restrict src, int len);
+static void rgb_to_uv_row(uint8_t* restrict u, uint8_t* restrict v, const uint32_t* restrict src, int len);
+static void alpha_row(uint8_t* restrict a, const uint32_t* restrict src, int len);
+static void chroma_average(uint32_t* restrict dst, const uint32_t* restrict row0, const uint32_t* restrict row1, int len, int shift_x);
+static void yuv_to_bgra_row(uint32_t* restrict dst, const uint8_t* restrict y, const uint8_t* restrict u, const uint8_t* restrict v, const uint8_t* restrict a, int len);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/* Runs STATEMENT for pixel k of a row in blocks of a constant size, so the compiler vectorizes it */
+#define ROW_LOOP(LEN, STATEMENT)                                           \
+    do {                                                                   \
+        int i = 0;                                                         \
+        for (; i + YUV_BLOCK_SIZE <= (LEN); i += YUV_BLOCK_SIZE) {         \
+            for (int j = 0; j < YUV_BLOCK_SIZE; j++) {                     \
+                const int k = i + j;                                       \
+                STATEMENT;                                                 \
+            }                                                              \
+        }                                                                  \
+        for (int k = i; k < (LEN); k++) {                                  \
+            STATEMENT;                                                     \
+        }                                                                  \
+    } while (0)
+
+#define CH_R(c) (int32_t)(((c) >> 16) & 0xFF)
+#define CH_G(c) (int32_t)(((c) >> 8) & 0xFF)
+#define CH_B(c) (int32_t)((c)&0xFF)
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool vg_lite_test_yuv_is_supported(vg_lite_buffer_format_t format)
+{
+    return yuv_get_desc(format).layout != YUV_LAYOUT_UNKNOWN;
+}
+
+vg_lite_feature_t vg_lite_test_yuv_get_feature(vg_lite_buffer_format_t format)
+{
+    const yuv_desc_t desc = yuv_get_desc(format);
+
+    if (desc.alpha) {
+        return gcFEATURE_BIT_VG_AYUV_INPUT;
+    }
+
+    return desc.layout == YUV_LAYOUT_PACKED ? gcFEATURE_BIT_VG_YUY2_INPUT : gcFEATURE_BIT_VG_YUV_INPUT;
+}
+
+struct gpu_buffer_s* vg_lite_test_yuv_buffer_alloc(vg_lite_buffer_t* buffer, uint32_t width, uint32_t height, vg_lite_buffer_format_t format)
+{
+    GPU_ASSERT_NULL(buffer);
+
+    const yuv_desc_t desc = yuv_get_desc(format);
+    if (desc.layout == YUV_LAYOUT_UNKNOWN) {
+        GPU_LOG_ERROR("Unsupported YUV format: %s", vg_lite_test_buffer_format_string(format));
+        return NULL;
+    }
+
+    width = GPU_ALIGN_UP(width, YUV_WIDTH_ALIGN);
+    height = GPU_ALIGN_UP(height, 2);
+
+    const uint32_t y_stride = desc.layout == YUV_LAYOUT_PACKED ? width * 2 : width;
+    const uint32_t chroma_width = width >> desc.shift_x;
+    const uint32_t chroma_height = height >> desc.shift_y;
+    const uint32_t uv_stride = desc.layout == YUV_LAYOUT_SEMI_PLANAR ? chroma_width * 2 : chroma_width;
+
+    /* Planes back to back: Y (or the packed pixels), U or UV, V, alpha */
+    const size_t y_size = GPU_ALIGN_UP((size_t)y_stride * height, YUV_PLANE_ALIGN);
+    const size_t uv_size = desc.layout == YUV_LAYOUT_PACKED ? 0 : GPU_ALIGN_UP((size_t)uv_stride * chroma_height, YUV_PLANE_ALIGN);
+    const size_t v_size = desc.layout == YUV_LAYOUT_PLANAR ? uv_size : 0;
+    const size_t alpha_size = desc.alpha ? GPU_ALIGN_UP((size_t)width * height, YUV_PLANE_ALIGN) : 0;
+    const size_t total_size = y_size + uv_size + v_size + alpha_size;
+
+    /* One allocation in rows of the first plane, the other planes follow it */
+    struct gpu_buffer_s* gpu_buffer = gpu_buffer_alloc(
+        width, (total_size + y_stride - 1) / y_stride, GPU_COLOR_FORMAT_UNKNOWN, y_stride, YUV_PLANE_ALIGN);
+
+    memset(buffer, 0, sizeof(vg_lite_buffer_t));
+    buffer->memory = gpu_buffer->data;
+    buffer->address = (vg_lite_uint32_t)(uintptr_t)buffer->memory;
+    buffer->width = width;
+    buffer->height = height;
+    buffer->format = format;
+    buffer->stride = y_stride;
+    buffer->tiled = VG_LITE_LINEAR;
+    buffer->image_mode = VG_LITE_NORMAL_IMAGE_MODE;
+    buffer->transparency_mode = VG_LITE_IMAGE_OPAQUE;
+
+    vg_lite_yuvinfo_t* yuv = &buffer->yuv;
+    yuv->swizzle = VG_LITE_SWIZZLE_UV;
+    yuv->yuv2rgb = VG_LITE_YUV601;
+
+    if (uv_size) {
+        yuv->uv_memory = (uint8_t*)buffer->memory + y_size;
+        yuv->uv_planar = buffer->address + y_size;
+        yuv->uv_stride = uv_stride;
+        yuv->uv_height = chroma_height;
+    }
+
+    if (v_size) {
+        yuv->v_memory = (uint8_t*)buffer->memory + y_size + uv_size;
+        yuv->v_planar = buffer->address + y_size + uv_size;
+        yuv->v_stride = uv_stride;
+        yuv->v_height = chroma_height;
+    }
+
+    if (alpha_size) {
+        yuv->alpha_planar = buffer->address + y_size + uv_size + v_size;
+        yuv->alpha_stride = width;
+    }
+
+    return gpu_buffer;
+}
+
+bool vg_lite_test_yuv_from_bgra8888(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src)
+{
+    GPU_ASSERT_NULL(dst);
+    GPU_ASSERT_NULL(src);
+
+    const yuv_desc_t desc = yuv_get_desc(dst->format);
+    if (desc.layout == YUV_LAYOUT_UNKNOWN || src->format != VG_LITE_BGRA8888 || src->tiled != VG_LITE_LINEAR
+        || dst->width != src->width || dst->height != src->height) {
+        GPU_LOG_ERROR("Unsupported conversion: %s -> %s",
+            vg_lite_test_buffer_format_string(src->format),
+            vg_lite_test_buffer_format_string(dst->format));
+        return false;
+    }
+
+    yuv_planes_t planes;
+    yuv_get_planes(dst, &desc, &planes);
+
+    const int width = dst->width;
+    const int chroma_width = width >> desc.shift_x;
+    const int chroma_height = dst->height >> desc.shift_y;
+
+    /* The planar rows are written straight, the others go through these */
+    uint8_t* temp = malloc((size_t)width * 3);
+    uint32_t* average = malloc((size_t)chroma_width * sizeof(uint32_t));
+    GPU_ASSERT_NULL(temp);
+    GPU_ASSERT_NULL(average);
+    uint8_t* u_row = temp + width;
+    uint8_t* v_row = temp + width * 2;
+
+    for (int cy = 0; cy < chroma_height; cy++) {
+        const int y0 = cy << desc.shift_y;
+
+        for (int y = y0; y < y0 + (1 << desc.shift_y); y++) {
+            const uint32_t* src_row = (const uint32_t*)((const uint8_t*)src->memory + (size_t)y * src->stride);
+            rgb_to_y_row(temp, src_row, width);
+            plane_store(planes.y + (size_t)y * planes.y_stride, temp, width, planes.y_step);
+
+            if (planes.a) {
+                alpha_row(planes.a + (size_t)y * planes.a_stride, src_row, width);
+            }
+        }
+
+        const uint32_t* row0 = (const uint32_t*)((const uint8_t*)src->memory + (size_t)y0 * src->stride);
+        const uint32_t* row1 = desc.shift_y ? (const uint32_t*)((const uint8_t*)row0 + src->stride) : row0;
+        chroma_average(average, row0, row1, chroma_width, desc.shift_x);
+        rgb_to_uv_row(u_row, v_row, average, chroma_width);
+        plane_store(planes.u + (size_t)cy * planes.c_stride, u_row, chroma_width, planes.c_step);
+        plane_store(planes.v + (size_t)cy * planes.c_stride, v_row, chroma_width, planes.c_step);
+    }
+
+    free(average);
+    free(temp);
+    return true;
+}
+
+bool vg_lite_test_yuv_to_bgra8888(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src)
+{
+    GPU_ASSERT_NULL(dst);
+    GPU_ASSERT_NULL(src);
+
+    const yuv_desc_t desc = yuv_get_desc(src->format);
+    if (desc.layout == YUV_LAYOUT_UNKNOWN || dst->format != VG_LITE_BGRA8888 || dst->tiled != VG_LITE_LINEAR
+        || dst->width != src->width || dst->height != src->height) {
+        GPU_LOG_ERROR("Unsupported conversion: %s -> %s",
+            vg_lite_test_buffer_format_string(src->format),
+            vg_lite_test_buffer_format_string(dst->format));
+        return false;
+    }
+
+    yuv_planes_t planes;
+    yuv_get_planes(src, &desc, &planes);
+
+    const int width = src->width;
+    uint8_t* temp = malloc((size_t)width * 4);
+    GPU_ASSERT_NULL(temp);
+    uint8_t* y_row = temp;
+    uint8_t* u_row = temp + width;
+    uint8_t* v_row = temp + width * 2;
+    uint8_t* a_row = temp + width * 3;
+
+    if (!planes.a) {
+        memset(a_row, 0xFF, width);
+    }
+
+    for (int y = 0; y < src->height; y++) {
+        const int cy = y >> desc.shift_y;
+        plane_load(y_row, planes.y + (size_t)y * planes.y_stride, width, planes.y_step, 0);
+        plane_load(u_row, planes.u + (size_t)cy * planes.c_stride, width, planes.c_step, desc.shift_x);
+        plane_load(v_row, planes.v + (size_t)cy * planes.c_stride, width, planes.c_step, desc.shift_x);
+
+        if (planes.a) {
+            memcpy(a_row, planes.a + (size_t)y * planes.a_stride, width);
+        }
+
+        yuv_to_bgra_row((uint32_t*)((uint8_t*)dst->memory + (size_t)y * dst->stride), y_row, u_row, v_row, a_row, width);
+    }
+
+    free(temp);
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline uint32_t clamp_u8(int32_t value)
+{
+    return value < 0 ? 0 : (value > 0xFF ? 0xFF : (uint32_t)value);
+}
+
+/* BT.601 limited range in 8 fraction bits */
+static void rgb_to_y_row(uint8_t* restrict y, const uint32_t* restrict src, int len)
+{
+    ROW_LOOP(len, y[k] = (uint8_t)(((66 * CH_R(src[k]) + 129 * CH_G(src[k]) + 25 * CH_B(src[k]) + 128) >> 8) + 16));
+}
+
+static void rgb_to_uv_row(uint8_t* restrict u, uint8_t* restrict v, const uint32_t* restrict src, int len)
+{
+    ROW_LOOP(len,
+        u[k] = (uint8_t)(((-38 * CH_R(src[k]) - 74 * CH_G(src[k]) + 112 * CH_B(src[k]) + 128) >> 8) + 128);
+        v[k] = (uint8_t)(((112 * CH_R(src[k]) - 94 * CH_G(src[k]) - 18 * CH_B(src[k]) + 128) >> 8) + 128));
+}
+
+static void alpha_row(uint8_t* restrict a, const uint32_t* restrict src, int len)
+{
+    ROW_LOOP(len, a[k] = (uint8_t)(src[k] >> 24));
+}
+
+/*
+ * The average of the pixels covered by one chroma sample. The channels are
+ * summed in 16 bits lanes of a word, two at a time, which fit 4 pixels.
+ */
+static void chroma_average(uint32_t* restrict dst, const uint32_t* restrict row0, const uint32_t* restrict row1, int len, int shift_x)
+{
+    if (shift_x) {
+        ROW_LOOP(len,
+            const uint32_t c0 = row0[k * 2];
+            const uint32_t c1 = row0[k * 2 + 1];
+            const uint32_t c2 = row1[k * 2];
+            const uint32_t c3 = row1[k * 2 + 1];
+            const uint32_t rb = (c0 & 0xFF00FF) + (c1 & 0xFF00FF) + (c2 & 0xFF00FF) + (c3 & 0xFF00FF) + 0x20002;
+            const uint32_t ag = ((c0 >> 8) & 0xFF00FF) + ((c1 >> 8) & 0xFF00FF) + ((c2 >> 8) & 0xFF00FF) + ((c3 >> 8) & 0xFF00FF) + 0x20002;
+            dst[k] = ((rb >> 2) & 0xFF00FF) | ((ag << 6) & 0xFF00FF00));
+    } else {
+        ROW_LOOP(len,
+            const uint32_t rb = (row0[k] & 0xFF00FF) + (row1[k] & 0xFF00FF) + 0x10001;
+            const uint32_t ag = ((row0[k] >> 8) & 0xFF00FF) + ((row1[k] >> 8) & 0xFF00FF) + 0x10001;
+            dst[k] = ((rb >> 1) & 0xFF00FF) | ((ag << 7) & 0xFF00FF00));
+    }
+}
+
+static void yuv_to_bgra_row(uint32_t* restrict dst, const uint8_t* restrict y, const uint8_t* restrict u, const uint8_t* restrict v, const uint8_t* restrict a, int len)
+{
+    ROW_LOOP(len,
+        const int32_t c = 298 * (y[k] - 16) + 128;
+        const int32_t d = u[k] - 128;
+        const int32_t e = v[k] - 128;
+        dst[k] = (uint32_t)a[k] << 24
+            | clamp_u8((c + 409 * e) >> 8) << 16
+            | clamp_u8((c - 100 * d - 208 * e) >> 8) << 8
+            | clamp_u8((c + 516 * d) >> 8));
+}
+
+static yuv_desc_t yuv_get_desc(vg_lite_buffer_format_t format)
+{
+    switch (format) {
+    case VG_LITE_NV12:
+        return (yuv_desc_t) { YUV_LAYOUT_SEMI_PLANAR, 1, 1, false };
+    case VG_LITE_NV16:
+        return (yuv_desc_t) { YUV_LAYOUT_SEMI_PLANAR, 1, 0, false };
+    case VG_LITE_YV12:
+        return (yuv_desc_t) { YUV_LAYOUT_PLANAR, 1, 1, false };
+    case VG_LITE_YV16:
+        return (yuv_desc_t) { YUV_LAYOUT_PLANAR, 1, 0, false };
+    case VG_LITE_YV24:
+        return (yuv_desc_t) { YUV_LAYOUT_PLANAR, 0, 0, false };
+    case VG_LITE_YUY2:
+        return (yuv_desc_t) { YUV_LAYOUT_PACKED, 1, 0, false };
+    case VG_LITE_ANV12:
+        return (yuv_desc_t) { YUV_LAYOUT_SEMI_PLANAR, 1, 1, true };
+    case VG_LITE_AYUY2:
+        return (yuv_desc_t) { YUV_LAYOUT_PACKED, 1, 0, true };
+    default:
+        break;
+    }
+
+    return (yuv_desc_t) { YUV_LAYOUT_UNKNOWN, 0, 0, false };
+}
+
+static void yuv_get_planes(const vg_lite_buffer_t* buffer, const yuv_desc_t* desc, yuv_planes_t* planes)
+{
+    memset(planes, 0, sizeof(yuv_planes_t));
+    planes->y = buffer->memory;
+    planes->y_stride = buffer->stride;
+    planes->y_step = 1;
+
+    switch (desc->layout) {
+    case YUV_LAYOUT_PACKED:
+        /* Y0 U Y1 V */
+        planes->y_step = 2;
+        planes->u = (uint8_t*)buffer->memory + 1;
+        planes->v = (uint8_t*)buffer->memory + 3;
+        planes->c_stride = buffer->stride;
+        planes->c_step = 4;
+        break;
+
+    case YUV_LAYOUT_SEMI_PLANAR:
+        planes->u = buffer->yuv.uv_memory;
+        planes->v = (uint8_t*)buffer->yuv.uv_memory + 1;
+        planes->c_stride = buffer->yuv.uv_stride;
+        planes->c_step = 2;
+        break;
+
+    case YUV_LAYOUT_PLANAR:
+        planes->u = buffer->yuv.uv_memory;
+        planes->v = buffer->yuv.v_memory;
+        planes->c_stride = buffer->yuv.uv_stride;
+        planes->c_step = 1;
+        break;
+
+    default:
+        GPU_ASSERT(false);
+        break;
+    }
+
+    if (desc->alpha) {
+        /* The yuv info has no CPU pointer of the alpha plane */
+        planes->a = (uint8_t*)buffer->memory + (buffer->yuv.alpha_planar - buffer->address);
+        planes->a_stride = buffer->yuv.alpha_stride;
+    }
+}
+
+static void plane_store(uint8_t* restrict dst, const uint8_t* restrict src, int len, int step)
+{
+    /* A constant step in each loop, so the interleaving compiles to shuffles */
+    switch (step) {
+    case 1:
+        memcpy(dst, src, len);
+        break;
+    case 2:
+        ROW_LOOP(len, dst[k * 2] = src[k]);
+        break;
+    case 4:
+        ROW_LOOP(len, dst[k * 4] = src[k]);
+        break;
+    default:
+        GPU_ASSERT(false);
+        break;
+    }
+}
+
+static void plane_load(uint8_t* restrict dst, const uint8_t* restrict src, int len, int step, int shift)
+{
+    if (shift) {
+        /* Nearest chroma sample, each one covers two pixels */
+        const int count = len / 2;
+        switch (step) {
+        case 1:
+            ROW_LOOP(count, dst[k * 2] = src[k]; dst[k * 2 + 1] = src[k]);
+            break;
+        case 2:
+            ROW_LOOP(count, dst[k * 2] = src[k * 2]; dst[k * 2 + 1] = src[k * 2]);
+            break;
+        case 4:
+            ROW_LOOP(count, dst[k * 2] = src[k * 4]; dst[k * 2 + 1] = src[k * 4]);
+            break;
+        default:
+            GPU_ASSERT(false);
+            break;
+        }
+
+        /* An odd width ends on half a chroma sample */
+        if (len & 1) {
+            dst[len - 1] = src[count * step];
+        }
+        return;
+    }
+
+    switch (step) {
+    case 1:
+        memcpy(dst, src, len);
+        break;
+    case 2:
+        ROW_LOOP(len, dst[k] = src[k * 2]);
+        break;
+    case 4:
+        ROW_LOOP(len, dst[k] = src[k * 4]);
+        break;
+    default:
+        GPU_ASSERT(false);
+        break;
+    }
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2025 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VG_LITE_TEST_YUV_H
+#define VG_LITE_TEST_YUV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "vg_lite_test_utils.h"
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * @brief Check whether a YUV format can be allocated and converted.
+ * @param format The pixel format.
+ * @return True for NV12, NV16, YV12, YV16, YV24, YUY2, ANV12 and AYUY2.
+ */
+bool vg_lite_test_yuv_is_supported(vg_lite_buffer_format_t format);
+
+/**
+ * @brief Get the GPU feature needed to read a YUV format.
+ * @param format The pixel format.
+ * @return YUY2_INPUT for YUY2, AYUV_INPUT for the formats with an alpha plane, YUV_INPUT otherwise.
+ */
+vg_lite_feature_t vg_lite_test_yuv_get_feature(vg_lite_buffer_format_t format);
+
+/**
+ * @brief Allocate a YUV buffer with all of its planes in one allocation.
+ * @param buffer The buffer to set up, the yuv info points at the chroma and alpha planes.
+ * @param width The width in pixels, aligned up to 16.
+ * @param height The height in pixels, aligned up to 2.
+ * @param format The YUV format, see vg_lite_test_yuv_is_supported.
+ * @return The GPU buffer holding the planes, NULL if the format is not supported.
+ * @note Every plane starts on 64 bytes. The chroma is sampled as BT.601 with U before V.
+ */
+struct gpu_buffer_s* vg_lite_test_yuv_buffer_alloc(vg_lite_buffer_t* buffer, uint32_t width, uint32_t height, vg_lite_buffer_format_t format);
+
+/**
+ * @brief Fill a YUV buffer from a BGRA8888 buffer of the same size.
+ * @param dst The YUV buffer.
+ * @param src The BGRA8888 buffer, linear layout.
+ * @return True on success, false if the buffers are not supported.
+ * @note BT.601 limited range. The chroma takes the average of the pixels it covers.
+ *       The caller handles the cache maintenance.
+ */
+bool vg_lite_test_yuv_from_bgra8888(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src);
+
+/**
+ * @brief Convert a YUV buffer into a BGRA8888 buffer of the same size, as a reference of the GPU.
+ * @param dst The BGRA8888 buffer, linear layout.
+ * @param src The YUV buffer.
+ * @return True on success, false if the buffers are not supported.
+ * @note BT.601 limited range, the nearest chroma sample is used. Without an alpha plane the alpha is 0xFF.
+ */
+bool vg_lite_test_yuv_to_bgra8888(vg_lite_buffer_t* dst, const vg_lite_buffer_t* src);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*VG_LITE_TEST_YUV_H*/
@@ -0,0 +1,444 @@
+"""
+Copyright (C) 2025 Xiaomi Corporation
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+     http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+"""
+
+"""
+Convert path resources to the .vgpath container loaded by vg_lite_test_vgpath_load().
+
+Sources:
+  * C resource headers such as vg_lite/resource/tiger_paths.h and glphy_paths.h.
+    Every static path data array becomes a path. If the header has a vg_lite_path_t
+    table, its order and bounding boxes are kept; a uint32_t *_color_data array
+    provides the fill colors.
+  * SVG files, every <path> element with its d, fill, fill-rule and transform.
+
+See vg_lite/vg_lite_test_vgpath.h for the file layout.
+"""
+
+import argparse
+import math
+import re
+import struct
+import xml.etree.ElementTree as ET
+
+VGPATH_MAGIC = 0x48544150
+VGPATH_VERSION = 1
+VGPATH_ALIGN = 4
+
+HEADER_FORMAT = "<IHHII"
+ENTRY_FORMAT = "<4fIIIBBBB"
+
+FORMAT_S8, FORMAT_S16, FORMAT_S32, FORMAT_FP32 = 0, 1, 2, 3
+FILL_NON_ZERO, FILL_EVEN_ODD = 0, 1
+QUALITY_HIGH = 0
+
+ELEMENT_CODES = {FORMAT_S8: "b", FORMAT_S16: "h", FORMAT_S32: "i", FORMAT_FP32: "f"}
+
+C_TYPE_FORMATS = {
+    "signed char": FORMAT_S8,
+    "int8_t": FORMAT_S8,
+    "int16_t": FORMAT_S16,
+    "short": FORMAT_S16,
+    "int32_t": FORMAT_S32,
+    "int": FORMAT_S32,
+    "float": FORMAT_FP32,
+}
+
+VLC_OPS = {
+    "END": 0x00, "CLOSE": 0x01, "MOVE": 0x02, "MOVE_REL": 0x03,
+    "LINE": 0x04, "LINE_REL": 0x05, "QUAD": 0x06, "QUAD_REL": 0x07,
+    "CUBIC": 0x08, "CUBIC_REL": 0x09,
+    "SCCWARC": 0x13, "SCCWARC_REL": 0x14, "SCWARC": 0x15, "SCWARC_REL": 0x16,
+    "LCCWARC": 0x17, "LCCWARC_REL": 0x18, "LCWARC": 0x19, "LCWARC_REL": 0x1A,
+}
+
+VLC_OP_ARG_LEN = {
+    0x00: 0, 0x01: 0, 0x02: 2, 0x03: 2, 0x04: 2, 0x05: 2, 0x06: 4, 0x07: 4,
+    0x08: 6, 0x09: 6, 0x13: 5, 0x14: 5, 0x15: 5, 0x16: 5, 0x17: 5, 0x18: 5,
+    0x19: 5, 0x1A: 5,
+}
+
+
+class Path:
+    def __init__(self, fmt, values, color=0xFF000000, fill_rule=FILL_EVEN_ODD, bounds=None):
+        self.fmt = fmt
+        self.values = values
+        self.color = color
+        self.fill_rule = fill_rule
+        self.bounds = bounds if bounds else calc_bounds(values)
+
+    def encode(self):
+        code = ELEMENT_CODES[self.fmt]
+        # Op codes are integers in the low byte of their element, also in FP32 streams
+        op_code = "I" if self.fmt == FORMAT_FP32 else code
+        out = bytearray()
+        i = 0
+        while i < len(self.values):
+            op = int(self.values[i])
+            arg_len = VLC_OP_ARG_LEN[op]
+            args = self.values[i + 1:i + 1 + arg_len]
+            if self.fmt != FORMAT_FP32:
+                # Integer streams hold truncated coordinates, like the C initializers
+                args = [int(v) for v in args]
+            out += struct.pack(f"<{op_code}{arg_len}{code}", op, *args)
+            i += 1 + arg_len
+        return bytes(out)
+
+
+def calc_bounds(values):
+    """Bounding box of the end and control points of a command stream."""
+    xs, ys = [], []
+    i = 0
+    while i < len(values):
+        op = int(values[i])
+        arg_len = VLC_OP_ARG_LEN[op]
+        args = values[i + 1:i + 1 + arg_len]
+        # Arc arguments are (rh, rv, rot, x, y), only the end point is a point
+        start = 3 if arg_len % 2 else 0
+        xs += args[start::2]
+        ys += args[start + 1::2]
+        i += 1 + arg_len
+    if not xs:
+        return (0.0, 0.0, 0.0, 0.0)
+    return (min(xs), min(ys), max(xs), max(ys))
+
+
+def parse_c_number(token):
+    token = token.strip()
+    if token.startswith("VLC_OP_"):
+        return VLC_OPS[token[len("VLC_OP_"):]]
+    if token.lower().startswith(("0x", "-0x")):
+        return int(token, 16)
+    return float(token.rstrip("fF"))
+
+
+def load_header(path, fill_rule):
+    with open(path, "r") as f:
+        text = f.read()
+
+    # Strip comments
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+
+    arrays = {}
+    array_re = re.compile(
+        r"static\s+(?:const\s+)?(signed char|int8_t|int16_t|short|int32_t|int|float|uint32_t)\s+(\w+)\s*\[[^\]]*\]\s*=\s*\{(.*?)\};",
+        re.S)
+    for c_type, name, body in array_re.findall(text):
+        tokens = [t for t in body.replace("\n", " ").split(",") if t.strip()]
+        arrays[name] = (c_type, [parse_c_number(t) for t in tokens])
+
+    colors = []
+    for name, (c_type, values) in arrays.items():
+        if c_type == "uint32_t" and name.endswith("color_data"):
+            colors = [int(v) for v in values]
+
+    # Keep the order and bounds of a vg_lite_path_t table when there is one
+    table_re = re.compile(
+        r"\{\s*\{\s*([^,{}]+),\s*([^,{}]+),\s*([^,{}]+),\s*([^,{}]+)\s*\}\s*,\s*\w+\s*,\s*(VG_LITE_\w+)\s*,"
+        r"\s*\{\s*0\s*\}\s*,\s*sizeof\((\w+)\)\s*,\s*(\w+)")
+    entries = table_re.findall(text)
+
+    paths = []
+    if entries:
+        for b0, b1, b2, b3, _, name, _ in entries:
+            c_type, values = arrays[name]
+            bounds = tuple(parse_c_number(b) for b in (b0, b1, b2, b3))
+            paths.append(Path(C_TYPE_FORMATS[c_type], values, fill_rule=fill_rule, bounds=bounds))
+    else:
+        for name, (c_type, values) in arrays.items():
+            if c_type in C_TYPE_FORMATS:
+                paths.append(Path(C_TYPE_FORMATS[c_type], values, fill_rule=fill_rule))
+
+    for i, p in enumerate(paths):
+        if i < len(colors):
+            p.color = colors[i]
+
+    return paths
+
+
+class SvgPathBuilder:
+    """Converts SVG path data into absolute MOVE/LINE/QUAD/CUBIC/CLOSE commands."""
+
+    TOKEN_RE = re.compile(r"[MmLlHhVvCcSsQqTtAaZz]|[-+]?(?:\d*\.\d+|\d+\.?)(?:[eE][-+]?\d+)?")
+
+    def __init__(self, matrix):
+        self.matrix = matrix
+        self.values = []
+
+    def point(self, x, y):
+        a, b, c, d, e, f = self.matrix
+        return [a * x + c * y + e, b * x + d * y + f]
+
+    def emit(self, op, *pts):
+        self.values.append(op)
+        for x, y in pts:
+            self.values += self.point(x, y)
+
+    def arc_to(self, x0, y0, rx, ry, angle, large, sweep, x, y):
+        """Endpoint to center parameterization (SVG spec F.6.5), then one cubic per quarter."""
+        if rx == 0 or ry == 0:
+            self.emit(VLC_OPS["LINE"], (x, y))
+            return
+        rx, ry = abs(rx), abs(ry)
+        phi = math.radians(angle)
+        cos_phi, sin_phi = math.cos(phi), math.sin(phi)
+        dx, dy = (x0 - x) / 2, (y0 - y) / 2
+        x1p = cos_phi * dx + sin_phi * dy
+        y1p = -sin_phi * dx + cos_phi * dy
+        lam = (x1p * x1p) / (rx * rx) + (y1p * y1p) / (ry * ry)
+        if lam > 1:
+            rx, ry = rx * math.sqrt(lam), ry * math.sqrt(lam)
+        num = rx * rx * ry * ry - rx * rx * y1p * y1p - ry * ry * x1p * x1p
+        den = rx * rx * y1p * y1p + ry * ry * x1p * x1p
+        coef = math.sqrt(max(0.0, num / den)) if den else 0.0
+        if large == sweep:
+            coef = -coef
+        cxp, cyp = coef * rx * y1p / ry, -coef * ry * x1p / rx
+        cx = cos_phi * cxp - sin_phi * cyp + (x0 + x) / 2
+        cy = sin_phi * cxp + cos_phi * cyp + (y0 + y) / 2
+
+        def vec_angle(ux, uy, vx, vy):
+            return math.atan2(ux * vy - uy * vx, ux * vx + uy * vy)
+
+        theta = vec_angle(1, 0, (x1p - cxp) / rx, (y1p - cyp) / ry)
+        delta = vec_angle((x1p - cxp) / rx, (y1p - cyp) / ry, (-x1p - cxp) / rx, (-y1p - cyp) / ry)
+        if not sweep and delta > 0:
+            delta -= 2 * math.pi
+        elif sweep and delta < 0:
+            delta += 2 * math.pi
+
+        n = max(1, int(math.ceil(abs(delta) / (math.pi / 2) - 1e-6)))
+        step = delta / n
+        k = 4 / 3 * math.tan(step / 4)
+
+        def ellipse(t):
+            return (cx + rx * math.cos(t) * cos_phi - ry * math.sin(t) * sin_phi,
+                    cy + rx * math.cos(t) * sin_phi + ry * math.sin(t) * cos_phi)
+
+        def deriv(t):
+            return (-rx * math.sin(t) * cos_phi - ry * math.cos(t) * sin_phi,
+                    -rx * math.sin(t) * sin_phi + ry * math.cos(t) * cos_phi)
+
+        t = theta
+        for _ in range(n):
+            p0, p3 = ellipse(t), ellipse(t + step)
+            d0, d3 = deriv(t), deriv(t + step)
+            p1 = (p0[0] + k * d0[0], p0[1] + k * d0[1])
+            p2 = (p3[0] - k * d3[0], p3[1] - k * d3[1])
+            self.emit(VLC_OPS["CUBIC"], p1, p2, p3)
+            t += step
+
+    def parse(self, d):
+        tokens = self.TOKEN_RE.findall(d)
+        i = 0
+        cmd = None
+        cx = cy = sx = sy = 0.0
+        last_ctrl = None
+        last_cmd = None
+
+        def num():
+            nonlocal i
+            v = float(tokens[i])
+            i += 1
+            return v
+
+        while i < len(tokens):
+            if tokens[i].isalpha():
+                cmd = tokens[i]
+                i += 1
+            elif cmd is None:
+                raise ValueError(f"path data must start with a command: {d[:32]}")
+
+            rel = cmd.islower()
+            c = cmd.upper()
+            ox, oy = (cx, cy) if rel else (0.0, 0.0)
+
+            if c == "Z":
+                self.emit(VLC_OPS["CLOSE"])
+                cx, cy = sx, sy
+                last_ctrl = None
+                last_cmd = c
+                continue
+            if c == "M":
+                cx, cy = ox + num(), oy + num()
+                sx, sy = cx, cy
+                self.emit(VLC_OPS["MOVE"], (cx, cy))
+                # Further pairs are implicit line-tos
+                cmd = "l" if rel else "L"
+                last_ctrl = None
+            elif c == "L":
+                cx, cy = ox + num(), oy + num()
+                self.emit(VLC_OPS["LINE"], (cx, cy))
+                last_ctrl = None
+            elif c == "H":
+                cx = ox + num()
+                self.emit(VLC_OPS["LINE"], (cx, cy))
+                last_ctrl = None
+            elif c == "V":
+                cy = oy + num()
+                self.emit(VLC_OPS["LINE"], (cx, cy))
+                last_ctrl = None
+            elif c in "CS":
+                if c == "C":
+                    x1, y1 = ox + num(), oy + num()
+                elif last_cmd in "CS" and last_ctrl:
+                    x1, y1 = 2 * cx - last_ctrl[0], 2 * cy - last_ctrl[1]
+                else:
+                    x1, y1 = cx, cy
+                x2, y2 = ox + num(), oy + num()
+                cx, cy = ox + num(), oy + num()
+                self.emit(VLC_OPS["CUBIC"], (x1, y1), (x2, y2), (cx, cy))
+                last_ctrl = (x2, y2)
+            elif c in "QT":
+                if c == "Q":
+                    x1, y1 = ox + num(), oy + num()
+                elif last_cmd in "QT" and last_ctrl:
+                    x1, y1 = 2 * cx - last_ctrl[0], 2 * cy - last_ctrl[1]
+                else:
+                    x1, y1 = cx, cy
+                cx, cy = ox + num(), oy + num()
+                self.emit(VLC_OPS["QUAD"], (x1, y1), (cx, cy))
+                last_ctrl = (x1, y1)
+            elif c == "A":
+                rx, ry, angle = num(), num(), num()
+                large, sweep = int(num()), int(num())
+                x, y = ox + num(), oy + num()
+                self.arc_to(cx, cy, rx, ry, angle, large, sweep, x, y)
+                cx, cy = x, y
+                last_ctrl = None
+            else:
+                raise ValueError(f"unsupported path command: {cmd}")
+            last_cmd = c
+
+        self.values.append(VLC_OPS["END"])
+        return self.values
+
+
+def parse_transform(text):
+    """Parse an SVG transform list into an (a, b, c, d, e, f) matrix."""
+    def multiply(m, n):
+        a, b, c, d, e, f = m
+        a2, b2, c2, d2, e2, f2 = n
+        return (a * a2 + c * b2, b * a2 + d * b2, a * c2 + c * d2,
+                b * c2 + d * d2, a * e2 + c * f2 + e, b * e2 + d * f2 + f)
+
+    matrix = (1.0, 0.0, 0.0, 1.0, 0.0, 0.0)
+    for name, args in re.findall(r"(\w+)\s*\(([^)]*)\)", text or ""):
+        v = [float(x) for x in re.split(r"[\s,]+", args.strip()) if x]
+        if name == "matrix":
+            m = tuple(v)
+        elif name == "translate":
+            m = (1, 0, 0, 1, v[0], v[1] if len(v) > 1 else 0)
+        elif name == "scale":
+            m = (v[0], 0, 0, v[1] if len(v) > 1 else v[0], 0, 0)
+        elif name == "rotate":
+            r = math.radians(v[0])
+            m = (math.cos(r), math.sin(r), -math.sin(r), math.cos(r), 0, 0)
+            if len(v) == 3:
+                m = multiply(multiply((1, 0, 0, 1, v[1], v[2]), m), (1, 0, 0, 1, -v[1], -v[2]))
+        else:
+            raise ValueError(f"unsupported transform: {name}")
+        matrix = multiply(matrix, m)
+    return matrix
+
+
+def parse_svg_color(text):
+    """SVG #rgb/#rrggbb to the ABGR8888 color taken by vg_lite_draw."""
+    text = (text or "#000000").strip()
+    if text == "none" or not text.startswith("#"):
+        return None if text == "none" else 0xFF000000
+    hex_str = text[1:]
+    if len(hex_str) == 3:
+        hex_str = "".join(ch * 2 for ch in hex_str)
+    r, g, b = int(hex_str[0:2], 16), int(hex_str[2:4], 16), int(hex_str[4:6], 16)
+    return 0xFF000000 | (b << 16) | (g << 8) | r
+
+
+def load_svg(path):
+    tree = ET.parse(path)
+    paths = []
+
+    def walk(node, matrix, fill, fill_rule):
+        tag = node.tag.split("}")[-1]
+        style = dict(kv.split(":", 1) for kv in (node.get("style") or "").split(";") if ":" in kv)
+        fill = style.get("fill", node.get("fill", fill))
+        fill_rule = style.get("fill-rule", node.get("fill-rule", fill_rule))
+        transform = node.get("transform")
+        if transform:
+            a, b, c, d, e, f = matrix
+            a2, b2, c2, d2, e2, f2 = parse_transform(transform)
+            matrix = (a * a2 + c * b2, b * a2 + d * b2, a * c2 + c * d2,
+                      b * c2 + d * d2, a * e2 + c * f2 + e, b * e2 + d * f2 + f)
+
+        if tag == "path" and node.get("d"):
+            color = parse_svg_color(fill)
+            if color is not None:
+                values = SvgPathBuilder(matrix).parse(node.get("d"))
+                rule = FILL_EVEN_ODD if fill_rule.strip() == "evenodd" else FILL_NON_ZERO
+                paths.append(Path(FORMAT_FP32, values, color=color, fill_rule=rule))
+
+        for child in node:
+            walk(child, matrix, fill, fill_rule)
+
+    walk(tree.getroot(), (1.0, 0.0, 0.0, 1.0, 0.0, 0.0), "#000000", "nonzero")
+    return paths
+
+
+def write_vgpath(path, paths):
+    header_size = struct.calcsize(HEADER_FORMAT)
+    entry_size = struct.calcsize(ENTRY_FORMAT)
+
+    streams = [p.encode() for p in paths]
+    offset = header_size + entry_size * len(paths)
+    offsets = []
+    for data in streams:
+        offset = (offset + VGPATH_ALIGN - 1) & ~(VGPATH_ALIGN - 1)
+        offsets.append(offset)
+        offset += len(data)
+    file_size = offset
+
+    out = bytearray(struct.pack(HEADER_FORMAT, VGPATH_MAGIC, VGPATH_VERSION, len(paths), header_size, file_size))
+    for p, data, data_offset in zip(paths, streams, offsets):
+        out += struct.pack(ENTRY_FORMAT, *p.bounds, p.color, data_offset, len(data), p.fmt, p.fill_rule, QUALITY_HIGH, 0)
+    for data, data_offset in zip(streams, offsets):
+        out += bytes(data_offset - len(out))
+        out += data
+
+    with open(path, "wb") as f:
+        f.write(out)
+    print(f"Saved {len(paths)} paths, {file_size} bytes: {path}")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Convert resource headers or SVG files to .vgpath.")
+    parser.add_argument("-i", "--input", type=str, required=True, help="Path to a resource header (.h) or an SVG file (.svg)")
+    parser.add_argument("-o", "--output", type=str, required=True, help="Path to save the .vgpath file")
+    parser.add_argument("-f", "--fill-rule", type=str, default="evenodd", choices=["evenodd", "nonzero"],
+                        help="Fill rule of header paths (default: evenodd)")
+
+    args = parser.parse_args()
+
+    if args.input.endswith(".svg"):
+        paths = load_svg(args.input)
+    else:
+        rule = FILL_EVEN_ODD if args.fill_rule == "evenodd" else FILL_NON_ZERO
+        paths = load_header(args.input, rule)
+
+    if not paths:
+        print(f"No paths found in {args.input}")
+        exit(1)
+
+    write_vgpath(args.output, paths)